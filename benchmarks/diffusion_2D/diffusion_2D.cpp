@@ -187,6 +187,13 @@ int UserData::parse_args(vector<string>& args, bool outproc)
     args.erase(it);
   }
 
+  it = find(args.begin(), args.end(), "--nopersistent");
+  if (it != args.end())
+  {
+    persistent = false;
+    args.erase(it);
+  }
+
   // Recompute total number of nodes
   nodes = nx * ny;
 
@@ -210,6 +217,7 @@ void UserData::help()
   cout << "  --ky <kx>    : y-direction diffusion coefficient" << endl;
   cout << "  --noforcing  : disable forcing term" << endl;
   cout << "  --tf <time>  : final time" << endl;
+  cout << "  --nopersistent : disable persistent exchange requests" << endl;
 }
 
 void UserData::print()
@@ -220,6 +228,7 @@ void UserData::print()
   cout << "  nprocs         = " << np << endl;
   cout << "  npx            = " << npx << endl;
   cout << "  npy            = " << npy << endl;
+  cout << "  persistent     = " << persistent << endl;
   cout << " --------------------------------- " << endl;
   cout << "  kx             = " << kx << endl;
   cout << "  ky             = " << ky << endl;
@@ -405,6 +414,17 @@ int UserData::setup()
     }
   }
 
+  // Create persistent exchange requests if necessary
+  if (persistent)
+  {
+    flag = init_requests();
+    if (flag)
+    {
+      cerr << "Error in InitRequests = " << flag << endl;
+      return -1;
+    }
+  }
+
   // Return success
   return 0;
 }
@@ -430,6 +450,40 @@ int UserData::start_exchange(const N_Vector u)
     return -1;
   }
 
+  // ---------------------------------------
+  // Start persistent receives and sends
+  // ---------------------------------------
+
+  if (persistent)
+  {
+    MPI_Request* reqs[8] = {&reqRW, &reqRE, &reqRS, &reqRN,
+                            &reqSW, &reqSE, &reqSS, &reqSN};
+
+    for (int k = 0; k < 8; k++)
+    {
+      // ensure packing has finished before starting the sends
+      if (k == 4)
+      {
+        flag = DeviceSynchronize();
+        if (flag != 0)
+        {
+          cerr << "Error in DeviceSynchronize" << endl;
+          return -1;
+        }
+      }
+
+      if (*reqs[k] == MPI_REQUEST_NULL) { continue; }
+      flag = MPI_Start(reqs[k]);
+      if (flag != MPI_SUCCESS)
+      {
+        cerr << "Error in MPI_Start = " << flag << endl;
+        return -1;
+      }
+    }
+
+    return 0;
+  }
+
   // -----------
   // Post Irecv
   // -----------
@@ -611,12 +665,88 @@ int UserData::end_exchange()
   return 0;
 }
 
+// Create persistent requests for the neighbor exchange, the requests are
+// reused by every call to start_exchange
+int UserData::init_requests()
+{
+  int flag = MPI_SUCCESS;
+
+  if (HaveNbrW)
+  {
+    flag = MPI_Recv_init(Wrecv, (int)ny_loc, MPI_SUNREALTYPE, ipW, MPI_ANY_TAG,
+                         comm_c, &reqRW);
+    if (flag == MPI_SUCCESS)
+    {
+      flag = MPI_Send_init(Wsend, (int)ny_loc, MPI_SUNREALTYPE, ipW, 0, comm_c,
+                           &reqSW);
+    }
+  }
+
+  if (HaveNbrE && flag == MPI_SUCCESS)
+  {
+    flag = MPI_Recv_init(Erecv, (int)ny_loc, MPI_SUNREALTYPE, ipE, MPI_ANY_TAG,
+                         comm_c, &reqRE);
+    if (flag == MPI_SUCCESS)
+    {
+      flag = MPI_Send_init(Esend, (int)ny_loc, MPI_SUNREALTYPE, ipE, 1, comm_c,
+                           &reqSE);
+    }
+  }
+
+  if (HaveNbrS && flag == MPI_SUCCESS)
+  {
+    flag = MPI_Recv_init(Srecv, (int)nx_loc, MPI_SUNREALTYPE, ipS, MPI_ANY_TAG,
+                         comm_c, &reqRS);
+    if (flag == MPI_SUCCESS)
+    {
+      flag = MPI_Send_init(Ssend, (int)nx_loc, MPI_SUNREALTYPE, ipS, 2, comm_c,
+                           &reqSS);
+    }
+  }
+
+  if (HaveNbrN && flag == MPI_SUCCESS)
+  {
+    flag = MPI_Recv_init(Nrecv, (int)nx_loc, MPI_SUNREALTYPE, ipN, MPI_ANY_TAG,
+                         comm_c, &reqRN);
+    if (flag == MPI_SUCCESS)
+    {
+      flag = MPI_Send_init(Nsend, (int)nx_loc, MPI_SUNREALTYPE, ipN, 3, comm_c,
+                           &reqSN);
+    }
+  }
+
+  if (flag != MPI_SUCCESS)
+  {
+    cerr << "Error in MPI_Send_init/MPI_Recv_init = " << flag << endl;
+    return -1;
+  }
+
+  return 0;
+}
+
+// Free persistent exchange requests
+int UserData::free_requests()
+{
+  MPI_Request* reqs[8] = {&reqRW, &reqRE, &reqRS, &reqRN,
+                          &reqSW, &reqSE, &reqSS, &reqSN};
+
+  for (int k = 0; k < 8; k++)
+  {
+    if (*reqs[k] != MPI_REQUEST_NULL) { MPI_Request_free(reqs[k]); }
+  }
+
+  return 0;
+}
+
 // -----------------------------------------------------------------------------
 // UserData helper functions
 // -----------------------------------------------------------------------------
 
 UserData::~UserData()
 {
+  // Free persistent exchange requests
+  if (persistent) { free_requests(); }
+
   // Free exchange buffers
   free_buffers();
 
@@ -140,6 +140,9 @@ struct UserData
   int ipS = -1;
   int ipN = -1;
 
+  // Use persistent requests for neighbor exchange
+  bool persistent = true;
+
   // Receive buffers for neighbor exchange
   sunrealtype* Wrecv = NULL;
   sunrealtype* Erecv = NULL;
@@ -147,10 +150,10 @@ struct UserData
   sunrealtype* Nrecv = NULL;
 
   // Receive requests for neighbor exchange
-  MPI_Request reqRW;
-  MPI_Request reqRE;
-  MPI_Request reqRS;
-  MPI_Request reqRN;
+  MPI_Request reqRW = MPI_REQUEST_NULL;
+  MPI_Request reqRE = MPI_REQUEST_NULL;
+  MPI_Request reqRS = MPI_REQUEST_NULL;
+  MPI_Request reqRN = MPI_REQUEST_NULL;
 
   // Send buffers for neighbor exchange
   sunrealtype* Wsend = NULL;
@@ -159,10 +162,10 @@ struct UserData
   sunrealtype* Nsend = NULL;
 
   // Send requests for neighbor exchange
-  MPI_Request reqSW;
-  MPI_Request reqSE;
-  MPI_Request reqSS;
-  MPI_Request reqSN;
+  MPI_Request reqSW = MPI_REQUEST_NULL;
+  MPI_Request reqSE = MPI_REQUEST_NULL;
+  MPI_Request reqSS = MPI_REQUEST_NULL;
+  MPI_Request reqSN = MPI_REQUEST_NULL;
 
   // Inverse of Jacobian diagonal for preconditioner
   N_Vector diag = NULL;
@@ -183,6 +186,8 @@ private:
   int allocate_buffers();
   int pack_buffers(const N_Vector u);
   int free_buffers();
+  int init_requests();
+  int free_requests();
 };
 
 // -----------------------------------------------------------------------------
@@ -176,6 +176,19 @@ int main(int argc, char* argv[])
     }
   }
 
+  /* rerun the reductions with reproducible reductions enabled */
+  flag = N_VEnableReproducibleReductions_Parallel(X, SUNTRUE);
+  if (myid == 0 && print_timing)
+  {
+    printf("\n\n reproducible reductions:\n");
+    PrintTableHeader(1);
+  }
+  flag = Test_N_VDotProd(X, veclen, ntests);
+  flag = Test_N_VWrmsNorm(X, veclen, ntests);
+  flag = Test_N_VWrmsNormMask(X, veclen, ntests);
+  flag = Test_N_VWL2Norm(X, veclen, ntests);
+  flag = Test_N_VL1Norm(X, veclen, ntests);
+
   /* Free vectors */
   N_VDestroy(X);
 
@@ -162,6 +162,16 @@ int main(int argc, char* argv[])
     }
   }
 
+  /* rerun the reductions with reproducible reductions enabled */
+  flag = N_VEnableReproducibleReductions_Pthreads(X, SUNTRUE);
+  if (print_timing) { printf("\n\n reproducible reductions:\n"); }
+  if (print_timing) { PrintTableHeader(1); }
+  flag = Test_N_VDotProd(X, veclen, ntests);
+  flag = Test_N_VWrmsNorm(X, veclen, ntests);
+  flag = Test_N_VWrmsNormMask(X, veclen, ntests);
+  flag = Test_N_VWL2Norm(X, veclen, ntests);
+  flag = Test_N_VL1Norm(X, veclen, ntests);
+
   /* Free vectors */
   N_VDestroy(X);
 
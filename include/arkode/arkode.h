@@ -152,6 +152,8 @@ extern "C" {
 #define ARK_ADJ_RECOMPUTE_FAIL  -54
 #define ARK_SUNADJSTEPPER_ERR   -55
 
+#define ARK_OUTPUT_FN_FAIL -56
+
 #define ARK_UNRECOGNIZED_ERROR -99
 
 /* ------------------------------
@@ -164,6 +166,9 @@ typedef int (*ARKRhsFn)(sunrealtype t, N_Vector y, N_Vector ydot,
 typedef int (*ARKRootFn)(sunrealtype t, N_Vector y, sunrealtype* gout,
                          void* user_data);
 
+typedef int (*ARKRootSubsetFn)(sunrealtype t, N_Vector y, sunrealtype* gout,
+                               const sunbooleantype* gmask, void* user_data);
+
 typedef int (*ARKEwtFn)(N_Vector y, N_Vector ewt, void* user_data);
 
 typedef int (*ARKRwtFn)(N_Vector y, N_Vector rwt, void* user_data);
@@ -180,6 +185,8 @@ typedef int (*ARKVecResizeFn)(N_Vector y, N_Vector ytemplate, void* user_data);
 
 typedef int (*ARKPostProcessFn)(sunrealtype t, N_Vector y, void* user_data);
 
+typedef int (*ARKOutputFn)(sunrealtype t, N_Vector y, void* user_data);
+
 typedef int (*ARKStagePredictFn)(sunrealtype t, N_Vector zpred, void* user_data);
 
 typedef int (*ARKRelaxFn)(N_Vector y, sunrealtype* r, void* user_data);
@@ -244,6 +251,10 @@ SUNDIALS_EXPORT int ARKodeResFtolerance(void* arkode_mem, ARKRwtFn rfun);
 SUNDIALS_EXPORT int ARKodeRootInit(void* arkode_mem, int nrtfn, ARKRootFn g);
 SUNDIALS_EXPORT int ARKodeSetRootDirection(void* arkode_mem, int* rootdir);
 SUNDIALS_EXPORT int ARKodeSetNoInactiveRootWarn(void* arkode_mem);
+SUNDIALS_EXPORT int ARKodeSetRootSubsetFn(void* arkode_mem,
+                                          ARKRootSubsetFn gsub);
+SUNDIALS_EXPORT int ARKodeSetRootRateBounds(void* arkode_mem,
+                                            const sunrealtype* gdotmax);
 
 /* Optional input functions (general) */
 SUNDIALS_EXPORT int ARKodeSetDefaults(void* arkode_mem);
@@ -257,11 +268,20 @@ SUNDIALS_EXPORT int ARKodeSetStopTime(void* arkode_mem, sunrealtype tstop);
 SUNDIALS_EXPORT int ARKodeClearStopTime(void* arkode_mem);
 SUNDIALS_EXPORT int ARKodeSetFixedStep(void* arkode_mem, sunrealtype hfixed);
 SUNDIALS_EXPORT int ARKodeSetStepDirection(void* arkode_mem, sunrealtype stepdir);
+SUNDIALS_EXPORT int ARKodeSetUseCompensatedSums(void* arkode_mem,
+                                                sunbooleantype onoff);
 SUNDIALS_EXPORT int ARKodeSetUserData(void* arkode_mem, void* user_data);
 SUNDIALS_EXPORT int ARKodeSetPostprocessStepFn(void* arkode_mem,
                                                ARKPostProcessFn ProcessStep);
 SUNDIALS_EXPORT int ARKodeSetPostprocessStageFn(void* arkode_mem,
                                                 ARKPostProcessFn ProcessStage);
+SUNDIALS_EXPORT int ARKodeSetOutputFn(void* arkode_mem, ARKOutputFn OutputFn);
+SUNDIALS_EXPORT int ARKodeSetOutputTimes(void* arkode_mem, sunrealtype tout0,
+                                         sunrealtype dtout);
+SUNDIALS_EXPORT int ARKodeSetOutputStepInterval(void* arkode_mem,
+                                                long int nsteps);
+SUNDIALS_EXPORT int ARKodeSetStepTelemetryFn(void* arkode_mem,
+                                             SUNStepTelemetryFn fn);
 
 /* Optional input functions (implicit solver) */
 SUNDIALS_EXPORT int ARKodeSetNonlinearSolver(void* arkode_mem,
@@ -328,6 +348,10 @@ SUNDIALS_EXPORT int ARKodeEvolve(void* arkode_mem, sunrealtype tout,
 SUNDIALS_EXPORT int ARKodeGetDky(void* arkode_mem, sunrealtype t, int k,
                                  N_Vector dky);
 
+/* Computes the kth derivative of the y function at each of nt times */
+SUNDIALS_EXPORT int ARKodeGetDkyArray(void* arkode_mem, int nt, sunrealtype* t,
+                                      int k, N_Vector* dky);
+
 /* Utility function to update/compute y based on zcor */
 SUNDIALS_EXPORT int ARKodeComputeState(void* arkode_mem, N_Vector zcor,
                                        N_Vector z);
@@ -367,6 +391,8 @@ SUNDIALS_EXPORT int ARKodeGetTolScaleFactor(void* arkode_mem,
                                             sunrealtype* tolsfac);
 SUNDIALS_EXPORT int ARKodeGetNumConstrFails(void* arkode_mem,
                                             long int* nconstrfails);
+SUNDIALS_EXPORT int ARKodeGetNumRhsEvalsReused(void* arkode_mem,
+                                               long int* nfe_reused);
 SUNDIALS_EXPORT int ARKodeGetStepStats(void* arkode_mem, long int* nsteps,
                                        sunrealtype* hinused, sunrealtype* hlast,
                                        sunrealtype* hcur, sunrealtype* tcur);
@@ -441,6 +467,7 @@ SUNDIALS_EXPORT void ARKodePrintMem(void* arkode_mem, FILE* outfile);
 /* Relaxation functions */
 SUNDIALS_EXPORT int ARKodeSetRelaxFn(void* arkode_mem, ARKRelaxFn rfn,
                                      ARKRelaxJacFn rjac);
+SUNDIALS_EXPORT int ARKodeSetRelaxQuadratic(void* arkode_mem, N_Vector weight);
 SUNDIALS_EXPORT int ARKodeSetRelaxEtaFail(void* arkode_mem, sunrealtype eta_rf);
 SUNDIALS_EXPORT int ARKodeSetRelaxLowerBound(void* arkode_mem, sunrealtype lower);
 SUNDIALS_EXPORT int ARKodeSetRelaxMaxFails(void* arkode_mem, int max_fails);
@@ -90,11 +90,15 @@ SUNDIALS_EXPORT int ARKStepSetTableNum(void* arkode_mem,
                                        ARKODE_ERKTableID etable);
 SUNDIALS_EXPORT int ARKStepSetTableName(void* arkode_mem, const char* itable,
                                         const char* etable);
+SUNDIALS_EXPORT int ARKStepSetStiffnessSwitching(void* arkode_mem,
+                                                 sunbooleantype onoff);
 
 /* Optional output functions */
 SUNDIALS_EXPORT int ARKStepGetCurrentButcherTables(void* arkode_mem,
                                                    ARKodeButcherTable* Bi,
                                                    ARKodeButcherTable* Be);
+SUNDIALS_EXPORT int ARKStepGetNumStiffnessSwitches(void* arkode_mem,
+                                                   long int* nswitches);
 SUNDIALS_EXPORT int ARKStepGetTimestepperStats(
   void* arkode_mem, long int* expsteps, long int* accsteps,
   long int* step_attempts, long int* nfe_evals, long int* nfi_evals,
@@ -83,6 +83,11 @@ SUNDIALS_EXPORT int LSRKStepSetMaxNumStages(void* arkode_mem,
 SUNDIALS_EXPORT int LSRKStepSetDomEigSafetyFactor(void* arkode_mem,
                                                   sunrealtype dom_eig_safety);
 
+SUNDIALS_EXPORT int LSRKStepSetDomEigMaxIters(void* arkode_mem, int max_iters);
+
+SUNDIALS_EXPORT int LSRKStepSetDomEigRelTol(void* arkode_mem,
+                                            sunrealtype reltol);
+
 SUNDIALS_EXPORT int LSRKStepSetNumSSPStages(void* arkode_mem, int num_of_stages);
 
 /* Optional output functions */
@@ -0,0 +1,50 @@
+/*---------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ *---------------------------------------------------------------
+ * This is the header file for the ARKODE PararealStep module.
+ *--------------------------------------------------------------*/
+
+#ifndef ARKODE_PARAREALSTEP_H_
+#define ARKODE_PARAREALSTEP_H_
+
+#include <sundials/sundials_nvector.h>
+#include <sundials/sundials_stepper.h>
+#include <sundials/sundials_types.h>
+
+#ifdef __cplusplus /* wrapper to enable C++ usage */
+extern "C" {
+#endif
+
+SUNDIALS_EXPORT void* PararealStepCreate(SUNStepper coarse, SUNStepper* fine,
+                                         int nfine, sunrealtype t0, N_Vector y0,
+                                         SUNContext sunctx);
+
+SUNDIALS_EXPORT int PararealStepReInit(void* arkode_mem, SUNStepper coarse,
+                                       SUNStepper* fine, int nfine,
+                                       sunrealtype t0, N_Vector y0);
+
+SUNDIALS_EXPORT int PararealStepSetNumSlices(void* arkode_mem, int nslices);
+
+SUNDIALS_EXPORT int PararealStepSetMaxIters(void* arkode_mem, int maxiters);
+
+SUNDIALS_EXPORT int PararealStepSetTolerance(void* arkode_mem, sunrealtype tol);
+
+SUNDIALS_EXPORT int PararealStepGetNumIters(void* arkode_mem, long int* iters);
+
+SUNDIALS_EXPORT int PararealStepGetNumEvolves(void* arkode_mem,
+                                              long int* coarse_evolves,
+                                              long int* fine_evolves);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
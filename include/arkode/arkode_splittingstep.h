@@ -105,6 +105,10 @@ SUNDIALS_EXPORT int SplittingStepReInit(void* arkode_mem, SUNStepper* steppers,
 SUNDIALS_EXPORT int SplittingStepSetCoefficients(
   void* arkode_mem, SplittingStepCoefficients coefficients);
 
+SUNDIALS_EXPORT int SplittingStepSetConcurrentSteppers(void* arkode_mem,
+                                                       int num_copies,
+                                                       SUNStepper* steppers);
+
 SUNDIALS_EXPORT int SplittingStepGetNumEvolves(void* arkode_mem, int partition,
                                                long int* evolves);
 
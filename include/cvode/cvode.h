@@ -81,6 +81,8 @@ extern "C" {
 
 #define CV_CONTEXT_ERR -32
 
+#define CV_OUTPUT_FN_FAIL -33
+
 #define CV_UNRECOGNIZED_ERR -99
 
 /* ------------------------------
@@ -92,10 +94,15 @@ typedef int (*CVRhsFn)(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data
 typedef int (*CVRootFn)(sunrealtype t, N_Vector y, sunrealtype* gout,
                         void* user_data);
 
+typedef int (*CVRootSubsetFn)(sunrealtype t, N_Vector y, sunrealtype* gout,
+                              const sunbooleantype* gmask, void* user_data);
+
 typedef int (*CVEwtFn)(N_Vector y, N_Vector ewt, void* user_data);
 
 typedef int (*CVMonitorFn)(void* cvode_mem, void* user_data);
 
+typedef int (*CVOutputFn)(sunrealtype t, N_Vector y, void* user_data);
+
 /* -------------------
  * Exported Functions
  * ------------------- */
@@ -122,6 +129,8 @@ SUNDIALS_EXPORT int CVodeWFtolerances(void* cvode_mem, CVEwtFn efun);
 SUNDIALS_EXPORT int CVodeSetConstraints(void* cvode_mem, N_Vector constraints);
 SUNDIALS_EXPORT int CVodeSetDeltaGammaMaxLSetup(void* cvode_mem,
                                                 sunrealtype dgmax_lsetup);
+SUNDIALS_EXPORT int CVodeSetErrWeightUpdateThreshold(void* cvode_mem,
+                                                     sunrealtype ewt_thresh);
 SUNDIALS_EXPORT int CVodeSetInitStep(void* cvode_mem, sunrealtype hin);
 SUNDIALS_EXPORT int CVodeSetLSetupFrequency(void* cvode_mem, long int msbp);
 SUNDIALS_EXPORT int CVodeSetMaxConvFails(void* cvode_mem, int maxncf);
@@ -138,13 +147,22 @@ SUNDIALS_EXPORT int CVodeSetNlsRhsFn(void* cvode_mem, CVRhsFn f);
 SUNDIALS_EXPORT int CVodeSetNonlinConvCoef(void* cvode_mem, sunrealtype nlscoef);
 SUNDIALS_EXPORT int CVodeSetNonlinearSolver(void* cvode_mem,
                                             SUNNonlinearSolver NLS);
+SUNDIALS_EXPORT int CVodeSetOutputFn(void* cvode_mem, CVOutputFn OutputFn);
+SUNDIALS_EXPORT int CVodeSetOutputStepInterval(void* cvode_mem,
+                                               long int nsteps);
+SUNDIALS_EXPORT int CVodeSetOutputTimes(void* cvode_mem, sunrealtype tout0,
+                                        sunrealtype dtout);
 SUNDIALS_EXPORT int CVodeSetStabLimDet(void* cvode_mem, sunbooleantype stldet);
+SUNDIALS_EXPORT int CVodeSetStepTelemetryFn(void* cvode_mem,
+                                            SUNStepTelemetryFn fn);
 SUNDIALS_EXPORT int CVodeSetStopTime(void* cvode_mem, sunrealtype tstop);
 SUNDIALS_EXPORT int CVodeSetInterpolateStopTime(void* cvode_mem,
                                                 sunbooleantype interp);
 SUNDIALS_EXPORT int CVodeClearStopTime(void* cvode_mem);
 SUNDIALS_EXPORT int CVodeSetUseIntegratorFusedKernels(void* cvode_mem,
                                                       sunbooleantype onoff);
+SUNDIALS_EXPORT int CVodeSetUseCompensatedSums(void* cvode_mem,
+                                               sunbooleantype onoff);
 SUNDIALS_EXPORT int CVodeSetUserData(void* cvode_mem, void* user_data);
 
 /* Optional step adaptivity input functions */
@@ -176,6 +194,9 @@ SUNDIALS_EXPORT int CVodeRootInit(void* cvode_mem, int nrtfn, CVRootFn g);
 /* Rootfinding optional input functions */
 SUNDIALS_EXPORT int CVodeSetRootDirection(void* cvode_mem, int* rootdir);
 SUNDIALS_EXPORT int CVodeSetNoInactiveRootWarn(void* cvode_mem);
+SUNDIALS_EXPORT int CVodeSetRootSubsetFn(void* cvode_mem, CVRootSubsetFn gsub);
+SUNDIALS_EXPORT int CVodeSetRootRateBounds(void* cvode_mem,
+                                           const sunrealtype* gdotmax);
 
 /* Solver function */
 SUNDIALS_EXPORT int CVode(void* cvode_mem, sunrealtype tout, N_Vector yout,
@@ -187,6 +208,8 @@ SUNDIALS_EXPORT int CVodeComputeState(void* cvode_mem, N_Vector ycor, N_Vector y
 /* Dense output function */
 SUNDIALS_EXPORT int CVodeGetDky(void* cvode_mem, sunrealtype t, int k,
                                 N_Vector dky);
+SUNDIALS_EXPORT int CVodeGetDkyArray(void* cvode_mem, int nt, sunrealtype* t,
+                                     int k, N_Vector* dky);
 
 /* Optional output functions */
 SUNDIALS_DEPRECATED_EXPORT_MSG(
@@ -194,6 +217,8 @@ SUNDIALS_DEPRECATED_EXPORT_MSG(
 int CVodeGetWorkSpace(void* cvode_mem, long int* lenrw, long int* leniw);
 SUNDIALS_EXPORT int CVodeGetNumSteps(void* cvode_mem, long int* nsteps);
 SUNDIALS_EXPORT int CVodeGetNumRhsEvals(void* cvode_mem, long int* nfevals);
+SUNDIALS_EXPORT int CVodeGetNumErrWeightEvals(void* cvode_mem,
+                                              long int* newtevals);
 SUNDIALS_EXPORT int CVodeGetNumLinSolvSetups(void* cvode_mem,
                                              long int* nlinsetups);
 SUNDIALS_EXPORT int CVodeGetNumErrTestFails(void* cvode_mem, long int* netfails);
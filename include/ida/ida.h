@@ -90,6 +90,10 @@ typedef int (*IDAResFn)(sunrealtype tt, N_Vector yy, N_Vector yp, N_Vector rr,
 typedef int (*IDARootFn)(sunrealtype t, N_Vector y, N_Vector yp,
                          sunrealtype* gout, void* user_data);
 
+typedef int (*IDARootSubsetFn)(sunrealtype t, N_Vector y, N_Vector yp,
+                               sunrealtype* gout, const sunbooleantype* gmask,
+                               void* user_data);
+
 typedef int (*IDAEwtFn)(N_Vector y, N_Vector ewt, void* user_data);
 
 /* -------------------
@@ -137,6 +141,7 @@ SUNDIALS_EXPORT int IDASetMaxErrTestFails(void* ida_mem, int maxnef);
 SUNDIALS_EXPORT int IDASetSuppressAlg(void* ida_mem, sunbooleantype suppressalg);
 SUNDIALS_EXPORT int IDASetId(void* ida_mem, N_Vector id);
 SUNDIALS_EXPORT int IDASetConstraints(void* ida_mem, N_Vector constraints);
+SUNDIALS_EXPORT int IDASetStepTelemetryFn(void* ida_mem, SUNStepTelemetryFn fn);
 
 /* Optional step adaptivity input functions */
 SUNDIALS_EXPORT
@@ -166,6 +171,9 @@ SUNDIALS_EXPORT int IDARootInit(void* ida_mem, int nrtfn, IDARootFn g);
 /* Rootfinding optional input functions */
 SUNDIALS_EXPORT int IDASetRootDirection(void* ida_mem, int* rootdir);
 SUNDIALS_EXPORT int IDASetNoInactiveRootWarn(void* ida_mem);
+SUNDIALS_EXPORT int IDASetRootSubsetFn(void* ida_mem, IDARootSubsetFn gsub);
+SUNDIALS_EXPORT int IDASetRootRateBounds(void* ida_mem,
+                                         const sunrealtype* gdotmax);
 
 /* Solver function */
 SUNDIALS_EXPORT int IDASolve(void* ida_mem, sunrealtype tout, sunrealtype* tret,
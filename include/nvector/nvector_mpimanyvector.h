@@ -57,6 +57,7 @@ struct _N_VectorContent_MPIManyVector
   sunindextype global_length;  /* overall global manyvector length */
   N_Vector* subvec_array;      /* pointer to N_Vector array        */
   sunbooleantype own_data;     /* flag indicating data ownership   */
+  int num_threads;             /* threads for subvector operations */
 };
 
 typedef struct _N_VectorContent_MPIManyVector* N_VectorContent_MPIManyVector;
@@ -88,6 +89,9 @@ SUNErrCode N_VSetSubvectorArrayPointer_MPIManyVector(sunrealtype* v_data,
 SUNDIALS_EXPORT
 sunindextype N_VGetNumSubvectors_MPIManyVector(N_Vector v);
 
+SUNDIALS_EXPORT
+SUNErrCode N_VSetNumThreads_MPIManyVector(N_Vector v, int num_threads);
+
 /* standard vector operations */
 SUNDIALS_EXPORT
 N_Vector_ID N_VGetVectorID_MPIManyVector(N_Vector v);
@@ -198,6 +202,21 @@ SUNDIALS_EXPORT
 SUNErrCode N_VDotProdMultiAllReduce_MPIManyVector(int nvec_total, N_Vector x,
                                                   sunrealtype* sum);
 
+/* split-phase (non-blocking) reduction operations */
+SUNDIALS_EXPORT
+SUNErrCode N_VDotProdMultiStart_MPIManyVector(int nvec, N_Vector x, N_Vector* Y,
+                                              sunrealtype* dotprods,
+                                              MPI_Request* request);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VDotProdMultiAllReduceStart_MPIManyVector(int nvec_total,
+                                                       N_Vector x,
+                                                       sunrealtype* sum,
+                                                       MPI_Request* request);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VReduceFinish_MPIManyVector(N_Vector x, MPI_Request* request);
+
 /* vector array operations */
 SUNDIALS_EXPORT
 SUNErrCode N_VLinearSumVectorArray_MPIManyVector(int nvec, sunrealtype a,
@@ -295,6 +295,15 @@ SUNDIALS_EXPORT
 SUNErrCode N_VEnableLinearCombinationVectorArray_OpenMP(N_Vector v,
                                                         sunbooleantype tf);
 
+/*
+ * -----------------------------------------------------------------
+ * Enable / disable reproducible reductions
+ * -----------------------------------------------------------------
+ */
+
+SUNDIALS_EXPORT
+SUNErrCode N_VEnableReproducibleReductions_OpenMP(N_Vector v, sunbooleantype tf);
+
 #ifdef __cplusplus
 }
 #endif
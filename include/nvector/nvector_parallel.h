@@ -279,6 +279,41 @@ SUNDIALS_EXPORT
 SUNErrCode N_VDotProdMultiAllReduce_Parallel(int nvec_total, N_Vector x,
                                              sunrealtype* dotprods);
 
+/* split-phase (non-blocking) reduction operations */
+
+SUNDIALS_EXPORT
+SUNErrCode N_VDotProdStart_Parallel(N_Vector x, N_Vector y,
+                                    sunrealtype* dotprod, MPI_Request* request);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VMaxNormStart_Parallel(N_Vector x, sunrealtype* maxnorm,
+                                    MPI_Request* request);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VMinStart_Parallel(N_Vector x, sunrealtype* min,
+                                MPI_Request* request);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VWrmsNormStart_Parallel(N_Vector x, N_Vector w, sunrealtype* nrm,
+                                     MPI_Request* request);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VWrmsNormFinish_Parallel(N_Vector x, sunrealtype* nrm,
+                                      MPI_Request* request);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VDotProdMultiStart_Parallel(int nvec, N_Vector x, N_Vector* Y,
+                                         sunrealtype* dotprods,
+                                         MPI_Request* request);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VDotProdMultiAllReduceStart_Parallel(int nvec_total, N_Vector x,
+                                                  sunrealtype* dotprods,
+                                                  MPI_Request* request);
+
+SUNDIALS_EXPORT
+SUNErrCode N_VReduceFinish_Parallel(N_Vector x, MPI_Request* request);
+
 /* OPTIONAL XBraid interface operations */
 
 SUNDIALS_EXPORT
@@ -338,6 +373,16 @@ SUNErrCode N_VEnableDotProdMultiLocal_Parallel(N_Vector v, sunbooleantype tf);
 SUNDIALS_EXPORT
 SUNErrCode N_VEnableDotProdMultiLocal_Parallel(N_Vector v, sunbooleantype tf);
 
+/*
+ * -----------------------------------------------------------------
+ * Enable / disable reproducible reductions
+ * -----------------------------------------------------------------
+ */
+
+SUNDIALS_EXPORT
+SUNErrCode N_VEnableReproducibleReductions_Parallel(N_Vector v,
+                                                    sunbooleantype tf);
+
 #ifdef __cplusplus
 }
 #endif
@@ -325,6 +325,16 @@ SUNDIALS_EXPORT
 SUNErrCode N_VEnableLinearCombinationVectorArray_Pthreads(N_Vector v,
                                                           sunbooleantype tf);
 
+/*
+ * -----------------------------------------------------------------
+ * Enable / disable reproducible reductions
+ * -----------------------------------------------------------------
+ */
+
+SUNDIALS_EXPORT
+SUNErrCode N_VEnableReproducibleReductions_Pthreads(N_Vector v,
+                                                    sunbooleantype tf);
+
 #ifdef __cplusplus
 }
 #endif
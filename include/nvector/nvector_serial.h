@@ -282,6 +282,15 @@ SUNDIALS_EXPORT
 SUNErrCode N_VEnableLinearCombinationVectorArray_Serial(N_Vector v,
                                                         sunbooleantype tf);
 
+/*
+ * -----------------------------------------------------------------
+ * Enable / disable reproducible reductions
+ * -----------------------------------------------------------------
+ */
+
+SUNDIALS_EXPORT
+SUNErrCode N_VEnableReproducibleReductions_Serial(N_Vector v, sunbooleantype tf);
+
 #ifdef __cplusplus
 }
 #endif
@@ -54,6 +54,10 @@ SUNErrCode SUNLogger_SetDebugFilename(SUNLogger logger,
 SUNDIALS_EXPORT
 SUNErrCode SUNLogger_SetInfoFilename(SUNLogger logger, const char* info_filename);
 
+SUNDIALS_EXPORT
+SUNErrCode SUNLogger_SetBinaryFilename(SUNLogger logger,
+                                       const char* binary_filename);
+
 SUNDIALS_EXPORT
 SUNErrCode SUNLogger_QueueMsg(SUNLogger logger, SUNLogLevel lvl,
                               const char* scope, const char* label,
@@ -0,0 +1,73 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This header file contains the definition of the per-step telemetry
+ * record passed to the user-supplied telemetry functions of the
+ * time integrators.
+ * -----------------------------------------------------------------*/
+
+#ifndef _SUNDIALS_TELEMETRY_H
+#define _SUNDIALS_TELEMETRY_H
+
+#include <sundials/sundials_types.h>
+
+#ifdef __cplusplus /* wrapper to enable C++ usage */
+extern "C" {
+#endif
+
+/* Version of the SUNStepTelemetry layout, incremented whenever fields are
+   added. New fields are only ever appended to the end of the struct. */
+#define SUN_STEP_TELEMETRY_VERSION 1
+
+/* Outcome of the step attempt described by a telemetry record */
+typedef enum
+{
+  SUN_STEP_ACCEPTED,       /* the step passed the error test         */
+  SUN_STEP_ERR_TEST_FAIL,  /* the step failed the error test         */
+  SUN_STEP_SOLVER_FAIL     /* the nonlinear solve failed (recovered) */
+} SUNStepOutcome;
+
+typedef struct
+{
+  int version;            /* SUN_STEP_TELEMETRY_VERSION                  */
+  SUNStepOutcome outcome; /* outcome of this step attempt                */
+  long int step;          /* number of steps accepted before this one    */
+  int attempt;            /* attempt number for this step (starts at 1)  */
+
+  sunrealtype t;   /* time at the start of the step attempt            */
+  sunrealtype h;   /* step size used in the attempt                    */
+  int order;       /* method order used in the attempt                 */
+  sunrealtype dsm; /* local error test value (negative if not computed) */
+
+  /* Counter increments during this attempt */
+  long int nni;     /* nonlinear iterations                         */
+  long int nli;     /* linear iterations                            */
+  long int nfe;     /* (implicit) right-hand side or residual evals */
+  long int nje;     /* Jacobian evaluations                         */
+  long int nsetups; /* linear solver setups                         */
+
+  /* Wall clock time (seconds) spent in this attempt */
+  double time_step;   /* the whole attempt                  */
+  double time_nls;    /* nonlinear solves (includes linsol) */
+  double time_lsetup; /* linear solver setups               */
+  double time_lsolve; /* linear solves                      */
+} SUNStepTelemetry;
+
+/* User-supplied function called after each step attempt. The record is only
+   valid for the duration of the call and the return value is ignored. */
+typedef int (*SUNStepTelemetryFn)(const SUNStepTelemetry* telemetry,
+                                  void* user_data);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* _SUNDIALS_TELEMETRY_H */
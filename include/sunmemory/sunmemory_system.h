@@ -64,6 +64,56 @@ SUNMemoryHelper SUNMemoryHelper_Clone_Sys(SUNMemoryHelper helper);
 SUNDIALS_EXPORT
 SUNErrCode SUNMemoryHelper_Destroy_Sys(SUNMemoryHelper helper);
 
+/* Pooling implementation */
+
+SUNDIALS_EXPORT
+SUNMemoryHelper SUNMemoryHelper_SysPool(SUNContext sunctx);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNMemoryHelper_SetAlignment_SysPool(SUNMemoryHelper helper,
+                                                size_t alignment);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNMemoryHelper_SetMaxCachedBytes_SysPool(SUNMemoryHelper helper,
+                                                     size_t max_bytes_cached);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNMemoryHelper_Trim_SysPool(SUNMemoryHelper helper);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNMemoryHelper_GetPoolStats_SysPool(SUNMemoryHelper helper,
+                                                unsigned long* num_hits,
+                                                unsigned long* num_misses,
+                                                size_t* bytes_cached);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNMemoryHelper_Alloc_SysPool(SUNMemoryHelper helper,
+                                         SUNMemory* memptr, size_t mem_size,
+                                         SUNMemoryType mem_type, void* queue);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNMemoryHelper_AllocStrided_SysPool(SUNMemoryHelper helper,
+                                                SUNMemory* memptr,
+                                                size_t mem_size, size_t stride,
+                                                SUNMemoryType mem_type,
+                                                void* queue);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNMemoryHelper_Dealloc_SysPool(SUNMemoryHelper helper,
+                                           SUNMemory mem, void* queue);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNMemoryHelper_GetAllocStats_SysPool(
+  SUNMemoryHelper helper, SUNMemoryType mem_type,
+  unsigned long* num_allocations, unsigned long* num_deallocations,
+  size_t* bytes_allocated, size_t* bytes_high_watermark);
+
+SUNDIALS_EXPORT
+SUNMemoryHelper SUNMemoryHelper_Clone_SysPool(SUNMemoryHelper helper);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNMemoryHelper_Destroy_SysPool(SUNMemoryHelper helper);
+
 #ifdef __cplusplus
 }
 #endif
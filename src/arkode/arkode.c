@@ -172,6 +172,10 @@ int ARKodeResize(void* arkode_mem, N_Vector y0, sunrealtype hscale,
   N_VScale(ONE, y0, ark_mem->yn);
   ark_mem->fn_is_current = SUNFALSE;
 
+  /* Clear the compensated summation corrections */
+  ark_mem->terr = ZERO;
+  if (ark_mem->ycomp != NULL) { N_VConst(ZERO, ark_mem->ycomp); }
+
   /* Disable constraints */
   ark_mem->constraintsSet = SUNFALSE;
 
@@ -907,6 +911,8 @@ int ARKodeEvolve(void* arkode_mem, sunrealtype tout, N_Vector yout,
                  "step = %li, tn = " SUN_FORMAT_G ", h = " SUN_FORMAT_G,
                  ark_mem->nst + 1, ark_mem->tn, ark_mem->h);
 
+      arkTelemetryBegin(ark_mem, attempts);
+
       /* Call time stepper module to attempt a step:
             0 => step completed successfully
            >0 => step encountered recoverable failure; reduce step if possible
@@ -917,6 +923,7 @@ int ARKodeEvolve(void* arkode_mem, sunrealtype tout, N_Vector yout,
         /* Log fatal errors here, other returns handled below */
         SUNLogInfo(ARK_LOGGER, "end-step-attempt",
                    "status = failed step, kflag = %i", kflag);
+        arkTelemetryEnd(ark_mem, SUN_STEP_SOLVER_FAIL, -ONE);
         break;
       }
 
@@ -926,6 +933,12 @@ int ARKodeEvolve(void* arkode_mem, sunrealtype tout, N_Vector yout,
       SUNLogInfoIf(kflag != ARK_SUCCESS, ARK_LOGGER, "end-step-attempt",
                    "status = failed step, kflag = %i", kflag);
 
+      /* retried steps are rejected before any work, so are not reported */
+      if (kflag != ARK_SUCCESS && kflag != ARK_RETRY_STEP)
+      {
+        arkTelemetryEnd(ark_mem, SUN_STEP_SOLVER_FAIL, -ONE);
+      }
+
       if (kflag < 0) { break; }
 
       /* Perform relaxation:
@@ -940,6 +953,11 @@ int ARKodeEvolve(void* arkode_mem, sunrealtype tout, N_Vector yout,
         SUNLogInfoIf(kflag != ARK_SUCCESS, ARK_LOGGER, "end-step-attempt",
                      "status = failed relaxtion, kflag = %i", kflag);
 
+        if (kflag != ARK_SUCCESS)
+        {
+          arkTelemetryEnd(ark_mem, SUN_STEP_SOLVER_FAIL, -ONE);
+        }
+
         if (kflag < 0) { break; }
       }
 
@@ -951,6 +969,11 @@ int ARKodeEvolve(void* arkode_mem, sunrealtype tout, N_Vector yout,
         SUNLogInfoIf(kflag != ARK_SUCCESS, ARK_LOGGER, "end-step-attempt",
                      "status = failed constraints, kflag = %i", kflag);
 
+        if (kflag != ARK_SUCCESS)
+        {
+          arkTelemetryEnd(ark_mem, SUN_STEP_SOLVER_FAIL, -ONE);
+        }
+
         if (kflag < 0) { break; }
       }
 
@@ -960,6 +983,7 @@ int ARKodeEvolve(void* arkode_mem, sunrealtype tout, N_Vector yout,
       {
         ark_mem->eta = ONE;
         SUNLogInfo(ARK_LOGGER, "end-step-attempt", "status = success");
+        arkTelemetryEnd(ark_mem, SUN_STEP_ACCEPTED, dsm);
         break;
       }
 
@@ -973,6 +997,11 @@ int ARKodeEvolve(void* arkode_mem, sunrealtype tout, N_Vector yout,
                      ", kflag = %i",
                      dsm, kflag);
 
+        if (kflag != ARK_SUCCESS && !ark_mem->force_pass)
+        {
+          arkTelemetryEnd(ark_mem, SUN_STEP_ERR_TEST_FAIL, dsm);
+        }
+
         if (kflag < 0) { break; }
       }
 
@@ -982,6 +1011,7 @@ int ARKodeEvolve(void* arkode_mem, sunrealtype tout, N_Vector yout,
         ark_mem->last_kflag = kflag;
         kflag               = ARK_SUCCESS;
         SUNLogInfo(ARK_LOGGER, "end-step-attempt", "status = success");
+        arkTelemetryEnd(ark_mem, SUN_STEP_ACCEPTED, dsm);
         break;
       }
 
@@ -990,6 +1020,7 @@ int ARKodeEvolve(void* arkode_mem, sunrealtype tout, N_Vector yout,
       {
         SUNLogInfo(ARK_LOGGER, "end-step-attempt",
                    "status = success, dsm = " SUN_FORMAT_G, dsm);
+        arkTelemetryEnd(ark_mem, SUN_STEP_ACCEPTED, dsm);
         break;
       }
 
@@ -1022,6 +1053,19 @@ int ARKodeEvolve(void* arkode_mem, sunrealtype tout, N_Vector yout,
 
     nstloc++;
 
+    /* Pass any requested outputs from the last step to the user */
+    if (ark_mem->OutputFn != NULL)
+    {
+      retval = arkOutputStep(ark_mem);
+      if (retval != ARK_SUCCESS)
+      {
+        istate            = retval;
+        ark_mem->tretlast = *tret = ark_mem->tcur;
+        N_VScale(ONE, ark_mem->yn, yout);
+        break;
+      }
+    }
+
     /* Check for root in last step taken. */
     if (ark_mem->root_mem != NULL)
     {
@@ -1225,6 +1269,87 @@ int ARKodeGetDky(void* arkode_mem, sunrealtype t, int k, N_Vector dky)
   return (ARK_SUCCESS);
 }
 
+/*---------------------------------------------------------------
+  ARKodeGetDkyArray:
+
+  This routine computes the k-th derivative of the interpolating
+  polynomial at each of the nt times t[m] and stores the results
+  in the vectors dky[m].  All of the times are checked before any
+  output is formed.  The interpolation module caches any interior
+  RHS samples it needs on the first evaluation, so the remaining
+  outputs only require one linear combination each.
+  ---------------------------------------------------------------*/
+int ARKodeGetDkyArray(void* arkode_mem, int nt, sunrealtype* t, int k,
+                      N_Vector* dky)
+{
+  sunrealtype s, tfuzz, tp, tn1;
+  int m, retval;
+  ARKodeMem ark_mem;
+
+  /* Check if ark_mem exists */
+  if (arkode_mem == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return (ARK_MEM_NULL);
+  }
+  ark_mem = (ARKodeMem)arkode_mem;
+
+  /* Check all inputs for legality */
+  if (nt < 0 || (nt > 0 && (t == NULL || dky == NULL)))
+  {
+    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "nt < 0 or t or dky is NULL");
+    return (ARK_ILL_INPUT);
+  }
+  if (ark_mem->interp == NULL)
+  {
+    arkProcessError(ark_mem, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    "Missing interpolation structure");
+    return (ARK_MEM_NULL);
+  }
+
+  /* Allow for some slack */
+  tfuzz = FUZZ_FACTOR * ark_mem->uround *
+          (SUNRabs(ark_mem->tcur) + SUNRabs(ark_mem->hold));
+  if (ark_mem->hold < ZERO) { tfuzz = -tfuzz; }
+  tp  = ark_mem->tcur - ark_mem->hold - tfuzz;
+  tn1 = ark_mem->tcur + tfuzz;
+
+  /* Check every output before overwriting any of them */
+  for (m = 0; m < nt; m++)
+  {
+    if (dky[m] == NULL)
+    {
+      arkProcessError(ark_mem, ARK_BAD_DKY, __LINE__, __func__, __FILE__,
+                      MSG_ARK_NULL_DKY);
+      return (ARK_BAD_DKY);
+    }
+    if ((t[m] - tp) * (t[m] - tn1) > ZERO)
+    {
+      arkProcessError(ark_mem, ARK_BAD_T, __LINE__, __func__, __FILE__,
+                      MSG_ARK_BAD_T, t[m], ark_mem->tcur - ark_mem->hold,
+                      ark_mem->tcur);
+      return (ARK_BAD_T);
+    }
+  }
+
+  /* call arkInterpEvaluate to evaluate each result */
+  for (m = 0; m < nt; m++)
+  {
+    s      = (t[m] - ark_mem->tcur) / ark_mem->h;
+    retval = arkInterpEvaluate(ark_mem, ark_mem->interp, s, k,
+                               ARK_INTERP_MAX_DEGREE, dky[m]);
+    if (retval != ARK_SUCCESS)
+    {
+      arkProcessError(ark_mem, retval, __LINE__, __func__, __FILE__,
+                      "Error calling arkInterpEvaluate");
+      return (retval);
+    }
+  }
+  return (ARK_SUCCESS);
+}
+
 /*---------------------------------------------------------------
   ARKodeFree:
 
@@ -1392,9 +1517,9 @@ void ARKodePrintMem(void* arkode_mem, FILE* outfile)
   fprintf(outfile, "tempv2:\n");
   N_VPrintFile(ark_mem->tempv2, outfile);
   fprintf(outfile, "tempv3:\n");
-  N_VPrintFile(ark_mem->tempv3, outfile);
+  if (ark_mem->tempv3) { N_VPrintFile(ark_mem->tempv3, outfile); }
   fprintf(outfile, "tempv4:\n");
-  N_VPrintFile(ark_mem->tempv4, outfile);
+  if (ark_mem->tempv4) { N_VPrintFile(ark_mem->tempv4, outfile); }
   fprintf(outfile, "tempv5:\n");
   N_VPrintFile(ark_mem->tempv5, outfile);
   fprintf(outfile, "constraints:\n");
@@ -1548,6 +1673,7 @@ ARKodeMem arkCreate(SUNContext sunctx)
   ark_mem->step_setstagepredictfn         = NULL;
   ark_mem->step_getnumrhsevals            = NULL;
   ark_mem->step_setstepdirection          = NULL;
+  ark_mem->step_setusecompensatedsums     = NULL;
   ark_mem->step_getnumlinsolvsetups       = NULL;
   ark_mem->step_setadaptcontroller        = NULL;
   ark_mem->step_getestlocalerrors         = NULL;
@@ -1590,6 +1716,18 @@ ARKodeMem arkCreate(SUNContext sunctx)
   /* No user-supplied stage postprocessing function yet */
   ark_mem->ProcessStage = NULL;
 
+  /* No user-supplied solution output function yet */
+  ark_mem->OutputFn   = NULL;
+  ark_mem->out_data   = NULL;
+  ark_mem->out_t0     = ZERO;
+  ark_mem->out_dt     = ZERO;
+  ark_mem->out_idx    = 0;
+  ark_mem->out_nsteps = 0;
+  ark_mem->ysink      = NULL;
+
+  /* No per-step telemetry function yet */
+  ark_mem->telemetryfn = NULL;
+
   /* No user_data pointer yet */
   ark_mem->user_data = NULL;
 
@@ -1795,9 +1933,16 @@ int arkInit(ARKodeMem ark_mem, sunrealtype t0, N_Vector y0, int init_type)
   N_VScale(ONE, y0, ark_mem->yn);
   ark_mem->fn_is_current = SUNFALSE;
 
+  /* Clear the compensated summation corrections */
+  ark_mem->terr = ZERO;
+  if (ark_mem->ycomp != NULL) { N_VConst(ZERO, ark_mem->ycomp); }
+
   /* Clear any previous 'tstop' */
   ark_mem->tstopset = SUNFALSE;
 
+  /* Restart the search for the next output grid time */
+  ark_mem->out_idx = 0;
+
   /* Initializations on (re-)initialization call, skip on reset */
   if (init_type == FIRST_INIT)
   {
@@ -1808,6 +1953,7 @@ int arkInit(ARKodeMem ark_mem, sunrealtype t0, N_Vector y0, int init_type)
     ark_mem->ncfn         = 0;
     ark_mem->netf         = 0;
     ark_mem->nconstrfails = 0;
+    ark_mem->nfe_reused   = 0;
 
     /* Initial, old, and next step sizes */
     ark_mem->h0u    = ZERO;
@@ -2006,6 +2152,14 @@ int arkInitialSetup(ARKodeMem ark_mem, sunrealtype tout)
     }
   }
 
+  /* Relaxation rescales the step increment after the solution is formed */
+  if (ark_mem->use_compensated_sums && ark_mem->relax_enabled)
+  {
+    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "Compensated summation is not compatible with relaxation");
+    return (ARK_ILL_INPUT);
+  }
+
   /* Check to see if y0 satisfies constraints */
   if (ark_mem->constraintsSet)
   {
@@ -2660,6 +2814,88 @@ int arkYddNorm(ARKodeMem ark_mem, sunrealtype hg, sunrealtype* yddnrm)
   return (ARK_SUCCESS);
 }
 
+/*---------------------------------------------------------------
+  arkTelemetryBegin
+
+  This routine records the state at the start of a step attempt
+  when a telemetry function is attached.  Until the attempt ends,
+  the counter fields of the record hold the counter values at the
+  start of the attempt and time_step holds the start time.
+  ---------------------------------------------------------------*/
+void arkTelemetryBegin(ARKodeMem ark_mem, int attempt)
+{
+  SUNStepTelemetry* tel = &(ark_mem->telemetry);
+
+  if (ark_mem->telemetryfn == NULL) { return; }
+
+  tel->version = SUN_STEP_TELEMETRY_VERSION;
+  tel->step    = ark_mem->nst;
+  tel->attempt = attempt;
+  tel->t       = ark_mem->tn;
+  tel->h       = ark_mem->h;
+  tel->order   = (ark_mem->hadapt_mem) ? ark_mem->hadapt_mem->q : 0;
+  tel->nni     = 0;
+  tel->nfe     = 0;
+  tel->nsetups = 0;
+  if (ark_mem->step_getnumnonlinsolviters)
+  {
+    (void)ark_mem->step_getnumnonlinsolviters(ark_mem, &(tel->nni));
+  }
+  if (ark_mem->step_getnumrhsevals)
+  {
+    (void)ark_mem->step_getnumrhsevals(ark_mem, -1, &(tel->nfe));
+  }
+  if (ark_mem->step_getnumlinsolvsetups)
+  {
+    (void)ark_mem->step_getnumlinsolvsetups(ark_mem, &(tel->nsetups));
+  }
+  arkLsTelemetryCounters(ark_mem, &(tel->nli), &(tel->nje));
+
+  tel->time_nls    = 0.0;
+  tel->time_lsetup = 0.0;
+  tel->time_lsolve = 0.0;
+  tel->time_step   = sunWallTime();
+}
+
+/*---------------------------------------------------------------
+  arkTelemetryEnd
+
+  This routine completes the record for the current step attempt
+  and passes it to the user's telemetry function.
+  ---------------------------------------------------------------*/
+void arkTelemetryEnd(ARKodeMem ark_mem, SUNStepOutcome outcome,
+                     sunrealtype dsm)
+{
+  SUNStepTelemetry* tel = &(ark_mem->telemetry);
+  long int nni = 0, nfe = 0, nsetups = 0, nli, nje;
+
+  if (ark_mem->telemetryfn == NULL) { return; }
+
+  tel->time_step = sunWallTime() - tel->time_step;
+  tel->outcome   = outcome;
+  tel->dsm       = dsm;
+  if (ark_mem->step_getnumnonlinsolviters)
+  {
+    (void)ark_mem->step_getnumnonlinsolviters(ark_mem, &nni);
+  }
+  if (ark_mem->step_getnumrhsevals)
+  {
+    (void)ark_mem->step_getnumrhsevals(ark_mem, -1, &nfe);
+  }
+  if (ark_mem->step_getnumlinsolvsetups)
+  {
+    (void)ark_mem->step_getnumlinsolvsetups(ark_mem, &nsetups);
+  }
+  arkLsTelemetryCounters(ark_mem, &nli, &nje);
+  tel->nni     = nni - tel->nni;
+  tel->nfe     = nfe - tel->nfe;
+  tel->nsetups = nsetups - tel->nsetups;
+  tel->nli     = nli - tel->nli;
+  tel->nje     = nje - tel->nje;
+
+  (void)ark_mem->telemetryfn(tel, ark_mem->user_data);
+}
+
 /*---------------------------------------------------------------
   arkCompleteStep
 
@@ -2736,6 +2972,16 @@ int arkCompleteStep(ARKodeMem ark_mem, sunrealtype dsm)
   N_VScale(ONE, ark_mem->ycur, ark_mem->yn);
   ark_mem->fn_is_current = SUNFALSE;
 
+  /* commit the compensated summation correction for the new yn, a
+     postprocessed solution replaces the compensated sum */
+  if (ark_mem->use_compensated_sums && ark_mem->ycomp != NULL)
+  {
+    if (ark_mem->ProcessStep != NULL) { N_VConst(ZERO, ark_mem->ycomp_new); }
+    N_Vector tmp       = ark_mem->ycomp;
+    ark_mem->ycomp     = ark_mem->ycomp_new;
+    ark_mem->ycomp_new = tmp;
+  }
+
   /* Notify time step controller object of successful step */
   if (ark_mem->hadapt_mem->hcontroller)
   {
@@ -2766,6 +3012,145 @@ int arkCompleteStep(ARKodeMem ark_mem, sunrealtype dsm)
   return (ARK_SUCCESS);
 }
 
+/*---------------------------------------------------------------
+  arkSetUseCompensatedSums
+
+  This routine enables or disables compensated summation for
+  time steppers that form the step solution with
+  arkCompensatedUpdate. It is attached as the stepper routine
+  called by ARKodeSetUseCompensatedSums.
+  ---------------------------------------------------------------*/
+int arkSetUseCompensatedSums(ARKodeMem ark_mem, sunbooleantype onoff)
+{
+  if (onoff)
+  {
+    if (!arkAllocVec(ark_mem, ark_mem->yn, &ark_mem->ycomp) ||
+        !arkAllocVec(ark_mem, ark_mem->yn, &ark_mem->ycomp_new))
+    {
+      arkProcessError(ark_mem, ARK_MEM_FAIL, __LINE__, __func__, __FILE__,
+                      MSG_ARK_MEM_FAIL);
+      return (ARK_MEM_FAIL);
+    }
+    N_VConst(ZERO, ark_mem->ycomp);
+  }
+  else
+  {
+    arkFreeVec(ark_mem, &ark_mem->ycomp);
+    arkFreeVec(ark_mem, &ark_mem->ycomp_new);
+  }
+
+  ark_mem->use_compensated_sums = onoff;
+  ark_mem->terr                 = ZERO;
+
+  return (ARK_SUCCESS);
+}
+
+/*---------------------------------------------------------------
+  arkCompensatedUpdate
+
+  This routine forms the step solution ycur = yn + dy with
+  compensated (Kahan) summation. On input, dy must hold the step
+  increment minus the running correction ycomp (steppers fold the
+  correction into the fused operation forming the increment) and
+  may not alias ycur, yn, or the corrections. The correction for
+  ycur is stored in ycomp_new and committed by arkCompleteStep
+  once the step is accepted.
+  ---------------------------------------------------------------*/
+int arkCompensatedUpdate(ARKodeMem ark_mem, N_Vector dy)
+{
+  N_VLinearSum(ONE, ark_mem->yn, ONE, dy, ark_mem->ycur);
+  N_VLinearSum(ONE, ark_mem->ycur, -ONE, ark_mem->yn, ark_mem->ycomp_new);
+  N_VLinearSum(ONE, ark_mem->ycomp_new, -ONE, dy, ark_mem->ycomp_new);
+  return (ARK_SUCCESS);
+}
+
+/*---------------------------------------------------------------
+  arkOutputStep
+
+  This routine passes any requested solution outputs from the
+  step just completed to the user-supplied output function.
+  Outputs on the time grid out_t0 + i*out_dt that fall within
+  [tn - hold, tn] are interpolated into the ysink vector, unless
+  they coincide with tn in which case yn is passed directly.
+  Outputs every out_nsteps steps always pass yn directly.  In
+  either case the vector is only borrowed by the output function
+  and must not be modified.
+  ---------------------------------------------------------------*/
+int arkOutputStep(ARKodeMem ark_mem)
+{
+  int retval;
+  long int idx;
+  sunrealtype tprev, tout, troundoff;
+  N_Vector y;
+
+  /* Outputs on a uniform time grid */
+  if (ark_mem->out_dt * ark_mem->hold > ZERO)
+  {
+    tprev     = ark_mem->tcur - ark_mem->hold;
+    troundoff = FUZZ_FACTOR * ark_mem->uround *
+                (SUNRabs(ark_mem->tcur) + SUNRabs(ark_mem->hold));
+
+    /* skip any grid times before the start of the step (e.g., after a
+       reset or when the grid starts before the initial time) */
+    tout = ark_mem->out_t0 + ark_mem->out_idx * ark_mem->out_dt;
+    if ((tout - tprev) * ark_mem->hold < ZERO &&
+        SUNRabs(tout - tprev) > troundoff)
+    {
+      idx              = (long int)SUNRceil((tprev - ark_mem->out_t0) /
+                                            ark_mem->out_dt);
+      ark_mem->out_idx = SUNMAX(idx, ark_mem->out_idx);
+    }
+
+    for (;;)
+    {
+      tout = ark_mem->out_t0 + ark_mem->out_idx * ark_mem->out_dt;
+
+      if (SUNRabs(tout - ark_mem->tcur) <= troundoff) { y = ark_mem->yn; }
+      else if ((tout - ark_mem->tcur) * ark_mem->hold > ZERO) { break; }
+      else
+      {
+        if (ark_mem->interp == NULL)
+        {
+          arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                          "Output times require an interpolation module");
+          return (ARK_ILL_INPUT);
+        }
+        retval = ARKodeGetDky(ark_mem, tout, 0, ark_mem->ysink);
+        if (retval != ARK_SUCCESS)
+        {
+          arkProcessError(ark_mem, retval, __LINE__, __func__, __FILE__,
+                          MSG_ARK_INTERPOLATION_FAIL, tout);
+          return (retval);
+        }
+        y = ark_mem->ysink;
+      }
+
+      retval = ark_mem->OutputFn(tout, y, ark_mem->out_data);
+      if (retval != 0)
+      {
+        arkProcessError(ark_mem, ARK_OUTPUT_FN_FAIL, __LINE__, __func__,
+                        __FILE__, MSG_ARK_OUTPUT_FN_FAIL, tout);
+        return (ARK_OUTPUT_FN_FAIL);
+      }
+      ark_mem->out_idx++;
+    }
+  }
+
+  /* Outputs every out_nsteps steps */
+  if (ark_mem->out_nsteps > 0 && ark_mem->nst % ark_mem->out_nsteps == 0)
+  {
+    retval = ark_mem->OutputFn(ark_mem->tcur, ark_mem->yn, ark_mem->out_data);
+    if (retval != 0)
+    {
+      arkProcessError(ark_mem, ARK_OUTPUT_FN_FAIL, __LINE__, __func__, __FILE__,
+                      MSG_ARK_OUTPUT_FN_FAIL, ark_mem->tcur);
+      return (ARK_OUTPUT_FN_FAIL);
+    }
+  }
+
+  return (ARK_SUCCESS);
+}
+
 /*---------------------------------------------------------------
   arkHandleFailure
 
@@ -3272,8 +3657,19 @@ int arkCheckConvergence(ARKodeMem ark_mem, int* nflagPtr, int* ncfPtr)
 int arkCheckConstraints(ARKodeMem ark_mem, int* constrfails, int* nflag)
 {
   sunbooleantype constraintsPassed;
-  N_Vector mm  = ark_mem->tempv4;
-  N_Vector tmp = ark_mem->tempv3;
+  N_Vector mm  = NULL;
+  N_Vector tmp = NULL;
+
+  /* Steppers with a smaller footprint may not allocate tempv3 and tempv4 */
+  if (!arkAllocVec(ark_mem, ark_mem->yn, &ark_mem->tempv3) ||
+      !arkAllocVec(ark_mem, ark_mem->yn, &ark_mem->tempv4))
+  {
+    arkProcessError(ark_mem, ARK_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_MEM_FAIL);
+    return (ARK_MEM_FAIL);
+  }
+  mm  = ark_mem->tempv4;
+  tmp = ark_mem->tempv3;
 
   /* Check constraints and get mask vector mm for where constraints failed */
   constraintsPassed = N_VConstrMask(ark_mem->constraints, ark_mem->ycur, mm);
@@ -3693,6 +4089,26 @@ sunbooleantype arkResizeVectors(ARKodeMem ark_mem, ARKVecResizeFn resize,
     return (SUNFALSE);
   }
 
+  /* output sink */
+  if (!arkResizeVec(ark_mem, resize, resize_data, lrw_diff, liw_diff, tmpl,
+                    &ark_mem->ysink))
+  {
+    return (SUNFALSE);
+  }
+
+  /* compensated summation corrections */
+  if (!arkResizeVec(ark_mem, resize, resize_data, lrw_diff, liw_diff, tmpl,
+                    &ark_mem->ycomp))
+  {
+    return (SUNFALSE);
+  }
+
+  if (!arkResizeVec(ark_mem, resize, resize_data, lrw_diff, liw_diff, tmpl,
+                    &ark_mem->ycomp_new))
+  {
+    return (SUNFALSE);
+  }
+
   return (SUNTRUE);
 }
 
@@ -3715,6 +4131,9 @@ void arkFreeVectors(ARKodeMem ark_mem)
   arkFreeVec(ark_mem, &ark_mem->fn);
   arkFreeVec(ark_mem, &ark_mem->Vabstol);
   arkFreeVec(ark_mem, &ark_mem->constraints);
+  arkFreeVec(ark_mem, &ark_mem->ysink);
+  arkFreeVec(ark_mem, &ark_mem->ycomp);
+  arkFreeVec(ark_mem, &ark_mem->ycomp_new);
 }
 
 /*---------------------------------------------------------------
@@ -115,6 +115,7 @@ void* ARKStepCreate(ARKRhsFn fe, ARKRhsFn fi, sunrealtype t0, N_Vector y0,
   ark_mem->step_computestate              = arkStep_ComputeState;
   ark_mem->step_setrelaxfn                = arkStep_SetRelaxFn;
   ark_mem->step_setorder                  = arkStep_SetOrder;
+  ark_mem->step_setusecompensatedsums     = arkSetUseCompensatedSums;
   ark_mem->step_setnonlinearsolver        = arkStep_SetNonlinearSolver;
   ark_mem->step_setlinear                 = arkStep_SetLinear;
   ark_mem->step_setnonlinear              = arkStep_SetNonlinear;
@@ -253,6 +254,12 @@ void* ARKStepCreate(ARKRhsFn fe, ARKRhsFn fi, sunrealtype t0, N_Vector y0,
   /* Initialize saved fi alias */
   step_mem->fn_implicit = NULL;
 
+  /* Initialize stiffness switching data */
+  step_mem->stiff     = SUNFALSE;
+  step_mem->stiff_v   = NULL;
+  step_mem->hrho_nst  = -1;
+  step_mem->nswitches = 0;
+
   /* Initialize main ARKODE infrastructure */
   retval = arkInit(ark_mem, t0, y0, FIRST_INIT);
   if (retval != ARK_SUCCESS)
@@ -333,10 +340,11 @@ int ARKStepReInit(void* arkode_mem, ARKRhsFn fe, ARKRhsFn fi, sunrealtype t0,
   }
 
   /* Initialize all the counters */
-  step_mem->nfe     = 0;
-  step_mem->nfi     = 0;
-  step_mem->nsetups = 0;
-  step_mem->nstlp   = 0;
+  step_mem->nfe       = 0;
+  step_mem->nfi       = 0;
+  step_mem->nsetups   = 0;
+  step_mem->nstlp     = 0;
+  step_mem->nswitches = 0;
 
   return (ARK_SUCCESS);
 }
@@ -427,6 +435,19 @@ int arkStep_Resize(ARKodeMem ark_mem, N_Vector y0,
     }
   }
 
+  /*     stiffness estimate vector */
+  if (step_mem->stiff_v != NULL)
+  {
+    if (!arkResizeVec(ark_mem, resize, resize_data, lrw_diff, liw_diff, y0,
+                      &step_mem->stiff_v))
+    {
+      arkProcessError(ark_mem, ARK_MEM_FAIL, __LINE__, __func__, __FILE__,
+                      "Unable to resize vector");
+      return (ARK_MEM_FAIL);
+    }
+    N_VConst(ONE, step_mem->stiff_v);
+  }
+
   /* If a NLS object was previously used, destroy and recreate default Newton
      NLS object (can be replaced by user-defined object if desired) */
   if ((step_mem->NLS != NULL) && (step_mem->ownNLS))
@@ -556,6 +577,13 @@ void arkStep_Free(ARKodeMem ark_mem)
       step_mem->zcor = NULL;
     }
 
+    /* free the stiffness estimate vector */
+    if (step_mem->stiff_v != NULL)
+    {
+      arkFreeVec(ark_mem, &step_mem->stiff_v);
+      step_mem->stiff_v = NULL;
+    }
+
     /* free the RHS vectors */
     if (step_mem->Fe != NULL)
     {
@@ -662,6 +690,7 @@ void arkStep_PrintMem(ARKodeMem ark_mem, FILE* outfile)
   fprintf(outfile, "ARKStep: nfi = %li\n", step_mem->nfi);
   fprintf(outfile, "ARKStep: nsetups = %li\n", step_mem->nsetups);
   fprintf(outfile, "ARKStep: nstlp = %li\n", step_mem->nstlp);
+  fprintf(outfile, "ARKStep: nswitches = %li\n", step_mem->nswitches);
 
   /* output boolean quantities */
   fprintf(outfile, "ARKStep: user_linear = %i\n", step_mem->linear);
@@ -669,6 +698,9 @@ void arkStep_PrintMem(ARKodeMem ark_mem, FILE* outfile)
           step_mem->linear_timedep);
   fprintf(outfile, "ARKStep: user_explicit = %i\n", step_mem->explicit);
   fprintf(outfile, "ARKStep: user_implicit = %i\n", step_mem->implicit);
+  fprintf(outfile, "ARKStep: stiff_switching = %i\n",
+          step_mem->stiff_switching);
+  fprintf(outfile, "ARKStep: stiff = %i\n", step_mem->stiff);
   fprintf(outfile, "ARKStep: jcur = %i\n", step_mem->jcur);
 
   /* output sunrealtype quantities */
@@ -954,6 +986,22 @@ int arkStep_Init(ARKodeMem ark_mem, SUNDIALS_MAYBE_UNUSED sunrealtype tout,
   /* initializations/checks for (re-)initialization call */
   if (init_type == FIRST_INIT)
   {
+    /* with stiffness switching fe and fi are the same function and the
+       explicit and implicit tables are set up together */
+    if (step_mem->stiff_switching)
+    {
+      if (step_mem->fe == NULL) { step_mem->fe = step_mem->fi; }
+      if (step_mem->fi == NULL) { step_mem->fi = step_mem->fe; }
+      if (step_mem->fe != step_mem->fi)
+      {
+        arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                        "Stiffness switching requires a single RHS function");
+        return (ARK_ILL_INPUT);
+      }
+      step_mem->explicit = SUNTRUE;
+      step_mem->implicit = SUNTRUE;
+    }
+
     /* enforce use of arkEwtSmallReal if using a fixed step size for
        an explicit method, an internal error weight function, not
        using an iterative mass matrix solver with rwt=ewt, and not
@@ -1023,6 +1071,36 @@ int arkStep_Init(ARKodeMem ark_mem, SUNDIALS_MAYBE_UNUSED sunrealtype tout,
       return (ARK_ILL_INPUT);
     }
 
+    /* Stiffness switching requires an explicit table and an implicit table
+       with an explicit first stage (so both start from f(tn, yn)) with the
+       same number of stages and an identity mass matrix */
+    if (step_mem->stiff_switching)
+    {
+      if (step_mem->Be == NULL || step_mem->Bi == NULL ||
+          step_mem->Be->stages != step_mem->Bi->stages)
+      {
+        arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                        "Stiffness switching requires explicit and implicit "
+                        "tables with the same number of stages");
+        return (ARK_ILL_INPUT);
+      }
+      if (SUNRabs(step_mem->Bi->A[0][0]) > TINY)
+      {
+        arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                        "Stiffness switching requires an implicit table with "
+                        "an explicit first stage");
+        return (ARK_ILL_INPUT);
+      }
+      if (step_mem->mass_type != MASS_IDENTITY || ark_mem->relax_enabled ||
+          step_mem->expforcing || step_mem->impforcing)
+      {
+        arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                        "Stiffness switching is not compatible with a mass "
+                        "matrix, relaxation, or external forcing");
+        return (ARK_ILL_INPUT);
+      }
+    }
+
     /* Relaxation is incompatible with implicit RHS deduction */
     if (ark_mem->relax_enabled && step_mem->implicit && step_mem->deduce_rhs)
     {
@@ -1123,6 +1201,25 @@ int arkStep_Init(ARKodeMem ark_mem, SUNDIALS_MAYBE_UNUSED sunrealtype tout,
       }
     }
 
+    /* Set up stiffness detection and start with the explicit table */
+    if (step_mem->stiff_switching)
+    {
+      if (!arkAllocVec(ark_mem, ark_mem->ewt, &(step_mem->stiff_v)))
+      {
+        return (ARK_MEM_FAIL);
+      }
+      N_VConst(ONE, step_mem->stiff_v);
+
+      step_mem->stab_bound = arkStep_StabilityBound(step_mem->Be,
+                                                    step_mem->cvals);
+      step_mem->stiff    = SUNFALSE;
+      step_mem->explicit = SUNTRUE;
+      step_mem->implicit = SUNFALSE;
+      step_mem->hrho_nst = -1;
+      step_mem->nsuggest = 0;
+      step_mem->nagree   = 0;
+    }
+
     /* Override the interpolant degree (if needed), used in arkInitialSetup */
     if (step_mem->q > 1 && ark_mem->interp_degree > (step_mem->q - 1))
     {
@@ -1676,14 +1773,21 @@ int arkStep_TakeStep_Z(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPtr)
   retval = arkStep_AccessStepMem(ark_mem, __func__, &step_mem);
   if (retval != ARK_SUCCESS) { return (retval); }
 
+  /* switch between the explicit and implicit tables if needed */
+  if (step_mem->stiff_switching)
+  {
+    retval = arkStep_StiffnessSwitch(ark_mem);
+    if (retval != ARK_SUCCESS) { return (retval); }
+  }
+
   /* if problem will involve no algebraic solvers, initialize nflagPtr to success */
   if ((!step_mem->implicit) && (step_mem->mass_type == MASS_IDENTITY))
   {
     *nflagPtr = ARK_SUCCESS;
   }
 
-  /* call nonlinear solver setup if it exists */
-  if (step_mem->NLS)
+  /* call nonlinear solver setup if it exists and will be used */
+  if (step_mem->NLS && step_mem->implicit)
   {
     if ((step_mem->NLS)->ops->setup)
     {
@@ -2159,6 +2263,13 @@ int arkStep_TakeStep_Z(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPtr)
 
   } /* loop over stages */
 
+  /* update the stiffness estimate */
+  if (step_mem->stiff_switching)
+  {
+    retval = arkStep_StiffnessEstimate(ark_mem);
+    if (retval != ARK_SUCCESS) { return (retval); }
+  }
+
   SUNLogInfo(ARK_LOGGER, "begin-compute-solution", "mass type = %i",
              step_mem->mass_type);
 
@@ -2926,6 +3037,7 @@ int arkStep_Predict(ARKodeMem ark_mem, int istage, N_Vector yguess)
     { /* Explicit pieces */
       for (jstage = 0; jstage < istage; jstage++)
       {
+        if (step_mem->Be->A[istage][jstage] == ZERO) { continue; }
         cvals[nvec] = ark_mem->h * step_mem->Be->A[istage][jstage];
         Xvecs[nvec] = step_mem->Fe[jstage];
         nvec += 1;
@@ -2935,6 +3047,7 @@ int arkStep_Predict(ARKodeMem ark_mem, int istage, N_Vector yguess)
     { /* Implicit pieces */
       for (jstage = 0; jstage < istage; jstage++)
       {
+        if (step_mem->Bi->A[istage][jstage] == ZERO) { continue; }
         cvals[nvec] = ark_mem->h * step_mem->Bi->A[istage][jstage];
         Xvecs[nvec] = step_mem->Fi[jstage];
         nvec += 1;
@@ -3091,6 +3204,7 @@ int arkStep_StageSetup(ARKodeMem ark_mem, sunbooleantype implicit)
   { /* Explicit pieces */
     for (j = 0; j < i; j++)
     {
+      if (step_mem->Be->A[i][j] == ZERO) { continue; }
       cvals[nvec] = ark_mem->h * step_mem->Be->A[i][j];
       Xvecs[nvec] = step_mem->Fe[j];
       nvec += 1;
@@ -3100,6 +3214,7 @@ int arkStep_StageSetup(ARKodeMem ark_mem, sunbooleantype implicit)
   { /* Implicit pieces */
     for (j = 0; j < i; j++)
     {
+      if (step_mem->Bi->A[i][j] == ZERO) { continue; }
       cvals[nvec] = ark_mem->h * step_mem->Bi->A[i][j];
       Xvecs[nvec] = step_mem->Fi[j];
       nvec += 1;
@@ -3206,24 +3321,34 @@ int arkStep_ComputeSolutions(ARKodeMem ark_mem, sunrealtype* dsmPtr)
     }
   }
 
-  /* If the method is stiffly accurate, ycur is already the new solution */
+  /* If the method is stiffly accurate, ycur is already the new solution.
+     With compensated summation the solution is always formed from the
+     increment so the rounding error in adding it to yn can be tracked. */
 
-  if (!stiffly_accurate)
+  if (!stiffly_accurate || ark_mem->ycomp != NULL)
   {
     /* Compute time step solution (if necessary) */
     /*   set arrays for fused vector operation */
-    cvals[0] = ONE;
-    Xvecs[0] = ark_mem->yn;
-    nvec     = 1;
+    if (ark_mem->ycomp != NULL)
+    {
+      cvals[0] = -ONE;
+      Xvecs[0] = ark_mem->ycomp;
+    }
+    else
+    {
+      cvals[0] = ONE;
+      Xvecs[0] = ark_mem->yn;
+    }
+    nvec = 1;
     for (j = 0; j < step_mem->stages; j++)
     {
-      if (step_mem->explicit)
+      if (step_mem->explicit && step_mem->Be->b[j] != ZERO)
       { /* Explicit pieces */
         cvals[nvec] = ark_mem->h * step_mem->Be->b[j];
         Xvecs[nvec] = step_mem->Fe[j];
         nvec += 1;
       }
-      if (step_mem->implicit)
+      if (step_mem->implicit && step_mem->Bi->b[j] != ZERO)
       { /* Implicit pieces */
         cvals[nvec] = ark_mem->h * step_mem->Bi->b[j];
         Xvecs[nvec] = step_mem->Fi[j];
@@ -3256,7 +3381,13 @@ int arkStep_ComputeSolutions(ARKodeMem ark_mem, sunrealtype* dsmPtr)
     }
 
     /*   call fused vector operation to do the work */
-    retval = N_VLinearCombination(nvec, cvals, Xvecs, y);
+    if (ark_mem->ycomp != NULL)
+    {
+      retval = N_VLinearCombination(nvec, cvals, Xvecs, ark_mem->tempv2);
+      if (retval != 0) { return (ARK_VECTOROP_ERR); }
+      retval = arkCompensatedUpdate(ark_mem, ark_mem->tempv2);
+    }
+    else { retval = N_VLinearCombination(nvec, cvals, Xvecs, y); }
     if (retval != 0) { return (ARK_VECTOROP_ERR); }
   }
 
@@ -3267,13 +3398,13 @@ int arkStep_ComputeSolutions(ARKodeMem ark_mem, sunrealtype* dsmPtr)
     nvec = 0;
     for (j = 0; j < step_mem->stages; j++)
     {
-      if (step_mem->explicit)
+      if (step_mem->explicit && step_mem->Be->b[j] != step_mem->Be->d[j])
       { /* Explicit pieces */
         cvals[nvec] = ark_mem->h * (step_mem->Be->b[j] - step_mem->Be->d[j]);
         Xvecs[nvec] = step_mem->Fe[j];
         nvec += 1;
       }
-      if (step_mem->implicit)
+      if (step_mem->implicit && step_mem->Bi->b[j] != step_mem->Bi->d[j])
       { /* Implicit pieces */
         cvals[nvec] = ark_mem->h * (step_mem->Bi->b[j] - step_mem->Bi->d[j]);
         Xvecs[nvec] = step_mem->Fi[j];
@@ -3308,8 +3439,13 @@ int arkStep_ComputeSolutions(ARKodeMem ark_mem, sunrealtype* dsmPtr)
     }
 
     /* call fused vector operation to do the work */
-    retval = N_VLinearCombination(nvec, cvals, Xvecs, yerr);
-    if (retval != 0) { return (ARK_VECTOROP_ERR); }
+    /*   (all terms vanish if the embedding matches the method weights) */
+    if (nvec > 0)
+    {
+      retval = N_VLinearCombination(nvec, cvals, Xvecs, yerr);
+      if (retval != 0) { return (ARK_VECTOROP_ERR); }
+    }
+    else { N_VConst(ZERO, yerr); }
 
     /* fill error norm */
     *dsmPtr = N_VWrmsNorm(yerr, ark_mem->ewt);
@@ -3380,22 +3516,23 @@ int arkStep_ComputeSolutions_MassFixed(ARKodeMem ark_mem, sunrealtype* dsmPtr)
     }
   }
 
-  /* If the method is stiffly accurate, ycur is already the new solution */
+  /* If the method is stiffly accurate, ycur is already the new solution
+     (unless compensated summation is enabled, see above) */
 
-  if (!stiffly_accurate)
+  if (!stiffly_accurate || ark_mem->ycomp != NULL)
   {
     /* compute y RHS (store in y) */
     /*   set arrays for fused vector operation */
     nvec = 0;
     for (j = 0; j < step_mem->stages; j++)
     {
-      if (step_mem->explicit)
+      if (step_mem->explicit && step_mem->Be->b[j] != ZERO)
       { /* Explicit pieces */
         cvals[nvec] = ark_mem->h * step_mem->Be->b[j];
         Xvecs[nvec] = step_mem->Fe[j];
         nvec += 1;
       }
-      if (step_mem->implicit)
+      if (step_mem->implicit && step_mem->Bi->b[j] != ZERO)
       { /* Implicit pieces */
         cvals[nvec] = ark_mem->h * step_mem->Bi->b[j];
         Xvecs[nvec] = step_mem->Fi[j];
@@ -3417,7 +3554,13 @@ int arkStep_ComputeSolutions_MassFixed(ARKodeMem ark_mem, sunrealtype* dsmPtr)
     }
 
     /* compute y = yn + update */
-    N_VLinearSum(ONE, ark_mem->yn, ONE, y, y);
+    if (ark_mem->ycomp != NULL)
+    {
+      N_VLinearSum(ONE, y, -ONE, ark_mem->ycomp, ark_mem->tempv2);
+      retval = arkCompensatedUpdate(ark_mem, ark_mem->tempv2);
+      if (retval != 0) { return (ARK_VECTOROP_ERR); }
+    }
+    else { N_VLinearSum(ONE, ark_mem->yn, ONE, y, y); }
   }
 
   /* compute yerr (if step adaptivity enabled) */
@@ -3428,13 +3571,13 @@ int arkStep_ComputeSolutions_MassFixed(ARKodeMem ark_mem, sunrealtype* dsmPtr)
     nvec = 0;
     for (j = 0; j < step_mem->stages; j++)
     {
-      if (step_mem->explicit)
+      if (step_mem->explicit && step_mem->Be->b[j] != step_mem->Be->d[j])
       { /* Explicit pieces */
         cvals[nvec] = ark_mem->h * (step_mem->Be->b[j] - step_mem->Be->d[j]);
         Xvecs[nvec] = step_mem->Fe[j];
         nvec += 1;
       }
-      if (step_mem->implicit)
+      if (step_mem->implicit && step_mem->Bi->b[j] != step_mem->Bi->d[j])
       { /* Implicit pieces */
         cvals[nvec] = ark_mem->h * (step_mem->Bi->b[j] - step_mem->Bi->d[j]);
         Xvecs[nvec] = step_mem->Fi[j];
@@ -3443,8 +3586,13 @@ int arkStep_ComputeSolutions_MassFixed(ARKodeMem ark_mem, sunrealtype* dsmPtr)
     }
 
     /*   call fused vector operation to compute yerr RHS */
-    retval = N_VLinearCombination(nvec, cvals, Xvecs, yerr);
-    if (retval != 0) { return (ARK_VECTOROP_ERR); }
+    /*   (all terms vanish if the embedding matches the method weights) */
+    if (nvec > 0)
+    {
+      retval = N_VLinearCombination(nvec, cvals, Xvecs, yerr);
+      if (retval != 0) { return (ARK_VECTOROP_ERR); }
+    }
+    else { N_VConst(ZERO, yerr); }
 
     /* solve for yerr */
     retval = step_mem->msolve((void*)ark_mem, yerr, step_mem->nlscoef);
@@ -3843,6 +3991,227 @@ void arkStep_ApplyForcing(ARKodeARKStepMem step_mem, sunrealtype* stage_times,
   *nvec += nforcing;
 }
 
+/*------------------------------------------------------------------------------
+  arkStep_StabilityBound
+
+  Returns the length of the interval [-x, 0] of the negative real axis contained
+  in the stability region of the explicit table B, i.e., the first x > 0 with
+  |R(-x)| > 1 where R is the stability function. R(z) is evaluated by applying
+  the method to y' = lambda y with z = h lambda,
+
+    g_i  = 1 + z sum_{j < i} A_ij g_j,
+    R(z) = 1 + z sum_i b_i g_i,
+
+  the boundary is bracketed by scanning the axis and then found by bisection.
+  With an embedding the smaller of the bounds for the weights b and d is
+  returned as adaptive steps are limited by the less stable of the two. The
+  array g must have at least B->stages entries.
+  ----------------------------------------------------------------------------*/
+
+static sunrealtype arkStep_AbsStabFn(ARKodeButcherTable B, sunrealtype* b,
+                                     sunrealtype x, sunrealtype* g)
+{
+  int i, j;
+  sunrealtype R = ONE;
+
+  for (i = 0; i < B->stages; i++)
+  {
+    g[i] = ONE;
+    for (j = 0; j < i; j++) { g[i] -= x * B->A[i][j] * g[j]; }
+    R -= x * b[i] * g[i];
+  }
+
+  return SUNRabs(R);
+}
+
+static sunrealtype arkStep_StabilityBoundWeights(ARKodeButcherTable B,
+                                                 sunrealtype* b, sunrealtype* g)
+{
+  int i;
+  sunrealtype dx   = SUN_RCONST(0.05);
+  sunrealtype xmax = SUN_RCONST(2.0) * B->stages * B->stages;
+  sunrealtype xlo, xhi, xmid;
+
+  /* scan for the first point outside of the stability region (the real
+     stability interval of an s stage explicit method is at most 2 s^2) */
+  xhi = dx;
+  while (xhi < xmax && arkStep_AbsStabFn(B, b, xhi, g) <= ONE) { xhi += dx; }
+  if (xhi >= xmax) { return xmax; }
+
+  /* bisect to locate the boundary */
+  xlo = xhi - dx;
+  for (i = 0; i < 50; i++)
+  {
+    xmid = HALF * (xlo + xhi);
+    if (arkStep_AbsStabFn(B, b, xmid, g) <= ONE) { xlo = xmid; }
+    else { xhi = xmid; }
+  }
+
+  return xlo;
+}
+
+sunrealtype arkStep_StabilityBound(ARKodeButcherTable B, sunrealtype* g)
+{
+  sunrealtype bound = arkStep_StabilityBoundWeights(B, B->b, g);
+
+  if (B->d != NULL)
+  {
+    bound = SUNMIN(bound, arkStep_StabilityBoundWeights(B, B->d, g));
+  }
+
+  return bound;
+}
+
+/*------------------------------------------------------------------------------
+  arkStep_StiffnessEstimate
+
+  Updates the estimate of the magnitude of the dominant eigenvalue of the
+  Jacobian of f with one step of a power iteration. The vector v from the
+  previous step is scaled to unit weighted norm and
+
+    w   = f(tn, yn + v) - f(tn, yn),
+    rho = ||w||,
+
+  after which w is retained as the vector for the next step. As the first stage
+  of both tables is explicit, f(tn, yn) is available in Fe[0] or Fi[0]. The
+  product h rho is saved with the current step number and used by
+  arkStep_StiffnessSwitch at the start of the next step if this step is
+  accepted. Uses tempv1 and tempv2 as workspace.
+  ----------------------------------------------------------------------------*/
+
+int arkStep_StiffnessEstimate(ARKodeMem ark_mem)
+{
+  ARKodeARKStepMem step_mem;
+  N_Vector fn;
+  sunrealtype vnrm;
+  int retval;
+
+  /* access ARKodeARKStepMem structure */
+  retval = arkStep_AccessStepMem(ark_mem, __func__, &step_mem);
+  if (retval != ARK_SUCCESS) { return (retval); }
+
+  fn = (step_mem->stiff) ? step_mem->Fi[0] : step_mem->Fe[0];
+
+  /* restart the iteration if the vector was annihilated */
+  vnrm = N_VWrmsNorm(step_mem->stiff_v, ark_mem->ewt);
+  if (vnrm == ZERO)
+  {
+    N_VConst(ONE, step_mem->stiff_v);
+    vnrm = N_VWrmsNorm(step_mem->stiff_v, ark_mem->ewt);
+  }
+
+  N_VLinearSum(ONE, ark_mem->yn, ONE / vnrm, step_mem->stiff_v,
+               ark_mem->tempv1);
+
+  retval = step_mem->fi(ark_mem->tn, ark_mem->tempv1, ark_mem->tempv2,
+                        ark_mem->user_data);
+  if (step_mem->stiff) { step_mem->nfi++; }
+  else { step_mem->nfe++; }
+  if (retval < 0) { return (ARK_RHSFUNC_FAIL); }
+
+  /* skip the update if the perturbed state is not admissible */
+  if (retval > 0)
+  {
+    step_mem->hrho_nst = -1;
+    return (ARK_SUCCESS);
+  }
+
+  N_VLinearSum(ONE, ark_mem->tempv2, -ONE, fn, step_mem->stiff_v);
+
+  step_mem->hrho = SUNRabs(ark_mem->h) *
+                   N_VWrmsNorm(step_mem->stiff_v, ark_mem->ewt);
+  step_mem->hrho_nst = ark_mem->nst;
+
+  return (ARK_SUCCESS);
+}
+
+/*------------------------------------------------------------------------------
+  arkStep_StiffnessSwitch
+
+  Called at the start of a step to decide whether to switch between the
+  explicit and implicit tables using the stiffness estimate from the last
+  accepted step. The explicit table is replaced once STIFF_NSTEPS steps have
+  h rho >= STIFF_RATIO times its real stability bound and the implicit table is
+  replaced once NONSTIFF_NSTEPS steps have h rho <= NONSTIFF_RATIO times the
+  bound. The count is cleared after STIFF_NRESET steps that favor the current
+  table.
+
+  The interpolation history is not affected by a switch. Since f(tn, yn) is
+  stored in Fe[0] with the explicit table and in Fi[0] with the implicit table,
+  it is completed with the current table and copied to the other array before
+  switching.
+  ----------------------------------------------------------------------------*/
+
+int arkStep_StiffnessSwitch(ARKodeMem ark_mem)
+{
+  ARKodeARKStepMem step_mem;
+  sunbooleantype switch_table;
+  int retval;
+
+  /* access ARKodeARKStepMem structure */
+  retval = arkStep_AccessStepMem(ark_mem, __func__, &step_mem);
+  if (retval != ARK_SUCCESS) { return (retval); }
+
+  /* only use estimates from accepted steps */
+  if (step_mem->hrho_nst < 0 || ark_mem->nst != step_mem->hrho_nst + 1)
+  {
+    return (ARK_SUCCESS);
+  }
+  step_mem->hrho_nst = -1;
+
+  if (step_mem->stiff)
+  {
+    switch_table = step_mem->hrho <= NONSTIFF_RATIO * step_mem->stab_bound;
+  }
+  else { switch_table = step_mem->hrho >= STIFF_RATIO * step_mem->stab_bound; }
+
+  if (switch_table)
+  {
+    step_mem->nsuggest++;
+    step_mem->nagree = 0;
+  }
+  else
+  {
+    step_mem->nagree++;
+    if (step_mem->nagree >= STIFF_NRESET) { step_mem->nsuggest = 0; }
+  }
+
+  if (step_mem->nsuggest <
+      ((step_mem->stiff) ? NONSTIFF_NSTEPS : STIFF_NSTEPS))
+  {
+    return (ARK_SUCCESS);
+  }
+
+  /* complete f(tn, yn) with the current table */
+  if (!(ark_mem->fn_is_current))
+  {
+    retval = ark_mem->step_fullrhs(ark_mem, ark_mem->tn, ark_mem->yn,
+                                   ark_mem->fn, ARK_FULLRHS_END);
+    if (retval) { return (ARK_RHSFUNC_FAIL); }
+    ark_mem->fn_is_current = SUNTRUE;
+  }
+
+  if (step_mem->stiff) { N_VScale(ONE, step_mem->Fi[0], step_mem->Fe[0]); }
+  else { N_VScale(ONE, step_mem->Fe[0], step_mem->Fi[0]); }
+
+  SUNLogInfo(ARK_LOGGER, "stiffness-switch",
+             "stiff = %i, h*rho = " SUN_FORMAT_G ", bound = " SUN_FORMAT_G,
+             !step_mem->stiff, step_mem->hrho, step_mem->stab_bound);
+
+  step_mem->stiff    = !step_mem->stiff;
+  step_mem->explicit = !step_mem->stiff;
+  step_mem->implicit = step_mem->stiff;
+  step_mem->nsuggest = 0;
+  step_mem->nagree   = 0;
+  step_mem->nswitches++;
+
+  /* treat the first implicit step like the first step of the integration so
+     the linear solver is set up with the current gamma */
+  if (step_mem->stiff) { ark_mem->firststage = SUNTRUE; }
+
+  return (ARK_SUCCESS);
+}
+
 /*------------------------------------------------------------------------------
   arkStep_SetInnerForcing
 
@@ -3960,8 +4329,7 @@ int arkStep_SetInnerForcing(ARKodeMem ark_mem, sunrealtype tshift,
  * be necessary to compute the delta_e estimate along the way with explicit
  * methods to avoid storing additional RHS or stage values.
  * ---------------------------------------------------------------------------*/
-int arkStep_RelaxDeltaE(ARKodeMem ark_mem, ARKRelaxJacFn relax_jac_fn,
-                        long int* num_relax_jac_evals, sunrealtype* delta_e_out)
+int arkStep_RelaxDeltaE(ARKodeMem ark_mem, sunrealtype* delta_e_out)
 {
   int i, j, nvec, retval;
   sunrealtype* cvals;
@@ -4006,6 +4374,7 @@ int arkStep_RelaxDeltaE(ARKodeMem ark_mem, ARKRelaxJacFn relax_jac_fn,
 
       for (j = 0; j < i; j++)
       {
+        if (step_mem->Be->A[i][j] == ZERO) { continue; }
         cvals[nvec] = ark_mem->h * step_mem->Be->A[i][j];
         Xvecs[nvec] = step_mem->Fe[j];
         nvec++;
@@ -4016,10 +4385,8 @@ int arkStep_RelaxDeltaE(ARKodeMem ark_mem, ARKRelaxJacFn relax_jac_fn,
     }
 
     /* Evaluate the Jacobian at z_i */
-    retval = relax_jac_fn(z_stage, J_relax, ark_mem->user_data);
-    (*num_relax_jac_evals)++;
-    if (retval < 0) { return ARK_RELAX_JAC_FAIL; }
-    if (retval > 0) { return ARK_RELAX_JAC_RECV; }
+    retval = arkRelaxJac(ark_mem, z_stage, J_relax);
+    if (retval) { return retval; }
 
     /* Reset temporary RHS alias */
     rhs_tmp = z_stage;
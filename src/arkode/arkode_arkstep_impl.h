@@ -48,6 +48,18 @@ extern "C" {
 /* #define NLSCOEF   SUN_RCONST(0.2)   */ /* CVODE constant */
 #define NLSCOEF SUN_RCONST(0.1)
 
+/* Stiffness switching: switch to the implicit table after STIFF_NSTEPS steps
+   in which h times the stiffness estimate is at least STIFF_RATIO times the
+   explicit stability bound and back after NONSTIFF_NSTEPS (fewer as implicit
+   steps are larger) steps in which it is at most NONSTIFF_RATIO times the
+   bound, the count is cleared after STIFF_NRESET steps that favor the current
+   table */
+#define STIFF_RATIO     SUN_RCONST(0.9)
+#define NONSTIFF_RATIO  SUN_RCONST(0.5)
+#define STIFF_NSTEPS    15
+#define NONSTIFF_NSTEPS 5
+#define STIFF_NRESET    6
+
 /* Mass matrix types */
 #define MASS_IDENTITY 0
 #define MASS_FIXED    1
@@ -166,6 +178,17 @@ typedef struct ARKodeARKStepMemRec
   sunrealtype* stage_times;  /* workspace for applying forcing */
   sunrealtype* stage_coefs;  /* workspace for applying forcing */
 
+  /* Data for stiffness detection and explicit/implicit table switching */
+  sunbooleantype stiff_switching; /* SUNTRUE if switching is enabled     */
+  sunbooleantype stiff;           /* SUNTRUE if using the implicit table */
+  N_Vector stiff_v;               /* power iteration vector              */
+  sunrealtype stab_bound;         /* ERK stability bound on real axis    */
+  sunrealtype hrho;               /* step size times stiffness estimate  */
+  long int hrho_nst;              /* step of the estimate (-1 if none)   */
+  int nsuggest;                   /* steps favoring the other table      */
+  int nagree;                     /* steps favoring the current table    */
+  long int nswitches;             /* num table switches                  */
+
 }* ARKodeARKStepMem;
 
 /*===============================================================
@@ -252,6 +275,9 @@ int arkStep_ComputeSolutions(ARKodeMem ark_mem, sunrealtype* dsm);
 int arkStep_ComputeSolutions_MassFixed(ARKodeMem ark_mem, sunrealtype* dsm);
 void arkStep_ApplyForcing(ARKodeARKStepMem step_mem, sunrealtype* stage_times,
                           sunrealtype* stage_coefs, int jmax, int* nvec);
+sunrealtype arkStep_StabilityBound(ARKodeButcherTable B, sunrealtype* g);
+int arkStep_StiffnessEstimate(ARKodeMem ark_mem);
+int arkStep_StiffnessSwitch(ARKodeMem ark_mem);
 
 /* private functions passed to nonlinear solver */
 int arkStep_NlsResidual_MassIdent(N_Vector zcor, N_Vector r, void* arkode_mem);
@@ -278,8 +304,7 @@ int arkStep_NlsConvTest(SUNNonlinearSolver NLS, N_Vector y, N_Vector del,
 
 /* private functions for relaxation */
 int arkStep_SetRelaxFn(ARKodeMem ark_mem, ARKRelaxFn rfn, ARKRelaxJacFn rjac);
-int arkStep_RelaxDeltaE(ARKodeMem ark_mem, ARKRelaxJacFn relax_jac_fn,
-                        long int* relax_jac_fn_evals, sunrealtype* delta_e_out);
+int arkStep_RelaxDeltaE(ARKodeMem ark_mem, sunrealtype* delta_e_out);
 int arkStep_GetOrder(ARKodeMem ark_mem);
 
 /* private functions for adjoints */
@@ -518,6 +518,54 @@ int ARKStepSetTableName(void* arkode_mem, const char* itable, const char* etable
   Exported optional output functions.
   ===============================================================*/
 
+/*---------------------------------------------------------------
+  ARKStepSetStiffnessSwitching:
+
+  Enables or disables automatic switching between the explicit
+  and implicit tables based on an estimate of the stiffness. The
+  problem must be given by a single RHS function, fi (or fe equal
+  to fi). Disabling switching reverts to implicit integration.
+  ---------------------------------------------------------------*/
+int ARKStepSetStiffnessSwitching(void* arkode_mem, sunbooleantype onoff)
+{
+  ARKodeMem ark_mem;
+  ARKodeARKStepMem step_mem;
+  int retval;
+
+  /* access ARKodeMem and ARKodeARKStepMem structures */
+  retval = arkStep_AccessARKODEStepMem(arkode_mem, __func__, &ark_mem, &step_mem);
+  if (retval != ARK_SUCCESS) { return (retval); }
+
+  if (!onoff)
+  {
+    if (!step_mem->stiff_switching) { return (ARK_SUCCESS); }
+    step_mem->stiff_switching = SUNFALSE;
+    step_mem->stiff           = SUNFALSE;
+    step_mem->fe              = NULL;
+    return (ARKStepSetImplicit(arkode_mem));
+  }
+
+  /* ensure that fi is defined and the same as fe (if set) */
+  if (step_mem->fi == NULL)
+  {
+    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    MSG_ARK_MISSING_FI);
+    return (ARK_ILL_INPUT);
+  }
+  if (step_mem->fe != NULL && step_mem->fe != step_mem->fi)
+  {
+    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "Stiffness switching requires a single RHS function");
+    return (ARK_ILL_INPUT);
+  }
+
+  /* both tables are set up and the active one is selected in each step */
+  step_mem->fe              = step_mem->fi;
+  step_mem->stiff_switching = SUNTRUE;
+
+  return (ARKStepSetImEx(arkode_mem));
+}
+
 /*---------------------------------------------------------------
   arkStep_GetNumRhsEvals:
 
@@ -592,6 +640,26 @@ int ARKStepGetCurrentButcherTables(void* arkode_mem, ARKodeButcherTable* Bi,
   return (ARK_SUCCESS);
 }
 
+/*---------------------------------------------------------------
+  ARKStepGetNumStiffnessSwitches:
+
+  Returns the number of switches between the explicit and
+  implicit tables.
+  ---------------------------------------------------------------*/
+int ARKStepGetNumStiffnessSwitches(void* arkode_mem, long int* nswitches)
+{
+  ARKodeMem ark_mem;
+  ARKodeARKStepMem step_mem;
+  int retval;
+
+  /* access ARKodeMem and ARKodeARKStepMem structures */
+  retval = arkStep_AccessARKODEStepMem(arkode_mem, __func__, &ark_mem, &step_mem);
+  if (retval != ARK_SUCCESS) { return (retval); }
+
+  *nswitches = step_mem->nswitches;
+  return (ARK_SUCCESS);
+}
+
 /*---------------------------------------------------------------
   ARKStepGetTimestepperStats:
 
@@ -711,6 +779,9 @@ int arkStep_SetDefaults(ARKodeMem ark_mem)
   step_mem->convfail = ARK_NO_FAILURES;
   step_mem->stage_predict = NULL; /* no user-supplied stage predictor */
 
+  /* Disable stiffness switching */
+  step_mem->stiff_switching = SUNFALSE;
+
   /* Remove pre-existing Butcher tables */
   if (step_mem->Be)
   {
@@ -1263,6 +1334,13 @@ int arkStep_PrintAllStats(ARKodeMem ark_mem, FILE* outfile, SUNOutputFormat fmt)
   sunfprintf_long(outfile, fmt, SUNFALSE, "Explicit RHS fn evals", step_mem->nfe);
   sunfprintf_long(outfile, fmt, SUNFALSE, "Implicit RHS fn evals", step_mem->nfi);
 
+  /* stiffness switching */
+  if (step_mem->stiff_switching)
+  {
+    sunfprintf_long(outfile, fmt, SUNFALSE, "Stiffness switches",
+                    step_mem->nswitches);
+  }
+
   /* nonlinear solver stats */
   sunfprintf_long(outfile, fmt, SUNFALSE, "NLS iters", step_mem->nls_iters);
   sunfprintf_long(outfile, fmt, SUNFALSE, "NLS fails", step_mem->nls_fails);
@@ -1353,6 +1431,10 @@ int arkStep_WriteParameters(ARKodeMem ark_mem, FILE* fp)
   }
   else if (step_mem->implicit) { fprintf(fp, "  Implicit integrator\n"); }
   else { fprintf(fp, "  Explicit integrator\n"); }
+  if (step_mem->stiff_switching)
+  {
+    fprintf(fp, "  Stiffness switching between explicit and implicit tables\n");
+  }
 
   if (step_mem->implicit)
   {
@@ -22,6 +22,7 @@
 
 #include "arkode_arkstep_impl.h"
 #include "arkode_impl.h"
+#include "sundials_utils.h"
 
 /*===============================================================
   Interface routines supplied to ARKODE
@@ -364,6 +365,7 @@ int arkStep_Nls(ARKodeMem ark_mem, int nflag)
   sunbooleantype callLSetup;
   long int nls_iters_inc = 0;
   long int nls_fails_inc = 0;
+  double t0              = 0.0;
   int retval;
 
   /* access ARKodeARKStepMem structure */
@@ -421,11 +423,18 @@ int arkStep_Nls(ARKodeMem ark_mem, int nflag)
   SUNLogInfo(ARK_LOGGER, "begin-nonlinear-solve", "tol = %.16g",
              step_mem->nlscoef);
 
+  if (ark_mem->telemetryfn) { t0 = sunWallTime(); }
+
   /* solve the nonlinear system for the actual correction */
   retval = SUNNonlinSolSolve(step_mem->NLS, step_mem->zpred, step_mem->zcor,
                              ark_mem->ewt, step_mem->nlscoef, callLSetup,
                              ark_mem);
 
+  if (ark_mem->telemetryfn)
+  {
+    ark_mem->telemetry.time_nls += sunWallTime() - t0;
+  }
+
   SUNLogExtraDebugVec(ARK_LOGGER, "correction", step_mem->zcor, "zcor(:) =");
 
   /* increment counters */
@@ -471,6 +480,7 @@ int arkStep_NlsLSetup(sunbooleantype jbad, sunbooleantype* jcur, void* arkode_me
   ARKodeMem ark_mem;
   ARKodeARKStepMem step_mem;
   int retval;
+  double t0 = 0.0;
 
   /* access ARKodeMem and ARKodeARKStepMem structures */
   retval = arkStep_AccessARKODEStepMem(arkode_mem, __func__, &ark_mem, &step_mem);
@@ -481,12 +491,19 @@ int arkStep_NlsLSetup(sunbooleantype jbad, sunbooleantype* jcur, void* arkode_me
 
   /* Use ARKODE's tempv1, tempv2 and tempv3 as
      temporary vectors for the linear solver setup routine */
+  if (ark_mem->telemetryfn) { t0 = sunWallTime(); }
+
   step_mem->nsetups++;
   retval = step_mem->lsetup(ark_mem, step_mem->convfail, ark_mem->tcur,
                             ark_mem->ycur, step_mem->Fi[step_mem->istage],
                             &(step_mem->jcur), ark_mem->tempv1, ark_mem->tempv2,
                             ark_mem->tempv3);
 
+  if (ark_mem->telemetryfn)
+  {
+    ark_mem->telemetry.time_lsetup += sunWallTime() - t0;
+  }
+
   /* update Jacobian status */
   *jcur = step_mem->jcur;
 
@@ -513,6 +530,7 @@ int arkStep_NlsLSolve(N_Vector b, void* arkode_mem)
   ARKodeMem ark_mem;
   ARKodeARKStepMem step_mem;
   int retval, nonlin_iter;
+  double t0 = 0.0;
 
   /* access ARKodeMem and ARKodeARKStepMem structures */
   retval = arkStep_AccessARKODEStepMem(arkode_mem, __func__, &ark_mem, &step_mem);
@@ -523,10 +541,17 @@ int arkStep_NlsLSolve(N_Vector b, void* arkode_mem)
   if (retval != SUN_SUCCESS) { return (ARK_NLS_OP_ERR); }
 
   /* call linear solver interface, and handle return value */
+  if (ark_mem->telemetryfn) { t0 = sunWallTime(); }
+
   retval = step_mem->lsolve(ark_mem, b, ark_mem->tcur, ark_mem->ycur,
                             step_mem->Fi[step_mem->istage], step_mem->eRNrm,
                             nonlin_iter);
 
+  if (ark_mem->telemetryfn)
+  {
+    ark_mem->telemetry.time_lsolve += sunWallTime() - t0;
+  }
+
   if (retval < 0) { return (ARK_LSOLVE_FAIL); }
   if (retval > 0) { return (CONV_FAIL); }
 
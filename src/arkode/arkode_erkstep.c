@@ -90,23 +90,24 @@ void* ERKStepCreate(ARKRhsFn f, sunrealtype t0, N_Vector y0, SUNContext sunctx)
   memset(step_mem, 0, sizeof(struct ARKodeERKStepMemRec));
 
   /* Attach step_mem structure and function pointers to ark_mem */
-  ark_mem->step_init                = erkStep_Init;
-  ark_mem->step_fullrhs             = erkStep_FullRHS;
-  ark_mem->step                     = erkStep_TakeStep;
-  ark_mem->step_printallstats       = erkStep_PrintAllStats;
-  ark_mem->step_writeparameters     = erkStep_WriteParameters;
-  ark_mem->step_resize              = erkStep_Resize;
-  ark_mem->step_free                = erkStep_Free;
-  ark_mem->step_printmem            = erkStep_PrintMem;
-  ark_mem->step_setdefaults         = erkStep_SetDefaults;
-  ark_mem->step_setrelaxfn          = erkStep_SetRelaxFn;
-  ark_mem->step_setorder            = erkStep_SetOrder;
-  ark_mem->step_getnumrhsevals      = erkStep_GetNumRhsEvals;
-  ark_mem->step_getestlocalerrors   = erkStep_GetEstLocalErrors;
-  ark_mem->step_setforcing          = erkStep_SetInnerForcing;
-  ark_mem->step_supports_adaptive   = SUNTRUE;
-  ark_mem->step_supports_relaxation = SUNTRUE;
-  ark_mem->step_mem                 = (void*)step_mem;
+  ark_mem->step_init                  = erkStep_Init;
+  ark_mem->step_fullrhs               = erkStep_FullRHS;
+  ark_mem->step                       = erkStep_TakeStep;
+  ark_mem->step_printallstats         = erkStep_PrintAllStats;
+  ark_mem->step_writeparameters       = erkStep_WriteParameters;
+  ark_mem->step_resize                = erkStep_Resize;
+  ark_mem->step_free                  = erkStep_Free;
+  ark_mem->step_printmem              = erkStep_PrintMem;
+  ark_mem->step_setdefaults           = erkStep_SetDefaults;
+  ark_mem->step_setrelaxfn            = erkStep_SetRelaxFn;
+  ark_mem->step_setorder              = erkStep_SetOrder;
+  ark_mem->step_setusecompensatedsums = arkSetUseCompensatedSums;
+  ark_mem->step_getnumrhsevals        = erkStep_GetNumRhsEvals;
+  ark_mem->step_getestlocalerrors     = erkStep_GetEstLocalErrors;
+  ark_mem->step_setforcing            = erkStep_SetInnerForcing;
+  ark_mem->step_supports_adaptive     = SUNTRUE;
+  ark_mem->step_supports_relaxation   = SUNTRUE;
+  ark_mem->step_mem                   = (void*)step_mem;
 
   /* Set default values for optional inputs */
   retval = erkStep_SetDefaults((void*)ark_mem);
@@ -822,6 +823,7 @@ int erkStep_TakeStep(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPtr)
     nvec = 0;
     for (js = 0; js < is; js++)
     {
+      if (step_mem->B->A[is][js] == ZERO) { continue; }
       cvals[nvec] = ark_mem->h * step_mem->B->A[is][js];
       Xvecs[nvec] = step_mem->F[js];
       nvec += 1;
@@ -1439,12 +1441,23 @@ int erkStep_ComputeSolutions(ARKodeMem ark_mem, sunrealtype* dsmPtr)
   nvec = 0;
   for (j = 0; j < step_mem->stages; j++)
   {
+    if (step_mem->B->b[j] == ZERO) { continue; }
     cvals[nvec] = ark_mem->h * step_mem->B->b[j];
     Xvecs[nvec] = step_mem->F[j];
     nvec += 1;
   }
-  cvals[nvec] = ONE;
-  Xvecs[nvec] = ark_mem->yn;
+  /*   with compensated summation the increment (less the running
+       correction) is formed and added to yn separately */
+  if (ark_mem->ycomp != NULL)
+  {
+    cvals[nvec] = -ONE;
+    Xvecs[nvec] = ark_mem->ycomp;
+  }
+  else
+  {
+    cvals[nvec] = ONE;
+    Xvecs[nvec] = ark_mem->yn;
+  }
   nvec += 1;
 
   /* apply external polynomial forcing */
@@ -1460,7 +1473,13 @@ int erkStep_ComputeSolutions(ARKodeMem ark_mem, sunrealtype* dsmPtr)
   }
 
   /*   call fused vector operation to do the work */
-  retval = N_VLinearCombination(nvec, cvals, Xvecs, y);
+  if (ark_mem->ycomp != NULL)
+  {
+    retval = N_VLinearCombination(nvec, cvals, Xvecs, ark_mem->tempv2);
+    if (retval != 0) { return (ARK_VECTOROP_ERR); }
+    retval = arkCompensatedUpdate(ark_mem, ark_mem->tempv2);
+  }
+  else { retval = N_VLinearCombination(nvec, cvals, Xvecs, y); }
   if (retval != 0) { return (ARK_VECTOROP_ERR); }
 
   /* Compute yerr (if step adaptivity or error accumulation enabled) */
@@ -1470,6 +1489,7 @@ int erkStep_ComputeSolutions(ARKodeMem ark_mem, sunrealtype* dsmPtr)
     nvec = 0;
     for (j = 0; j < step_mem->stages; j++)
     {
+      if (step_mem->B->b[j] == step_mem->B->d[j]) { continue; }
       cvals[nvec] = ark_mem->h * (step_mem->B->b[j] - step_mem->B->d[j]);
       Xvecs[nvec] = step_mem->F[j];
       nvec += 1;
@@ -1489,8 +1509,13 @@ int erkStep_ComputeSolutions(ARKodeMem ark_mem, sunrealtype* dsmPtr)
     }
 
     /* call fused vector operation to do the work */
-    retval = N_VLinearCombination(nvec, cvals, Xvecs, yerr);
-    if (retval != 0) { return (ARK_VECTOROP_ERR); }
+    /*   (all terms vanish if the embedding matches the method weights) */
+    if (nvec > 0)
+    {
+      retval = N_VLinearCombination(nvec, cvals, Xvecs, yerr);
+      if (retval != 0) { return (ARK_VECTOROP_ERR); }
+    }
+    else { N_VConst(ZERO, yerr); }
 
     /* fill error norm */
     *dsmPtr = N_VWrmsNorm(yerr, ark_mem->ewt);
@@ -1509,8 +1534,7 @@ int erkStep_ComputeSolutions(ARKodeMem ark_mem, sunrealtype* dsmPtr)
  * Computes the change in the relaxation functions for use in relaxation methods
  * delta_e = h * sum_i b_i * <rjac(z_i), f_i>
  * ---------------------------------------------------------------------------*/
-int erkStep_RelaxDeltaE(ARKodeMem ark_mem, ARKRelaxJacFn relax_jac_fn,
-                        long int* num_relax_jac_evals, sunrealtype* delta_e_out)
+int erkStep_RelaxDeltaE(ARKodeMem ark_mem, sunrealtype* delta_e_out)
 {
   int i, j, nvec, retval;
   sunrealtype* cvals;
@@ -1546,6 +1570,7 @@ int erkStep_RelaxDeltaE(ARKodeMem ark_mem, ARKRelaxJacFn relax_jac_fn,
 
     for (j = 0; j < i; j++)
     {
+      if (step_mem->B->A[i][j] == ZERO) { continue; }
       cvals[nvec] = ark_mem->h * step_mem->B->A[i][j];
       Xvecs[nvec] = step_mem->F[j];
       nvec++;
@@ -1555,10 +1580,8 @@ int erkStep_RelaxDeltaE(ARKodeMem ark_mem, ARKRelaxJacFn relax_jac_fn,
     if (retval) { return ARK_VECTOROP_ERR; }
 
     /* Evaluate the Jacobian at z_i */
-    retval = relax_jac_fn(z_stage, J_relax, ark_mem->user_data);
-    (*num_relax_jac_evals)++;
-    if (retval < 0) { return ARK_RELAX_JAC_FAIL; }
-    if (retval > 0) { return ARK_RELAX_JAC_RECV; }
+    retval = arkRelaxJac(ark_mem, z_stage, J_relax);
+    if (retval) { return retval; }
 
     /* Update estimates */
     if (J_relax->ops->nvdotprodlocal && J_relax->ops->nvdotprodmultiallreduce)
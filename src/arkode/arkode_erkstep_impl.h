@@ -115,8 +115,7 @@ void erkStep_ApplyForcing(ARKodeERKStepMem step_mem, sunrealtype* stage_times,
 
 /* private functions for relaxation */
 int erkStep_SetRelaxFn(ARKodeMem ark_mem, ARKRelaxFn rfn, ARKRelaxJacFn rjac);
-int erkStep_RelaxDeltaE(ARKodeMem ark_mem, ARKRelaxJacFn relax_jac_fn,
-                        long int* relax_jac_fn_evals, sunrealtype* delta_e_out);
+int erkStep_RelaxDeltaE(ARKodeMem ark_mem, sunrealtype* delta_e_out);
 int erkStep_GetOrder(ARKodeMem ark_mem);
 
 /* private functions for adjoints */
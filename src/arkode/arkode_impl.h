@@ -57,6 +57,22 @@ extern "C" {
   MACROS
   ===============================================================*/
 
+/* Macro for the OpenMP directives used by SplittingStep and PararealStep to
+   evolve SUNSteppers concurrently. The profiler and logger are not thread
+   safe, so concurrent evaluation is disabled when profiling or when the
+   steppers may log informational output. The error handlers and the last
+   error of a SUNContext are not thread safe either, so SUNSteppers evolved
+   at the same time must not share a SUNContext (see
+   arkStepperContextsShared) and errors are only reported after the parallel
+   region, from the return codes collected by each thread. */
+#if defined(_OPENMP) && !defined(SUNDIALS_BUILD_WITH_PROFILING) && \
+  SUNDIALS_LOGGING_LEVEL < SUNDIALS_LOGGING_INFO
+#define ARK_CONCURRENT
+#define ARK_OMP_PRAGMA(x) _Pragma(#x)
+#else
+#define ARK_OMP_PRAGMA(x)
+#endif
+
 /* TODO(DJG): replace with signbit when C99+ is required */
 #define DIFFERENT_SIGN(a, b) (((a) < 0 && (b) > 0) || ((a) > 0 && (b) < 0))
 #define SAME_SIGN(a, b)      (((a) > 0 && (b) > 0) || ((a) < 0 && (b) < 0))
@@ -228,6 +244,8 @@ typedef int (*ARKTimestepGetNumRhsEvals)(ARKodeMem ark_mem, int partition_index,
                                          long int* num_rhs_evals);
 typedef int (*ARKTimestepSetStepDirection)(ARKodeMem ark_mem,
                                            sunrealtype stepdir);
+typedef int (*ARKTimestepSetUseCompensatedSums)(ARKodeMem ark_mem,
+                                                sunbooleantype onoff);
 
 /* time stepper interface functions -- temporal adaptivity */
 typedef int (*ARKTimestepGetEstLocalErrors)(ARKodeMem ark_mem, N_Vector ele);
@@ -418,6 +436,7 @@ struct ARKodeMemRec
   ARKTimestepSetOrder step_setorder;
   ARKTimestepGetNumRhsEvals step_getnumrhsevals;
   ARKTimestepSetStepDirection step_setstepdirection;
+  ARKTimestepSetUseCompensatedSums step_setusecompensatedsums;
 
   /* Time stepper module -- temporal adaptivity */
   sunbooleantype step_supports_adaptive;
@@ -527,6 +546,7 @@ struct ARKodeMemRec
   long int ncfn;         /* num corrector convergence failures         */
   long int netf;         /* num error test failures                    */
   long int nconstrfails; /* number of constraint failures              */
+  long int nfe_reused;   /* num full RHS evaluations avoided by reuse  */
 
   /* Space requirements for ARKODE */
   sunindextype lrw1; /* no. of sunrealtype words in 1 N_Vector          */
@@ -566,7 +586,24 @@ struct ARKodeMemRec
   /* User-supplied stage solution post-processing function */
   ARKPostProcessFn ProcessStage;
 
+  /* User-supplied solution output function */
+  ARKOutputFn OutputFn;
+  void* out_data;      /* pointer to user_data                     */
+  sunrealtype out_t0;  /* first time in the output grid            */
+  sunrealtype out_dt;  /* output grid spacing (0 = no grid output) */
+  long int out_idx;    /* index of the next grid time to output    */
+  long int out_nsteps; /* output every out_nsteps steps (0 = off)  */
+  N_Vector ysink;      /* interpolated solution passed to OutputFn */
+
+  /* User-supplied per-step telemetry function */
+  SUNStepTelemetryFn telemetryfn;
+  SUNStepTelemetry telemetry; /* record for the current step attempt */
+
+  /* Compensated summation data, the corrections are only allocated by time
+     steppers that call arkCompensatedUpdate */
   sunbooleantype use_compensated_sums;
+  N_Vector ycomp;     /* running correction to yn                      */
+  N_Vector ycomp_new; /* correction to ycur, committed on step success */
 
   /* Adjoint solver data */
   sunbooleantype load_checkpoint_fail;
@@ -644,7 +681,10 @@ int arkHin(ARKodeMem ark_mem, sunrealtype tout);
 sunrealtype arkUpperBoundH0(ARKodeMem ark_mem, sunrealtype tdist);
 int arkYddNorm(ARKodeMem ark_mem, sunrealtype hg, sunrealtype* yddnrm);
 
+int arkSetUseCompensatedSums(ARKodeMem ark_mem, sunbooleantype onoff);
+int arkCompensatedUpdate(ARKodeMem ark_mem, N_Vector dy);
 int arkCompleteStep(ARKodeMem ark_mem, sunrealtype dsm);
+int arkOutputStep(ARKodeMem ark_mem);
 int arkHandleFailure(ARKodeMem ark_mem, int flag);
 
 int arkEwtSetSS(N_Vector ycur, N_Vector weight, void* arkode_mem);
@@ -663,6 +703,10 @@ int arkCheckConvergence(ARKodeMem ark_mem, int* nflagPtr, int* ncfPtr);
 int arkCheckConstraints(ARKodeMem ark_mem, int* nflag, int* constrfails);
 int arkCheckTemporalError(ARKodeMem ark_mem, int* nflagPtr, int* nefPtr,
                           sunrealtype dsm);
+void arkTelemetryBegin(ARKodeMem ark_mem, int attempt);
+void arkTelemetryEnd(ARKodeMem ark_mem, SUNStepOutcome outcome,
+                     sunrealtype dsm);
+void arkLsTelemetryCounters(ARKodeMem ark_mem, long int* nli, long int* nje);
 int arkAccessHAdaptMem(void* arkode_mem, const char* fname, ARKodeMem* ark_mem,
                        ARKodeHAdaptMem* hadapt_mem);
 
@@ -689,6 +733,8 @@ int ark_MRIStepInnerSetRTol(MRIStepInnerStepper stepper, sunrealtype rtol);
 
 /* utility functions for wrapping ARKODE as a SUNStepper */
 SUNErrCode arkSUNStepperSelfDestruct(SUNStepper stepper);
+sunbooleantype arkStepperContextsShared(SUNStepper* a, int na, SUNStepper* b,
+                                        int nb);
 
 /* XBraid interface functions */
 int arkSetForcePass(void* arkode_mem, sunbooleantype force_pass);
@@ -806,6 +852,9 @@ int arkGetLastKFlag(void* arkode_mem, int* last_kflag);
 #define MSG_ARK_POSTPROCESS_STAGE_FAIL \
   "At " MSG_TIME                       \
   ", the stage postprocessing routine failed in an unrecoverable manner."
+#define MSG_ARK_OUTPUT_FN_FAIL \
+  "At " MSG_TIME               \
+  ", the solution output function failed in an unrecoverable manner."
 #define MSG_ARK_NULL_SUNCTX "sunctx = NULL illegal."
 #define MSG_ARK_CONTEXT_MISMATCH \
   "Outer and inner steppers have different contexts."
@@ -1232,6 +1281,15 @@ int arkGetLastKFlag(void* arkode_mem, int* last_kflag);
   requested method order parameter that was passed to
   ARKodeSetOrder.
 
+  ---------------------------------------------------------------
+
+  ARKTimestepSetUseCompensatedSums
+
+  This optional routine is called by ARKodeSetUseCompensatedSums
+  and should only be provided if the stepper forms the step
+  solution with compensated summation when requested, e.g., by
+  calling arkCompensatedUpdate.
+
   ===============================================================
 
   Internal Interface to Time Steppers -- Temporal Adaptivity
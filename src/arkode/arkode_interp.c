@@ -144,6 +144,10 @@ ARKInterp arkInterpCreate_Hermite(ARKodeMem ark_mem, int degree)
   content->fa   = NULL;
   content->fb   = NULL;
 
+  /* higher-order RHS samples have not been computed */
+  content->fa_current = SUNFALSE;
+  content->fb_current = SUNFALSE;
+
   /* set maximum interpolant degree */
   content->degree = SUNMIN(ARK_INTERP_MAX_DEGREE, degree);
 
@@ -201,6 +205,10 @@ int arkInterpResize_Hermite(ARKodeMem ark_mem, ARKInterp interp,
   HINT_TNEW(interp) = ark_mem->tcur;
   HINT_H(interp)    = SUN_RCONST(0.0);
 
+  /* invalidate higher-order RHS samples */
+  HINT_FA_CUR(interp) = SUNFALSE;
+  HINT_FB_CUR(interp) = SUNFALSE;
+
   return (ARK_SUCCESS);
 }
 
@@ -312,6 +320,10 @@ int arkInterpSetDegree_Hermite(ARKodeMem ark_mem, ARKInterp interp, int degree)
 
   HINT_DEGREE(interp) = degree;
 
+  /* invalidate higher-order RHS samples */
+  HINT_FA_CUR(interp) = SUNFALSE;
+  HINT_FB_CUR(interp) = SUNFALSE;
+
   return ARK_SUCCESS;
 }
 
@@ -332,6 +344,10 @@ int arkInterpInit_Hermite(ARKodeMem ark_mem, ARKInterp interp, sunrealtype tnew)
   HINT_TNEW(interp) = tnew;
   HINT_H(interp)    = SUN_RCONST(0.0);
 
+  /* invalidate higher-order RHS samples */
+  HINT_FA_CUR(interp) = SUNFALSE;
+  HINT_FB_CUR(interp) = SUNFALSE;
+
   /* allocate vectors based on interpolant degree */
   if (HINT_FOLD(interp) == NULL)
   {
@@ -402,6 +418,10 @@ int arkInterpUpdate_Hermite(ARKodeMem ark_mem, ARKInterp interp, sunrealtype tne
   HINT_TNEW(interp) = tnew;
   HINT_H(interp)    = ark_mem->h;
 
+  /* invalidate higher-order RHS samples from the previous interval */
+  HINT_FA_CUR(interp) = SUNFALSE;
+  HINT_FB_CUR(interp) = SUNFALSE;
+
   /* return with success */
   return (ARK_SUCCESS);
 }
@@ -575,16 +595,22 @@ int arkInterpEvaluate_Hermite(ARKodeMem ark_mem, ARKInterp interp,
 
   case (4): /* quartic interpolant */
 
-    /* first, evaluate cubic interpolant at tau=-1/3 */
-    tval   = -ONE / THREE;
-    retval = arkInterpEvaluate(ark_mem, interp, tval, 0, 3, yout);
-    if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
-
-    /* second, evaluate RHS at tau=-1/3, storing the result in fa */
-    tval   = HINT_TNEW(interp) - h / THREE;
-    retval = ark_mem->step_fullrhs(ark_mem, tval, yout, HINT_FA(interp),
-                                   ARK_FULLRHS_OTHER);
-    if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
+    /* fa depends only on the interval [told,tnew], reuse it if possible */
+    if (HINT_FA_CUR(interp)) { ark_mem->nfe_reused++; }
+    else
+    {
+      /* first, evaluate cubic interpolant at tau=-1/3 */
+      tval   = -ONE / THREE;
+      retval = arkInterpEvaluate(ark_mem, interp, tval, 0, 3, yout);
+      if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
+
+      /* second, evaluate RHS at tau=-1/3, storing the result in fa */
+      tval   = HINT_TNEW(interp) - h / THREE;
+      retval = ark_mem->step_fullrhs(ark_mem, tval, yout, HINT_FA(interp),
+                                     ARK_FULLRHS_OTHER);
+      if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
+      HINT_FA_CUR(interp) = SUNTRUE;
+    }
 
     /* evaluate desired function */
     if (d == 0)
@@ -645,27 +671,24 @@ int arkInterpEvaluate_Hermite(ARKodeMem ark_mem, ARKInterp interp,
 
   case (5): /* quintic interpolant */
 
-    /* first, evaluate quartic interpolant at tau=-1/3 */
-    tval   = -ONE / THREE;
-    retval = arkInterpEvaluate(ark_mem, interp, tval, 0, 4, yout);
-    if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
-
-    /* second, evaluate RHS at tau=-1/3, storing the result in fa */
-    tval   = HINT_TNEW(interp) - h / THREE;
-    retval = ark_mem->step_fullrhs(ark_mem, tval, yout, HINT_FA(interp),
-                                   ARK_FULLRHS_OTHER);
-    if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
-
-    /* third, evaluate quartic interpolant at tau=-2/3 */
-    tval   = -TWO / THREE;
-    retval = arkInterpEvaluate(ark_mem, interp, tval, 0, 4, yout);
-    if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
-
-    /* fourth, evaluate RHS at tau=-2/3, storing the result in fb */
-    tval   = HINT_TNEW(interp) - h * TWO / THREE;
-    retval = ark_mem->step_fullrhs(ark_mem, tval, yout, HINT_FB(interp),
-                                   ARK_FULLRHS_OTHER);
-    if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
+    /* The quintic interpolant shares fa with the quartic interpolant and adds
+       fb, an RHS sample at tau=-2/3. Both depend only on [told,tnew], so they
+       are reused until the interpolation data is updated. */
+    if (HINT_FB_CUR(interp)) { ark_mem->nfe_reused += 2; }
+    else
+    {
+      /* first, evaluate quartic interpolant at tau=-2/3 (this fills fa) */
+      tval   = -TWO / THREE;
+      retval = arkInterpEvaluate(ark_mem, interp, tval, 0, 4, yout);
+      if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
+
+      /* second, evaluate RHS at tau=-2/3, storing the result in fb */
+      tval   = HINT_TNEW(interp) - h * TWO / THREE;
+      retval = ark_mem->step_fullrhs(ark_mem, tval, yout, HINT_FB(interp),
+                                     ARK_FULLRHS_OTHER);
+      if (retval != 0) { return (ARK_RHSFUNC_FAIL); }
+      HINT_FB_CUR(interp) = SUNTRUE;
+    }
 
     /* evaluate desired function */
     if (d == 0)
@@ -45,14 +45,16 @@ extern "C" {
 
 struct _ARKInterpContent_Hermite
 {
-  int degree;       /* maximum interpolant degree to use           */
-  N_Vector fold;    /* f(t,y) at beginning of last successful step */
-  N_Vector yold;    /* y at beginning of last successful step      */
-  N_Vector fa;      /* f(t,y) used in higher-order interpolation   */
-  N_Vector fb;      /* f(t,y) used in higher-order interpolation   */
-  sunrealtype told; /* t at beginning of last successful step      */
-  sunrealtype tnew; /* t at end of last successful step            */
-  sunrealtype h;    /* last successful step size                   */
+  int degree;                /* maximum interpolant degree to use           */
+  N_Vector fold;             /* f(t,y) at beginning of last successful step */
+  N_Vector yold;             /* y at beginning of last successful step      */
+  N_Vector fa;               /* f(t,y) used in higher-order interpolation   */
+  N_Vector fb;               /* f(t,y) used in higher-order interpolation   */
+  sunrealtype told;          /* t at beginning of last successful step      */
+  sunrealtype tnew;          /* t at end of last successful step            */
+  sunrealtype h;             /* last successful step size                   */
+  sunbooleantype fa_current; /* fa is current for the interval [told,tnew]  */
+  sunbooleantype fb_current; /* fb is current for the interval [told,tnew]  */
 };
 
 typedef struct _ARKInterpContent_Hermite* ARKInterpContent_Hermite;
@@ -68,6 +70,8 @@ typedef struct _ARKInterpContent_Hermite* ARKInterpContent_Hermite;
 #define HINT_TOLD(I)    (HINT_CONTENT(I)->told)
 #define HINT_TNEW(I)    (HINT_CONTENT(I)->tnew)
 #define HINT_H(I)       (HINT_CONTENT(I)->h)
+#define HINT_FA_CUR(I)  (HINT_CONTENT(I)->fa_current)
+#define HINT_FB_CUR(I)  (HINT_CONTENT(I)->fb_current)
 
 /* Hermite structure operations */
 
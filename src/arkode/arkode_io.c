@@ -55,6 +55,10 @@ int ARKodeSetDefaults(void* arkode_mem)
   }
   ark_mem = (ARKodeMem)arkode_mem;
 
+  /* Free any compensated summation corrections */
+  arkFreeVec(ark_mem, &ark_mem->ycomp);
+  arkFreeVec(ark_mem, &ark_mem->ycomp_new);
+
   /* Set default values for integrator optional inputs */
   ark_mem->use_compensated_sums = SUNFALSE;
   ark_mem->fixedstep            = SUNFALSE; /* default to use adaptive steps */
@@ -873,6 +877,9 @@ int ARKodeSetUserData(void* arkode_mem, void* user_data)
   /* Set data for post-processing a step */
   if (ark_mem->ProcessStep != NULL) { ark_mem->ps_data = user_data; }
 
+  /* Set data for solution output */
+  if (ark_mem->OutputFn != NULL) { ark_mem->out_data = user_data; }
+
   /* Set user data into stepper (if provided) */
   if (ark_mem->step_setuserdata)
   {
@@ -1418,6 +1425,39 @@ int ARKodeSetStepDirection(void* arkode_mem, sunrealtype stepdir)
   return ARK_SUCCESS;
 }
 
+/*---------------------------------------------------------------
+  ARKodeSetUseCompensatedSums:
+
+  Turns on/off compensated (Kahan) summation of the step solution
+  and time updates. This reduces the accumulation of roundoff in
+  very long integrations, at the cost of additional vector
+  operations and storage.
+  ---------------------------------------------------------------*/
+int ARKodeSetUseCompensatedSums(void* arkode_mem, sunbooleantype onoff)
+{
+  ARKodeMem ark_mem;
+  if (arkode_mem == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return (ARK_MEM_NULL);
+  }
+  ark_mem = (ARKodeMem)arkode_mem;
+
+  /* Call stepper routine (if provided) */
+  if (ark_mem->step_setusecompensatedsums)
+  {
+    return (ark_mem->step_setusecompensatedsums(ark_mem, onoff));
+  }
+  else
+  {
+    arkProcessError(ark_mem, ARK_STEPPER_UNSUPPORTED, __LINE__, __func__,
+                    __FILE__,
+                    "time-stepping module does not support this function");
+    return (ARK_STEPPER_UNSUPPORTED);
+  }
+}
+
 /*---------------------------------------------------------------
   ARKodeSetRootDirection:
 
@@ -1486,6 +1526,145 @@ int ARKodeSetNoInactiveRootWarn(void* arkode_mem)
   return (ARK_SUCCESS);
 }
 
+/*---------------------------------------------------------------
+  ARKodeSetRootSubsetFn:
+
+  Specifies an optional function that evaluates only the root
+  functions flagged in a mask.  When supplied, ARKODE only
+  evaluates the root functions that bracket a root while
+  locating it, and those that may have changed sign in a step
+  when bounds on their rate of change are given with
+  ARKodeSetRootRateBounds.  A NULL input disables the subset
+  evaluations.
+  ---------------------------------------------------------------*/
+int ARKodeSetRootSubsetFn(void* arkode_mem, ARKRootSubsetFn gsub)
+{
+  ARKodeMem ark_mem;
+  ARKodeRootMem ark_root_mem;
+  int i;
+
+  if (arkode_mem == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return (ARK_MEM_NULL);
+  }
+  ark_mem = (ARKodeMem)arkode_mem;
+  if (ark_mem->root_mem == NULL)
+  {
+    arkProcessError(ark_mem, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return (ARK_MEM_NULL);
+  }
+  ark_root_mem = (ARKodeRootMem)ark_mem->root_mem;
+
+  if (ark_root_mem->nrtfn == 0)
+  {
+    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_ROOT);
+    return (ARK_ILL_INPUT);
+  }
+
+  /* Allocate the evaluation mask and the times of the last evaluation of
+     each function, the latter are set so the first check evaluates all
+     functions */
+  if (gsub != NULL && ark_root_mem->gmask == NULL)
+  {
+    ark_root_mem->gmask =
+      (sunbooleantype*)malloc(ark_root_mem->nrtfn * sizeof(sunbooleantype));
+    ark_root_mem->gtime =
+      (sunrealtype*)malloc(ark_root_mem->nrtfn * sizeof(sunrealtype));
+    if (ark_root_mem->gmask == NULL || ark_root_mem->gtime == NULL)
+    {
+      free(ark_root_mem->gmask);
+      ark_root_mem->gmask = NULL;
+      free(ark_root_mem->gtime);
+      ark_root_mem->gtime = NULL;
+      arkProcessError(ark_mem, ARK_MEM_FAIL, __LINE__, __func__, __FILE__,
+                      MSG_ARK_MEM_FAIL);
+      return (ARK_MEM_FAIL);
+    }
+    for (i = 0; i < ark_root_mem->nrtfn; i++)
+    {
+      ark_root_mem->gmask[i] = SUNTRUE;
+      ark_root_mem->gtime[i] = -SUN_BIG_REAL;
+    }
+    ark_mem->liw += ark_root_mem->nrtfn;
+    ark_mem->lrw += ark_root_mem->nrtfn;
+  }
+
+  ark_root_mem->gsub = gsub;
+  return (ARK_SUCCESS);
+}
+
+/*---------------------------------------------------------------
+  ARKodeSetRootRateBounds:
+
+  Specifies bounds on the magnitude of the time derivative of
+  each root function, a negative value indicates the function
+  has no bound.  With a subset function, a root function is only
+  evaluated at the end of a step if its bound allows it to
+  change sign since its last evaluation.  A NULL input removes
+  the bounds.
+  ---------------------------------------------------------------*/
+int ARKodeSetRootRateBounds(void* arkode_mem, const sunrealtype* gdotmax)
+{
+  ARKodeMem ark_mem;
+  ARKodeRootMem ark_root_mem;
+  int i;
+
+  if (arkode_mem == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return (ARK_MEM_NULL);
+  }
+  ark_mem = (ARKodeMem)arkode_mem;
+  if (ark_mem->root_mem == NULL)
+  {
+    arkProcessError(ark_mem, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return (ARK_MEM_NULL);
+  }
+  ark_root_mem = (ARKodeRootMem)ark_mem->root_mem;
+
+  if (ark_root_mem->nrtfn == 0)
+  {
+    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_ROOT);
+    return (ARK_ILL_INPUT);
+  }
+
+  if (gdotmax == NULL)
+  {
+    if (ark_root_mem->gdotmax != NULL)
+    {
+      free(ark_root_mem->gdotmax);
+      ark_root_mem->gdotmax = NULL;
+      ark_mem->lrw -= ark_root_mem->nrtfn;
+    }
+    return (ARK_SUCCESS);
+  }
+
+  if (ark_root_mem->gdotmax == NULL)
+  {
+    ark_root_mem->gdotmax =
+      (sunrealtype*)malloc(ark_root_mem->nrtfn * sizeof(sunrealtype));
+    if (ark_root_mem->gdotmax == NULL)
+    {
+      arkProcessError(ark_mem, ARK_MEM_FAIL, __LINE__, __func__, __FILE__,
+                      MSG_ARK_MEM_FAIL);
+      return (ARK_MEM_FAIL);
+    }
+    ark_mem->lrw += ark_root_mem->nrtfn;
+  }
+  for (i = 0; i < ark_root_mem->nrtfn; i++)
+  {
+    ark_root_mem->gdotmax[i] = gdotmax[i];
+  }
+  return (ARK_SUCCESS);
+}
+
 /*---------------------------------------------------------------
   ARKodeSetPostprocessStepFn:
 
@@ -1550,6 +1729,124 @@ int ARKodeSetPostprocessStageFn(void* arkode_mem, ARKPostProcessFn ProcessStage)
   return (ARK_SUCCESS);
 }
 
+/*---------------------------------------------------------------
+  ARKodeSetOutputFn:
+
+  Specifies a user-provided solution output function having type
+  ARKOutputFn.  The function is called from within ARKodeEvolve
+  at the times requested with ARKodeSetOutputTimes and/or every
+  nsteps steps as requested with ARKodeSetOutputStepInterval.  A
+  NULL input function disables solution output.
+
+  The vector passed to the output function is owned by ARKODE and
+  is only valid for the duration of the call; it must not be
+  modified.
+  ---------------------------------------------------------------*/
+int ARKodeSetOutputFn(void* arkode_mem, ARKOutputFn OutputFn)
+{
+  ARKodeMem ark_mem;
+  if (arkode_mem == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return (ARK_MEM_NULL);
+  }
+  ark_mem = (ARKodeMem)arkode_mem;
+
+  /* NULL argument sets default, otherwise set inputs */
+  ark_mem->OutputFn = OutputFn;
+  ark_mem->out_data = ark_mem->user_data;
+
+  return (ARK_SUCCESS);
+}
+
+/*---------------------------------------------------------------
+  ARKodeSetStepTelemetryFn:
+
+  Specifies a user-provided function that is called after each
+  step attempt with the per-step telemetry record.  A NULL input
+  function disables telemetry.
+  ---------------------------------------------------------------*/
+int ARKodeSetStepTelemetryFn(void* arkode_mem, SUNStepTelemetryFn fn)
+{
+  ARKodeMem ark_mem;
+  if (arkode_mem == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return (ARK_MEM_NULL);
+  }
+  ark_mem = (ARKodeMem)arkode_mem;
+
+  ark_mem->telemetryfn = fn;
+
+  return (ARK_SUCCESS);
+}
+
+/*---------------------------------------------------------------
+  ARKodeSetOutputTimes:
+
+  Requests solution output at the times tout0 + i*dtout for
+  i = 0, 1, 2, ...  The sign of dtout must match the direction of
+  integration.  A zero dtout disables output on a time grid.
+  ---------------------------------------------------------------*/
+int ARKodeSetOutputTimes(void* arkode_mem, sunrealtype tout0, sunrealtype dtout)
+{
+  ARKodeMem ark_mem;
+  if (arkode_mem == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return (ARK_MEM_NULL);
+  }
+  ark_mem = (ARKodeMem)arkode_mem;
+
+  /* A zero spacing disables grid output and frees the output vector */
+  if (dtout == ZERO)
+  {
+    arkFreeVec(ark_mem, &ark_mem->ysink);
+    ark_mem->out_t0  = ZERO;
+    ark_mem->out_dt  = ZERO;
+    ark_mem->out_idx = 0;
+    return (ARK_SUCCESS);
+  }
+
+  /* Allocate the vector to hold interpolated outputs (if necessary) */
+  if (!arkAllocVec(ark_mem, ark_mem->yn, &ark_mem->ysink))
+  {
+    return (ARK_MEM_FAIL);
+  }
+
+  ark_mem->out_t0  = tout0;
+  ark_mem->out_dt  = dtout;
+  ark_mem->out_idx = 0;
+
+  return (ARK_SUCCESS);
+}
+
+/*---------------------------------------------------------------
+  ARKodeSetOutputStepInterval:
+
+  Requests solution output after every nsteps successful steps.
+  A non-positive input disables output based on the step count.
+  ---------------------------------------------------------------*/
+int ARKodeSetOutputStepInterval(void* arkode_mem, long int nsteps)
+{
+  ARKodeMem ark_mem;
+  if (arkode_mem == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return (ARK_MEM_NULL);
+  }
+  ark_mem = (ARKodeMem)arkode_mem;
+
+  /* Non-positive argument disables step-based output */
+  ark_mem->out_nsteps = (nsteps > 0) ? nsteps : 0;
+
+  return (ARK_SUCCESS);
+}
+
 /*---------------------------------------------------------------
   ARKodeSetConstraints:
 
@@ -2736,6 +3033,27 @@ int ARKodeGetNumConstrFails(void* arkode_mem, long int* nconstrfails)
   return (ARK_SUCCESS);
 }
 
+/*---------------------------------------------------------------
+  ARKodeGetNumRhsEvalsReused:
+
+  Returns the current number of full RHS evaluations that were
+  avoided by reusing previously computed values
+  ---------------------------------------------------------------*/
+int ARKodeGetNumRhsEvalsReused(void* arkode_mem, long int* nfe_reused)
+{
+  ARKodeMem ark_mem;
+  if (arkode_mem == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return (ARK_MEM_NULL);
+  }
+  ark_mem = (ARKodeMem)arkode_mem;
+
+  *nfe_reused = ark_mem->nfe_reused;
+  return (ARK_SUCCESS);
+}
+
 /*---------------------------------------------------------------
   ARKodeGetNumExpSteps:
 
@@ -3081,6 +3399,11 @@ int ARKodePrintAllStats(void* arkode_mem, FILE* outfile, SUNOutputFormat fmt)
     ark_root_mem = (ARKodeRootMem)ark_mem->root_mem;
     sunfprintf_long(outfile, fmt, SUNFALSE, "Root fn evals", ark_root_mem->nge);
   }
+  if (ark_mem->nfe_reused > 0)
+  {
+    sunfprintf_long(outfile, fmt, SUNFALSE, "RHS evals reused",
+                    ark_mem->nfe_reused);
+  }
 
   /* Print relaxation stats */
   if (ark_mem->relax_enabled)
@@ -3174,6 +3497,7 @@ char* ARKodeGetReturnFlagName(long int flag)
     break;
   case ARK_SUNSTEPPER_ERR: sprintf(name, "ARK_SUNSTEPPER_ERR"); break;
   case ARK_STEP_DIRECTION_ERR: sprintf(name, "ARK_STEP_DIRECTION_ERR"); break;
+  case ARK_OUTPUT_FN_FAIL: sprintf(name, "ARK_OUTPUT_FN_FAIL"); break;
   case ARK_UNRECOGNIZED_ERROR: sprintf(name, "ARK_UNRECOGNIZED_ERROR"); break;
   default: sprintf(name, "NONE");
   }
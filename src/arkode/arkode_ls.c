@@ -4033,6 +4033,29 @@ int arkLsInitializeCounters(ARKLsMem arkls_mem)
   return (0);
 }
 
+/*---------------------------------------------------------------
+  arkLsTelemetryCounters:
+
+  Returns the linear iteration and Jacobian evaluation counters
+  for the per-step telemetry. Both are zero when the stepper has
+  no linear solver interface attached.
+  ---------------------------------------------------------------*/
+void arkLsTelemetryCounters(ARKodeMem ark_mem, long int* nli, long int* nje)
+{
+  ARKLsMem arkls_mem;
+
+  *nli = 0;
+  *nje = 0;
+
+  if (ark_mem->step_getlinmem == NULL) { return; }
+
+  arkls_mem = (ARKLsMem)ark_mem->step_getlinmem(ark_mem);
+  if (arkls_mem == NULL) { return; }
+
+  *nli = arkls_mem->nli;
+  *nje = arkls_mem->nje;
+}
+
 int arkLsInitializeMassCounters(ARKLsMassMem arkls_mem)
 {
   arkls_mem->nmsetups   = 0;
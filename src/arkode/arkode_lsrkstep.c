@@ -192,8 +192,9 @@ void* lsrkStep_Create_Commons(ARKRhsFn rhs, sunrealtype t0, N_Vector y0,
   /* Copy the input parameters into ARKODE state */
   step_mem->fe = rhs;
 
-  /* Set NULL for dom_eig_fn */
-  step_mem->dom_eig_fn = NULL;
+  /* Set NULL for dom_eig_fn (use the internal estimator) */
+  step_mem->dom_eig_fn  = NULL;
+  step_mem->dom_eig_vec = NULL;
 
   /* Initialize all the counters */
   step_mem->nfe               = 0;
@@ -201,6 +202,7 @@ void* lsrkStep_Create_Commons(ARKRhsFn rhs, sunrealtype t0, N_Vector y0,
   step_mem->dom_eig_num_evals = 0;
   step_mem->stage_max_limit   = STAGE_MAX_LIMIT_DEFAULT;
   step_mem->dom_eig_nst       = 0;
+  step_mem->dom_eig_num_iters = 0;
 
   /* Initialize main ARKODE infrastructure */
   retval = arkInit(ark_mem, t0, y0, FIRST_INIT);
@@ -280,12 +282,33 @@ int lsrkStep_ReInit_Commons(void* arkode_mem, ARKRhsFn rhs, sunrealtype t0,
   step_mem->spectral_radius_max = 0;
   step_mem->spectral_radius_min = 0;
   step_mem->dom_eig_nst         = 0;
+  step_mem->dom_eig_num_iters   = 0;
   step_mem->dom_eig_update      = SUNTRUE;
   step_mem->dom_eig_is_current  = SUNFALSE;
 
   return ARK_SUCCESS;
 }
 
+/*---------------------------------------------------------------
+  lsrkStep_AllocSSPVecs:
+
+  Allocates the tempv3 vector used by the SSP methods (if needed).
+  lsrkStep_Init releases tempv3 for the STS methods, so it must be
+  allocated again when switching to an SSP method after the
+  integration has started.
+  ---------------------------------------------------------------*/
+
+static int lsrkStep_AllocSSPVecs(ARKodeMem ark_mem)
+{
+  if (!arkAllocVec(ark_mem, ark_mem->yn, &ark_mem->tempv3))
+  {
+    arkProcessError(ark_mem, ARK_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_MEM_FAIL);
+    return ARK_MEM_FAIL;
+  }
+  return ARK_SUCCESS;
+}
+
 /*---------------------------------------------------------------
   lsrkStep_Init:
 
@@ -309,11 +332,15 @@ int lsrkStep_Init(ARKodeMem ark_mem, SUNDIALS_MAYBE_UNUSED sunrealtype tout,
   retval = lsrkStep_AccessStepMem(ark_mem, __func__, &step_mem);
   if (retval != ARK_SUCCESS) { return retval; }
 
-  /* immediately return if resize or reset */
-  if (init_type == RESIZE_INIT || init_type == RESET_INIT)
+  /* the internal dominant eigenvalue estimate restarts after a resize */
+  if (init_type == RESIZE_INIT)
   {
+    arkFreeVec(ark_mem, &step_mem->dom_eig_vec);
     return ARK_SUCCESS;
   }
+
+  /* immediately return if reset */
+  if (init_type == RESET_INIT) { return ARK_SUCCESS; }
   /* enforce use of arkEwtSmallReal if using a fixed step size
      and an internal error weight function */
   if (ark_mem->fixedstep && !ark_mem->user_efun)
@@ -323,13 +350,17 @@ int lsrkStep_Init(ARKodeMem ark_mem, SUNDIALS_MAYBE_UNUSED sunrealtype tout,
     ark_mem->e_data    = ark_mem;
   }
 
-  /* Check if user has provided dom_eig_fn */
-  if (!step_mem->is_SSP && step_mem->dom_eig_fn == NULL)
+  /* The STS methods only need yn, fn, ycur, tempv1, and tempv2 while the SSP
+     methods also use tempv3. The unused vectors are released and are only
+     allocated again if needed e.g., when inequality constraints are enabled
+     or an SSP method is selected after the integration has started. */
+  if (step_mem->is_SSP)
   {
-    arkProcessError(ark_mem, ARK_DOMEIG_FAIL, __LINE__, __func__,
-                    __FILE__, "STS methods require a user provided dominant eigenvalue function");
-    return ARK_DOMEIG_FAIL;
+    retval = lsrkStep_AllocSSPVecs(ark_mem);
+    if (retval != ARK_SUCCESS) { return retval; }
   }
+  else { arkFreeVec(ark_mem, &ark_mem->tempv3); }
+  arkFreeVec(ark_mem, &ark_mem->tempv4);
 
   /* Allocate reusable arrays for fused vector interface */
   if (step_mem->cvals == NULL)
@@ -457,6 +488,57 @@ int lsrkStep_FullRHS(ARKodeMem ark_mem, sunrealtype t, N_Vector y, N_Vector f,
   return ARK_SUCCESS;
 }
 
+/*---------------------------------------------------------------
+  lsrkStep_STSStageVectors:
+
+  The RKC and RKL stages are computed with a three-term recurrence
+  that only needs the two previous stages. The stages rotate through
+  ycur, tempv1, and tempv2 without any copies: stage j is stored in
+  stages[j % 3], which first holds the RHS of stage j - 1 and then
+  is updated in place. This routine assigns the vectors such that
+  the final stage is stored in ycur.
+  ---------------------------------------------------------------*/
+
+static void lsrkStep_STSStageVectors(ARKodeMem ark_mem, int num_stages,
+                                     N_Vector* stages)
+{
+  stages[num_stages % 3]       = ark_mem->ycur;
+  stages[(num_stages + 1) % 3] = ark_mem->tempv1;
+  stages[(num_stages + 2) % 3] = ark_mem->tempv2;
+}
+
+/*---------------------------------------------------------------
+  lsrkStep_STSStageUpdate:
+
+  Computes the RKC or RKL stage
+
+    Yj = h mus Fjm1 + nu Yjm2 + (1 - mu - nu) yn + mu Yjm1
+         - h mus ajm1 fn
+
+  with one fused linear combination, where Yj holds F(Yjm1) on
+  input and Yjm2 = yn for the second stage.
+  ---------------------------------------------------------------*/
+
+static int lsrkStep_STSStageUpdate(ARKodeMem ark_mem, sunrealtype* cvals,
+                                   N_Vector* Xvecs, sunrealtype mus,
+                                   sunrealtype nu, sunrealtype mu,
+                                   sunrealtype ajm1, N_Vector Yj,
+                                   N_Vector Yjm1, N_Vector Yjm2)
+{
+  cvals[0] = mus * ark_mem->h;
+  Xvecs[0] = Yj;
+  cvals[1] = nu;
+  Xvecs[1] = Yjm2;
+  cvals[2] = ONE - mu - nu;
+  Xvecs[2] = ark_mem->yn;
+  cvals[3] = mu;
+  Xvecs[3] = Yjm1;
+  cvals[4] = -mus * ajm1 * ark_mem->h;
+  Xvecs[4] = ark_mem->fn;
+
+  return N_VLinearCombination(5, cvals, Xvecs, Yj);
+}
+
 /*---------------------------------------------------------------
   lsrkStep_TakeStepRKC:
 
@@ -504,6 +586,7 @@ int lsrkStep_TakeStepRKC(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPtr)
 
   sunrealtype* cvals = step_mem->cvals;
   N_Vector* Xvecs    = step_mem->Xvecs;
+  N_Vector stages[3];
 
   /* Compute dominant eigenvalue and update stats */
   if (step_mem->dom_eig_update)
@@ -590,21 +673,22 @@ int lsrkStep_TakeStepRKC(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPtr)
   bjm1 = ONE / SUNSQR(TWO * w0);
   bjm2 = bjm1;
 
-  /* Evaluate the first stage */
-  N_VScale(ONE, ark_mem->yn, ark_mem->tempv1);
+  /* Select the stage storage so the last stage is stored in ycur */
+  lsrkStep_STSStageVectors(ark_mem, step_mem->req_stages, stages);
 
+  /* Evaluate the first stage */
   mus = w1 * bjm1;
 
   SUNLogInfo(ARK_LOGGER, "begin-stage", "stage = %i, tcur = " SUN_FORMAT_G, 1,
              ark_mem->tn + ark_mem->h * mus);
 
-  N_VLinearSum(ONE, ark_mem->yn, ark_mem->h * mus, ark_mem->fn, ark_mem->tempv2);
+  N_VLinearSum(ONE, ark_mem->yn, ark_mem->h * mus, ark_mem->fn, stages[1]);
 
   /* apply user-supplied stage postprocessing function (if supplied) */
   if (ark_mem->ProcessStage != NULL)
   {
-    retval = ark_mem->ProcessStage(ark_mem->tn + ark_mem->h * mus,
-                                   ark_mem->tempv2, ark_mem->user_data);
+    retval = ark_mem->ProcessStage(ark_mem->tn + ark_mem->h * mus, stages[1],
+                                   ark_mem->user_data);
     if (retval != 0)
     {
       SUNLogInfo(ARK_LOGGER, "end-stage",
@@ -634,13 +718,16 @@ int lsrkStep_TakeStepRKC(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPtr)
     nu   = -bj / bjm2;
     mus  = mu * w1 / w0;
 
-    /* Use the ycur array for temporary storage here */
-    retval = step_mem->fe(ark_mem->tcur + ark_mem->h * thjm1, ark_mem->tempv2,
-                          ark_mem->ycur, ark_mem->user_data);
+    /* Stage j overwrites stage j - 3, first with the RHS of stage j - 1 */
+    N_Vector Yj   = stages[j % 3];
+    N_Vector Yjm1 = stages[(j - 1) % 3];
+    N_Vector Yjm2 = (j == 2) ? ark_mem->yn : stages[(j - 2) % 3];
+
+    retval = step_mem->fe(ark_mem->tcur + ark_mem->h * thjm1, Yjm1, Yj,
+                          ark_mem->user_data);
     step_mem->nfe++;
 
-    SUNLogExtraDebugVec(ARK_LOGGER, "stage RHS", ark_mem->ycur,
-                        "F_%i(:) =", j - 1);
+    SUNLogExtraDebugVec(ARK_LOGGER, "stage RHS", Yj, "F_%i(:) =", j - 1);
     SUNLogInfoIf(retval != 0, ARK_LOGGER, "end-stage",
                  "status = failed rhs eval, retval = %i", retval);
 
@@ -655,18 +742,8 @@ int lsrkStep_TakeStepRKC(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPtr)
     SUNLogInfo(ARK_LOGGER, "begin-stage", "stage = %i, tcur = " SUN_FORMAT_G, j,
                ark_mem->tn + ark_mem->h * thj);
 
-    cvals[0] = mus * ark_mem->h;
-    Xvecs[0] = ark_mem->ycur;
-    cvals[1] = nu;
-    Xvecs[1] = ark_mem->tempv1;
-    cvals[2] = ONE - mu - nu;
-    Xvecs[2] = ark_mem->yn;
-    cvals[3] = mu;
-    Xvecs[3] = ark_mem->tempv2;
-    cvals[4] = -mus * ajm1 * ark_mem->h;
-    Xvecs[4] = ark_mem->fn;
-
-    retval = N_VLinearCombination(5, cvals, Xvecs, ark_mem->ycur);
+    retval = lsrkStep_STSStageUpdate(ark_mem, cvals, Xvecs, mus, nu, mu,
+                                     ajm1, Yj, Yjm1, Yjm2);
     if (retval != 0)
     {
       SUNLogInfo(ARK_LOGGER, "end-stage",
@@ -677,8 +754,8 @@ int lsrkStep_TakeStepRKC(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPtr)
     /* apply user-supplied stage postprocessing function (if supplied) */
     if (ark_mem->ProcessStage != NULL && j < step_mem->req_stages)
     {
-      retval = ark_mem->ProcessStage(ark_mem->tcur + ark_mem->h * thj,
-                                     ark_mem->ycur, ark_mem->user_data);
+      retval = ark_mem->ProcessStage(ark_mem->tcur + ark_mem->h * thj, Yj,
+                                     ark_mem->user_data);
       if (retval != 0)
       {
         SUNLogInfo(ARK_LOGGER, "end-stage",
@@ -690,13 +767,6 @@ int lsrkStep_TakeStepRKC(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPtr)
     /* Shift the data for the next stage */
     if (j < step_mem->req_stages)
     {
-      /* To avoid two data copies we swap ARKODE's tempv1 and tempv2 pointers*/
-      N_Vector temp   = ark_mem->tempv1;
-      ark_mem->tempv1 = ark_mem->tempv2;
-      ark_mem->tempv2 = temp;
-
-      N_VScale(ONE, ark_mem->ycur, ark_mem->tempv2);
-
       thjm2  = thjm1;
       thjm1  = thj;
       bjm2   = bjm1;
@@ -813,6 +883,7 @@ int lsrkStep_TakeStepRKL(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPtr)
 
   sunrealtype* cvals = step_mem->cvals;
   N_Vector* Xvecs    = step_mem->Xvecs;
+  N_Vector stages[3];
 
   /* Compute dominant eigenvalue and update stats */
   if (step_mem->dom_eig_update)
@@ -898,22 +969,23 @@ int lsrkStep_TakeStepRKL(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPtr)
   bjm2 = ONE / THREE;
   bjm1 = bjm2;
 
-  /* Evaluate the first stage */
-  N_VScale(ONE, ark_mem->yn, ark_mem->tempv1);
+  /* Select the stage storage so the last stage is stored in ycur */
+  lsrkStep_STSStageVectors(ark_mem, step_mem->req_stages, stages);
 
+  /* Evaluate the first stage */
   mus  = w1 * bjm1;
   cjm1 = mus;
 
   SUNLogInfo(ARK_LOGGER, "begin-stage", "stage = %i, tcur = " SUN_FORMAT_G, 1,
              ark_mem->tn + ark_mem->h * mus);
 
-  N_VLinearSum(ONE, ark_mem->yn, ark_mem->h * mus, ark_mem->fn, ark_mem->tempv2);
+  N_VLinearSum(ONE, ark_mem->yn, ark_mem->h * mus, ark_mem->fn, stages[1]);
 
   /* apply user-supplied stage postprocessing function (if supplied) */
   if (ark_mem->ProcessStage != NULL)
   {
-    retval = ark_mem->ProcessStage(ark_mem->tn + ark_mem->h * mus,
-                                   ark_mem->tempv2, ark_mem->user_data);
+    retval = ark_mem->ProcessStage(ark_mem->tn + ark_mem->h * mus, stages[1],
+                                   ark_mem->user_data);
     if (retval != 0)
     {
       SUNLogInfo(ARK_LOGGER, "end-stage",
@@ -933,13 +1005,16 @@ int lsrkStep_TakeStepRKL(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPtr)
     mus  = w1 * mu;
     cj   = temj * w1 / FOUR;
 
-    /* Use the ycur array for temporary storage here */
-    retval = step_mem->fe(ark_mem->tcur + ark_mem->h * cjm1, ark_mem->tempv2,
-                          ark_mem->ycur, ark_mem->user_data);
+    /* Stage j overwrites stage j - 3, first with the RHS of stage j - 1 */
+    N_Vector Yj   = stages[j % 3];
+    N_Vector Yjm1 = stages[(j - 1) % 3];
+    N_Vector Yjm2 = (j == 2) ? ark_mem->yn : stages[(j - 2) % 3];
+
+    retval = step_mem->fe(ark_mem->tcur + ark_mem->h * cjm1, Yjm1, Yj,
+                          ark_mem->user_data);
     step_mem->nfe++;
 
-    SUNLogExtraDebugVec(ARK_LOGGER, "stage RHS", ark_mem->ycur,
-                        "F_%i(:) =", j - 1);
+    SUNLogExtraDebugVec(ARK_LOGGER, "stage RHS", Yj, "F_%i(:) =", j - 1);
     SUNLogInfoIf(retval != 0, ARK_LOGGER, "end-stage",
                  "status = failed rhs eval, retval = %i", retval);
 
@@ -950,18 +1025,8 @@ int lsrkStep_TakeStepRKL(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPtr)
     SUNLogInfo(ARK_LOGGER, "begin-stage", "stage = %i, tcur = " SUN_FORMAT_G, j,
                ark_mem->tn + ark_mem->h * cj);
 
-    cvals[0] = mus * ark_mem->h;
-    Xvecs[0] = ark_mem->ycur;
-    cvals[1] = nu;
-    Xvecs[1] = ark_mem->tempv1;
-    cvals[2] = ONE - mu - nu;
-    Xvecs[2] = ark_mem->yn;
-    cvals[3] = mu;
-    Xvecs[3] = ark_mem->tempv2;
-    cvals[4] = -mus * ajm1 * ark_mem->h;
-    Xvecs[4] = ark_mem->fn;
-
-    retval = N_VLinearCombination(5, cvals, Xvecs, ark_mem->ycur);
+    retval = lsrkStep_STSStageUpdate(ark_mem, cvals, Xvecs, mus, nu, mu,
+                                     ajm1, Yj, Yjm1, Yjm2);
     if (retval != 0)
     {
       SUNLogInfo(ARK_LOGGER, "end-stage",
@@ -972,8 +1037,8 @@ int lsrkStep_TakeStepRKL(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPtr)
     /* apply user-supplied stage postprocessing function (if supplied) */
     if (ark_mem->ProcessStage != NULL && j < step_mem->req_stages)
     {
-      retval = ark_mem->ProcessStage(ark_mem->tcur + ark_mem->h * cj,
-                                     ark_mem->ycur, ark_mem->user_data);
+      retval = ark_mem->ProcessStage(ark_mem->tcur + ark_mem->h * cj, Yj,
+                                     ark_mem->user_data);
       if (retval != 0)
       {
         SUNLogInfo(ARK_LOGGER, "end-stage",
@@ -985,13 +1050,6 @@ int lsrkStep_TakeStepRKL(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPtr)
     /* Shift the data for the next stage */
     if (j < step_mem->req_stages)
     {
-      /* To avoid two data copies we swap ARKODE's tempv1 and tempv2 pointers*/
-      N_Vector temp   = ark_mem->tempv1;
-      ark_mem->tempv1 = ark_mem->tempv2;
-      ark_mem->tempv2 = temp;
-
-      N_VScale(ONE, ark_mem->ycur, ark_mem->tempv2);
-
       cjm1 = cj;
       bjm2 = bjm1;
       bjm1 = bj;
@@ -1091,6 +1149,10 @@ int lsrkStep_TakeStepSSPs2(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPtr
   retval = lsrkStep_AccessStepMem(ark_mem, __func__, &step_mem);
   if (retval != ARK_SUCCESS) { return retval; }
 
+  /* tempv3 is not allocated if switching from an STS method */
+  retval = lsrkStep_AllocSSPVecs(ark_mem);
+  if (retval != ARK_SUCCESS) { return retval; }
+
   sunrealtype* cvals = step_mem->cvals;
   N_Vector* Xvecs    = step_mem->Xvecs;
 
@@ -1289,6 +1351,10 @@ int lsrkStep_TakeStepSSPs3(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPtr
   retval = lsrkStep_AccessStepMem(ark_mem, __func__, &step_mem);
   if (retval != ARK_SUCCESS) { return retval; }
 
+  /* tempv3 is not allocated if switching from an STS method */
+  retval = lsrkStep_AllocSSPVecs(ark_mem);
+  if (retval != ARK_SUCCESS) { return retval; }
+
   sunrealtype* cvals = step_mem->cvals;
   N_Vector* Xvecs    = step_mem->Xvecs;
 
@@ -1573,6 +1639,10 @@ int lsrkStep_TakeStepSSP43(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPtr
   retval = lsrkStep_AccessStepMem(ark_mem, __func__, &step_mem);
   if (retval != ARK_SUCCESS) { return retval; }
 
+  /* tempv3 is not allocated if switching from an STS method */
+  retval = lsrkStep_AllocSSPVecs(ark_mem);
+  if (retval != ARK_SUCCESS) { return retval; }
+
   sunrealtype* cvals = step_mem->cvals;
   N_Vector* Xvecs    = step_mem->Xvecs;
 
@@ -1781,6 +1851,10 @@ int lsrkStep_TakeStepSSP104(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPt
   retval = lsrkStep_AccessStepMem(ark_mem, __func__, &step_mem);
   if (retval != ARK_SUCCESS) { return retval; }
 
+  /* tempv3 is not allocated if switching from an STS method */
+  retval = lsrkStep_AllocSSPVecs(ark_mem);
+  if (retval != ARK_SUCCESS) { return retval; }
+
   sunrealtype* cvals = step_mem->cvals;
   N_Vector* Xvecs    = step_mem->Xvecs;
 
@@ -2003,6 +2077,9 @@ void lsrkStep_Free(ARKodeMem ark_mem)
       ark_mem->liw -= step_mem->nfusedopvecs;
     }
 
+    /* free the internal dominant eigenvector estimate */
+    arkFreeVec(ark_mem, &step_mem->dom_eig_vec);
+
     /* free the time stepper module itself */
     free(ark_mem->step_mem);
     ark_mem->step_mem = NULL;
@@ -2075,6 +2152,8 @@ void lsrkStep_PrintMem(ARKodeMem ark_mem, FILE* outfile)
     fprintf(outfile, "LSRKStep: nfe                   = %li\n", step_mem->nfe);
     fprintf(outfile, "LSRKStep: dom_eig_num_evals     = %li\n",
             step_mem->dom_eig_num_evals);
+    fprintf(outfile, "LSRKStep: dom_eig_num_iters     = %li\n",
+            step_mem->dom_eig_num_iters);
 
     /* output sunrealtype quantities */
     // TODO(SRB): temporary fix for complex numbers
@@ -2194,10 +2273,16 @@ int lsrkStep_ComputeNewDomEig(ARKodeMem ark_mem, ARKodeLSRKStepMem step_mem)
 {
   int retval = SUN_SUCCESS;
 
-  retval = step_mem->dom_eig_fn(ark_mem->tn, ark_mem->ycur, ark_mem->fn,
-                                &step_mem->lambdaR, &step_mem->lambdaI,
-                                ark_mem->user_data, ark_mem->tempv1,
-                                ark_mem->tempv2, ark_mem->tempv3);
+  if (step_mem->dom_eig_fn != NULL)
+  {
+    /* ycur is not needed until the stages are computed, so it can be used
+       as a work vector along with tempv1 and tempv2 */
+    retval = step_mem->dom_eig_fn(ark_mem->tn, ark_mem->yn, ark_mem->fn,
+                                  &step_mem->lambdaR, &step_mem->lambdaI,
+                                  ark_mem->user_data, ark_mem->tempv1,
+                                  ark_mem->tempv2, ark_mem->ycur);
+  }
+  else { retval = lsrkStep_EstimateDomEig(ark_mem, step_mem); }
   step_mem->dom_eig_num_evals++;
   if (retval != ARK_SUCCESS)
   {
@@ -2244,6 +2329,167 @@ int lsrkStep_ComputeNewDomEig(ARKodeMem ark_mem, ARKodeLSRKStepMem step_mem)
   return retval;
 }
 
+/*---------------------------------------------------------------
+  lsrkStep_DQJtimes:
+
+  This routine approximates the product of the Jacobian at
+  (tn, yn) with a vector v of unit 2-norm using the difference
+  quotient
+
+    Jv ~ [f(tn, yn + sigma v) - f(tn, yn)] / sigma
+
+  where fy = f(tn, yn). The vector work is used as temporary
+  storage.
+  ---------------------------------------------------------------*/
+
+static int lsrkStep_DQJtimes(ARKodeMem ark_mem, ARKodeLSRKStepMem step_mem,
+                             N_Vector fy, sunrealtype sigma, N_Vector v,
+                             N_Vector Jv, N_Vector work)
+{
+  int retval;
+
+  N_VLinearSum(ONE, ark_mem->yn, sigma, v, work);
+  retval = step_mem->fe(ark_mem->tn, work, Jv, ark_mem->user_data);
+  step_mem->nfe++;
+  if (retval != 0) { return ARK_RHSFUNC_FAIL; }
+
+  N_VLinearSum(ONE / sigma, Jv, -ONE / sigma, fy, Jv);
+
+  return ARK_SUCCESS;
+}
+
+/*---------------------------------------------------------------
+  lsrkStep_EstimateDomEig:
+
+  This routine is the internal dominant eigenvalue estimator used
+  when no dom_eig function is provided. It applies the power
+  iteration to difference quotient Jacobian-vector products,
+  starting from the eigenvector estimate of the previous call,
+  until the norm of the iterates converges or the maximum number
+  of iterations is reached. The eigenvalue is then taken as the
+  largest Ritz value from a two-step Arnoldi process on the final
+  iterate, which also captures a dominant complex conjugate pair.
+  The work vectors tempv1, tempv2, and ycur are used.
+  ---------------------------------------------------------------*/
+
+int lsrkStep_EstimateDomEig(ARKodeMem ark_mem, ARKodeLSRKStepMem step_mem)
+{
+  int retval, iters;
+  sunrealtype sigma, rho, rho_old, h11, h12, h21, h22, tr, disc, mod;
+  N_Vector v = NULL;
+  N_Vector w = ark_mem->ycur;
+
+  /* Allocate the eigenvector estimate and start from a constant vector */
+  if (step_mem->dom_eig_vec == NULL)
+  {
+    if (!arkAllocVec(ark_mem, ark_mem->yn, &step_mem->dom_eig_vec))
+    {
+      arkProcessError(ark_mem, ARK_MEM_FAIL, __LINE__, __func__, __FILE__,
+                      MSG_ARK_MEM_FAIL);
+      return ARK_MEM_FAIL;
+    }
+    N_VConst(ONE, step_mem->dom_eig_vec);
+    N_VScale(ONE / SUNRsqrt(N_VDotProd(step_mem->dom_eig_vec,
+                                       step_mem->dom_eig_vec)),
+             step_mem->dom_eig_vec, step_mem->dom_eig_vec);
+  }
+  v = step_mem->dom_eig_vec;
+
+  /* The difference quotients are taken about f(tn, yn) */
+  if ((!ark_mem->fn_is_current && ark_mem->initsetup) ||
+      (step_mem->step_nst != ark_mem->nst))
+  {
+    retval = step_mem->fe(ark_mem->tn, ark_mem->yn, ark_mem->fn,
+                          ark_mem->user_data);
+    step_mem->nfe++;
+    if (retval != 0) { return ARK_RHSFUNC_FAIL; }
+    ark_mem->fn_is_current = SUNTRUE;
+  }
+
+  sigma = SUNRsqrt(ark_mem->uround) *
+          SUNMAX(ONE, SUNRsqrt(N_VDotProd(ark_mem->yn, ark_mem->yn)));
+
+  /* Power iteration: v <- Jv / ||Jv|| until ||Jv|| converges */
+  rho = ZERO;
+  for (iters = 1;; iters++)
+  {
+    retval = lsrkStep_DQJtimes(ark_mem, step_mem, ark_mem->fn, sigma, v, w,
+                               ark_mem->tempv1);
+    if (retval != ARK_SUCCESS) { return retval; }
+
+    rho_old = rho;
+    rho     = SUNRsqrt(N_VDotProd(w, w));
+    if (rho == ZERO || iters >= step_mem->dom_eig_max_iters ||
+        SUNRabs(rho - rho_old) <= step_mem->dom_eig_reltol * rho)
+    {
+      break;
+    }
+    N_VScale(ONE / rho, w, v);
+  }
+  step_mem->dom_eig_num_iters += iters;
+
+  if (rho == ZERO)
+  {
+    step_mem->lambdaR = ZERO;
+    step_mem->lambdaI = ZERO;
+    return ARK_SUCCESS;
+  }
+
+  /* Arnoldi step: w = h11 v + h21 q with q orthogonal to v */
+  h11 = N_VDotProd(v, w);
+  N_VLinearSum(ONE, w, -h11, v, w);
+  h21 = SUNRsqrt(N_VDotProd(w, w));
+
+  if (h21 <= step_mem->dom_eig_reltol * rho)
+  {
+    /* v is an (approximate) real eigenvector */
+    step_mem->lambdaR = h11;
+    step_mem->lambdaI = ZERO;
+  }
+  else
+  {
+    /* Second Arnoldi step with z = Jq stored in tempv2 */
+    N_VScale(ONE / h21, w, w);
+    retval = lsrkStep_DQJtimes(ark_mem, step_mem, ark_mem->fn, sigma, w,
+                               ark_mem->tempv2, ark_mem->tempv1);
+    if (retval != ARK_SUCCESS) { return retval; }
+    h12 = N_VDotProd(v, ark_mem->tempv2);
+    h22 = N_VDotProd(w, ark_mem->tempv2);
+
+    /* Ritz values are the eigenvalues of [h11 h12; h21 h22] */
+    tr   = HALF * (h11 + h22);
+    disc = SUNSQR(tr) - (h11 * h22 - h12 * h21);
+    if (disc >= ZERO)
+    {
+      step_mem->lambdaR = (tr < ZERO) ? tr - SUNRsqrt(disc)
+                                      : tr + SUNRsqrt(disc);
+      step_mem->lambdaI = ZERO;
+    }
+    else
+    {
+      step_mem->lambdaR = tr;
+      step_mem->lambdaI = SUNRsqrt(-disc);
+    }
+  }
+
+  /* A Ritz value with the wrong sign of the real part (e.g., from a
+     nearly imaginary spectrum) is replaced by a real value with the
+     same modulus */
+  if (step_mem->lambdaR * ark_mem->h >= ZERO)
+  {
+    mod = SUNRsqrt(SUNSQR(step_mem->lambdaR) + SUNSQR(step_mem->lambdaI));
+    step_mem->lambdaR = (ark_mem->h > ZERO) ? -mod : mod;
+    step_mem->lambdaI = ZERO;
+  }
+
+  SUNLogInfo(ARK_LOGGER, "estimate-dom-eig",
+             "iterations = %i, lambdaR = " SUN_FORMAT_G
+             ", lambdaI = " SUN_FORMAT_G,
+             iters, step_mem->lambdaR, step_mem->lambdaI);
+
+  return ARK_SUCCESS;
+}
+
 /*===============================================================
   EOF
   ===============================================================*/
@@ -26,9 +26,11 @@
 extern "C" {
 #endif
 
-#define STAGE_MAX_LIMIT_DEFAULT 200
-#define DOM_EIG_SAFETY_DEFAULT  SUN_RCONST(1.01)
-#define DOM_EIG_FREQ_DEFAULT    25
+#define STAGE_MAX_LIMIT_DEFAULT   200
+#define DOM_EIG_SAFETY_DEFAULT    SUN_RCONST(1.01)
+#define DOM_EIG_FREQ_DEFAULT      25
+#define DOM_EIG_MAX_ITERS_DEFAULT 100
+#define DOM_EIG_RELTOL_DEFAULT    SUN_RCONST(0.001)
 
 /*===============================================================
   LSRK time step module private math function macros
@@ -154,6 +156,12 @@ typedef struct ARKodeLSRKStepMemRec
   sunrealtype dom_eig_safety; /* some safety factor for the user provided dom_eig*/
   long int dom_eig_freq; /* indicates dom_eig update after dom_eig_freq successful steps*/
 
+  /* Internal dom_eig estimator (used when dom_eig_fn is NULL) */
+  N_Vector dom_eig_vec;       /* dominant eigenvector estimate (warm start) */
+  int dom_eig_max_iters;      /* max power iterations per estimate */
+  sunrealtype dom_eig_reltol; /* power iteration relative tolerance */
+  long int dom_eig_num_iters; /* total number of power iterations */
+
   /* Flags */
   sunbooleantype dom_eig_update; /* flag indicating new dom_eig is needed */
   sunbooleantype const_Jac;      /* flag indicating Jacobian is constant */
@@ -203,6 +211,7 @@ int lsrkStep_AccessStepMem(ARKodeMem ark_mem, const char* fname,
 void lsrkStep_DomEigUpdateLogic(ARKodeMem ark_mem, ARKodeLSRKStepMem step_mem,
                                 sunrealtype dsm);
 int lsrkStep_ComputeNewDomEig(ARKodeMem ark_mem, ARKodeLSRKStepMem step_mem);
+int lsrkStep_EstimateDomEig(ARKodeMem ark_mem, ARKodeLSRKStepMem step_mem);
 
 /*===============================================================
   Reusable LSRKStep Error Messages
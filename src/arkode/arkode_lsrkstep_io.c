@@ -195,6 +195,7 @@ int LSRKStepSetSSPMethodByName(void* arkode_mem, const char* emethod)
   LSRKStepSetDomEigFn specifies the dom_eig function.
   Specifies the dominant eigenvalue approximation routine to be used for determining
   the number of stages that will be used by either the RKC or RKL methods.
+  Passing NULL selects the internal matrix-free power iteration estimator.
   ---------------------------------------------------------------*/
 int LSRKStepSetDomEigFn(void* arkode_mem, ARKDomEigFn dom_eig)
 {
@@ -207,21 +208,10 @@ int LSRKStepSetDomEigFn(void* arkode_mem, ARKDomEigFn dom_eig)
                                         &step_mem);
   if (retval != ARK_SUCCESS) { return retval; }
 
-  /* set the dom_eig routine pointer, and update relevant flags */
-  if (dom_eig != NULL)
-  {
-    step_mem->dom_eig_fn = dom_eig;
+  /* set the dom_eig routine pointer, NULL selects the internal estimator */
+  step_mem->dom_eig_fn = dom_eig;
 
-    return ARK_SUCCESS;
-  }
-  else
-  {
-    step_mem->dom_eig_fn = NULL;
-
-    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
-                    "Internal dom_eig is not supported yet!");
-    return ARK_ILL_INPUT;
-  }
+  return ARK_SUCCESS;
 }
 
 /*---------------------------------------------------------------
@@ -319,6 +309,57 @@ int LSRKStepSetDomEigSafetyFactor(void* arkode_mem, sunrealtype dom_eig_safety)
   return ARK_SUCCESS;
 }
 
+/*---------------------------------------------------------------
+  LSRKStepSetDomEigMaxIters sets the maximum number of power
+  iterations used by the internal dominant eigenvalue estimator
+  for each eigenvalue update.
+
+  Calling this function with max_iters <= 0 resets the default value
+  ---------------------------------------------------------------*/
+int LSRKStepSetDomEigMaxIters(void* arkode_mem, int max_iters)
+{
+  ARKodeMem ark_mem;
+  ARKodeLSRKStepMem step_mem;
+  int retval;
+
+  /* access ARKodeMem and ARKodeLSRKStepMem structures */
+  retval = lsrkStep_AccessARKODEStepMem(arkode_mem, __func__, &ark_mem,
+                                        &step_mem);
+  if (retval != ARK_SUCCESS) { return retval; }
+
+  if (max_iters <= 0)
+  {
+    step_mem->dom_eig_max_iters = DOM_EIG_MAX_ITERS_DEFAULT;
+  }
+  else { step_mem->dom_eig_max_iters = max_iters; }
+
+  return ARK_SUCCESS;
+}
+
+/*---------------------------------------------------------------
+  LSRKStepSetDomEigRelTol sets the relative tolerance on the change
+  in the spectral radius between power iterations used by the
+  internal dominant eigenvalue estimator.
+
+  Calling this function with reltol <= 0 resets the default value
+  ---------------------------------------------------------------*/
+int LSRKStepSetDomEigRelTol(void* arkode_mem, sunrealtype reltol)
+{
+  ARKodeMem ark_mem;
+  ARKodeLSRKStepMem step_mem;
+  int retval;
+
+  /* access ARKodeMem and ARKodeLSRKStepMem structures */
+  retval = lsrkStep_AccessARKODEStepMem(arkode_mem, __func__, &ark_mem,
+                                        &step_mem);
+  if (retval != ARK_SUCCESS) { return retval; }
+
+  if (reltol <= ZERO) { step_mem->dom_eig_reltol = DOM_EIG_RELTOL_DEFAULT; }
+  else { step_mem->dom_eig_reltol = reltol; }
+
+  return ARK_SUCCESS;
+}
+
 /*---------------------------------------------------------------
   LSRKStepSetNumSSPStages sets the number of stages in the following
   SSP methods:
@@ -519,6 +560,8 @@ int lsrkStep_SetDefaults(ARKodeMem ark_mem)
   step_mem->spectral_radius_min = ZERO;
   step_mem->dom_eig_safety      = DOM_EIG_SAFETY_DEFAULT;
   step_mem->dom_eig_freq        = DOM_EIG_FREQ_DEFAULT;
+  step_mem->dom_eig_max_iters   = DOM_EIG_MAX_ITERS_DEFAULT;
+  step_mem->dom_eig_reltol      = DOM_EIG_RELTOL_DEFAULT;
 
   /* Flags */
   step_mem->dom_eig_update     = SUNTRUE;
@@ -557,6 +600,11 @@ int lsrkStep_PrintAllStats(ARKodeMem ark_mem, FILE* outfile, SUNOutputFormat fmt
   {
     sunfprintf_long(outfile, fmt, SUNFALSE, "Number of dom_eig updates",
                     step_mem->dom_eig_num_evals);
+    if (step_mem->dom_eig_fn == NULL)
+    {
+      sunfprintf_long(outfile, fmt, SUNFALSE, "Number of dom_eig iterations",
+                      step_mem->dom_eig_num_iters);
+    }
     sunfprintf_long(outfile, fmt, SUNFALSE, "Max. num. of stages used",
                     step_mem->stage_max);
     sunfprintf_long(outfile, fmt, SUNFALSE, "Max. num. of stages allowed",
@@ -629,6 +677,13 @@ int lsrkStep_WriteParameters(ARKodeMem ark_mem, FILE* fp)
             step_mem->dom_eig_freq);
     fprintf(fp, "  Flag to indicate Jacobian is constant = %d\n",
             step_mem->const_Jac);
+    if (step_mem->dom_eig_fn == NULL)
+    {
+      fprintf(fp, "  Max num of dom eig power iterations = %i\n",
+              step_mem->dom_eig_max_iters);
+      fprintf(fp, "  Relative tolerance for the dom eig = " SUN_FORMAT_G "\n",
+              step_mem->dom_eig_reltol);
+    }
     break;
   default:
     arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
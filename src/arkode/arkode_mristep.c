@@ -240,6 +240,7 @@ void* MRIStepCreate(ARKRhsFn fse, ARKRhsFn fsi, sunrealtype t0, N_Vector y0,
   step_mem->inner_rtol_factor     = ONE;
   step_mem->inner_dsm             = ONE;
   step_mem->inner_rtol_factor_new = ONE;
+  step_mem->inner_cont_nst        = -1;
 
   /* Initialize pre and post inner evolve functions */
   step_mem->pre_inner_evolve  = NULL;
@@ -924,6 +925,9 @@ int mriStep_Init(ARKodeMem ark_mem, sunrealtype tout, int init_type)
   retval = mriStep_AccessStepMem(ark_mem, __func__, &step_mem);
   if (retval != ARK_SUCCESS) { return (retval); }
 
+  /* the inner stepper state is unknown after a reset, resize, or reinit */
+  step_mem->inner_cont_nst = -1;
+
   /* immediately return if reset */
   if (init_type == RESET_INIT) { return (ARK_SUCCESS); }
 
@@ -1797,8 +1801,9 @@ int mriStep_TakeStepMRIGARK(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPt
     }
   }
 
-  /* for adaptive computations, reset the inner integrator to the beginning of this step */
-  if (!ark_mem->fixedstep)
+  /* for adaptive computations, reset the inner integrator to the beginning of
+     this step unless it continues from the end of the previous (accepted) step */
+  if (!ark_mem->fixedstep && step_mem->inner_cont_nst != ark_mem->nst)
   {
     retval = mriStepInnerStepper_Reset(step_mem->stepper, ark_mem->tn,
                                        ark_mem->yn);
@@ -1809,6 +1814,7 @@ int mriStep_TakeStepMRIGARK(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPt
       return (ARK_INNERSTEP_FAIL);
     }
   }
+  step_mem->inner_cont_nst = -1;
 
   /* call nonlinear solver setup if it exists */
   if (step_mem->NLS)
@@ -2232,6 +2238,15 @@ int mriStep_TakeStepMRIGARK(ARKodeMem ark_mem, sunrealtype* dsmPtr, int* nflagPt
       *dsmPtr = N_VWrmsNorm(ark_mem->tempv1, ark_mem->ewt);
     }
 
+    /* The inner stepper now holds the step solution at tn + h, so if the step
+       is accepted (and not modified by a step postprocessing function) the
+       next step can continue the inner integration without a reset */
+    if ((step_mem->stagetypes[is] != MRISTAGE_STIFF_ACC) &&
+        (ark_mem->ProcessStep == NULL))
+    {
+      step_mem->inner_cont_nst = ark_mem->nst + 1;
+    }
+
     SUNLogInfo(ARK_LOGGER, "end-stage", "status = success");
 
   } /* loop over stages */
@@ -140,6 +140,10 @@ typedef struct ARKodeMRIStepMemRec
   sunrealtype inner_dsm;             /* prev inner stepper accumulated error */
   sunrealtype inner_rtol_factor_new; /* upcoming control parameter */
 
+  /* Step number for which the inner stepper state already matches (tn, yn)
+     at the start of the step, i.e., it can continue without a reset */
+  long int inner_cont_nst;
+
   /* Counters */
   long int nfse;        /* num fse calls                    */
   long int nfsi;        /* num fsi calls                    */
@@ -0,0 +1,764 @@
+/*------------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ *------------------------------------------------------------------------------
+ * This is the implementation file for ARKODE's Parareal method
+ *----------------------------------------------------------------------------*/
+
+#include <arkode/arkode_pararealstep.h>
+#include <sundials/sundials_nvector.h>
+
+#include "arkode_impl.h"
+#include "arkode_pararealstep_impl.h"
+
+/*------------------------------------------------------------------------------
+  Shortcut routine to unpack step_mem structure from ark_mem. If missing it
+  returns ARK_MEM_NULL.
+  ----------------------------------------------------------------------------*/
+static int pararealStep_AccessStepMem(ARKodeMem ark_mem, const char* fname,
+                                      ARKodePararealStepMem* step_mem)
+{
+  if (ark_mem->step_mem == NULL)
+  {
+    arkProcessError(ark_mem, ARK_MEM_NULL, __LINE__, fname, __FILE__,
+                    "Time step module memory is NULL.");
+    return ARK_MEM_NULL;
+  }
+  *step_mem = (ARKodePararealStepMem)ark_mem->step_mem;
+  return ARK_SUCCESS;
+}
+
+/*------------------------------------------------------------------------------
+  Shortcut routine to unpack ark_mem and step_mem structures from void* pointer.
+  If either is missing it returns ARK_MEM_NULL.
+  ----------------------------------------------------------------------------*/
+static int pararealStep_AccessARKODEStepMem(void* arkode_mem, const char* fname,
+                                            ARKodeMem* ark_mem,
+                                            ARKodePararealStepMem* step_mem)
+{
+  /* access ARKodeMem structure */
+  if (arkode_mem == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, fname, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return ARK_MEM_NULL;
+  }
+  *ark_mem = (ARKodeMem)arkode_mem;
+
+  return pararealStep_AccessStepMem(*ark_mem, __func__, step_mem);
+}
+
+/*------------------------------------------------------------------------------
+  This routine frees the slice vectors
+  ----------------------------------------------------------------------------*/
+static void pararealStep_FreeSliceVectors(ARKodeMem ark_mem,
+                                          ARKodePararealStepMem step_mem)
+{
+  arkFreeVecArray(step_mem->nslices_alloc, &step_mem->U, ark_mem->lrw1,
+                  &ark_mem->lrw, ark_mem->liw1, &ark_mem->liw);
+  arkFreeVecArray(step_mem->nslices_alloc, &step_mem->G, ark_mem->lrw1,
+                  &ark_mem->lrw, ark_mem->liw1, &ark_mem->liw);
+  arkFreeVecArray(step_mem->nslices_alloc, &step_mem->F, ark_mem->lrw1,
+                  &ark_mem->lrw, ark_mem->liw1, &ark_mem->liw);
+  step_mem->nslices_alloc = 0;
+}
+
+/*------------------------------------------------------------------------------
+  This routine is called just prior to performing internal time steps (after
+  all user "set" routines have been called) from within arkInitialSetup.
+  ----------------------------------------------------------------------------*/
+static int pararealStep_Init(ARKodeMem ark_mem,
+                             SUNDIALS_MAYBE_UNUSED sunrealtype tout,
+                             int init_type)
+{
+  ARKodePararealStepMem step_mem = NULL;
+  int retval = pararealStep_AccessStepMem(ark_mem, __func__, &step_mem);
+  if (retval != ARK_SUCCESS) { return retval; }
+
+  /* assume fixed outer step size */
+  if (!ark_mem->fixedstep)
+  {
+    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "Adaptive outer time stepping is not currently supported");
+    return ARK_ILL_INPUT;
+  }
+
+  if (ark_mem->interp_type == ARK_INTERP_HERMITE &&
+      step_mem->fine[0]->ops->fullrhs == NULL)
+  {
+    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "The fine SUNStepper must implement SUNStepper_FullRhs "
+                    "when using Hermite interpolation");
+    return ARK_ILL_INPUT;
+  }
+
+  /* the slice vectors must be reallocated after a resize */
+  if (init_type == RESIZE_INIT)
+  {
+    pararealStep_FreeSliceVectors(ark_mem, step_mem);
+  }
+
+  /* (re)allocate the slice vectors if the number of slices changed */
+  step_mem->nslices = (step_mem->nslices_set > 0) ? step_mem->nslices_set
+                                                  : step_mem->nfine;
+  if (step_mem->nslices_alloc != step_mem->nslices)
+  {
+    pararealStep_FreeSliceVectors(ark_mem, step_mem);
+    if (!arkAllocVecArray(step_mem->nslices, ark_mem->yn, &step_mem->U,
+                          ark_mem->lrw1, &ark_mem->lrw, ark_mem->liw1,
+                          &ark_mem->liw) ||
+        !arkAllocVecArray(step_mem->nslices, ark_mem->yn, &step_mem->G,
+                          ark_mem->lrw1, &ark_mem->lrw, ark_mem->liw1,
+                          &ark_mem->liw) ||
+        !arkAllocVecArray(step_mem->nslices, ark_mem->yn, &step_mem->F,
+                          ark_mem->lrw1, &ark_mem->lrw, ark_mem->liw1,
+                          &ark_mem->liw))
+    {
+      step_mem->nslices_alloc = step_mem->nslices;
+      pararealStep_FreeSliceVectors(ark_mem, step_mem);
+      arkProcessError(ark_mem, ARK_MEM_FAIL, __LINE__, __func__, __FILE__,
+                      MSG_ARK_MEM_FAIL);
+      return ARK_MEM_FAIL;
+    }
+    step_mem->nslices_alloc = step_mem->nslices;
+  }
+
+  if (init_type == FIRST_INIT) { ark_mem->interp_degree = 1; }
+
+  return ARK_SUCCESS;
+}
+
+/*------------------------------------------------------------------------------
+  This routine sets the step direction of the coarse and fine integrators and
+  is called once the PararealStep integrator has updated its step direction.
+  ----------------------------------------------------------------------------*/
+static int pararealStep_SetStepDirection(ARKodeMem ark_mem, sunrealtype stepdir)
+{
+  ARKodePararealStepMem step_mem = NULL;
+  int retval = pararealStep_AccessStepMem(ark_mem, __func__, &step_mem);
+  if (retval != ARK_SUCCESS) { return retval; }
+
+  SUNErrCode err = SUNStepper_SetStepDirection(step_mem->coarse, stepdir);
+  if (err != SUN_SUCCESS)
+  {
+    arkProcessError(ark_mem, ARK_SUNSTEPPER_ERR, __LINE__, __func__, __FILE__,
+                    "Setting the step direction for the coarse SUNStepper "
+                    "failed");
+    return ARK_SUNSTEPPER_ERR;
+  }
+
+  for (int l = 0; l < step_mem->nfine; l++)
+  {
+    err = SUNStepper_SetStepDirection(step_mem->fine[l], stepdir);
+    if (err != SUN_SUCCESS)
+    {
+      arkProcessError(ark_mem, ARK_SUNSTEPPER_ERR, __LINE__, __func__,
+                      __FILE__,
+                      "Setting the step direction for fine SUNStepper %i "
+                      "failed",
+                      l);
+      return ARK_SUNSTEPPER_ERR;
+    }
+  }
+
+  return ARK_SUCCESS;
+}
+
+/*------------------------------------------------------------------------------
+  This is just a wrapper to call the fine SUNStepper full RHS function. The
+  state of the fine SUNStepper is not consistent with the PararealStep
+  integrator, so the SUN_FULLRHS_OTHER mode is always used.
+  ----------------------------------------------------------------------------*/
+static int pararealStep_FullRHS(ARKodeMem ark_mem, sunrealtype t, N_Vector y,
+                                N_Vector f, SUNDIALS_MAYBE_UNUSED int mode)
+{
+  ARKodePararealStepMem step_mem = NULL;
+  int retval = pararealStep_AccessStepMem(ark_mem, __func__, &step_mem);
+  if (retval != ARK_SUCCESS) { return retval; }
+
+  SUNErrCode err = SUNStepper_FullRhs(step_mem->fine[0], t, y, f,
+                                      SUN_FULLRHS_OTHER);
+  if (err != SUN_SUCCESS)
+  {
+    arkProcessError(ark_mem, ARK_RHSFUNC_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_RHSFUNC_FAILED, t);
+    return ARK_RHSFUNC_FAIL;
+  }
+
+  return ARK_SUCCESS;
+}
+
+/*------------------------------------------------------------------------------
+  This routine returns the time at the start of slice p (or the end of the step
+  when p is the number of slices)
+  ----------------------------------------------------------------------------*/
+static sunrealtype pararealStep_SliceTime(ARKodeMem ark_mem,
+                                          ARKodePararealStepMem step_mem, int p)
+{
+  if (p == step_mem->nslices) { return ark_mem->tn + ark_mem->h; }
+  return ark_mem->tn + (ark_mem->h * p) / step_mem->nslices;
+}
+
+/*------------------------------------------------------------------------------
+  This routine returns the initial condition for slice p
+  ----------------------------------------------------------------------------*/
+static N_Vector pararealStep_SliceStart(ARKodeMem ark_mem,
+                                        ARKodePararealStepMem step_mem, int p)
+{
+  return (p == 0) ? ark_mem->yn : step_mem->U[p - 1];
+}
+
+/*------------------------------------------------------------------------------
+  This routine evolves a SUNStepper over slice p from the initial condition y0
+  and stores the result in yf. It may be called concurrently with different
+  SUNSteppers, so any error is only reported through the return value.
+  ----------------------------------------------------------------------------*/
+static int pararealStep_Propagate(ARKodeMem ark_mem,
+                                  ARKodePararealStepMem step_mem,
+                                  SUNStepper stepper, int p, N_Vector y0,
+                                  N_Vector yf)
+{
+  sunrealtype t0   = pararealStep_SliceTime(ark_mem, step_mem, p);
+  sunrealtype tf   = pararealStep_SliceTime(ark_mem, step_mem, p + 1);
+  sunrealtype tret = ZERO;
+
+  if (SUNStepper_Reset(stepper, t0, y0) != SUN_SUCCESS)
+  {
+    return ARK_SUNSTEPPER_ERR;
+  }
+  if (SUNStepper_SetStopTime(stepper, tf) != SUN_SUCCESS)
+  {
+    return ARK_SUNSTEPPER_ERR;
+  }
+  if (SUNStepper_Evolve(stepper, tf, yf, &tret) != SUN_SUCCESS)
+  {
+    return ARK_SUNSTEPPER_ERR;
+  }
+
+  return ARK_SUCCESS;
+}
+
+/*------------------------------------------------------------------------------
+  This routine evolves slices first, ..., nslices - 1 with the fine SUNSteppers.
+  Thread l uses fine SUNStepper l and evolves slices first + l, first + l + n,
+  ... where n is the number of threads. The fine SUNSteppers do not share a
+  SUNContext (see pararealStep_CheckArgs), and a failure is only reported
+  through the return value once all threads have finished.
+  ----------------------------------------------------------------------------*/
+static int pararealStep_FineSweep(ARKodeMem ark_mem,
+                                  ARKodePararealStepMem step_mem, int first)
+{
+  int nthreads = SUNMIN(step_mem->nfine, step_mem->nslices - first);
+  int retval   = ARK_SUCCESS;
+
+  ARK_OMP_PRAGMA(omp parallel for schedule(static, 1) num_threads(nthreads) \
+                   reduction(min : retval))
+  for (int l = 0; l < nthreads; l++)
+  {
+    int thread_retval = ARK_SUCCESS;
+    for (int p = first + l; p < step_mem->nslices; p += nthreads)
+    {
+      thread_retval =
+        pararealStep_Propagate(ark_mem, step_mem, step_mem->fine[l], p,
+                               pararealStep_SliceStart(ark_mem, step_mem, p),
+                               step_mem->F[p]);
+      ARK_OMP_PRAGMA(omp atomic)
+      step_mem->n_fine_evolves++;
+      if (thread_retval != ARK_SUCCESS) { break; }
+    }
+    retval = SUNMIN(retval, thread_retval);
+  }
+
+  return retval;
+}
+
+/*------------------------------------------------------------------------------
+  This routine performs a single step of the Parareal method. The step is
+  divided into nslices slices which are first evolved sequentially with the
+  coarse propagator G. Each iteration k = 1, 2, ... evolves the slices which
+  have not converged concurrently with the fine propagator F and then applies
+  the sequential correction
+
+    U_p^k = G(U_{p-1}^k) + F(U_{p-1}^{k-1}) - G(U_{p-1}^{k-1})
+
+  until the WRMS norm of the updates is below the tolerance. After k iterations
+  the first k slices match the sequential fine solution.
+  ----------------------------------------------------------------------------*/
+static int pararealStep_TakeStep(ARKodeMem ark_mem, sunrealtype* dsmPtr,
+                                 int* nflagPtr)
+{
+  ARKodePararealStepMem step_mem = NULL;
+  int retval = pararealStep_AccessStepMem(ark_mem, __func__, &step_mem);
+  if (retval != ARK_SUCCESS) { return retval; }
+
+  *nflagPtr = ARK_SUCCESS; /* No algebraic solver */
+  *dsmPtr   = ZERO;        /* No error estimate */
+
+  int nslices   = step_mem->nslices;
+  int max_iters = (step_mem->max_iters > 0)
+                    ? SUNMIN(step_mem->max_iters, nslices)
+                    : nslices;
+  N_Vector* U   = step_mem->U;
+  N_Vector* G   = step_mem->G;
+  N_Vector* F   = step_mem->F;
+  sunrealtype cvals[3];
+  N_Vector Xvecs[3];
+
+  /* Initial coarse sweep */
+  SUNLogInfo(ARK_LOGGER, "begin-coarse-sweep", "slices = %i", nslices);
+
+  for (int p = 0; p < nslices; p++)
+  {
+    retval = pararealStep_Propagate(ark_mem, step_mem, step_mem->coarse, p,
+                                    pararealStep_SliceStart(ark_mem, step_mem,
+                                                            p),
+                                    G[p]);
+    if (retval != ARK_SUCCESS)
+    {
+      SUNLogInfo(ARK_LOGGER, "end-coarse-sweep",
+                 "status = failed coarse evolve, slice = %i", p);
+      return retval;
+    }
+    step_mem->n_coarse_evolves++;
+    N_VScale(ONE, G[p], U[p]);
+  }
+
+  SUNLogInfo(ARK_LOGGER, "end-coarse-sweep", "status = success");
+
+  for (int k = 1; k <= max_iters; k++)
+  {
+    /* Slices before 'first' have converged to the fine solution */
+    int first          = k - 1;
+    sunrealtype update = ZERO;
+
+    SUNLogInfo(ARK_LOGGER, "begin-iteration", "iteration = %i", k);
+
+    retval = pararealStep_FineSweep(ark_mem, step_mem, first);
+    if (retval != ARK_SUCCESS)
+    {
+      SUNLogInfo(ARK_LOGGER, "end-iteration",
+                 "status = failed fine evolve, retval = %i", retval);
+      return retval;
+    }
+
+    /* Slice 'first' starts from a converged state and needs no correction */
+    N_VLinearSum(ONE, F[first], -ONE, U[first], ark_mem->tempv1);
+    update = N_VWrmsNorm(ark_mem->tempv1, ark_mem->ewt);
+    N_VScale(ONE, F[first], U[first]);
+
+    /* Sequential coarse correction, the new coarse solution is stored in
+       tempv1 and the corrected solution in tempv2 */
+    for (int p = first + 1; p < nslices; p++)
+    {
+      retval = pararealStep_Propagate(ark_mem, step_mem, step_mem->coarse, p,
+                                      U[p - 1], ark_mem->tempv1);
+      if (retval != ARK_SUCCESS)
+      {
+        SUNLogInfo(ARK_LOGGER, "end-iteration",
+                   "status = failed coarse evolve, slice = %i", p);
+        return retval;
+      }
+      step_mem->n_coarse_evolves++;
+
+      cvals[0] = ONE;
+      Xvecs[0] = ark_mem->tempv1;
+      cvals[1] = ONE;
+      Xvecs[1] = F[p];
+      cvals[2] = -ONE;
+      Xvecs[2] = G[p];
+      retval   = N_VLinearCombination(3, cvals, Xvecs, ark_mem->tempv2);
+      if (retval != 0) { return ARK_VECTOROP_ERR; }
+
+      N_VLinearSum(ONE, ark_mem->tempv2, -ONE, U[p], ark_mem->tempv3);
+      update = SUNMAX(update, N_VWrmsNorm(ark_mem->tempv3, ark_mem->ewt));
+
+      N_VScale(ONE, ark_mem->tempv1, G[p]);
+      N_VScale(ONE, ark_mem->tempv2, U[p]);
+    }
+    step_mem->n_iters++;
+
+    SUNLogInfo(ARK_LOGGER, "end-iteration",
+               "status = success, max update = " SUN_FORMAT_G, update);
+
+    if (update <= step_mem->tol) { break; }
+  }
+
+  N_VScale(ONE, U[nslices - 1], ark_mem->ycur);
+
+  SUNLogExtraDebugVec(ARK_LOGGER, "current state", ark_mem->ycur, "y_cur(:) =");
+
+  return ARK_SUCCESS;
+}
+
+/*------------------------------------------------------------------------------
+  Prints integrator statistics
+  ----------------------------------------------------------------------------*/
+static int pararealStep_PrintAllStats(ARKodeMem ark_mem, FILE* outfile,
+                                      SUNOutputFormat fmt)
+{
+  ARKodePararealStepMem step_mem = NULL;
+  int retval = pararealStep_AccessStepMem(ark_mem, __func__, &step_mem);
+  if (retval != ARK_SUCCESS) { return retval; }
+
+  sunfprintf_long(outfile, fmt, SUNFALSE, "Parareal iterations",
+                  step_mem->n_iters);
+  sunfprintf_long(outfile, fmt, SUNFALSE, "Coarse evolves",
+                  step_mem->n_coarse_evolves);
+  sunfprintf_long(outfile, fmt, SUNFALSE, "Fine evolves",
+                  step_mem->n_fine_evolves);
+
+  return ARK_SUCCESS;
+}
+
+/*------------------------------------------------------------------------------
+  Frees all PararealStep memory.
+  ----------------------------------------------------------------------------*/
+static void pararealStep_Free(ARKodeMem ark_mem)
+{
+  ARKodePararealStepMem step_mem = (ARKodePararealStepMem)ark_mem->step_mem;
+  if (step_mem != NULL)
+  {
+    pararealStep_FreeSliceVectors(ark_mem, step_mem);
+    free(step_mem->fine);
+    free(step_mem);
+  }
+  ark_mem->step_mem = NULL;
+}
+
+/*------------------------------------------------------------------------------
+  This routine outputs the memory from the PararealStep structure to a
+  specified file pointer (useful when debugging).
+  ----------------------------------------------------------------------------*/
+static void pararealStep_PrintMem(ARKodeMem ark_mem, FILE* outfile)
+{
+  ARKodePararealStepMem step_mem = NULL;
+  int retval = pararealStep_AccessStepMem(ark_mem, __func__, &step_mem);
+  if (retval != ARK_SUCCESS) { return; }
+
+  fprintf(outfile, "PararealStep: nfine = %i\n", step_mem->nfine);
+  fprintf(outfile, "PararealStep: nslices = %i\n", step_mem->nslices);
+  fprintf(outfile, "PararealStep: max_iters = %i\n", step_mem->max_iters);
+  fprintf(outfile, "PararealStep: tol = " SUN_FORMAT_G "\n", step_mem->tol);
+  fprintf(outfile, "PararealStep: n_iters = %li\n", step_mem->n_iters);
+  fprintf(outfile, "PararealStep: n_coarse_evolves = %li\n",
+          step_mem->n_coarse_evolves);
+  fprintf(outfile, "PararealStep: n_fine_evolves = %li\n",
+          step_mem->n_fine_evolves);
+}
+
+/*------------------------------------------------------------------------------
+  This routine checks if all required SUNStepper operations are present. If any
+  of them are missing it return SUNFALSE.
+  ----------------------------------------------------------------------------*/
+static sunbooleantype pararealStep_CheckSUNStepper(SUNStepper stepper)
+{
+  SUNStepper_Ops ops = stepper->ops;
+  return ops->evolve != NULL && ops->reset != NULL && ops->setstoptime != NULL;
+}
+
+/*------------------------------------------------------------------------------
+  This routine validates arguments when (re)initializing a PararealStep
+  integrator
+  ----------------------------------------------------------------------------*/
+static int pararealStep_CheckArgs(ARKodeMem ark_mem, SUNStepper coarse,
+                                  SUNStepper* fine, int nfine, N_Vector y0)
+{
+  if (coarse == NULL)
+  {
+    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "coarse = NULL illegal.");
+    return ARK_ILL_INPUT;
+  }
+  if (!pararealStep_CheckSUNStepper(coarse))
+  {
+    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "The coarse SUNStepper does not implement the required "
+                    "operations.");
+    return ARK_ILL_INPUT;
+  }
+
+  if (fine == NULL || nfine < 1)
+  {
+    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "At least one fine SUNStepper is required.");
+    return ARK_ILL_INPUT;
+  }
+  for (int l = 0; l < nfine; l++)
+  {
+    if (fine[l] == NULL)
+    {
+      arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                      "fine[%i] = NULL illegal.", l);
+      return ARK_ILL_INPUT;
+    }
+    if (!pararealStep_CheckSUNStepper(fine[l]))
+    {
+      arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                      "fine[%i] does not implement the required operations.",
+                      l);
+      return ARK_ILL_INPUT;
+    }
+  }
+
+  /* The fine SUNSteppers are evolved concurrently and must not share a
+     SUNContext */
+  for (int l = 1; l < nfine; l++)
+  {
+    if (arkStepperContextsShared(&fine[l], 1, fine, l))
+    {
+      arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                      "fine[%i] shares a SUNContext with another fine "
+                      "SUNStepper.",
+                      l);
+      return ARK_ILL_INPUT;
+    }
+  }
+
+  if (y0 == NULL)
+  {
+    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NULL_Y0);
+    return ARK_ILL_INPUT;
+  }
+
+  return ARK_SUCCESS;
+}
+
+/*------------------------------------------------------------------------------
+  This routine stores the SUNSteppers in the step memory and resets the
+  statistics. The slice vectors and options are retained.
+  ----------------------------------------------------------------------------*/
+static int pararealStep_InitStepMem(ARKodePararealStepMem step_mem,
+                                    SUNStepper coarse, SUNStepper* fine,
+                                    int nfine)
+{
+  SUNStepper* fine_copy = (SUNStepper*)malloc(nfine * sizeof(SUNStepper));
+  if (fine_copy == NULL) { return ARK_MEM_FAIL; }
+  for (int l = 0; l < nfine; l++) { fine_copy[l] = fine[l]; }
+
+  free(step_mem->fine);
+  step_mem->coarse           = coarse;
+  step_mem->fine             = fine_copy;
+  step_mem->nfine            = nfine;
+  step_mem->n_iters          = 0;
+  step_mem->n_coarse_evolves = 0;
+  step_mem->n_fine_evolves   = 0;
+
+  return ARK_SUCCESS;
+}
+
+/*------------------------------------------------------------------------------
+  Creates the PararealStep integrator
+  ----------------------------------------------------------------------------*/
+void* PararealStepCreate(SUNStepper coarse, SUNStepper* fine, int nfine,
+                         sunrealtype t0, N_Vector y0, SUNContext sunctx)
+{
+  int retval = pararealStep_CheckArgs(NULL, coarse, fine, nfine, y0);
+  if (retval != ARK_SUCCESS) { return NULL; }
+
+  if (sunctx == NULL)
+  {
+    arkProcessError(NULL, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NULL_SUNCTX);
+    return NULL;
+  }
+
+  /* Create ark_mem structure and set default values */
+  ARKodeMem ark_mem = arkCreate(sunctx);
+  if (ark_mem == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return NULL;
+  }
+
+  ARKodePararealStepMem step_mem =
+    (ARKodePararealStepMem)calloc(1, sizeof(*step_mem));
+  if (step_mem == NULL)
+  {
+    arkProcessError(ark_mem, ARK_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_ARKMEM_FAIL);
+    ARKodeFree((void**)&ark_mem);
+    return NULL;
+  }
+
+  /* Attach step_mem structure and function pointers to ark_mem */
+  ark_mem->step_init             = pararealStep_Init;
+  ark_mem->step_fullrhs          = pararealStep_FullRHS;
+  ark_mem->step_setstepdirection = pararealStep_SetStepDirection;
+  ark_mem->step                  = pararealStep_TakeStep;
+  ark_mem->step_printallstats    = pararealStep_PrintAllStats;
+  ark_mem->step_free             = pararealStep_Free;
+  ark_mem->step_printmem         = pararealStep_PrintMem;
+  ark_mem->step_mem              = (void*)step_mem;
+
+  retval = pararealStep_InitStepMem(step_mem, coarse, fine, nfine);
+  if (retval != ARK_SUCCESS)
+  {
+    arkProcessError(ark_mem, ARK_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_ARKMEM_FAIL);
+    ARKodeFree((void**)&ark_mem);
+    return NULL;
+  }
+
+  /* Set default options */
+  step_mem->nslices_set = 0;
+  step_mem->max_iters   = 0;
+  step_mem->tol         = ONE;
+
+  /* Initialize main ARKODE infrastructure */
+  retval = arkInit(ark_mem, t0, y0, FIRST_INIT);
+  if (retval != ARK_SUCCESS)
+  {
+    arkProcessError(ark_mem, retval, __LINE__, __func__, __FILE__,
+                    "Unable to initialize main ARKODE infrastructure");
+    ARKodeFree((void**)&ark_mem);
+    return NULL;
+  }
+
+  ARKodeSetInterpolantType(ark_mem, ARK_INTERP_LAGRANGE);
+
+  return ark_mem;
+}
+
+/*------------------------------------------------------------------------------
+  This routine re-initializes the PararealStep module to solve a new problem of
+  the same size as was previously solved. This routine should also be called
+  when the problem dynamics or desired solvers have changed dramatically, so
+  that the problem integration should resume as if started from scratch.
+
+  Note all internal counters are set to 0 on re-initialization.
+  ----------------------------------------------------------------------------*/
+int PararealStepReInit(void* arkode_mem, SUNStepper coarse, SUNStepper* fine,
+                       int nfine, sunrealtype t0, N_Vector y0)
+{
+  ARKodeMem ark_mem              = NULL;
+  ARKodePararealStepMem step_mem = NULL;
+
+  int retval = pararealStep_AccessARKODEStepMem(arkode_mem, __func__, &ark_mem,
+                                                &step_mem);
+  if (retval != ARK_SUCCESS) { return (retval); }
+
+  /* Check if ark_mem was allocated */
+  if (ark_mem->MallocDone == SUNFALSE)
+  {
+    arkProcessError(ark_mem, ARK_NO_MALLOC, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_MALLOC);
+    return ARK_NO_MALLOC;
+  }
+
+  retval = pararealStep_CheckArgs(ark_mem, coarse, fine, nfine, y0);
+  if (retval != ARK_SUCCESS) { return retval; }
+
+  retval = pararealStep_InitStepMem(step_mem, coarse, fine, nfine);
+  if (retval != ARK_SUCCESS)
+  {
+    arkProcessError(ark_mem, ARK_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_ARKMEM_FAIL);
+    return ARK_MEM_FAIL;
+  }
+
+  /* Initialize main ARKODE infrastructure */
+  retval = arkInit(ark_mem, t0, y0, FIRST_INIT);
+  if (retval != ARK_SUCCESS)
+  {
+    arkProcessError(ark_mem, retval, __LINE__, __func__, __FILE__,
+                    "Unable to initialize main ARKODE infrastructure");
+    return retval;
+  }
+
+  return ARK_SUCCESS;
+}
+
+/*------------------------------------------------------------------------------
+  Sets the number of time slices per step. A nonpositive value selects the
+  default of one slice per fine SUNStepper.
+  ----------------------------------------------------------------------------*/
+int PararealStepSetNumSlices(void* arkode_mem, int nslices)
+{
+  ARKodeMem ark_mem              = NULL;
+  ARKodePararealStepMem step_mem = NULL;
+  int retval = pararealStep_AccessARKODEStepMem(arkode_mem, __func__, &ark_mem,
+                                                &step_mem);
+  if (retval != ARK_SUCCESS) { return retval; }
+
+  step_mem->nslices_set = (nslices > 0) ? nslices : 0;
+
+  return ARK_SUCCESS;
+}
+
+/*------------------------------------------------------------------------------
+  Sets the maximum number of Parareal iterations per step. A nonpositive value
+  selects the default of one iteration per slice, i.e., the sequential fine
+  solution is always recovered.
+  ----------------------------------------------------------------------------*/
+int PararealStepSetMaxIters(void* arkode_mem, int maxiters)
+{
+  ARKodeMem ark_mem              = NULL;
+  ARKodePararealStepMem step_mem = NULL;
+  int retval = pararealStep_AccessARKODEStepMem(arkode_mem, __func__, &ark_mem,
+                                                &step_mem);
+  if (retval != ARK_SUCCESS) { return retval; }
+
+  step_mem->max_iters = (maxiters > 0) ? maxiters : 0;
+
+  return ARK_SUCCESS;
+}
+
+/*------------------------------------------------------------------------------
+  Sets the tolerance for the WRMS norm of the updates in an iteration. A
+  negative value selects the default of one.
+  ----------------------------------------------------------------------------*/
+int PararealStepSetTolerance(void* arkode_mem, sunrealtype tol)
+{
+  ARKodeMem ark_mem              = NULL;
+  ARKodePararealStepMem step_mem = NULL;
+  int retval = pararealStep_AccessARKODEStepMem(arkode_mem, __func__, &ark_mem,
+                                                &step_mem);
+  if (retval != ARK_SUCCESS) { return retval; }
+
+  step_mem->tol = (tol < ZERO) ? ONE : tol;
+
+  return ARK_SUCCESS;
+}
+
+/*------------------------------------------------------------------------------
+  Accesses the total number of Parareal iterations
+  ----------------------------------------------------------------------------*/
+int PararealStepGetNumIters(void* arkode_mem, long int* iters)
+{
+  ARKodeMem ark_mem              = NULL;
+  ARKodePararealStepMem step_mem = NULL;
+  int retval = pararealStep_AccessARKODEStepMem(arkode_mem, __func__, &ark_mem,
+                                                &step_mem);
+  if (retval != ARK_SUCCESS) { return retval; }
+
+  *iters = step_mem->n_iters;
+
+  return ARK_SUCCESS;
+}
+
+/*------------------------------------------------------------------------------
+  Accesses the number of times the coarse and fine SUNSteppers were evolved
+  ----------------------------------------------------------------------------*/
+int PararealStepGetNumEvolves(void* arkode_mem, long int* coarse_evolves,
+                              long int* fine_evolves)
+{
+  ARKodeMem ark_mem              = NULL;
+  ARKodePararealStepMem step_mem = NULL;
+  int retval = pararealStep_AccessARKODEStepMem(arkode_mem, __func__, &ark_mem,
+                                                &step_mem);
+  if (retval != ARK_SUCCESS) { return retval; }
+
+  *coarse_evolves = step_mem->n_coarse_evolves;
+  *fine_evolves   = step_mem->n_fine_evolves;
+
+  return ARK_SUCCESS;
+}
@@ -0,0 +1,44 @@
+/*---------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ *---------------------------------------------------------------
+ * This header defines the step memory for PararealStep.
+ *--------------------------------------------------------------*/
+
+#ifndef ARKODE_PARAREALSTEP_IMPL_H_
+#define ARKODE_PARAREALSTEP_IMPL_H_
+
+#include <sundials/sundials_stepper.h>
+
+typedef struct ARKodePararealStepMemRec
+{
+  SUNStepper coarse; /* coarse propagator                     */
+  SUNStepper* fine;  /* fine propagators, one per thread      */
+  int nfine;         /* number of fine propagators            */
+
+  int nslices_set; /* requested number of slices, 0 = nfine */
+  int max_iters;   /* maximum number of iterations per step */
+  sunrealtype tol; /* tolerance on the WRMS norm of updates */
+
+  /* Slice data, U[p] is the solution at the end of slice p and G[p] and F[p]
+     the coarse and fine solutions from the start of slice p */
+  N_Vector* U;
+  N_Vector* G;
+  N_Vector* F;
+  int nslices;       /* number of time slices per step   */
+  int nslices_alloc; /* length of the slice vector arrays */
+
+  /* Counters */
+  long int n_iters;          /* total number of iterations  */
+  long int n_coarse_evolves; /* number of coarse evolves    */
+  long int n_fine_evolves;   /* number of fine evolves      */
+}* ARKodePararealStepMem;
+
+#endif
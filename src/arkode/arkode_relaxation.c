@@ -16,7 +16,8 @@
  *
  * Temporary vectors utilized in the functions below:
  *   tempv2 - holds delta_y, the update direction vector
- *   tempv3 - holds y_relax, the relaxed solution vector
+ *   tempv3 - holds y_relax, the relaxed solution vector, or W delta_y with a
+ *            weighted quadratic relaxation function
  *   tempv4 - holds J_relax, the Jacobian of the relaxation function
  * ---------------------------------------------------------------------------*/
 
@@ -56,6 +57,22 @@ static int arkRelaxAccessMem(void* arkode_mem, const char* fname,
   return ARK_SUCCESS;
 }
 
+/* Placeholder relaxation function and Jacobian attached with a quadratic
+   relaxation function, the quadratic function is evaluated directly */
+static int arkRelaxQuadraticFn(SUNDIALS_MAYBE_UNUSED N_Vector y,
+                               SUNDIALS_MAYBE_UNUSED sunrealtype* r,
+                               SUNDIALS_MAYBE_UNUSED void* user_data)
+{
+  return ARK_RELAX_FUNC_FAIL;
+}
+
+static int arkRelaxQuadraticJac(SUNDIALS_MAYBE_UNUSED N_Vector y,
+                                SUNDIALS_MAYBE_UNUSED N_Vector J,
+                                SUNDIALS_MAYBE_UNUSED void* user_data)
+{
+  return ARK_RELAX_JAC_FAIL;
+}
+
 /* Evaluates the relaxation residual function */
 static int arkRelaxResidual(sunrealtype relax_param, sunrealtype* relax_res,
                             ARKodeMem ark_mem)
@@ -333,6 +350,54 @@ static int arkRelaxBrentSolve(ARKodeMem ark_mem)
   return ARK_RELAX_SOLVE_RECV;
 }
 
+/* Solve the relaxation residual equation for the quadratic relaxation function
+   xi(y) = 1/2 <y, W y>. With delta_y = y_n - y_{n-1} the residual is
+
+     F(r) = r <y_{n-1}, W delta_y> + r^2 / 2 <delta_y, W delta_y> - r delta_e
+
+   and the nonzero root follows from the two inner products computed with a
+   single fused dot product. As with the iterative solvers, the previous value
+   is kept if it satisfies the residual tolerance since the root is sensitive
+   to roundoff when the update is small. */
+static int arkRelaxQuadraticSolve(ARKodeMem ark_mem)
+{
+  int retval;
+  sunrealtype r, dots[2];
+  N_Vector Yvecs[2];
+  N_Vector delta_y         = ark_mem->tempv2;
+  N_Vector W_delta_y       = ark_mem->tempv2;
+  ARKodeRelaxMem relax_mem = ark_mem->relax_mem;
+
+  if (relax_mem->weight)
+  {
+    W_delta_y = ark_mem->tempv3;
+    N_VProd(relax_mem->weight, delta_y, W_delta_y);
+  }
+
+  Yvecs[0] = ark_mem->yn;
+  Yvecs[1] = delta_y;
+
+  retval = N_VDotProdMulti(2, W_delta_y, Yvecs, dots);
+  if (retval) { return ARK_VECTOROP_ERR; }
+
+  SUNLogExtraDebug(ARK_LOGGER, "quadratic inner products",
+                   "<yn, W dy> = " SUN_FORMAT_G ", <dy, W dy> = " SUN_FORMAT_G,
+                   dots[0], dots[1]);
+
+  /* Check the residual with the previous relaxation parameter */
+  r                      = relax_mem->relax_param_prev;
+  relax_mem->relax_param = r;
+  relax_mem->res = r * (dots[0] + HALF * r * dots[1] - relax_mem->delta_e);
+
+  if (SUNRabs(relax_mem->res) < relax_mem->res_tol) { return ARK_SUCCESS; }
+  if (dots[1] == ZERO) { return ARK_RELAX_SOLVE_RECV; }
+
+  relax_mem->relax_param = TWO * (relax_mem->delta_e - dots[0]) / dots[1];
+  relax_mem->res         = ZERO;
+
+  return ARK_SUCCESS;
+}
+
 /* Compute and apply relaxation parameter */
 static int arkRelaxSolve(ARKodeMem ark_mem, ARKodeRelaxMem relax_mem,
                          sunrealtype* relax_val_out)
@@ -340,9 +405,7 @@ static int arkRelaxSolve(ARKodeMem ark_mem, ARKodeRelaxMem relax_mem,
   int retval;
 
   /* Get the change in entropy (uses temp vectors 2 and 3) */
-  retval = relax_mem->delta_e_fn(ark_mem, relax_mem->relax_jac_fn,
-                                 &(relax_mem->num_relax_jac_evals),
-                                 &(relax_mem->delta_e));
+  retval = relax_mem->delta_e_fn(ark_mem, &(relax_mem->delta_e));
   if (retval) { return retval; }
 
   SUNLogExtraDebug(ARK_LOGGER, "compute delta e", "delta_e = " SUN_FORMAT_G,
@@ -354,24 +417,28 @@ static int arkRelaxSolve(ARKodeMem ark_mem, ARKodeRelaxMem relax_mem,
   SUNLogExtraDebugVec(ARK_LOGGER, "compute delta y", ark_mem->tempv2,
                       "delta_y(:) =");
 
-  /* Store the current relaxation function value */
-  retval = relax_mem->relax_fn(ark_mem->yn, &(relax_mem->e_old),
-                               ark_mem->user_data);
-  relax_mem->num_relax_fn_evals++;
-  if (retval < 0) { return ARK_RELAX_FUNC_FAIL; }
-  if (retval > 0) { return ARK_RELAX_FUNC_RECV; }
+  if (relax_mem->quadratic) { retval = arkRelaxQuadraticSolve(ark_mem); }
+  else
+  {
+    /* Store the current relaxation function value */
+    retval = relax_mem->relax_fn(ark_mem->yn, &(relax_mem->e_old),
+                                 ark_mem->user_data);
+    relax_mem->num_relax_fn_evals++;
+    if (retval < 0) { return ARK_RELAX_FUNC_FAIL; }
+    if (retval > 0) { return ARK_RELAX_FUNC_RECV; }
 
-  SUNLogExtraDebug(ARK_LOGGER, "compute old e", "e_old = " SUN_FORMAT_G,
-                   relax_mem->e_old);
+    SUNLogExtraDebug(ARK_LOGGER, "compute old e", "e_old = " SUN_FORMAT_G,
+                     relax_mem->e_old);
 
-  /* Initial guess for relaxation parameter */
-  relax_mem->relax_param = relax_mem->relax_param_prev;
+    /* Initial guess for relaxation parameter */
+    relax_mem->relax_param = relax_mem->relax_param_prev;
 
-  switch (relax_mem->solver)
-  {
-  case (ARK_RELAX_BRENT): retval = arkRelaxBrentSolve(ark_mem); break;
-  case (ARK_RELAX_NEWTON): retval = arkRelaxNewtonSolve(ark_mem); break;
-  default: return ARK_ILL_INPUT; break;
+    switch (relax_mem->solver)
+    {
+    case (ARK_RELAX_BRENT): retval = arkRelaxBrentSolve(ark_mem); break;
+    case (ARK_RELAX_NEWTON): retval = arkRelaxNewtonSolve(ark_mem); break;
+    default: return ARK_ILL_INPUT; break;
+    }
   }
 
   /* Check for solver failure */
@@ -408,6 +475,7 @@ static int arkRelaxSolve(ARKodeMem ark_mem, ARKodeRelaxMem relax_mem,
 
 int ARKodeSetRelaxFn(void* arkode_mem, ARKRelaxFn rfn, ARKRelaxJacFn rjac)
 {
+  int retval;
   ARKodeMem ark_mem;
   if (arkode_mem == NULL)
   {
@@ -428,7 +496,8 @@ int ARKodeSetRelaxFn(void* arkode_mem, ARKRelaxFn rfn, ARKRelaxJacFn rjac)
   /* Call stepper-specific routine (if it exists) */
   if (ark_mem->step_setrelaxfn)
   {
-    return ark_mem->step_setrelaxfn(arkode_mem, rfn, rjac);
+    retval = ark_mem->step_setrelaxfn(arkode_mem, rfn, rjac);
+    if (retval) { return retval; }
   }
   else
   {
@@ -436,6 +505,93 @@ int ARKodeSetRelaxFn(void* arkode_mem, ARKRelaxFn rfn, ARKRelaxJacFn rjac)
                     __FILE__, "time-stepping module does not support relaxation");
     return (ARK_STEPPER_UNSUPPORTED);
   }
+
+  /* The weights are only used by the quadratic relaxation function */
+  if (ark_mem->relax_mem)
+  {
+    arkFreeVec(ark_mem, &(ark_mem->relax_mem->weight));
+  }
+
+  return ARK_SUCCESS;
+}
+
+int ARKodeSetRelaxQuadratic(void* arkode_mem, N_Vector weight)
+{
+  int retval;
+  ARKodeMem ark_mem;
+  ARKodeRelaxMem relax_mem;
+  N_Vector new_weight = NULL;
+
+  if (arkode_mem == NULL)
+  {
+    arkProcessError(NULL, ARK_MEM_NULL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_NO_MEM);
+    return (ARK_MEM_NULL);
+  }
+  ark_mem = (ARKodeMem)arkode_mem;
+
+  /* Ensure that the current N_Vector supports N_VDotProd */
+  if (ark_mem->tempv1->ops->nvdotprod == NULL)
+  {
+    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "N_VDotProd unimplemented (required for relaxation)");
+    return (ARK_ILL_INPUT);
+  }
+
+  if (weight && ark_mem->tempv1->ops->nvprod == NULL)
+  {
+    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "N_VProd unimplemented (required for weights)");
+    return (ARK_ILL_INPUT);
+  }
+
+  if (!ark_mem->step_setrelaxfn)
+  {
+    arkProcessError(ark_mem, ARK_STEPPER_UNSUPPORTED, __LINE__, __func__,
+                    __FILE__, "time-stepping module does not support relaxation");
+    return (ARK_STEPPER_UNSUPPORTED);
+  }
+
+  /* Allocate the weights before enabling relaxation, so that relaxation is
+     left unchanged if the allocation fails */
+  if (weight && !(ark_mem->relax_mem && ark_mem->relax_mem->weight))
+  {
+    new_weight = N_VClone(weight);
+    if (!new_weight)
+    {
+      arkProcessError(ark_mem, ARK_MEM_FAIL, __LINE__, __func__, __FILE__,
+                      MSG_ARK_MEM_FAIL);
+      return ARK_MEM_FAIL;
+    }
+  }
+
+  /* Enable relaxation with the placeholder functions */
+  retval = ark_mem->step_setrelaxfn(ark_mem, arkRelaxQuadraticFn,
+                                    arkRelaxQuadraticJac);
+  if (retval)
+  {
+    if (new_weight) { N_VDestroy(new_weight); }
+    return retval;
+  }
+
+  relax_mem = ark_mem->relax_mem;
+
+  /* Copy the weights */
+  if (weight)
+  {
+    if (new_weight)
+    {
+      relax_mem->weight = new_weight;
+      ark_mem->lrw += ark_mem->lrw1;
+      ark_mem->liw += ark_mem->liw1;
+    }
+    N_VScale(ONE, weight, relax_mem->weight);
+  }
+  else { arkFreeVec(ark_mem, &(relax_mem->weight)); }
+
+  relax_mem->quadratic = SUNTRUE;
+
+  return ARK_SUCCESS;
 }
 
 int ARKodeSetRelaxEtaFail(void* arkode_mem, sunrealtype eta_fail)
@@ -837,6 +993,7 @@ int arkRelaxCreate(ARKodeMem ark_mem, ARKRelaxFn relax_fn,
   ark_mem->relax_mem->relax_jac_fn = relax_jac_fn;
   ark_mem->relax_mem->delta_e_fn   = delta_e_fn;
   ark_mem->relax_mem->get_order_fn = get_order_fn;
+  ark_mem->relax_mem->quadratic    = SUNFALSE;
 
   /* Enable relaxation */
   ark_mem->relax_enabled = SUNTRUE;
@@ -849,6 +1006,9 @@ int arkRelaxDestroy(ARKodeRelaxMem relax_mem)
 {
   if (!relax_mem) { return ARK_SUCCESS; }
 
+  /* Free quadratic relaxation function weights */
+  if (relax_mem->weight) { N_VDestroy(relax_mem->weight); }
+
   /* Free structure */
   free(relax_mem);
 
@@ -913,6 +1073,28 @@ int arkRelax(ARKodeMem ark_mem, int* relax_fails, sunrealtype* dsm_inout)
   return ARK_SUCCESS;
 }
 
+/* Evaluate the Jacobian of the relaxation function, called by stepper */
+int arkRelaxJac(ARKodeMem ark_mem, N_Vector y, N_Vector J)
+{
+  int retval;
+  ARKodeRelaxMem relax_mem = ark_mem->relax_mem;
+
+  /* The Jacobian of xi(y) = 1/2 <y, W y> is W y */
+  if (relax_mem->quadratic)
+  {
+    if (relax_mem->weight) { N_VProd(relax_mem->weight, y, J); }
+    else { N_VScale(ONE, y, J); }
+    return ARK_SUCCESS;
+  }
+
+  retval = relax_mem->relax_jac_fn(y, J, ark_mem->user_data);
+  relax_mem->num_relax_jac_evals++;
+  if (retval < 0) { return ARK_RELAX_JAC_FAIL; }
+  if (retval > 0) { return ARK_RELAX_JAC_RECV; }
+
+  return ARK_SUCCESS;
+}
+
 /* Print relaxation solver statistics, called by ARKODE */
 int arkRelaxPrintAllStats(void* arkode_mem, FILE* outfile, SUNOutputFormat fmt)
 {
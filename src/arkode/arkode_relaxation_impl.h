@@ -50,8 +50,7 @@
  * ---------------------------------------------------------------------------*/
 
 /* Compute the estimated change in entropy for this step delta_e */
-typedef int (*ARKRelaxDeltaEFn)(ARKodeMem ark_mem, ARKRelaxJacFn relax_jac_fn,
-                                long int* evals_out, sunrealtype* delta_e_out);
+typedef int (*ARKRelaxDeltaEFn)(ARKodeMem ark_mem, sunrealtype* delta_e_out);
 
 /* Get the method order */
 typedef int (*ARKRelaxGetOrderFn)(ARKodeMem ark_mem);
@@ -68,6 +67,10 @@ struct ARKodeRelaxMemRec
   ARKRelaxDeltaEFn delta_e_fn;     /* get delta entropy from stepper       */
   ARKRelaxGetOrderFn get_order_fn; /* get the method order                 */
 
+  /* quadratic relaxation function xi(y) = 1/2 <y, W y> */
+  sunbooleantype quadratic; /* use the quadratic function           */
+  N_Vector weight;          /* diagonal of W, NULL for the identity */
+
   /* relaxation variables */
   int max_fails;                /* max allowed relax fails in a step   */
   long int num_relax_fn_evals;  /* counter for total function evals    */
@@ -104,6 +107,7 @@ int arkRelaxCreate(ARKodeMem ark_mem, ARKRelaxFn relax_fn,
                    ARKRelaxGetOrderFn get_order_fn);
 int arkRelaxDestroy(ARKodeRelaxMem relax_mem);
 int arkRelax(ARKodeMem ark_mem, int* relax_fails, sunrealtype* dsm_inout);
+int arkRelaxJac(ARKodeMem ark_mem, N_Vector y, N_Vector J);
 
 /* User Functions */
 int arkRelaxPrintAllStats(void* arkode_mem, FILE* outfile, SUNOutputFormat fmt);
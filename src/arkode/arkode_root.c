@@ -92,6 +92,10 @@ int ARKodeRootInit(void* arkode_mem, int nrtfn, ARKRootFn g)
     ark_mem->root_mem->gactive   = NULL;
     ark_mem->root_mem->mxgnull   = 1;
     ark_mem->root_mem->root_data = ark_mem->user_data;
+    ark_mem->root_mem->gsub      = NULL;
+    ark_mem->root_mem->gmask     = NULL;
+    ark_mem->root_mem->gdotmax   = NULL;
+    ark_mem->root_mem->gtime     = NULL;
 
     ark_mem->lrw += ARK_ROOT_LRW;
     ark_mem->liw += ARK_ROOT_LIW;
@@ -117,6 +121,10 @@ int ARKodeRootInit(void* arkode_mem, int nrtfn, ARKRootFn g)
 
     ark_mem->lrw -= 3 * (ark_mem->root_mem->nrtfn);
     ark_mem->liw -= 3 * (ark_mem->root_mem->nrtfn);
+
+    /* the subset evaluation data is sized for the old functions */
+    arkRootFreeSubset(ark_mem);
+    ark_mem->root_mem->gsub = NULL;
   }
 
   /* If ARKodeRootInit() was called with nrtfn == 0, then set
@@ -309,6 +317,7 @@ int arkRootFree(void* arkode_mem)
       ark_mem->root_mem->gactive = NULL;
       ark_mem->lrw -= 3 * ark_mem->root_mem->nrtfn;
       ark_mem->liw -= 3 * ark_mem->root_mem->nrtfn;
+      arkRootFreeSubset(ark_mem);
     }
     free(ark_mem->root_mem);
     ark_mem->lrw -= ARK_ROOT_LRW;
@@ -317,6 +326,99 @@ int arkRootFree(void* arkode_mem)
   return (ARK_SUCCESS);
 }
 
+/*---------------------------------------------------------------
+  arkRootFreeSubset
+
+  This routine frees the arrays used for evaluating a subset of
+  the root functions.
+  ---------------------------------------------------------------*/
+void arkRootFreeSubset(void* arkode_mem)
+{
+  ARKodeMem ark_mem = (ARKodeMem)arkode_mem;
+  ARKodeRootMem rootmem;
+  if (ark_mem == NULL || ark_mem->root_mem == NULL) { return; }
+  rootmem = ark_mem->root_mem;
+
+  if (rootmem->gmask != NULL)
+  {
+    free(rootmem->gmask);
+    rootmem->gmask = NULL;
+    ark_mem->liw -= rootmem->nrtfn;
+  }
+  if (rootmem->gtime != NULL)
+  {
+    free(rootmem->gtime);
+    rootmem->gtime = NULL;
+    ark_mem->lrw -= rootmem->nrtfn;
+  }
+  if (rootmem->gdotmax != NULL)
+  {
+    free(rootmem->gdotmax);
+    rootmem->gdotmax = NULL;
+    ark_mem->lrw -= rootmem->nrtfn;
+  }
+}
+
+/*---------------------------------------------------------------
+  arkRootEval
+
+  This routine evaluates the root functions at (t, y) and stores
+  the result in gout.  If sparse is SUNTRUE and a subset function
+  was supplied, only the components flagged in gmask are
+  evaluated and the remaining entries of gout are unchanged.  All
+  evaluations of g go through this routine so that they are
+  counted in nge.
+  ---------------------------------------------------------------*/
+static int arkRootEval(ARKodeMem ark_mem, sunrealtype t, N_Vector y,
+                       sunrealtype* gout, sunbooleantype sparse)
+{
+  ARKodeRootMem rootmem = ark_mem->root_mem;
+
+  rootmem->nge++;
+  if (sparse && rootmem->gsub != NULL)
+  {
+    return rootmem->gsub(t, y, gout, rootmem->gmask, rootmem->root_data);
+  }
+  return rootmem->gfun(t, y, gout, rootmem->root_data);
+}
+
+/*---------------------------------------------------------------
+  arkRootEvalSubset
+
+  This routine sets gout to g at (t, ycur) given the last values
+  of g in glo, computed at the times in gtime.  Only the inactive
+  g_i and the g_i that were not evaluated at t are updated with
+  the subset function.  If rate bounds were supplied, the latter
+  are further restricted to the g_i that could have changed sign
+  since they were last evaluated, and the other entries of gout
+  are copied from glo.  The evaluated components are flagged in
+  gmask on return.
+  ---------------------------------------------------------------*/
+static int arkRootEvalSubset(ARKodeMem ark_mem, sunrealtype t,
+                             sunrealtype* gout)
+{
+  int i;
+  sunbooleantype update;
+  ARKodeRootMem rootmem = ark_mem->root_mem;
+
+  update = SUNFALSE;
+  for (i = 0; i < rootmem->nrtfn; i++)
+  {
+    rootmem->gmask[i] = !rootmem->gactive[i] || rootmem->gtime[i] != t;
+    if (rootmem->gmask[i] && rootmem->gactive[i] && rootmem->gdotmax != NULL &&
+        rootmem->gdotmax[i] >= ZERO)
+    {
+      rootmem->gmask[i] = SUNRabs(rootmem->glo[i]) <=
+                          rootmem->gdotmax[i] * SUNRabs(t - rootmem->gtime[i]);
+    }
+    if (rootmem->gmask[i]) { update = SUNTRUE; }
+    else { gout[i] = rootmem->glo[i]; }
+  }
+  if (!update) { return (0); }
+
+  return (arkRootEval(ark_mem, t, ark_mem->ycur, gout, SUNTRUE));
+}
+
 /*---------------------------------------------------------------
   arkPrintRootMem
 
@@ -431,9 +533,9 @@ int arkRootCheck1(void* arkode_mem)
                   ark_mem->uround * HUND;
 
   /* Evaluate g at initial t and check for zero values. */
-  retval       = rootmem->gfun(rootmem->tlo, ark_mem->yn, rootmem->glo,
-                               rootmem->root_data);
-  rootmem->nge = 1;
+  rootmem->nge = 0;
+  retval = arkRootEval(ark_mem, rootmem->tlo, ark_mem->yn, rootmem->glo,
+                       SUNFALSE);
   if (retval != 0)
   {
     arkProcessError(ark_mem, ARK_RTFUNC_FAIL, __LINE__, __func__, __FILE__,
@@ -441,6 +543,11 @@ int arkRootCheck1(void* arkode_mem)
     return (ARK_RTFUNC_FAIL);
   }
 
+  if (rootmem->gtime != NULL)
+  {
+    for (i = 0; i < rootmem->nrtfn; i++) { rootmem->gtime[i] = rootmem->tlo; }
+  }
+
   zroot = SUNFALSE;
   for (i = 0; i < rootmem->nrtfn; i++)
   {
@@ -471,8 +578,7 @@ int arkRootCheck1(void* arkode_mem)
   smallh = hratio * ark_mem->h;
   tplus  = rootmem->tlo + smallh;
   N_VLinearSum(ONE, ark_mem->yn, smallh, ark_mem->fn, ark_mem->ycur);
-  retval = rootmem->gfun(tplus, ark_mem->ycur, rootmem->ghi, rootmem->root_data);
-  rootmem->nge++;
+  retval = arkRootEval(ark_mem, tplus, ark_mem->ycur, rootmem->ghi, SUNFALSE);
   if (retval != 0)
   {
     arkProcessError(ark_mem, ARK_RTFUNC_FAIL, __LINE__, __func__, __FILE__,
@@ -488,6 +594,7 @@ int arkRootCheck1(void* arkode_mem)
     {
       rootmem->gactive[i] = SUNTRUE;
       rootmem->glo[i]     = rootmem->ghi[i];
+      if (rootmem->gtime != NULL) { rootmem->gtime[i] = tplus; }
     }
   }
   return (ARK_SUCCESS);
@@ -536,10 +643,25 @@ int arkRootCheck2(void* arkode_mem)
   (void)ARKodeGetDky(ark_mem, rootmem->tlo, 0, ark_mem->ycur);
 
   /* Evaluate root-finding function: glo = g(tlo, y(tlo)) */
-  retval = rootmem->gfun(rootmem->tlo, ark_mem->ycur, rootmem->glo,
-                         rootmem->root_data);
-  rootmem->nge++;
-  if (retval != 0) { return (ARK_RTFUNC_FAIL); }
+  if (rootmem->gsub != NULL)
+  {
+    retval = arkRootEvalSubset(ark_mem, rootmem->tlo, rootmem->glo);
+    if (retval != 0) { return (ARK_RTFUNC_FAIL); }
+    for (i = 0; i < rootmem->nrtfn; i++)
+    {
+      if (rootmem->gmask[i]) { rootmem->gtime[i] = rootmem->tlo; }
+    }
+  }
+  else
+  {
+    retval = arkRootEval(ark_mem, rootmem->tlo, ark_mem->ycur, rootmem->glo,
+                         SUNFALSE);
+    if (retval != 0) { return (ARK_RTFUNC_FAIL); }
+    if (rootmem->gtime != NULL)
+    {
+      for (i = 0; i < rootmem->nrtfn; i++) { rootmem->gtime[i] = rootmem->tlo; }
+    }
+  }
 
   /* reset root-finding flags (overall, and for specific eqns) */
   zroot = SUNFALSE;
@@ -576,9 +698,17 @@ int arkRootCheck2(void* arkode_mem)
     (void)ARKodeGetDky(ark_mem, tplus, 0, ark_mem->ycur);
   }
   /*     set ghi = g(tplus,y(tplus)) */
-  retval = rootmem->gfun(tplus, ark_mem->ycur, rootmem->ghi, rootmem->root_data);
-  rootmem->nge++;
-  if (retval != 0) { return (ARK_RTFUNC_FAIL); }
+  if (rootmem->gsub != NULL)
+  {
+    retval = arkRootEvalSubset(ark_mem, tplus, rootmem->ghi);
+    if (retval != 0) { return (ARK_RTFUNC_FAIL); }
+  }
+  else
+  {
+    retval = arkRootEval(ark_mem, tplus, ark_mem->ycur, rootmem->ghi,
+                         SUNFALSE);
+    if (retval != 0) { return (ARK_RTFUNC_FAIL); }
+  }
 
   /* Check for close roots (error return), for a new zero at tlo+smallh,
   and for a g_i that changed from zero to nonzero. */
@@ -594,7 +724,11 @@ int arkRootCheck2(void* arkode_mem)
     }
     else
     {
-      if (rootmem->iroots[i] == 1) { rootmem->glo[i] = rootmem->ghi[i]; }
+      if (rootmem->iroots[i] == 1)
+      {
+        rootmem->glo[i] = rootmem->ghi[i];
+        if (rootmem->gtime != NULL) { rootmem->gtime[i] = tplus; }
+      }
     }
   }
   if (zroot) { return (RTFOUND); }
@@ -648,10 +782,25 @@ int arkRootCheck3(void* arkode_mem)
   }
 
   /* Set rootmem->ghi = g(thi) and call arkRootfind to search (tlo,thi) for roots. */
-  retval = rootmem->gfun(rootmem->thi, ark_mem->ycur, rootmem->ghi,
-                         rootmem->root_data);
-  rootmem->nge++;
-  if (retval != 0) { return (ARK_RTFUNC_FAIL); }
+  if (rootmem->gsub != NULL)
+  {
+    retval = arkRootEvalSubset(ark_mem, rootmem->thi, rootmem->ghi);
+    if (retval != 0) { return (ARK_RTFUNC_FAIL); }
+    for (i = 0; i < rootmem->nrtfn; i++)
+    {
+      if (rootmem->gmask[i]) { rootmem->gtime[i] = rootmem->thi; }
+    }
+  }
+  else
+  {
+    retval = arkRootEval(ark_mem, rootmem->thi, ark_mem->ycur, rootmem->ghi,
+                         SUNFALSE);
+    if (retval != 0) { return (ARK_RTFUNC_FAIL); }
+    if (rootmem->gtime != NULL)
+    {
+      for (i = 0; i < rootmem->nrtfn; i++) { rootmem->gtime[i] = rootmem->thi; }
+    }
+  }
 
   rootmem->ttol = (SUNRabs(ark_mem->tcur) + SUNRabs(ark_mem->h)) *
                   ark_mem->uround * HUND;
@@ -697,6 +846,14 @@ int arkRootCheck3(void* arkode_mem)
   gfun     = user-defined function for g(t).  Its form is
              (void) gfun(t, y, gt, user_data)
 
+  gsub     = optional user-defined function evaluating the
+             components of g(t) flagged in gmask.  If supplied,
+             only the g_i with a sign change or zero at thi are
+             evaluated while searching for the root.
+
+  gtime    = if allocated, the times at which the g_i values
+             in glo and ghi were last evaluated.
+
   rootdir  = in array specifying the direction of zero-crossings.
              If rootdir[i] > 0, search for roots of g_i only if
              g_i is increasing; if rootdir[i] < 0, search for
@@ -818,6 +975,22 @@ int arkRootfind(void* arkode_mem)
     return (RTFOUND);
   }
 
+  /* If a subset function was supplied, only the g_i that change sign or are
+     zero at thi (and the inactive g_i) are evaluated during the search; the
+     others keep their value at thi as they do not change sign in (tlo,thi).
+     Since a root is always found below, arkRootCheck2 updates any of these g_i
+     that may vanish at the root before the next search. */
+  if (rootmem->gsub != NULL)
+  {
+    for (i = 0; i < rootmem->nrtfn; i++)
+    {
+      rootmem->gmask[i] = !rootmem->gactive[i] ||
+                          SUNRabs(rootmem->ghi[i]) == ZERO ||
+                          DIFFERENT_SIGN(rootmem->glo[i], rootmem->ghi[i]);
+      if (!rootmem->gmask[i]) { rootmem->grout[i] = rootmem->ghi[i]; }
+    }
+  }
+
   /* Initialize alpha to avoid compiler warning */
   alpha = ONE;
 
@@ -861,9 +1034,8 @@ int arkRootfind(void* arkode_mem)
     }
 
     (void)ARKodeGetDky(ark_mem, tmid, 0, ark_mem->ycur);
-    retval = rootmem->gfun(tmid, ark_mem->ycur, rootmem->grout,
-                           rootmem->root_data);
-    rootmem->nge++;
+    retval = arkRootEval(ark_mem, tmid, ark_mem->ycur, rootmem->grout,
+                         SUNTRUE);
     if (retval != 0) { return (ARK_RTFUNC_FAIL); }
 
     /* Check to see in which subinterval g changes sign, and reset imax.
@@ -937,6 +1109,11 @@ int arkRootfind(void* arkode_mem)
   rootmem->trout = rootmem->thi;
   for (i = 0; i < rootmem->nrtfn; i++)
   {
+    if (rootmem->gtime != NULL &&
+        (rootmem->gsub == NULL || rootmem->gmask[i]))
+    {
+      rootmem->gtime[i] = rootmem->thi;
+    }
     rootmem->grout[i]  = rootmem->ghi[i];
     rootmem->iroots[i] = 0;
     if (!rootmem->gactive[i]) { continue; }
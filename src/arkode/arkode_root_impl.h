@@ -67,6 +67,11 @@ typedef struct ARKodeRootMemRec
   int mxgnull;             /* num. warning messages about possible g==0    */
   void* root_data;         /* pointer to user_data                         */
 
+  /* Sparse evaluation of the root functions */
+  ARKRootSubsetFn gsub;    /* function evaluating a subset of g            */
+  sunbooleantype* gmask;   /* array flagging components to evaluate        */
+  sunrealtype* gdotmax;    /* array of bounds on |dg_i/dt|                 */
+  sunrealtype* gtime;      /* array of times of last g_i evaluations       */
 }* ARKodeRootMem;
 
 /*===============================================================
@@ -74,6 +79,7 @@ typedef struct ARKodeRootMemRec
 ===============================================================*/
 
 int arkRootFree(void* arkode_mem);
+void arkRootFreeSubset(void* arkode_mem);
 int arkPrintRootMem(void* arkode_mem, FILE* outfile);
 int arkRootCheck1(void* arkode_mem);
 int arkRootCheck2(void* arkode_mem);
@@ -104,6 +104,25 @@ static int splittingStep_SetCoefficients(ARKodeMem ark_mem,
   return ARK_SUCCESS;
 }
 
+/*------------------------------------------------------------------------------
+  Frees the work vectors used when evaluating sequential methods concurrently
+  ----------------------------------------------------------------------------*/
+static void splittingStep_FreeWorkVectors(ARKodeMem ark_mem,
+                                          ARKodeSplittingStepMem step_mem)
+{
+  if (step_mem->y_seq != NULL)
+  {
+    arkFreeVecArray(step_mem->num_y_seq, &step_mem->y_seq, ark_mem->lrw1,
+                    &ark_mem->lrw, ark_mem->liw1, &ark_mem->liw);
+  }
+  if (step_mem->Xvecs != NULL)
+  {
+    free(step_mem->Xvecs);
+    step_mem->Xvecs = NULL;
+  }
+  step_mem->num_y_seq = 0;
+}
+
 /*-----------------------------------------------------------------------------
   This routine is called just prior to performing internal time steps (after all
   user "set" routines have been called) from within arkInitialSetup.
@@ -135,6 +154,12 @@ static int splittingStep_Init(ARKodeMem ark_mem,
     }
   }
 
+  /* the work vectors are reallocated at the next step after a resize */
+  if (init_type == RESIZE_INIT)
+  {
+    splittingStep_FreeWorkVectors(ark_mem, step_mem);
+  }
+
   /* immediately return if resize or reset */
   if (init_type == RESIZE_INIT || init_type == RESET_INIT)
   {
@@ -204,11 +229,13 @@ static int splittingStep_FullRHS(ARKodeMem ark_mem, sunrealtype t, N_Vector y,
 }
 
 /*------------------------------------------------------------------------------
-  This routine performs a sequential operator splitting method
+  This routine performs a sequential operator splitting method using the given
+  set of steppers (one per partition)
   ----------------------------------------------------------------------------*/
 static int splittingStep_SequentialMethod(ARKodeMem ark_mem,
                                           ARKodeSplittingStepMem step_mem,
-                                          int i, N_Vector y)
+                                          SUNStepper* steppers, int i,
+                                          N_Vector y)
 {
   SplittingStepCoefficients coefficients = step_mem->coefficients;
 
@@ -231,7 +258,7 @@ static int splittingStep_SequentialMethod(ARKodeMem ark_mem,
                  ", t_end = " SUN_FORMAT_G,
                  k, t_start, t_end);
 
-      SUNStepper stepper = step_mem->steppers[k];
+      SUNStepper stepper = steppers[k];
       /* TODO(SBR): A potential future optimization is removing this reset and
        * a call to SUNStepper_SetStopTime later for methods that start a step
        * evolving the same partition the last step ended with (essentially a
@@ -278,6 +305,7 @@ static int splittingStep_SequentialMethod(ARKodeMem ark_mem,
                    "status = failed partition, err = %i", err);
         return ARK_SUNSTEPPER_ERR;
       }
+      ARK_OMP_PRAGMA(omp atomic)
       step_mem->n_stepper_evolves[k]++;
 
       SUNLogInfo(ARK_LOGGER, "end-partition", "status = success");
@@ -288,6 +316,92 @@ static int splittingStep_SequentialMethod(ARKodeMem ark_mem,
   return ARK_SUCCESS;
 }
 
+#ifdef ARK_CONCURRENT
+/*------------------------------------------------------------------------------
+  This routine performs a single step of the splitting method with the
+  sequential methods evaluated concurrently. Thread l uses stepper set l and
+  evaluates sequential methods l, l + n, l + 2n, ... where n is the number of
+  stepper sets. The results are combined with a single linear combination.
+  Each stepper set uses its own SUNContexts (see
+  SplittingStepSetConcurrentSteppers), and a failure is only reported through
+  the return value once all threads have finished.
+  ----------------------------------------------------------------------------*/
+static int splittingStep_TakeStepConcurrent(ARKodeMem ark_mem,
+                                            ARKodeSplittingStepMem step_mem)
+{
+  SplittingStepCoefficients coefficients = step_mem->coefficients;
+  int methods = coefficients->sequential_methods;
+  int sets    = SUNMIN(step_mem->num_stepper_copies + 1, methods);
+  int retval  = ARK_SUCCESS;
+
+  /* Allocate the work vectors for sequential methods 1, 2, ... */
+  if (step_mem->num_y_seq < methods - 1)
+  {
+    splittingStep_FreeWorkVectors(ark_mem, step_mem);
+    step_mem->Xvecs = (N_Vector*)malloc(methods * sizeof(N_Vector));
+    if (step_mem->Xvecs == NULL ||
+        !arkAllocVecArray(methods - 1, ark_mem->yn, &step_mem->y_seq,
+                          ark_mem->lrw1, &ark_mem->lrw, ark_mem->liw1,
+                          &ark_mem->liw))
+    {
+      splittingStep_FreeWorkVectors(ark_mem, step_mem);
+      arkProcessError(ark_mem, ARK_MEM_FAIL, __LINE__, __func__, __FILE__,
+                      MSG_ARK_MEM_FAIL);
+      return ARK_MEM_FAIL;
+    }
+    step_mem->num_y_seq = methods - 1;
+  }
+
+  /* Initialize the sequential method states before the parallel region, so
+     the threads only use the contexts of their own steppers */
+  N_VScale(ONE, ark_mem->yn, ark_mem->ycur);
+  for (int i = 1; i < methods; i++)
+  {
+    N_VScale(ONE, ark_mem->yn, step_mem->y_seq[i - 1]);
+  }
+
+  ARK_OMP_PRAGMA(omp parallel for schedule(static, 1) num_threads(sets) \
+                   reduction(min : retval))
+  for (int l = 0; l < sets; l++)
+  {
+    SUNStepper* steppers =
+      l == 0 ? step_mem->steppers
+             : &step_mem->stepper_copies[(l - 1) * step_mem->partitions];
+
+    int set_retval = ARK_SUCCESS;
+    for (int i = l; i < methods && set_retval == ARK_SUCCESS; i += sets)
+    {
+      N_Vector y = i == 0 ? ark_mem->ycur : step_mem->y_seq[i - 1];
+      set_retval = splittingStep_SequentialMethod(ark_mem, step_mem, steppers,
+                                                  i, y);
+    }
+    retval = SUNMIN(retval, set_retval);
+  }
+
+  if (retval != ARK_SUCCESS)
+  {
+    SUNLogInfo(ARK_LOGGER, "end-sequential-method",
+               "status = failed sequential method, retval = %i", retval);
+    return retval;
+  }
+
+  /* ycur = alpha_0 ycur + alpha_1 y_seq[0] + ... */
+  step_mem->Xvecs[0] = ark_mem->ycur;
+  for (int i = 1; i < methods; i++)
+  {
+    step_mem->Xvecs[i] = step_mem->y_seq[i - 1];
+  }
+
+  retval = N_VLinearCombination(methods, coefficients->alpha, step_mem->Xvecs,
+                                ark_mem->ycur);
+  if (retval != 0) { return ARK_VECTOROP_ERR; }
+
+  SUNLogExtraDebugVec(ARK_LOGGER, "current state", ark_mem->ycur, "y_cur(:) =");
+
+  return ARK_SUCCESS;
+}
+#endif
+
 /*------------------------------------------------------------------------------
   This routine performs a single step of the splitting method.
   ----------------------------------------------------------------------------*/
@@ -305,8 +419,16 @@ static int splittingStep_TakeStep(ARKodeMem ark_mem, sunrealtype* dsmPtr,
 
   SUNLogInfo(ARK_LOGGER, "begin-sequential-method", "sequential method = 0");
 
+#ifdef ARK_CONCURRENT
+  if (step_mem->num_stepper_copies > 0 && coefficients->sequential_methods > 1)
+  {
+    return splittingStep_TakeStepConcurrent(ark_mem, step_mem);
+  }
+#endif
+
   N_VScale(ONE, ark_mem->yn, ark_mem->ycur);
-  retval = splittingStep_SequentialMethod(ark_mem, step_mem, 0, ark_mem->ycur);
+  retval = splittingStep_SequentialMethod(ark_mem, step_mem, step_mem->steppers,
+                                          0, ark_mem->ycur);
   SUNLogExtraDebugVec(ARK_LOGGER, "sequential state", ark_mem->ycur,
                       "y_seq(:) =");
   if (retval != ARK_SUCCESS)
@@ -329,7 +451,8 @@ static int splittingStep_TakeStep(ARKodeMem ark_mem, sunrealtype* dsmPtr,
                i);
 
     N_VScale(ONE, ark_mem->yn, ark_mem->tempv1);
-    retval = splittingStep_SequentialMethod(ark_mem, step_mem, i,
+    retval = splittingStep_SequentialMethod(ark_mem, step_mem,
+                                            step_mem->steppers, i,
                                             ark_mem->tempv1);
     SUNLogExtraDebugVec(ARK_LOGGER, "sequential state", ark_mem->tempv1,
                         "y_seq(:) =");
@@ -396,6 +519,8 @@ static void splittingStep_Free(ARKodeMem ark_mem)
   if (step_mem != NULL)
   {
     if (step_mem->steppers != NULL) { free(step_mem->steppers); }
+    if (step_mem->stepper_copies != NULL) { free(step_mem->stepper_copies); }
+    splittingStep_FreeWorkVectors(ark_mem, step_mem);
     if (step_mem->n_stepper_evolves != NULL)
     {
       free(step_mem->n_stepper_evolves);
@@ -539,6 +664,14 @@ static int splittingStep_InitStepMem(ARKodeMem ark_mem,
   }
   memcpy(step_mem->steppers, steppers, partitions * sizeof(*steppers));
 
+  /* Any stepper copies were created for the previous steppers */
+  if (step_mem->stepper_copies != NULL)
+  {
+    free(step_mem->stepper_copies);
+    step_mem->stepper_copies = NULL;
+  }
+  step_mem->num_stepper_copies = 0;
+
   if (step_mem->n_stepper_evolves != NULL)
   {
     free(step_mem->n_stepper_evolves);
@@ -593,11 +726,16 @@ void* SplittingStepCreate(SUNStepper* steppers, int partitions, sunrealtype t0,
     return NULL;
   }
 
-  step_mem->partitions        = partitions;
-  step_mem->order             = 0;
-  step_mem->steppers          = NULL;
-  step_mem->n_stepper_evolves = NULL;
-  step_mem->coefficients      = NULL;
+  step_mem->partitions         = partitions;
+  step_mem->order              = 0;
+  step_mem->steppers           = NULL;
+  step_mem->n_stepper_evolves  = NULL;
+  step_mem->coefficients       = NULL;
+  step_mem->stepper_copies     = NULL;
+  step_mem->num_stepper_copies = 0;
+  step_mem->y_seq              = NULL;
+  step_mem->Xvecs              = NULL;
+  step_mem->num_y_seq          = 0;
   retval = splittingStep_InitStepMem(ark_mem, step_mem, steppers, partitions);
   if (retval != ARK_SUCCESS)
   {
@@ -724,6 +862,84 @@ int SplittingStepSetCoefficients(void* arkode_mem,
   return ARK_SUCCESS;
 }
 
+/*---------------------------------------------------------------
+  Provides additional sets of steppers so that the sequential methods of the
+  splitting method can be evaluated concurrently.
+  ---------------------------------------------------------------*/
+int SplittingStepSetConcurrentSteppers(void* arkode_mem, int num_copies,
+                                       SUNStepper* steppers)
+{
+  ARKodeMem ark_mem               = NULL;
+  ARKodeSplittingStepMem step_mem = NULL;
+  int retval = splittingStep_AccessARKODEStepMem(arkode_mem, __func__, &ark_mem,
+                                                 &step_mem);
+  if (retval != ARK_SUCCESS) { return retval; }
+
+  if (num_copies < 0 || (num_copies > 0 && steppers == NULL))
+  {
+    arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    "num_copies must be nonnegative and steppers non-NULL");
+    return ARK_ILL_INPUT;
+  }
+
+  int count = num_copies * step_mem->partitions;
+  for (int i = 0; i < count; i++)
+  {
+    if (steppers[i] == NULL || !splittingStep_CheckSUNStepper(steppers[i]))
+    {
+      arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                      "steppers[%d] is NULL or does not implement the "
+                      "required operations.",
+                      i);
+      return ARK_ILL_INPUT;
+    }
+  }
+
+  /* Sets of steppers evolved concurrently must not share a SUNContext */
+  for (int c = 0; c < num_copies; c++)
+  {
+    SUNStepper* set = &steppers[c * step_mem->partitions];
+    sunbooleantype shared = arkStepperContextsShared(set, step_mem->partitions,
+                                                     step_mem->steppers,
+                                                     step_mem->partitions);
+    for (int d = 0; d < c && !shared; d++)
+    {
+      shared = arkStepperContextsShared(set, step_mem->partitions,
+                                        &steppers[d * step_mem->partitions],
+                                        step_mem->partitions);
+    }
+    if (shared)
+    {
+      arkProcessError(ark_mem, ARK_ILL_INPUT, __LINE__, __func__, __FILE__,
+                      "The steppers in copy %d share a SUNContext with the "
+                      "steppers in another set.",
+                      c);
+      return ARK_ILL_INPUT;
+    }
+  }
+
+  if (step_mem->stepper_copies != NULL)
+  {
+    free(step_mem->stepper_copies);
+    step_mem->stepper_copies = NULL;
+  }
+  step_mem->num_stepper_copies = 0;
+
+  if (num_copies == 0) { return ARK_SUCCESS; }
+
+  step_mem->stepper_copies = malloc(count * sizeof(*steppers));
+  if (step_mem->stepper_copies == NULL)
+  {
+    arkProcessError(ark_mem, ARK_MEM_FAIL, __LINE__, __func__, __FILE__,
+                    MSG_ARK_MEM_FAIL);
+    return ARK_MEM_FAIL;
+  }
+  memcpy(step_mem->stepper_copies, steppers, count * sizeof(*steppers));
+  step_mem->num_stepper_copies = num_copies;
+
+  return ARK_SUCCESS;
+}
+
 /*------------------------------------------------------------------------------
   Accesses the number of times a given partition was evolved
   ----------------------------------------------------------------------------*/
@@ -27,6 +27,17 @@ typedef struct ARKodeSplittingStepMemRec
 
   int partitions;
   int order;
+
+  /* Additional stepper sets for evaluating sequential methods concurrently,
+     set c (1 <= c <= num_stepper_copies) starts at (c - 1) * partitions */
+  SUNStepper* stepper_copies;
+  int num_stepper_copies;
+
+  /* Work vectors holding the results of sequential methods 1, 2, ... when
+     they are evaluated concurrently and the vector array for combining them */
+  N_Vector* y_seq;
+  N_Vector* Xvecs;
+  int num_y_seq;
 }* ARKodeSplittingStepMem;
 
 #endif
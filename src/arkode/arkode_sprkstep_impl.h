@@ -76,6 +76,7 @@ int sprkStep_TakeStep_Compensated(ARKodeMem ark_mem, sunrealtype* dsmPtr,
 int sprkStep_SetUserData(ARKodeMem ark_mem, void* user_data);
 int sprkStep_SetDefaults(ARKodeMem ark_mem);
 int sprkStep_SetOrder(ARKodeMem ark_mem, int ord);
+int sprkStep_SetUseCompensatedSums(ARKodeMem ark_mem, sunbooleantype onoff);
 int sprkStep_PrintAllStats(ARKodeMem ark_mem, FILE* outfile, SUNOutputFormat fmt);
 int sprkStep_WriteParameters(ARKodeMem ark_mem, FILE* fp);
 int sprkStep_Reset(ARKodeMem ark_mem, sunrealtype tR, N_Vector yR);
@@ -48,27 +48,7 @@ int SPRKStepSetUseCompensatedSums(void* arkode_mem, sunbooleantype onoff)
                                         &step_mem);
   if (retval != ARK_SUCCESS) { return (retval); }
 
-  if (onoff)
-  {
-    ark_mem->use_compensated_sums = SUNTRUE;
-    ark_mem->step                 = sprkStep_TakeStep_Compensated;
-    if (!step_mem->yerr)
-    {
-      if (!arkAllocVec(ark_mem, ark_mem->yn, &(step_mem->yerr)))
-      {
-        return ARK_MEM_FAIL;
-      }
-      /* Zero yerr for compensated summation */
-      N_VConst(ZERO, step_mem->yerr);
-    }
-  }
-  else
-  {
-    ark_mem->use_compensated_sums = SUNFALSE;
-    ark_mem->step                 = sprkStep_TakeStep;
-  }
-
-  return (retval);
+  return (sprkStep_SetUseCompensatedSums(ark_mem, onoff));
 }
 
 /*---------------------------------------------------------------
@@ -208,6 +188,44 @@ int SPRKStepGetNumRhsEvals(void* arkode_mem, long int* nf1, long int* nf2)
   Private functions attached to ARKODE
   ===============================================================*/
 
+/*---------------------------------------------------------------
+  sprkStep_SetUseCompensatedSums:
+
+  Switches between the standard and compensated step functions
+  and allocates the compensated summation error vector.
+  ---------------------------------------------------------------*/
+int sprkStep_SetUseCompensatedSums(ARKodeMem ark_mem, sunbooleantype onoff)
+{
+  ARKodeSPRKStepMem step_mem = NULL;
+  int retval                 = 0;
+
+  /* access ARKodeSPRKStepMem structure */
+  retval = sprkStep_AccessStepMem(ark_mem, __func__, &step_mem);
+  if (retval != ARK_SUCCESS) { return (retval); }
+
+  if (onoff)
+  {
+    ark_mem->use_compensated_sums = SUNTRUE;
+    ark_mem->step                 = sprkStep_TakeStep_Compensated;
+    if (!step_mem->yerr)
+    {
+      if (!arkAllocVec(ark_mem, ark_mem->yn, &(step_mem->yerr)))
+      {
+        return ARK_MEM_FAIL;
+      }
+      /* Zero yerr for compensated summation */
+      N_VConst(ZERO, step_mem->yerr);
+    }
+  }
+  else
+  {
+    ark_mem->use_compensated_sums = SUNFALSE;
+    ark_mem->step                 = sprkStep_TakeStep;
+  }
+
+  return (retval);
+}
+
 /*---------------------------------------------------------------
   sprkStep_SetDefaults:
 
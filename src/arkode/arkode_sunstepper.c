@@ -292,3 +292,23 @@ int ARKodeCreateSUNStepper(void* arkode_mem, SUNStepper* stepper)
 
   return ARK_SUCCESS;
 }
+
+/*------------------------------------------------------------------------------
+  arkStepperContextsShared
+
+  Returns SUNTRUE if any of the SUNSteppers a[0], ..., a[na - 1] uses the same
+  SUNContext as any of the SUNSteppers b[0], ..., b[nb - 1]. SUNSteppers that
+  are evolved concurrently must not share a SUNContext (see ARK_OMP_PRAGMA).
+  ----------------------------------------------------------------------------*/
+sunbooleantype arkStepperContextsShared(SUNStepper* a, int na, SUNStepper* b,
+                                        int nb)
+{
+  for (int i = 0; i < na; i++)
+  {
+    for (int j = 0; j < nb; j++)
+    {
+      if (a[i]->sunctx == b[j]->sunctx) { return SUNTRUE; }
+    }
+  }
+  return SUNFALSE;
+}
@@ -30,6 +30,7 @@
 
 #include "cvode_impl.h"
 #include "sundials/priv/sundials_errors_impl.h"
+#include "sundials_utils.h"
 
 /*=================================================================*/
 /* CVODE Private Constants                                         */
@@ -148,6 +149,12 @@ static int cvYddNorm(CVodeMem cv_mem, sunrealtype hg, sunrealtype* yddnrm);
 
 static int cvStep(CVodeMem cv_mem);
 
+/* Per-step telemetry */
+
+static void cvTelemetryBegin(CVodeMem cv_mem, int attempt);
+static void cvTelemetryEnd(CVodeMem cv_mem, SUNStepOutcome outcome,
+                           sunrealtype dsm);
+
 /* Function called at beginning of step */
 
 static void cvAdjustParams(CVodeMem cv_mem);
@@ -187,14 +194,17 @@ static int cvDoErrorTest(CVodeMem cv_mem, int* nflagPtr, sunrealtype saved_t,
 static void cvCompleteStep(CVodeMem cv_mem);
 static void cvPrepareNextStep(CVodeMem cv_mem, sunrealtype dsm);
 static void cvSetEta(CVodeMem cv_mem);
-static sunrealtype cvComputeEtaqm1(CVodeMem cv_mem);
-static sunrealtype cvComputeEtaqp1(CVodeMem cv_mem);
+static void cvComputeEtaqm1qp1(CVodeMem cv_mem);
 static void cvChooseEta(CVodeMem cv_mem);
 
 /* Function to handle failures */
 
 static int cvHandleFailure(CVodeMem cv_mem, int flag);
 
+/* Function to pass solution output to the user */
+
+static int cvOutputStep(CVodeMem cv_mem);
+
 /* Functions for BDF Stability Limit Detection */
 
 static void cvBDFStab(CVodeMem cv_mem);
@@ -206,6 +216,10 @@ static int cvRcheck1(CVodeMem cv_mem);
 static int cvRcheck2(CVodeMem cv_mem);
 static int cvRcheck3(CVodeMem cv_mem);
 static int cvRootfind(CVodeMem cv_mem);
+static int cvRootEval(CVodeMem cv_mem, sunrealtype t, N_Vector y,
+                      sunrealtype* gout, sunbooleantype sparse);
+static int cvRootEvalSubset(CVodeMem cv_mem, sunrealtype t, sunrealtype* gout);
+static void cvRootFreeSubset(CVodeMem cv_mem);
 
 /*
  * =================================================================
@@ -277,8 +291,16 @@ void* CVodeCreate(int lmm, SUNContext sunctx)
   cv_mem->cv_user_efun        = SUNFALSE;
   cv_mem->cv_efun             = NULL;
   cv_mem->cv_e_data           = NULL;
+  cv_mem->cv_ewt_thresh       = ZERO;
+  cv_mem->cv_ewt_drift        = ZERO;
   cv_mem->cv_monitorfun       = NULL;
   cv_mem->cv_monitor_interval = 0;
+  cv_mem->cv_outputfn         = NULL;
+  cv_mem->cv_out_t0           = ZERO;
+  cv_mem->cv_out_dt           = ZERO;
+  cv_mem->cv_out_idx          = 0;
+  cv_mem->cv_out_nsteps       = 0;
+  cv_mem->cv_ysink            = NULL;
   cv_mem->cv_qmax             = maxord;
   cv_mem->cv_mxstep           = MXSTEP_DEFAULT;
   cv_mem->cv_mxhnil           = MXHNIL_DEFAULT;
@@ -307,6 +329,8 @@ void* CVodeCreate(int lmm, SUNContext sunctx)
   cv_mem->convfail            = CV_NO_FAILURES;
   cv_mem->cv_constraints      = NULL;
   cv_mem->cv_constraintsSet   = SUNFALSE;
+  cv_mem->cv_compsums         = SUNFALSE;
+  cv_mem->cv_telemetryfn      = NULL; /* no per-step telemetry by default */
 
   /* Initialize root finding variables */
 
@@ -319,6 +343,10 @@ void* CVodeCreate(int lmm, SUNContext sunctx)
   cv_mem->cv_nrtfn   = 0;
   cv_mem->cv_gactive = NULL;
   cv_mem->cv_mxgnull = 1;
+  cv_mem->cv_gsub    = NULL;
+  cv_mem->cv_gmask   = NULL;
+  cv_mem->cv_gdotmax = NULL;
+  cv_mem->cv_gtime   = NULL;
 
   /* Initialize projection variables */
   cv_mem->proj_mem     = NULL;
@@ -342,6 +370,8 @@ void* CVodeCreate(int lmm, SUNContext sunctx)
   cv_mem->cv_VabstolMallocDone     = SUNFALSE;
   cv_mem->cv_MallocDone            = SUNFALSE;
   cv_mem->cv_constraintsMallocDone = SUNFALSE;
+  cv_mem->cv_compsumsMallocDone    = SUNFALSE;
+  cv_mem->cv_ysinkMallocDone       = SUNFALSE;
 
   /* Initialize nonlinear solver variables */
   cv_mem->NLS    = NULL;
@@ -439,8 +469,9 @@ int CVodeInit(void* cvode_mem, CVRhsFn f, sunrealtype t0, N_Vector y0)
   /* Input checks complete at this point and history array allocated */
 
   /* Copy the input parameters into CVODE state */
-  cv_mem->cv_f  = f;
-  cv_mem->cv_tn = t0;
+  cv_mem->cv_f    = f;
+  cv_mem->cv_tn   = t0;
+  cv_mem->cv_terr = ZERO;
 
   /* Initialize zn[0] in the history array */
   N_VScale(ONE, y0, cv_mem->cv_zn[0]);
@@ -506,6 +537,7 @@ int CVodeInit(void* cvode_mem, CVRhsFn f, sunrealtype t0, N_Vector y0)
   cv_mem->cv_nni     = 0;
   cv_mem->cv_nnf     = 0;
   cv_mem->cv_nsetups = 0;
+  cv_mem->cv_newt    = 0;
   cv_mem->cv_nhnil   = 0;
   cv_mem->cv_nstlp   = 0;
   cv_mem->cv_nscon   = 0;
@@ -513,6 +545,10 @@ int CVodeInit(void* cvode_mem, CVRhsFn f, sunrealtype t0, N_Vector y0)
 
   cv_mem->cv_irfnd = 0;
 
+  /* Restart the search for the next output grid time */
+
+  cv_mem->cv_out_idx = 0;
+
   /* Initialize other integrator optional outputs */
 
   cv_mem->cv_h0u    = ZERO;
@@ -607,6 +643,11 @@ int CVodeReInit(void* cvode_mem, sunrealtype t0, N_Vector y0)
 
   N_VScale(ONE, y0, cv_mem->cv_zn[0]);
 
+  /* Reset the compensated summation corrections */
+
+  cv_mem->cv_terr = ZERO;
+  if (cv_mem->cv_compsumsMallocDone) { N_VConst(ZERO, cv_mem->cv_ycomp); }
+
   /* Initialize all the counters */
 
   cv_mem->cv_nst     = 0;
@@ -616,6 +657,7 @@ int CVodeReInit(void* cvode_mem, sunrealtype t0, N_Vector y0)
   cv_mem->cv_nni     = 0;
   cv_mem->cv_nnf     = 0;
   cv_mem->cv_nsetups = 0;
+  cv_mem->cv_newt    = 0;
   cv_mem->cv_nhnil   = 0;
   cv_mem->cv_nstlp   = 0;
   cv_mem->cv_nscon   = 0;
@@ -623,6 +665,10 @@ int CVodeReInit(void* cvode_mem, sunrealtype t0, N_Vector y0)
 
   cv_mem->cv_irfnd = 0;
 
+  /* Restart the search for the next output grid time */
+
+  cv_mem->cv_out_idx = 0;
+
   /* Initialize other integrator optional outputs */
 
   cv_mem->cv_h0u    = ZERO;
@@ -704,6 +750,9 @@ int CVodeSStolerances(void* cvode_mem, sunrealtype reltol, sunrealtype abstol)
   cv_mem->cv_itol = CV_SS;
 
   cv_mem->cv_user_efun = SUNFALSE;
+
+  /* Force an update of the weights before the next step */
+  cv_mem->cv_ewt_drift = SUN_BIG_REAL;
   cv_mem->cv_efun      = cvEwtSet;
   cv_mem->cv_e_data    = NULL; /* will be set to cvode_mem in InitialSetup */
 
@@ -769,6 +818,9 @@ int CVodeSVtolerances(void* cvode_mem, sunrealtype reltol, N_Vector abstol)
   cv_mem->cv_itol = CV_SV;
 
   cv_mem->cv_user_efun = SUNFALSE;
+
+  /* Force an update of the weights before the next step */
+  cv_mem->cv_ewt_drift = SUN_BIG_REAL;
   cv_mem->cv_efun      = cvEwtSet;
   cv_mem->cv_e_data    = NULL; /* will be set to cvode_mem in InitialSetup */
 
@@ -849,6 +901,10 @@ int CVodeRootInit(void* cvode_mem, int nrtfn, CVRootFn g)
 
     cv_mem->cv_lrw -= 3 * (cv_mem->cv_nrtfn);
     cv_mem->cv_liw -= 3 * (cv_mem->cv_nrtfn);
+
+    /* the subset evaluation data is sized for the old functions */
+    cvRootFreeSubset(cv_mem);
+    cv_mem->cv_gsub = NULL;
   }
 
   /* If CVodeRootInit() was called with nrtfn == 0, then set cv_nrtfn to
@@ -1038,7 +1094,7 @@ int CVode(void* cvode_mem, sunrealtype tout, N_Vector yout, sunrealtype* tret,
   int retval, hflag, kflag, istate, ir, ier, irfndp;
   int ewtsetOK;
   sunrealtype troundoff, tout_hin, rh, nrm;
-  sunbooleantype inactive_roots;
+  sunbooleantype inactive_roots, lazyewt;
 
   /*
    * -------------------------------------
@@ -1442,29 +1498,49 @@ int CVode(void* cvode_mem, sunrealtype tout, N_Vector yout, sunrealtype* tret,
     cv_mem->cv_next_h = cv_mem->cv_h;
     cv_mem->cv_next_q = cv_mem->cv_q;
 
-    /* Reset and check ewt */
+    /* Reset and check ewt. With lazy updates, the largest relative change
+       in 1/ewt_i = rtol |y_i| + atol_i over the last step is estimated by
+       rtol max_i |h y'_i| ewt_i = rtol ||zn[1] ewt||_max and the weights are
+       only recomputed once the accumulated change exceeds the threshold.
+       Lazy updates are limited to internal weights with atol_i > 0, which are
+       always positive, so the positivity check in cvEwtSet is never
+       skipped. */
     if (cv_mem->cv_nst > 0)
     {
-      ewtsetOK = cv_mem->cv_efun(cv_mem->cv_zn[0], cv_mem->cv_ewt,
-                                 cv_mem->cv_e_data);
+      lazyewt = (cv_mem->cv_ewt_thresh > ZERO) &&
+                (cv_mem->cv_itol != CV_WF) && !cv_mem->cv_atolmin0;
+      if (lazyewt)
+      {
+        N_VProd(cv_mem->cv_zn[1], cv_mem->cv_ewt, cv_mem->cv_tempv);
+        cv_mem->cv_ewt_drift += cv_mem->cv_reltol *
+                                N_VMaxNorm(cv_mem->cv_tempv);
+      }
 
-      if (ewtsetOK != 0)
+      if (!lazyewt || cv_mem->cv_ewt_drift >= cv_mem->cv_ewt_thresh)
       {
-        if (cv_mem->cv_itol == CV_WF)
-        {
-          cvProcessError(cv_mem, CV_ILL_INPUT, __LINE__, __func__, __FILE__,
-                         MSGCV_EWT_NOW_FAIL, cv_mem->cv_tn);
-        }
-        else
+        ewtsetOK = cv_mem->cv_efun(cv_mem->cv_zn[0], cv_mem->cv_ewt,
+                                   cv_mem->cv_e_data);
+        cv_mem->cv_newt++;
+        cv_mem->cv_ewt_drift = ZERO;
+
+        if (ewtsetOK != 0)
         {
-          cvProcessError(cv_mem, CV_ILL_INPUT, __LINE__, __func__, __FILE__,
-                         MSGCV_EWT_NOW_BAD, cv_mem->cv_tn);
-        }
+          if (cv_mem->cv_itol == CV_WF)
+          {
+            cvProcessError(cv_mem, CV_ILL_INPUT, __LINE__, __func__, __FILE__,
+                           MSGCV_EWT_NOW_FAIL, cv_mem->cv_tn);
+          }
+          else
+          {
+            cvProcessError(cv_mem, CV_ILL_INPUT, __LINE__, __func__, __FILE__,
+                           MSGCV_EWT_NOW_BAD, cv_mem->cv_tn);
+          }
 
-        istate              = CV_ILL_INPUT;
-        cv_mem->cv_tretlast = *tret = cv_mem->cv_tn;
-        N_VScale(ONE, cv_mem->cv_zn[0], yout);
-        break;
+          istate              = CV_ILL_INPUT;
+          cv_mem->cv_tretlast = *tret = cv_mem->cv_tn;
+          N_VScale(ONE, cv_mem->cv_zn[0], yout);
+          break;
+        }
       }
     }
 
@@ -1531,7 +1607,21 @@ int CVode(void* cvode_mem, sunrealtype tout, N_Vector yout, sunrealtype* tret,
                   (SUNRabs(cv_mem->cv_tn) + SUNRabs(cv_mem->cv_h));
       if (SUNRabs(cv_mem->cv_tn - cv_mem->cv_tstop) <= troundoff)
       {
-        cv_mem->cv_tn = cv_mem->cv_tstop;
+        cv_mem->cv_tn   = cv_mem->cv_tstop;
+        cv_mem->cv_terr = ZERO;
+      }
+    }
+
+    /* Pass any requested outputs from the last step to the user */
+    if (cv_mem->cv_outputfn != NULL)
+    {
+      retval = cvOutputStep(cv_mem);
+      if (retval != CV_SUCCESS)
+      {
+        istate              = retval;
+        cv_mem->cv_tretlast = *tret = cv_mem->cv_tn;
+        N_VScale(ONE, cv_mem->cv_zn[0], yout);
+        break;
       }
     }
 
@@ -1742,6 +1832,112 @@ int CVodeGetDky(void* cvode_mem, sunrealtype t, int k, N_Vector dky)
   return (CV_SUCCESS);
 }
 
+/*
+ * CVodeGetDkyArray
+ *
+ * This routine computes the k-th derivative of the interpolating
+ * polynomial at each of the nt times t[m] and stores the results in
+ * the vectors dky[m]. All of the times are checked before any output
+ * is formed and the scaling h^(-k) is folded into the combination
+ * coefficients, so each output vector is produced by a single
+ * N_VLinearCombination over the Nordsieck history array.
+ */
+
+int CVodeGetDkyArray(void* cvode_mem, int nt, sunrealtype* t, int k,
+                     N_Vector* dky)
+{
+  sunrealtype s, r;
+  sunrealtype tfuzz, tp, tn1;
+  int i, j, m, nvec, ier;
+  CVodeMem cv_mem;
+
+  /* Check all inputs for legality */
+
+  if (cvode_mem == NULL)
+  {
+    cvProcessError(NULL, CV_MEM_NULL, __LINE__, __func__, __FILE__, MSGCV_NO_MEM);
+    return (CV_MEM_NULL);
+  }
+  cv_mem = (CVodeMem)cvode_mem;
+
+  SUNDIALS_MARK_FUNCTION_BEGIN(CV_PROFILER);
+
+  if (nt < 0 || (nt > 0 && (t == NULL || dky == NULL)))
+  {
+    cvProcessError(cv_mem, CV_ILL_INPUT, __LINE__, __func__, __FILE__,
+                   "nt < 0 or t or dky is NULL");
+    SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+    return (CV_ILL_INPUT);
+  }
+
+  if ((k < 0) || (k > cv_mem->cv_q))
+  {
+    cvProcessError(cv_mem, CV_BAD_K, __LINE__, __func__, __FILE__, MSGCV_BAD_K);
+    SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+    return (CV_BAD_K);
+  }
+
+  /* Allow for some slack */
+  tfuzz = FUZZ_FACTOR * cv_mem->cv_uround *
+          (SUNRabs(cv_mem->cv_tn) + SUNRabs(cv_mem->cv_hu));
+  if (cv_mem->cv_hu < ZERO) { tfuzz = -tfuzz; }
+  tp  = cv_mem->cv_tn - cv_mem->cv_hu - tfuzz;
+  tn1 = cv_mem->cv_tn + tfuzz;
+
+  /* Check every output before overwriting any of them */
+  for (m = 0; m < nt; m++)
+  {
+    if (dky[m] == NULL)
+    {
+      cvProcessError(cv_mem, CV_BAD_DKY, __LINE__, __func__, __FILE__,
+                     MSGCV_NULL_DKY);
+      SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+      return (CV_BAD_DKY);
+    }
+    if ((t[m] - tp) * (t[m] - tn1) > ZERO)
+    {
+      cvProcessError(cv_mem, CV_BAD_T, __LINE__, __func__, __FILE__,
+                     MSGCV_BAD_T, t[m], cv_mem->cv_tn - cv_mem->cv_hu,
+                     cv_mem->cv_tn);
+      SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+      return (CV_BAD_T);
+    }
+  }
+
+  /* The history vectors are the same for every output time */
+  nvec = 0;
+  for (j = cv_mem->cv_q; j >= k; j--)
+  {
+    cv_mem->cv_Xvecs[nvec] = cv_mem->cv_zn[j];
+    nvec += 1;
+  }
+  r = (k == 0) ? ONE : SUNRpowerI(cv_mem->cv_h, -k);
+
+  /* Sum the differentiated interpolating polynomial at each time */
+  for (m = 0; m < nt; m++)
+  {
+    nvec = 0;
+    s    = (t[m] - cv_mem->cv_tn) / cv_mem->cv_h;
+    for (j = cv_mem->cv_q; j >= k; j--)
+    {
+      cv_mem->cv_cvals[nvec] = r;
+      for (i = j; i >= j - k + 1; i--) { cv_mem->cv_cvals[nvec] *= i; }
+      for (i = 0; i < j - k; i++) { cv_mem->cv_cvals[nvec] *= s; }
+      nvec += 1;
+    }
+    ier = N_VLinearCombination(nvec, cv_mem->cv_cvals, cv_mem->cv_Xvecs,
+                               dky[m]);
+    if (ier != CV_SUCCESS)
+    {
+      SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+      return (CV_VECTOROP_ERR);
+    }
+  }
+
+  SUNDIALS_MARK_FUNCTION_END(CV_PROFILER);
+  return (CV_SUCCESS);
+}
+
 /*
  * CVodeComputeState
  *
@@ -1811,6 +2007,7 @@ void CVodeFree(void** cvode_mem)
     cv_mem->cv_rootdir = NULL;
     free(cv_mem->cv_gactive);
     cv_mem->cv_gactive = NULL;
+    cvRootFreeSubset(cv_mem);
   }
 
   if (cv_mem->proj_mem) { cvProjFree(&(cv_mem->proj_mem)); }
@@ -1995,6 +2192,22 @@ static void cvFreeVectors(CVodeMem cv_mem)
     cv_mem->cv_lrw -= cv_mem->cv_lrw1;
     cv_mem->cv_liw -= cv_mem->cv_liw1;
   }
+
+  if (cv_mem->cv_compsumsMallocDone)
+  {
+    N_VDestroy(cv_mem->cv_ycomp);
+    N_VDestroy(cv_mem->cv_dycomp);
+    N_VDestroy(cv_mem->cv_ynsave);
+    cv_mem->cv_lrw -= 3 * cv_mem->cv_lrw1;
+    cv_mem->cv_liw -= 3 * cv_mem->cv_liw1;
+  }
+
+  if (cv_mem->cv_ysinkMallocDone)
+  {
+    N_VDestroy(cv_mem->cv_ysink);
+    cv_mem->cv_lrw -= cv_mem->cv_lrw1;
+    cv_mem->cv_liw -= cv_mem->cv_liw1;
+  }
 }
 
 /*
@@ -2053,6 +2266,8 @@ static int cvInitialSetup(CVodeMem cv_mem)
 
   /* Load initial error weights */
   ier = cv_mem->cv_efun(cv_mem->cv_zn[0], cv_mem->cv_ewt, cv_mem->cv_e_data);
+  cv_mem->cv_newt++;
+  cv_mem->cv_ewt_drift = ZERO;
   if (ier != 0)
   {
     if (cv_mem->cv_itol == CV_WF)
@@ -2404,6 +2619,8 @@ static int cvStep(CVodeMem cv_mem)
                ", q = %d",
                cv_mem->cv_nst + 1, cv_mem->cv_tn, cv_mem->cv_h, cv_mem->cv_q);
 
+    cvTelemetryBegin(cv_mem, ncf + npf + nef + 1);
+
     cvPredict(cv_mem);
     cvSet(cv_mem);
 
@@ -2413,6 +2630,11 @@ static int cvStep(CVodeMem cv_mem)
     SUNLogInfoIf(kflag == PREDICT_AGAIN || kflag != DO_ERROR_TEST, CV_LOGGER,
                  "end-step-attempt", "status = failed solve, kflag = %i", kflag);
 
+    if (kflag != DO_ERROR_TEST)
+    {
+      cvTelemetryEnd(cv_mem, SUN_STEP_SOLVER_FAIL, -ONE);
+    }
+
     /* Go back in loop if we need to predict again (nflag=PREV_CONV_FAIL) */
     if (kflag == PREDICT_AGAIN) { continue; }
 
@@ -2430,6 +2652,11 @@ static int cvStep(CVodeMem cv_mem)
       SUNLogInfoIf(pflag != CV_SUCCESS, CV_LOGGER, "end-step-attempt",
                    "status = failed projection, pflag = %i", pflag);
 
+      if (pflag != CV_SUCCESS)
+      {
+        cvTelemetryEnd(cv_mem, SUN_STEP_SOLVER_FAIL, -ONE);
+      }
+
       /* Go back in loop if we need to predict again (nflag=PREV_PROJ_FAIL) */
       if (pflag == PREDICT_AGAIN) { continue; }
 
@@ -2445,6 +2672,11 @@ static int cvStep(CVodeMem cv_mem)
                  ", eflag = %i",
                  dsm, eflag);
 
+    if (eflag != CV_SUCCESS)
+    {
+      cvTelemetryEnd(cv_mem, SUN_STEP_ERR_TEST_FAIL, dsm);
+    }
+
     /* Go back in loop if we need to predict again (nflag=PREV_ERR_FAIL) */
     if (eflag == TRY_AGAIN) { continue; }
 
@@ -2458,6 +2690,8 @@ static int cvStep(CVodeMem cv_mem)
   SUNLogInfo(CV_LOGGER, "end-step-attempt",
              "status = success, dsm = " SUN_FORMAT_G, dsm);
 
+  cvTelemetryEnd(cv_mem, SUN_STEP_ACCEPTED, dsm);
+
   /* Nonlinear system solve and error test were both successful.
      Update data, and consider change of step and/or order.       */
 
@@ -2482,6 +2716,72 @@ static int cvStep(CVodeMem cv_mem)
   return (CV_SUCCESS);
 }
 
+/*
+ * -----------------------------------------------------------------
+ * Per-step telemetry
+ * -----------------------------------------------------------------
+ */
+
+/*
+ * cvTelemetryBegin
+ *
+ * This routine records the state at the start of a step attempt when
+ * a telemetry function is attached. Until the attempt ends, the
+ * counter fields of the record hold the counter values at the start
+ * of the attempt and time_step holds the start time.
+ */
+
+static void cvTelemetryBegin(CVodeMem cv_mem, int attempt)
+{
+  SUNStepTelemetry* tel = &(cv_mem->cv_telemetry);
+
+  if (cv_mem->cv_telemetryfn == NULL) { return; }
+
+  tel->version = SUN_STEP_TELEMETRY_VERSION;
+  tel->step    = cv_mem->cv_nst;
+  tel->attempt = attempt;
+  tel->t       = cv_mem->cv_tn;
+  tel->h       = cv_mem->cv_h;
+  tel->order   = cv_mem->cv_q;
+  tel->nni     = cv_mem->cv_nni;
+  tel->nfe     = cv_mem->cv_nfe;
+  tel->nsetups = cv_mem->cv_nsetups;
+  cvLsTelemetryCounters(cv_mem, &(tel->nli), &(tel->nje));
+
+  tel->time_nls    = 0.0;
+  tel->time_lsetup = 0.0;
+  tel->time_lsolve = 0.0;
+  tel->time_step   = sunWallTime();
+}
+
+/*
+ * cvTelemetryEnd
+ *
+ * This routine completes the record for the current step attempt and
+ * passes it to the user's telemetry function.
+ */
+
+static void cvTelemetryEnd(CVodeMem cv_mem, SUNStepOutcome outcome,
+                           sunrealtype dsm)
+{
+  SUNStepTelemetry* tel = &(cv_mem->cv_telemetry);
+  long int nli, nje;
+
+  if (cv_mem->cv_telemetryfn == NULL) { return; }
+
+  tel->time_step = sunWallTime() - tel->time_step;
+  tel->outcome   = outcome;
+  tel->dsm       = dsm;
+  tel->nni       = cv_mem->cv_nni - tel->nni;
+  tel->nfe       = cv_mem->cv_nfe - tel->nfe;
+  tel->nsetups   = cv_mem->cv_nsetups - tel->nsetups;
+  cvLsTelemetryCounters(cv_mem, &nli, &nje);
+  tel->nli = nli - tel->nli;
+  tel->nje = nje - tel->nje;
+
+  (void)cv_mem->cv_telemetryfn(tel, cv_mem->cv_user_data);
+}
+
 /*
  * -----------------------------------------------------------------
  * Function called at beginning of step
@@ -2739,18 +3039,31 @@ void cvRescale(CVodeMem cv_mem)
  * prediction of zn is done by repeated additions.
  * If tstop is enabled, it is possible for tn + h to be past tstop by roundoff,
  * and in that case, we reset tn (after incrementing by h) to tstop.
+ *
+ * With compensated summation, tn is advanced with a compensated sum and
+ * the predicted zn[0] is formed from the increment less the running
+ * correction. The increment is kept in dycomp and zn[0] at the start of
+ * the step in ynsave for use in cvCompleteStep and cvRestore.
  */
 
 static void cvPredict(CVodeMem cv_mem)
 {
   int j, k;
+  N_Vector tmp;
 
-  cv_mem->cv_tn += cv_mem->cv_h;
+  if (cv_mem->cv_compsums)
+  {
+    cv_mem->cv_terr_saved = cv_mem->cv_terr;
+    sunCompensatedSum(cv_mem->cv_tn, cv_mem->cv_h, &cv_mem->cv_tn,
+                      &cv_mem->cv_terr);
+  }
+  else { cv_mem->cv_tn += cv_mem->cv_h; }
   if (cv_mem->cv_tstopset)
   {
     if ((cv_mem->cv_tn - cv_mem->cv_tstop) * cv_mem->cv_h > ZERO)
     {
-      cv_mem->cv_tn = cv_mem->cv_tstop;
+      cv_mem->cv_tn   = cv_mem->cv_tstop;
+      cv_mem->cv_terr = ZERO;
     }
   }
 
@@ -2758,8 +3071,21 @@ static void cvPredict(CVodeMem cv_mem)
   {
     for (j = cv_mem->cv_q; j >= k; j--)
     {
-      N_VLinearSum(ONE, cv_mem->cv_zn[j - 1], ONE, cv_mem->cv_zn[j],
-                   cv_mem->cv_zn[j - 1]);
+      if (j == 1 && cv_mem->cv_compsums)
+      {
+        N_VLinearSum(ONE, cv_mem->cv_zn[1], -ONE, cv_mem->cv_ycomp,
+                     cv_mem->cv_dycomp);
+        N_VLinearSum(ONE, cv_mem->cv_zn[0], ONE, cv_mem->cv_dycomp,
+                     cv_mem->cv_ynsave);
+        tmp               = cv_mem->cv_zn[0];
+        cv_mem->cv_zn[0]  = cv_mem->cv_ynsave;
+        cv_mem->cv_ynsave = tmp;
+      }
+      else
+      {
+        N_VLinearSum(ONE, cv_mem->cv_zn[j - 1], ONE, cv_mem->cv_zn[j],
+                     cv_mem->cv_zn[j - 1]);
+      }
     }
   }
 
@@ -3067,6 +3393,7 @@ static int cvNls(CVodeMem cv_mem, int nflag)
   sunbooleantype callSetup;
   long int nni_inc = 0;
   long int nnf_inc = 0;
+  double t0        = 0.0;
 
   /* Decide whether or not to call setup routine (if one exists) and */
   /* set flag convfail (input to lsetup for its evaluation decision) */
@@ -3090,6 +3417,8 @@ static int cvNls(CVodeMem cv_mem, int nflag)
   /* initial guess for the correction to the predictor */
   N_VConst(ZERO, cv_mem->cv_acor);
 
+  if (cv_mem->cv_telemetryfn) { t0 = sunWallTime(); }
+
   /* call nonlinear solver setup if it exists */
   if ((cv_mem->NLS)->ops->setup)
   {
@@ -3104,6 +3433,11 @@ static int cvNls(CVodeMem cv_mem, int nflag)
   flag = SUNNonlinSolSolve(cv_mem->NLS, cv_mem->cv_zn[0], cv_mem->cv_acor,
                            cv_mem->cv_ewt, cv_mem->cv_tq[4], callSetup, cv_mem);
 
+  if (cv_mem->cv_telemetryfn)
+  {
+    cv_mem->cv_telemetry.time_nls += sunWallTime() - t0;
+  }
+
   /* increment counters */
   (void)SUNNonlinSolGetNumIters(cv_mem->NLS, &nni_inc);
   cv_mem->cv_nni += nni_inc;
@@ -3311,14 +3645,26 @@ static int cvHandleNFlag(CVodeMem cv_mem, int* nflagPtr, sunrealtype saved_t,
 void cvRestore(CVodeMem cv_mem, sunrealtype saved_t)
 {
   int j, k;
+  N_Vector tmp;
 
   cv_mem->cv_tn = saved_t;
+  if (cv_mem->cv_compsums) { cv_mem->cv_terr = cv_mem->cv_terr_saved; }
   for (k = 1; k <= cv_mem->cv_q; k++)
   {
     for (j = cv_mem->cv_q; j >= k; j--)
     {
-      N_VLinearSum(ONE, cv_mem->cv_zn[j - 1], -ONE, cv_mem->cv_zn[j],
-                   cv_mem->cv_zn[j - 1]);
+      if (j == 1 && cv_mem->cv_compsums)
+      {
+        /* zn[0] at the start of the step was saved by cvPredict */
+        tmp               = cv_mem->cv_zn[0];
+        cv_mem->cv_zn[0]  = cv_mem->cv_ynsave;
+        cv_mem->cv_ynsave = tmp;
+      }
+      else
+      {
+        N_VLinearSum(ONE, cv_mem->cv_zn[j - 1], -ONE, cv_mem->cv_zn[j],
+                     cv_mem->cv_zn[j - 1]);
+      }
     }
   }
 }
@@ -3482,15 +3828,44 @@ static void cvCompleteStep(CVodeMem cv_mem)
   cv_mem->cv_tau[1] = cv_mem->cv_h;
 
   /* Apply correction to column j of zn: l_j * Delta_n */
-  (void)N_VScaleAddMulti(cv_mem->cv_q + 1, cv_mem->cv_l, cv_mem->cv_acor,
-                         cv_mem->cv_zn, cv_mem->cv_zn);
+  if (cv_mem->cv_compsums)
+  {
+    /* Columns j > 0 are updated as usual while the corrections to zn[0] are
+       added to the increment which is then added to zn[0] at the start of
+       the step with compensated summation */
+    (void)N_VScaleAddMulti(cv_mem->cv_q, cv_mem->cv_l + 1, cv_mem->cv_acor,
+                           cv_mem->cv_zn + 1, cv_mem->cv_zn + 1);
+    N_VLinearSum(ONE, cv_mem->cv_dycomp, cv_mem->cv_l[0], cv_mem->cv_acor,
+                 cv_mem->cv_dycomp);
+
+    if (cv_mem->proj_applied)
+    {
+      (void)N_VScaleAddMulti(cv_mem->cv_q, cv_mem->proj_p + 1,
+                             cv_mem->cv_tempv, /* tempv = acorP */
+                             cv_mem->cv_zn + 1, cv_mem->cv_zn + 1);
+      N_VLinearSum(ONE, cv_mem->cv_dycomp, cv_mem->proj_p[0], cv_mem->cv_tempv,
+                   cv_mem->cv_dycomp);
+    }
 
-  /* Apply the projection correction to column j of zn: p_j * Delta_n */
-  if (cv_mem->proj_applied)
+    N_VLinearSum(ONE, cv_mem->cv_ynsave, ONE, cv_mem->cv_dycomp,
+                 cv_mem->cv_zn[0]);
+    N_VLinearSum(ONE, cv_mem->cv_zn[0], -ONE, cv_mem->cv_ynsave,
+                 cv_mem->cv_ycomp);
+    N_VLinearSum(ONE, cv_mem->cv_ycomp, -ONE, cv_mem->cv_dycomp,
+                 cv_mem->cv_ycomp);
+  }
+  else
   {
-    (void)N_VScaleAddMulti(cv_mem->cv_q + 1, cv_mem->proj_p,
-                           cv_mem->cv_tempv, /* tempv = acorP */
+    (void)N_VScaleAddMulti(cv_mem->cv_q + 1, cv_mem->cv_l, cv_mem->cv_acor,
                            cv_mem->cv_zn, cv_mem->cv_zn);
+
+    /* Apply the projection correction to column j of zn: p_j * Delta_n */
+    if (cv_mem->proj_applied)
+    {
+      (void)N_VScaleAddMulti(cv_mem->cv_q + 1, cv_mem->proj_p,
+                             cv_mem->cv_tempv, /* tempv = acorP */
+                             cv_mem->cv_zn, cv_mem->cv_zn);
+    }
   }
 
   cv_mem->cv_qwait--;
@@ -3550,9 +3925,8 @@ static void cvPrepareNextStep(CVodeMem cv_mem, sunrealtype dsm)
       /* If qwait = 0, consider an order change.   etaqm1 and etaqp1 are
         the ratios of new to old h at orders q-1 and q+1, respectively.
         cvChooseEta selects the largest; cvSetEta adjusts eta and acor */
-      cv_mem->cv_qwait  = 2;
-      cv_mem->cv_etaqm1 = cvComputeEtaqm1(cv_mem);
-      cv_mem->cv_etaqp1 = cvComputeEtaqp1(cv_mem);
+      cv_mem->cv_qwait = 2;
+      cvComputeEtaqm1qp1(cv_mem);
       cvChooseEta(cv_mem);
       cvSetEta(cv_mem);
     }
@@ -3604,51 +3978,66 @@ static void cvSetEta(CVodeMem cv_mem)
 }
 
 /*
- * cvComputeEtaqm1
+ * cvComputeEtaqm1qp1
  *
- * This routine computes and returns the value of etaqm1 for a
- * possible decrease in order by 1.
+ * This routine computes the values of etaqm1 and etaqp1 for a
+ * possible decrease or increase in order by 1. Both estimates are
+ * weighted by ewt, so the two norms are evaluated together with a
+ * single fused N_VWrmsNormVectorArray call (one global reduction).
  */
 
-static sunrealtype cvComputeEtaqm1(CVodeMem cv_mem)
+static void cvComputeEtaqm1qp1(CVodeMem cv_mem)
 {
-  sunrealtype ddn;
+  int nvec, iqm1, iqp1;
+  sunrealtype ddn, dup, cquot;
+  N_Vector wvecs[2];
 
   cv_mem->cv_etaqm1 = ZERO;
+  cv_mem->cv_etaqp1 = ZERO;
+
+  nvec = 0;
+  iqm1 = -1;
+  iqp1 = -1;
+
+  /* order decrease: norm of zn[q] */
   if (cv_mem->cv_q > 1)
   {
-    ddn = N_VWrmsNorm(cv_mem->cv_zn[cv_mem->cv_q], cv_mem->cv_ewt) *
-          cv_mem->cv_tq[1];
-    cv_mem->cv_etaqm1 = ONE /
-                        (SUNRpowerR(BIAS1 * ddn, ONE / cv_mem->cv_q) + ADDON);
+    iqm1                   = nvec;
+    cv_mem->cv_Xvecs[nvec] = cv_mem->cv_zn[cv_mem->cv_q];
+    wvecs[nvec]            = cv_mem->cv_ewt;
+    nvec++;
   }
-  return (cv_mem->cv_etaqm1);
-}
-
-/*
- * cvComputeEtaqp1
- *
- * This routine computes and returns the value of etaqp1 for a
- * possible increase in order by 1.
- */
 
-static sunrealtype cvComputeEtaqp1(CVodeMem cv_mem)
-{
-  sunrealtype dup, cquot;
-
-  cv_mem->cv_etaqp1 = ZERO;
-  if (cv_mem->cv_q != cv_mem->cv_qmax)
+  /* order increase: norm of acor - cquot * zn[qmax] */
+  if ((cv_mem->cv_q != cv_mem->cv_qmax) && (cv_mem->cv_saved_tq5 != ZERO))
   {
-    if (cv_mem->cv_saved_tq5 == ZERO) { return (cv_mem->cv_etaqp1); }
     cquot = (cv_mem->cv_tq[5] / cv_mem->cv_saved_tq5) *
             SUNRpowerI(cv_mem->cv_h / cv_mem->cv_tau[2], cv_mem->cv_L);
     N_VLinearSum(-cquot, cv_mem->cv_zn[cv_mem->cv_qmax], ONE, cv_mem->cv_acor,
                  cv_mem->cv_tempv);
-    dup = N_VWrmsNorm(cv_mem->cv_tempv, cv_mem->cv_ewt) * cv_mem->cv_tq[3];
+    iqp1                   = nvec;
+    cv_mem->cv_Xvecs[nvec] = cv_mem->cv_tempv;
+    wvecs[nvec]            = cv_mem->cv_ewt;
+    nvec++;
+  }
+
+  if (nvec == 0) { return; }
+
+  (void)N_VWrmsNormVectorArray(nvec, cv_mem->cv_Xvecs, wvecs, cv_mem->cv_cvals);
+
+  if (iqm1 >= 0)
+  {
+    ddn               = cv_mem->cv_cvals[iqm1] * cv_mem->cv_tq[1];
+    cv_mem->cv_etaqm1 = ONE /
+                        (SUNRpowerR(BIAS1 * ddn, ONE / cv_mem->cv_q) + ADDON);
+  }
+
+  if (iqp1 >= 0)
+  {
+    dup = cv_mem->cv_cvals[iqp1] * cv_mem->cv_tq[3];
     cv_mem->cv_etaqp1 =
       ONE / (SUNRpowerR(BIAS3 * dup, ONE / (cv_mem->cv_L + 1)) + ADDON);
   }
-  return (cv_mem->cv_etaqp1);
 }
 
 /*
@@ -3808,6 +4197,93 @@ static int cvHandleFailure(CVodeMem cv_mem, int flag)
   return (flag);
 }
 
+/*
+ * -----------------------------------------------------------------
+ * Function to pass solution output to the user
+ * -----------------------------------------------------------------
+ */
+
+/*
+ * cvOutputStep
+ *
+ * This routine passes any requested solution outputs from the step
+ * just completed to the user-supplied output function. Outputs on
+ * the time grid out_t0 + i*out_dt that fall within [tn - hu, tn]
+ * are interpolated into the ysink vector, unless they coincide with
+ * tn in which case zn[0] is passed directly. Outputs every
+ * out_nsteps steps always pass zn[0] directly. In either case the
+ * vector is only borrowed by the output function and must not be
+ * modified.
+ */
+
+static int cvOutputStep(CVodeMem cv_mem)
+{
+  int retval;
+  long int idx;
+  sunrealtype tprev, tout, troundoff;
+  N_Vector y;
+
+  /* Outputs on a uniform time grid */
+  if (cv_mem->cv_out_dt * cv_mem->cv_hu > ZERO)
+  {
+    tprev     = cv_mem->cv_tn - cv_mem->cv_hu;
+    troundoff = FUZZ_FACTOR * cv_mem->cv_uround *
+                (SUNRabs(cv_mem->cv_tn) + SUNRabs(cv_mem->cv_hu));
+
+    /* Skip any grid times before the start of the step (e.g., after a
+       reinitialization or when the grid starts before the initial time) */
+    tout = cv_mem->cv_out_t0 + cv_mem->cv_out_idx * cv_mem->cv_out_dt;
+    if ((tout - tprev) * cv_mem->cv_hu < ZERO &&
+        SUNRabs(tout - tprev) > troundoff)
+    {
+      idx = (long int)SUNRceil((tprev - cv_mem->cv_out_t0) / cv_mem->cv_out_dt);
+      cv_mem->cv_out_idx = SUNMAX(idx, cv_mem->cv_out_idx);
+    }
+
+    for (;;)
+    {
+      tout = cv_mem->cv_out_t0 + cv_mem->cv_out_idx * cv_mem->cv_out_dt;
+
+      if (SUNRabs(tout - cv_mem->cv_tn) <= troundoff)
+      {
+        y = cv_mem->cv_zn[0];
+      }
+      else if ((tout - cv_mem->cv_tn) * cv_mem->cv_hu > ZERO) { break; }
+      else
+      {
+        retval = CVodeGetDky(cv_mem, tout, 0, cv_mem->cv_ysink);
+        if (retval != CV_SUCCESS) { return (retval); }
+        y = cv_mem->cv_ysink;
+      }
+
+      retval = cv_mem->cv_outputfn(tout, y, cv_mem->cv_user_data);
+      if (retval != 0)
+      {
+        cvProcessError(cv_mem, CV_OUTPUT_FN_FAIL, __LINE__, __func__,
+                       __FILE__, MSGCV_OUTPUT_FN_FAILED, tout);
+        return (CV_OUTPUT_FN_FAIL);
+      }
+      cv_mem->cv_out_idx++;
+    }
+  }
+
+  /* Outputs every out_nsteps steps */
+  if (cv_mem->cv_out_nsteps > 0 &&
+      cv_mem->cv_nst % cv_mem->cv_out_nsteps == 0)
+  {
+    retval = cv_mem->cv_outputfn(cv_mem->cv_tn, cv_mem->cv_zn[0],
+                                 cv_mem->cv_user_data);
+    if (retval != 0)
+    {
+      cvProcessError(cv_mem, CV_OUTPUT_FN_FAIL, __LINE__, __func__, __FILE__,
+                     MSGCV_OUTPUT_FN_FAILED, cv_mem->cv_tn);
+      return (CV_OUTPUT_FN_FAIL);
+    }
+  }
+
+  return (CV_SUCCESS);
+}
+
 /*
  * -----------------------------------------------------------------
  * Functions for BDF Stability Limit Detection
@@ -4232,6 +4708,92 @@ static int cvSLdet(CVodeMem cv_mem)
  * -----------------------------------------------------------------
  */
 
+/*
+ * cvRootEval
+ *
+ * This routine evaluates the root functions at (t, y) and stores
+ * the result in gout.  If sparse is SUNTRUE and a subset function
+ * was supplied, only the components flagged in gmask are evaluated
+ * and the remaining entries of gout are unchanged.  All evaluations
+ * of g go through this routine so that they are counted in nge.
+ */
+
+static int cvRootEval(CVodeMem cv_mem, sunrealtype t, N_Vector y,
+                      sunrealtype* gout, sunbooleantype sparse)
+{
+  cv_mem->cv_nge++;
+  if (sparse && cv_mem->cv_gsub != NULL)
+  {
+    return cv_mem->cv_gsub(t, y, gout, cv_mem->cv_gmask, cv_mem->cv_user_data);
+  }
+  return cv_mem->cv_gfun(t, y, gout, cv_mem->cv_user_data);
+}
+
+/*
+ * cvRootEvalSubset
+ *
+ * This routine sets gout to g at (t, y) given the last values of g
+ * in glo, computed at the times in gtime. Only the inactive g_i and
+ * the g_i that were not evaluated at t are updated with the subset
+ * function. If rate bounds were supplied, the latter are further
+ * restricted to the g_i that could have changed sign since they
+ * were last evaluated, and the other entries of gout are copied
+ * from glo. The evaluated components are flagged in gmask on return.
+ */
+
+static int cvRootEvalSubset(CVodeMem cv_mem, sunrealtype t, sunrealtype* gout)
+{
+  int i;
+  sunbooleantype update;
+
+  update = SUNFALSE;
+  for (i = 0; i < cv_mem->cv_nrtfn; i++)
+  {
+    cv_mem->cv_gmask[i] = !cv_mem->cv_gactive[i] || cv_mem->cv_gtime[i] != t;
+    if (cv_mem->cv_gmask[i] && cv_mem->cv_gactive[i] &&
+        cv_mem->cv_gdotmax != NULL && cv_mem->cv_gdotmax[i] >= ZERO)
+    {
+      cv_mem->cv_gmask[i] = SUNRabs(cv_mem->cv_glo[i]) <=
+                            cv_mem->cv_gdotmax[i] *
+                              SUNRabs(t - cv_mem->cv_gtime[i]);
+    }
+    if (cv_mem->cv_gmask[i]) { update = SUNTRUE; }
+    else { gout[i] = cv_mem->cv_glo[i]; }
+  }
+  if (!update) { return (0); }
+
+  return (cvRootEval(cv_mem, t, cv_mem->cv_y, gout, SUNTRUE));
+}
+
+/*
+ * cvRootFreeSubset
+ *
+ * This routine frees the arrays used for evaluating a subset of
+ * the root functions.
+ */
+
+static void cvRootFreeSubset(CVodeMem cv_mem)
+{
+  if (cv_mem->cv_gmask != NULL)
+  {
+    free(cv_mem->cv_gmask);
+    cv_mem->cv_gmask = NULL;
+    cv_mem->cv_liw -= cv_mem->cv_nrtfn;
+  }
+  if (cv_mem->cv_gtime != NULL)
+  {
+    free(cv_mem->cv_gtime);
+    cv_mem->cv_gtime = NULL;
+    cv_mem->cv_lrw -= cv_mem->cv_nrtfn;
+  }
+  if (cv_mem->cv_gdotmax != NULL)
+  {
+    free(cv_mem->cv_gdotmax);
+    cv_mem->cv_gdotmax = NULL;
+    cv_mem->cv_lrw -= cv_mem->cv_nrtfn;
+  }
+}
+
 /*
  * cvRcheck1
  *
@@ -4256,10 +4818,17 @@ static int cvRcheck1(CVodeMem cv_mem)
                     cv_mem->cv_uround * HUNDRED;
 
   /* Evaluate g at initial t and check for zero values. */
-  retval = cv_mem->cv_gfun(cv_mem->cv_tlo, cv_mem->cv_zn[0], cv_mem->cv_glo,
-                           cv_mem->cv_user_data);
-  cv_mem->cv_nge = 1;
+  cv_mem->cv_nge = 0;
+  retval = cvRootEval(cv_mem, cv_mem->cv_tlo, cv_mem->cv_zn[0], cv_mem->cv_glo,
+                      SUNFALSE);
   if (retval != 0) { return (CV_RTFUNC_FAIL); }
+  if (cv_mem->cv_gtime != NULL)
+  {
+    for (i = 0; i < cv_mem->cv_nrtfn; i++)
+    {
+      cv_mem->cv_gtime[i] = cv_mem->cv_tlo;
+    }
+  }
 
   zroot = SUNFALSE;
   for (i = 0; i < cv_mem->cv_nrtfn; i++)
@@ -4277,9 +4846,7 @@ static int cvRcheck1(CVodeMem cv_mem)
   smallh = hratio * cv_mem->cv_h;
   tplus  = cv_mem->cv_tlo + smallh;
   N_VLinearSum(ONE, cv_mem->cv_zn[0], hratio, cv_mem->cv_zn[1], cv_mem->cv_y);
-  retval = cv_mem->cv_gfun(tplus, cv_mem->cv_y, cv_mem->cv_ghi,
-                           cv_mem->cv_user_data);
-  cv_mem->cv_nge++;
+  retval = cvRootEval(cv_mem, tplus, cv_mem->cv_y, cv_mem->cv_ghi, SUNFALSE);
   if (retval != 0) { return (CV_RTFUNC_FAIL); }
 
   /* We check now only the components of g which were exactly 0.0 at t0
@@ -4290,6 +4857,7 @@ static int cvRcheck1(CVodeMem cv_mem)
     {
       cv_mem->cv_gactive[i] = SUNTRUE;
       cv_mem->cv_glo[i]     = cv_mem->cv_ghi[i];
+      if (cv_mem->cv_gtime != NULL) { cv_mem->cv_gtime[i] = tplus; }
     }
   }
   return (CV_SUCCESS);
@@ -4325,10 +4893,28 @@ static int cvRcheck2(CVodeMem cv_mem)
   if (cv_mem->cv_irfnd == 0) { return (CV_SUCCESS); }
 
   (void)CVodeGetDky(cv_mem, cv_mem->cv_tlo, 0, cv_mem->cv_y);
-  retval = cv_mem->cv_gfun(cv_mem->cv_tlo, cv_mem->cv_y, cv_mem->cv_glo,
-                           cv_mem->cv_user_data);
-  cv_mem->cv_nge++;
-  if (retval != 0) { return (CV_RTFUNC_FAIL); }
+  if (cv_mem->cv_gsub != NULL)
+  {
+    retval = cvRootEvalSubset(cv_mem, cv_mem->cv_tlo, cv_mem->cv_glo);
+    if (retval != 0) { return (CV_RTFUNC_FAIL); }
+    for (i = 0; i < cv_mem->cv_nrtfn; i++)
+    {
+      if (cv_mem->cv_gmask[i]) { cv_mem->cv_gtime[i] = cv_mem->cv_tlo; }
+    }
+  }
+  else
+  {
+    retval = cvRootEval(cv_mem, cv_mem->cv_tlo, cv_mem->cv_y, cv_mem->cv_glo,
+                        SUNFALSE);
+    if (retval != 0) { return (CV_RTFUNC_FAIL); }
+    if (cv_mem->cv_gtime != NULL)
+    {
+      for (i = 0; i < cv_mem->cv_nrtfn; i++)
+      {
+        cv_mem->cv_gtime[i] = cv_mem->cv_tlo;
+      }
+    }
+  }
 
   zroot = SUNFALSE;
   for (i = 0; i < cv_mem->cv_nrtfn; i++) { cv_mem->cv_iroots[i] = 0; }
@@ -4354,10 +4940,16 @@ static int cvRcheck2(CVodeMem cv_mem)
     N_VLinearSum(ONE, cv_mem->cv_y, hratio, cv_mem->cv_zn[1], cv_mem->cv_y);
   }
   else { (void)CVodeGetDky(cv_mem, tplus, 0, cv_mem->cv_y); }
-  retval = cv_mem->cv_gfun(tplus, cv_mem->cv_y, cv_mem->cv_ghi,
-                           cv_mem->cv_user_data);
-  cv_mem->cv_nge++;
-  if (retval != 0) { return (CV_RTFUNC_FAIL); }
+  if (cv_mem->cv_gsub != NULL)
+  {
+    retval = cvRootEvalSubset(cv_mem, tplus, cv_mem->cv_ghi);
+    if (retval != 0) { return (CV_RTFUNC_FAIL); }
+  }
+  else
+  {
+    retval = cvRootEval(cv_mem, tplus, cv_mem->cv_y, cv_mem->cv_ghi, SUNFALSE);
+    if (retval != 0) { return (CV_RTFUNC_FAIL); }
+  }
 
   /* Check for close roots (error return), for a new zero at tlo+smallh,
   and for a g_i that changed from zero to nonzero. */
@@ -4373,7 +4965,11 @@ static int cvRcheck2(CVodeMem cv_mem)
     }
     else
     {
-      if (cv_mem->cv_iroots[i] == 1) { cv_mem->cv_glo[i] = cv_mem->cv_ghi[i]; }
+      if (cv_mem->cv_iroots[i] == 1)
+      {
+        cv_mem->cv_glo[i] = cv_mem->cv_ghi[i];
+        if (cv_mem->cv_gtime != NULL) { cv_mem->cv_gtime[i] = tplus; }
+      }
     }
   }
   if (zroot) { return (RTFOUND); }
@@ -4418,10 +5014,28 @@ static int cvRcheck3(CVodeMem cv_mem)
   }
 
   /* Set ghi = g(thi) and call cvRootfind to search (tlo,thi) for roots. */
-  retval = cv_mem->cv_gfun(cv_mem->cv_thi, cv_mem->cv_y, cv_mem->cv_ghi,
-                           cv_mem->cv_user_data);
-  cv_mem->cv_nge++;
-  if (retval != 0) { return (CV_RTFUNC_FAIL); }
+  if (cv_mem->cv_gsub != NULL)
+  {
+    retval = cvRootEvalSubset(cv_mem, cv_mem->cv_thi, cv_mem->cv_ghi);
+    if (retval != 0) { return (CV_RTFUNC_FAIL); }
+    for (i = 0; i < cv_mem->cv_nrtfn; i++)
+    {
+      if (cv_mem->cv_gmask[i]) { cv_mem->cv_gtime[i] = cv_mem->cv_thi; }
+    }
+  }
+  else
+  {
+    retval = cvRootEval(cv_mem, cv_mem->cv_thi, cv_mem->cv_y, cv_mem->cv_ghi,
+                        SUNFALSE);
+    if (retval != 0) { return (CV_RTFUNC_FAIL); }
+    if (cv_mem->cv_gtime != NULL)
+    {
+      for (i = 0; i < cv_mem->cv_nrtfn; i++)
+      {
+        cv_mem->cv_gtime[i] = cv_mem->cv_thi;
+      }
+    }
+  }
 
   cv_mem->cv_ttol = (SUNRabs(cv_mem->cv_tn) + SUNRabs(cv_mem->cv_h)) *
                     cv_mem->cv_uround * HUNDRED;
@@ -4472,6 +5086,14 @@ static int cvRcheck3(CVodeMem cv_mem)
  * gfun     = user-defined function for g(t).  Its form is
  *            (void) gfun(t, y, gt, user_data)
  *
+ * gsub     = optional user-defined function evaluating the
+ *            components of g(t) flagged in gmask.  If supplied,
+ *            only the g_i with a sign change or zero at thi are
+ *            evaluated while searching for the root.
+ *
+ * gtime    = if allocated, the times at which the g_i values
+ *            in glo and ghi were last evaluated.
+ *
  * rootdir  = in array specifying the direction of zero-crossings.
  *            If rootdir[i] > 0, search for roots of g_i only if
  *            g_i is increasing; if rootdir[i] < 0, search for
@@ -4589,6 +5211,22 @@ static int cvRootfind(CVodeMem cv_mem)
     return (RTFOUND);
   }
 
+  /* If a subset function was supplied, only the g_i that change sign or are
+     zero at thi (and the inactive g_i) are evaluated during the search; the
+     others keep their value at thi as they do not change sign in (tlo,thi).
+     Since a root is always found below, cvRcheck2 updates any of these g_i
+     that may vanish at the root before the next search. */
+  if (cv_mem->cv_gsub != NULL)
+  {
+    for (i = 0; i < cv_mem->cv_nrtfn; i++)
+    {
+      cv_mem->cv_gmask[i] =
+        !cv_mem->cv_gactive[i] || SUNRabs(cv_mem->cv_ghi[i]) == ZERO ||
+        DIFFERENT_SIGN(cv_mem->cv_glo[i], cv_mem->cv_ghi[i]);
+      if (!cv_mem->cv_gmask[i]) { cv_mem->cv_grout[i] = cv_mem->cv_ghi[i]; }
+    }
+  }
+
   /* Initialize alph to avoid compiler warning */
   alph = ONE;
 
@@ -4635,9 +5273,7 @@ static int cvRootfind(CVodeMem cv_mem)
     }
 
     (void)CVodeGetDky(cv_mem, tmid, 0, cv_mem->cv_y);
-    retval = cv_mem->cv_gfun(tmid, cv_mem->cv_y, cv_mem->cv_grout,
-                             cv_mem->cv_user_data);
-    cv_mem->cv_nge++;
+    retval = cvRootEval(cv_mem, tmid, cv_mem->cv_y, cv_mem->cv_grout, SUNTRUE);
     if (retval != 0) { return (CV_RTFUNC_FAIL); }
 
     /* Check to see in which subinterval g changes sign, and reset imax.
@@ -4717,6 +5353,11 @@ static int cvRootfind(CVodeMem cv_mem)
   cv_mem->cv_trout = cv_mem->cv_thi;
   for (i = 0; i < cv_mem->cv_nrtfn; i++)
   {
+    if (cv_mem->cv_gtime != NULL &&
+        (cv_mem->cv_gsub == NULL || cv_mem->cv_gmask[i]))
+    {
+      cv_mem->cv_gtime[i] = cv_mem->cv_thi;
+    }
     cv_mem->cv_grout[i]  = cv_mem->cv_ghi[i];
     cv_mem->cv_iroots[i] = 0;
     if (!cv_mem->cv_gactive[i]) { continue; }
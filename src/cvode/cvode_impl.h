@@ -212,6 +212,8 @@ typedef struct CVodeMemRec
   sunbooleantype cv_user_efun; /* SUNTRUE if user sets efun                     */
   CVEwtFn cv_efun; /* function to set ewt                           */
   void* cv_e_data; /* user pointer passed to efun                   */
+  sunrealtype cv_ewt_thresh; /* weight change that triggers an ewt update */
+  sunrealtype cv_ewt_drift;  /* estimated weight change since last update */
 
   sunbooleantype cv_constraintsSet; /* constraints vector present:
                                     do constraints calc                       */
@@ -244,6 +246,17 @@ typedef struct CVodeMemRec
 
   N_Vector cv_constraints; /* vector of inequality constraint options         */
 
+  /*------------------------------------------------
+    Compensated summation of the solution and time
+    ------------------------------------------------*/
+
+  sunbooleantype cv_compsums; /* use compensated summation                 */
+  N_Vector cv_ycomp;          /* running correction to zn[0]               */
+  N_Vector cv_dycomp;         /* step increment less the correction        */
+  N_Vector cv_ynsave;         /* zn[0] at the start of the step            */
+  sunrealtype cv_terr;        /* running correction to tn                  */
+  sunrealtype cv_terr_saved;  /* correction to tn at the start of the step */
+
   /*-----------------
     Tstop information
     -----------------*/
@@ -328,6 +341,7 @@ typedef struct CVodeMemRec
   long int cv_nnf;     /* number of nonlinear convergence failures        */
   long int cv_netf;    /* number of error test failures                   */
   long int cv_nsetups; /* number of setup calls                           */
+  long int cv_newt;    /* number of ewt evaluations                       */
   int cv_nhnil;        /* number of messages issued to the user that
                               t + h == t for the next iternal step            */
 
@@ -403,6 +417,8 @@ typedef struct CVodeMemRec
   sunbooleantype cv_VabstolMallocDone;
   sunbooleantype cv_MallocDone;
   sunbooleantype cv_constraintsMallocDone;
+  sunbooleantype cv_compsumsMallocDone;
+  sunbooleantype cv_ysinkMallocDone;
 
   /*-------------------------------------------
     User access function
@@ -410,6 +426,22 @@ typedef struct CVodeMemRec
   CVMonitorFn cv_monitorfun;    /* func called with CVODE mem and user data  */
   long int cv_monitor_interval; /* step interval to call cv_monitorfun       */
 
+  /*-----------------------------
+    User solution output function
+    -----------------------------*/
+  CVOutputFn cv_outputfn; /* func called with the solution               */
+  sunrealtype cv_out_t0;  /* first time in the output grid               */
+  sunrealtype cv_out_dt;  /* output grid spacing (0 = no grid output)    */
+  long int cv_out_idx;    /* index of the next grid time to output       */
+  long int cv_out_nsteps; /* output every cv_out_nsteps steps (0 = off)  */
+  N_Vector cv_ysink;      /* interpolated solution passed to cv_outputfn */
+
+  /*-------------------
+    Per-step telemetry
+    -------------------*/
+  SUNStepTelemetryFn cv_telemetryfn; /* func called after each step attempt */
+  SUNStepTelemetry cv_telemetry;     /* record for the current attempt      */
+
   /*-------------------------
     Stability Limit Detection
     -------------------------*/
@@ -441,6 +473,11 @@ typedef struct CVodeMemRec
   sunbooleantype* cv_gactive; /* array with active/inactive event functions      */
   int cv_mxgnull; /* number of warning messages about possible g==0  */
 
+  CVRootSubsetFn cv_gsub;   /* function evaluating a subset of g            */
+  sunbooleantype* cv_gmask; /* array flagging components to evaluate        */
+  sunrealtype* cv_gdotmax;  /* array of bounds on |dg_i/dt|                 */
+  sunrealtype* cv_gtime;    /* array of times of last g_i evaluations       */
+
   /*---------------
     Projection Data
     ---------------*/
@@ -633,6 +670,10 @@ void cvRestore(CVodeMem cv_mem, sunrealtype saved_t);
 
 void cvRescale(CVodeMem cv_mem);
 
+/* Linear solver counters reported in the per-step telemetry */
+
+void cvLsTelemetryCounters(CVodeMem cv_mem, long int* nli, long int* nje);
+
 #ifdef SUNDIALS_BUILD_PACKAGE_FUSED_KERNELS
 int cvEwtSetSS_fused(const sunbooleantype atolmin0, const sunrealtype reltol,
                      const sunrealtype Sabstol, const N_Vector ycur,
@@ -757,6 +798,9 @@ int cvDiagSolve_updateM(const sunrealtype r, N_Vector M);
 #define MSGCV_RTFUNC_FAILED                                              \
   "At " MSG_TIME ", the rootfinding routine failed in an unrecoverable " \
   "manner."
+#define MSGCV_OUTPUT_FN_FAILED                                  \
+  "At " MSG_TIME ", the solution output function failed in an " \
+  "unrecoverable manner."
 #define MSGCV_CLOSE_ROOTS "Root found at and very near " MSG_TIME "."
 #define MSGCV_BAD_TSTOP                                      \
   "The value " MSG_TIME_TSTOP " is behind current " MSG_TIME \
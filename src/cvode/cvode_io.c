@@ -58,6 +58,32 @@ int CVodeSetDeltaGammaMaxLSetup(void* cvode_mem, sunrealtype dgmax_lsetup)
   return (CV_SUCCESS);
 }
 
+/*
+ * CVodeSetErrWeightUpdateThreshold
+ *
+ * Specifies the estimated relative change in the error weights that
+ * triggers a recomputation of the weights (0 = recompute every step)
+ */
+
+int CVodeSetErrWeightUpdateThreshold(void* cvode_mem, sunrealtype ewt_thresh)
+{
+  CVodeMem cv_mem;
+
+  if (cvode_mem == NULL)
+  {
+    cvProcessError(NULL, CV_MEM_NULL, __LINE__, __func__, __FILE__, MSGCV_NO_MEM);
+    return (CV_MEM_NULL);
+  }
+
+  cv_mem = (CVodeMem)cvode_mem;
+
+  /* Set value or use default */
+  if (ewt_thresh <= ZERO) { cv_mem->cv_ewt_thresh = ZERO; }
+  else { cv_mem->cv_ewt_thresh = ewt_thresh; }
+
+  return (CV_SUCCESS);
+}
+
 /*
  * CVodeSetUserData
  *
@@ -147,6 +173,148 @@ int CVodeSetMonitorFrequency(void* cvode_mem, long int nst)
 #endif
 }
 
+/*
+ * CVodeSetStepTelemetryFn
+ *
+ * Specifies the user function to call after each step attempt with
+ * the per-step telemetry record. Passing NULL disables telemetry.
+ */
+
+int CVodeSetStepTelemetryFn(void* cvode_mem, SUNStepTelemetryFn fn)
+{
+  CVodeMem cv_mem;
+
+  if (cvode_mem == NULL)
+  {
+    cvProcessError(NULL, CV_MEM_NULL, __LINE__, __func__, __FILE__, MSGCV_NO_MEM);
+    return (CV_MEM_NULL);
+  }
+
+  cv_mem = (CVodeMem)cvode_mem;
+
+  cv_mem->cv_telemetryfn = fn;
+
+  return (CV_SUCCESS);
+}
+
+/*
+ * CVodeSetOutputFn
+ *
+ * Specifies the user function to call with the solution at the times
+ * requested with CVodeSetOutputTimes and/or every nsteps steps as
+ * requested with CVodeSetOutputStepInterval. Passing NULL disables
+ * solution output. The vector passed to the function is owned by
+ * CVODE, is only valid for the duration of the call, and must not be
+ * modified.
+ */
+
+int CVodeSetOutputFn(void* cvode_mem, CVOutputFn OutputFn)
+{
+  CVodeMem cv_mem;
+
+  if (cvode_mem == NULL)
+  {
+    cvProcessError(NULL, CV_MEM_NULL, __LINE__, __func__, __FILE__, MSGCV_NO_MEM);
+    return (CV_MEM_NULL);
+  }
+
+  cv_mem = (CVodeMem)cvode_mem;
+
+  cv_mem->cv_outputfn = OutputFn;
+
+  return (CV_SUCCESS);
+}
+
+/*
+ * CVodeSetOutputTimes
+ *
+ * Requests solution output at the times tout0 + i*dtout for
+ * i = 0, 1, 2, ... The sign of dtout must match the direction of
+ * integration. A zero dtout disables output on a time grid.
+ */
+
+int CVodeSetOutputTimes(void* cvode_mem, sunrealtype tout0, sunrealtype dtout)
+{
+  CVodeMem cv_mem;
+
+  if (cvode_mem == NULL)
+  {
+    cvProcessError(NULL, CV_MEM_NULL, __LINE__, __func__, __FILE__, MSGCV_NO_MEM);
+    return (CV_MEM_NULL);
+  }
+
+  cv_mem = (CVodeMem)cvode_mem;
+
+  if (cv_mem->cv_MallocDone == SUNFALSE)
+  {
+    cvProcessError(cv_mem, CV_NO_MALLOC, __LINE__, __func__, __FILE__,
+                   MSGCV_NO_MALLOC);
+    return (CV_NO_MALLOC);
+  }
+
+  /* A zero spacing disables grid output, destroy data structures */
+  if (dtout == ZERO)
+  {
+    if (cv_mem->cv_ysinkMallocDone)
+    {
+      N_VDestroy(cv_mem->cv_ysink);
+      cv_mem->cv_lrw -= cv_mem->cv_lrw1;
+      cv_mem->cv_liw -= cv_mem->cv_liw1;
+    }
+    cv_mem->cv_ysink           = NULL;
+    cv_mem->cv_ysinkMallocDone = SUNFALSE;
+    cv_mem->cv_out_t0          = ZERO;
+    cv_mem->cv_out_dt          = ZERO;
+    cv_mem->cv_out_idx         = 0;
+    return (CV_SUCCESS);
+  }
+
+  /* Allocate the vector to hold interpolated outputs */
+  if (!(cv_mem->cv_ysinkMallocDone))
+  {
+    cv_mem->cv_ysink = N_VClone(cv_mem->cv_ewt);
+    if (cv_mem->cv_ysink == NULL)
+    {
+      cvProcessError(cv_mem, CV_MEM_FAIL, __LINE__, __func__, __FILE__,
+                     MSGCV_MEM_FAIL);
+      return (CV_MEM_FAIL);
+    }
+    cv_mem->cv_lrw += cv_mem->cv_lrw1;
+    cv_mem->cv_liw += cv_mem->cv_liw1;
+    cv_mem->cv_ysinkMallocDone = SUNTRUE;
+  }
+
+  cv_mem->cv_out_t0  = tout0;
+  cv_mem->cv_out_dt  = dtout;
+  cv_mem->cv_out_idx = 0;
+
+  return (CV_SUCCESS);
+}
+
+/*
+ * CVodeSetOutputStepInterval
+ *
+ * Requests solution output after every nsteps successful steps. A
+ * non-positive input disables output based on the step count.
+ */
+
+int CVodeSetOutputStepInterval(void* cvode_mem, long int nsteps)
+{
+  CVodeMem cv_mem;
+
+  if (cvode_mem == NULL)
+  {
+    cvProcessError(NULL, CV_MEM_NULL, __LINE__, __func__, __FILE__, MSGCV_NO_MEM);
+    return (CV_MEM_NULL);
+  }
+
+  cv_mem = (CVodeMem)cvode_mem;
+
+  cv_mem->cv_out_nsteps = (nsteps > 0) ? nsteps : 0;
+
+  return (CV_SUCCESS);
+}
+
 /*
  * CVodeSetMaxOrd
  *
@@ -922,6 +1090,128 @@ int CVodeSetNoInactiveRootWarn(void* cvode_mem)
   return (CV_SUCCESS);
 }
 
+/*
+ * CVodeSetRootSubsetFn
+ *
+ * Specifies an optional function that evaluates only the root
+ * functions flagged in a mask. When supplied, CVODE only evaluates
+ * the root functions that bracket a root while locating it, and
+ * those that may have changed sign in a step when bounds on their
+ * rate of change are given with CVodeSetRootRateBounds. A NULL
+ * input disables the subset evaluations.
+ */
+
+int CVodeSetRootSubsetFn(void* cvode_mem, CVRootSubsetFn gsub)
+{
+  CVodeMem cv_mem;
+  int i, nrt;
+
+  if (cvode_mem == NULL)
+  {
+    cvProcessError(NULL, CV_MEM_NULL, __LINE__, __func__, __FILE__, MSGCV_NO_MEM);
+    return (CV_MEM_NULL);
+  }
+
+  cv_mem = (CVodeMem)cvode_mem;
+
+  nrt = cv_mem->cv_nrtfn;
+  if (nrt == 0)
+  {
+    cvProcessError(cv_mem, CV_ILL_INPUT, __LINE__, __func__, __FILE__,
+                   MSGCV_NO_ROOT);
+    return (CV_ILL_INPUT);
+  }
+
+  /* Allocate the evaluation mask and the times of the last evaluation of
+     each function, the latter are set so the first check evaluates all
+     functions */
+  if (gsub != NULL && cv_mem->cv_gmask == NULL)
+  {
+    cv_mem->cv_gmask = (sunbooleantype*)malloc(nrt * sizeof(sunbooleantype));
+    cv_mem->cv_gtime = (sunrealtype*)malloc(nrt * sizeof(sunrealtype));
+    if (cv_mem->cv_gmask == NULL || cv_mem->cv_gtime == NULL)
+    {
+      free(cv_mem->cv_gmask);
+      cv_mem->cv_gmask = NULL;
+      free(cv_mem->cv_gtime);
+      cv_mem->cv_gtime = NULL;
+      cvProcessError(cv_mem, CV_MEM_FAIL, __LINE__, __func__, __FILE__,
+                     MSGCV_MEM_FAIL);
+      return (CV_MEM_FAIL);
+    }
+    for (i = 0; i < nrt; i++)
+    {
+      cv_mem->cv_gmask[i] = SUNTRUE;
+      cv_mem->cv_gtime[i] = -SUN_BIG_REAL;
+    }
+    cv_mem->cv_liw += nrt;
+    cv_mem->cv_lrw += nrt;
+  }
+
+  cv_mem->cv_gsub = gsub;
+
+  return (CV_SUCCESS);
+}
+
+/*
+ * CVodeSetRootRateBounds
+ *
+ * Specifies bounds on the magnitude of the time derivative of each
+ * root function, a negative value indicates the function has no
+ * bound. With a subset function, a root function is only evaluated
+ * at the end of a step if its bound allows it to change sign since
+ * its last evaluation. A NULL input removes the bounds.
+ */
+
+int CVodeSetRootRateBounds(void* cvode_mem, const sunrealtype* gdotmax)
+{
+  CVodeMem cv_mem;
+  int i, nrt;
+
+  if (cvode_mem == NULL)
+  {
+    cvProcessError(NULL, CV_MEM_NULL, __LINE__, __func__, __FILE__, MSGCV_NO_MEM);
+    return (CV_MEM_NULL);
+  }
+
+  cv_mem = (CVodeMem)cvode_mem;
+
+  nrt = cv_mem->cv_nrtfn;
+  if (nrt == 0)
+  {
+    cvProcessError(cv_mem, CV_ILL_INPUT, __LINE__, __func__, __FILE__,
+                   MSGCV_NO_ROOT);
+    return (CV_ILL_INPUT);
+  }
+
+  if (gdotmax == NULL)
+  {
+    if (cv_mem->cv_gdotmax != NULL)
+    {
+      free(cv_mem->cv_gdotmax);
+      cv_mem->cv_gdotmax = NULL;
+      cv_mem->cv_lrw -= nrt;
+    }
+    return (CV_SUCCESS);
+  }
+
+  if (cv_mem->cv_gdotmax == NULL)
+  {
+    cv_mem->cv_gdotmax = (sunrealtype*)malloc(nrt * sizeof(sunrealtype));
+    if (cv_mem->cv_gdotmax == NULL)
+    {
+      cvProcessError(cv_mem, CV_MEM_FAIL, __LINE__, __func__, __FILE__,
+                     MSGCV_MEM_FAIL);
+      return (CV_MEM_FAIL);
+    }
+    cv_mem->cv_lrw += nrt;
+  }
+
+  for (i = 0; i < nrt; i++) { cv_mem->cv_gdotmax[i] = gdotmax[i]; }
+
+  return (CV_SUCCESS);
+}
+
 /*
  * CVodeSetConstraints
  *
@@ -992,6 +1282,77 @@ int CVodeSetConstraints(void* cvode_mem, N_Vector constraints)
   return (CV_SUCCESS);
 }
 
+/*
+ * CVodeSetUseCompensatedSums
+ *
+ * Enable or disable compensated summation when updating the solution
+ * and time at the end of each step
+ */
+
+int CVodeSetUseCompensatedSums(void* cvode_mem, sunbooleantype onoff)
+{
+  CVodeMem cv_mem;
+
+  if (cvode_mem == NULL)
+  {
+    cvProcessError(NULL, CV_MEM_NULL, __LINE__, __func__, __FILE__, MSGCV_NO_MEM);
+    return (CV_MEM_NULL);
+  }
+
+  cv_mem = (CVodeMem)cvode_mem;
+
+  if (cv_mem->cv_MallocDone == SUNFALSE)
+  {
+    cvProcessError(cv_mem, CV_NO_MALLOC, __LINE__, __func__, __FILE__,
+                   MSGCV_NO_MALLOC);
+    return (CV_NO_MALLOC);
+  }
+
+  /* If compensated sums are disabled, destroy data structures */
+  if (!onoff)
+  {
+    if (cv_mem->cv_compsumsMallocDone)
+    {
+      N_VDestroy(cv_mem->cv_ycomp);
+      N_VDestroy(cv_mem->cv_dycomp);
+      N_VDestroy(cv_mem->cv_ynsave);
+      cv_mem->cv_lrw -= 3 * cv_mem->cv_lrw1;
+      cv_mem->cv_liw -= 3 * cv_mem->cv_liw1;
+    }
+    cv_mem->cv_compsumsMallocDone = SUNFALSE;
+    cv_mem->cv_compsums           = SUNFALSE;
+    cv_mem->cv_terr               = ZERO;
+    return (CV_SUCCESS);
+  }
+
+  if (!(cv_mem->cv_compsumsMallocDone))
+  {
+    cv_mem->cv_ycomp  = N_VClone(cv_mem->cv_ewt);
+    cv_mem->cv_dycomp = N_VClone(cv_mem->cv_ewt);
+    cv_mem->cv_ynsave = N_VClone(cv_mem->cv_ewt);
+    if (!(cv_mem->cv_ycomp) || !(cv_mem->cv_dycomp) || !(cv_mem->cv_ynsave))
+    {
+      N_VDestroy(cv_mem->cv_ycomp);
+      N_VDestroy(cv_mem->cv_dycomp);
+      N_VDestroy(cv_mem->cv_ynsave);
+      cvProcessError(cv_mem, CV_MEM_FAIL, __LINE__, __func__, __FILE__,
+                     MSGCV_MEM_FAIL);
+      return (CV_MEM_FAIL);
+    }
+    cv_mem->cv_lrw += 3 * cv_mem->cv_lrw1;
+    cv_mem->cv_liw += 3 * cv_mem->cv_liw1;
+    cv_mem->cv_compsumsMallocDone = SUNTRUE;
+  }
+
+  /* Start with no accumulated correction */
+  N_VConst(ZERO, cv_mem->cv_ycomp);
+
+  cv_mem->cv_compsums = SUNTRUE;
+  cv_mem->cv_terr     = ZERO;
+
+  return (CV_SUCCESS);
+}
+
 /*
  * CVodeSetUseIntegratorFusedKernels
  *
@@ -1085,6 +1446,29 @@ int CVodeGetNumRhsEvals(void* cvode_mem, long int* nfevals)
   return (CV_SUCCESS);
 }
 
+/*
+ * CVodeGetNumErrWeightEvals
+ *
+ * Returns the current number of error weight vector evaluations
+ */
+
+int CVodeGetNumErrWeightEvals(void* cvode_mem, long int* newtevals)
+{
+  CVodeMem cv_mem;
+
+  if (cvode_mem == NULL)
+  {
+    cvProcessError(NULL, CV_MEM_NULL, __LINE__, __func__, __FILE__, MSGCV_NO_MEM);
+    return (CV_MEM_NULL);
+  }
+
+  cv_mem = (CVodeMem)cvode_mem;
+
+  *newtevals = cv_mem->cv_newt;
+
+  return (CV_SUCCESS);
+}
+
 /*
  * CVodeGetNumLinSolvSetups
  *
@@ -1758,6 +2142,7 @@ char* CVodeGetReturnFlagName(long int flag)
   case CV_PROJ_MEM_NULL: sprintf(name, "CV_PROJ_MEM_NULL"); break;
   case CV_PROJFUNC_FAIL: sprintf(name, "CV_PROJFUNC_FAIL"); break;
   case CV_REPTD_PROJFUNC_ERR: sprintf(name, "CV_REPTD_PROJFUNC_ERR"); break;
+  case CV_OUTPUT_FN_FAIL: sprintf(name, "CV_OUTPUT_FN_FAIL"); break;
   default: sprintf(name, "NONE");
   }
 
@@ -1915,6 +1915,27 @@ int cvLsInitializeCounters(CVLsMem cvls_mem)
   return (0);
 }
 
+/*-----------------------------------------------------------------
+  cvLsTelemetryCounters
+
+  This routine returns the linear iteration and Jacobian evaluation
+  counters for the per-step telemetry. Both are zero when the CVLs
+  interface is not attached.
+  -----------------------------------------------------------------*/
+void cvLsTelemetryCounters(CVodeMem cv_mem, long int* nli, long int* nje)
+{
+  CVLsMem cvls_mem;
+
+  *nli = 0;
+  *nje = 0;
+
+  if (cv_mem->cv_lmem == NULL || cv_mem->cv_lsolve != cvLsSolve) { return; }
+
+  cvls_mem = (CVLsMem)cv_mem->cv_lmem;
+  *nli     = cvls_mem->nli;
+  *nje     = cvls_mem->nje;
+}
+
 /*---------------------------------------------------------------
   cvLs_AccessLMem
 
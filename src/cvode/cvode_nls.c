@@ -16,6 +16,7 @@
 
 #include "cvode_impl.h"
 #include "sundials/sundials_math.h"
+#include "sundials_utils.h"
 
 /* constant macros */
 #define ONE SUN_RCONST(1.0) /* real 1.0 */
@@ -254,6 +255,7 @@ static int cvNlsLSetup(sunbooleantype jbad, sunbooleantype* jcur, void* cvode_me
 {
   CVodeMem cv_mem;
   int retval;
+  double t0 = 0.0;
 
   if (cvode_mem == NULL)
   {
@@ -265,6 +267,8 @@ static int cvNlsLSetup(sunbooleantype jbad, sunbooleantype* jcur, void* cvode_me
   /* if the nonlinear solver marked the Jacobian as bad update convfail */
   if (jbad) { cv_mem->convfail = CV_FAIL_BAD_J; }
 
+  if (cv_mem->cv_telemetryfn) { t0 = sunWallTime(); }
+
   /* setup the linear solver */
   retval = cv_mem->cv_lsetup(cv_mem, cv_mem->convfail, cv_mem->cv_y,
                              cv_mem->cv_ftemp, &(cv_mem->cv_jcur),
@@ -272,6 +276,11 @@ static int cvNlsLSetup(sunbooleantype jbad, sunbooleantype* jcur, void* cvode_me
                              cv_mem->cv_vtemp3);
   cv_mem->cv_nsetups++;
 
+  if (cv_mem->cv_telemetryfn)
+  {
+    cv_mem->cv_telemetry.time_lsetup += sunWallTime() - t0;
+  }
+
   /* update Jacobian status */
   *jcur = cv_mem->cv_jcur;
 
@@ -290,6 +299,7 @@ static int cvNlsLSolve(N_Vector delta, void* cvode_mem)
 {
   CVodeMem cv_mem;
   int retval;
+  double t0 = 0.0;
 
   if (cvode_mem == NULL)
   {
@@ -298,9 +308,16 @@ static int cvNlsLSolve(N_Vector delta, void* cvode_mem)
   }
   cv_mem = (CVodeMem)cvode_mem;
 
+  if (cv_mem->cv_telemetryfn) { t0 = sunWallTime(); }
+
   retval = cv_mem->cv_lsolve(cv_mem, delta, cv_mem->cv_ewt, cv_mem->cv_y,
                              cv_mem->cv_ftemp);
 
+  if (cv_mem->cv_telemetryfn)
+  {
+    cv_mem->cv_telemetry.time_lsolve += sunWallTime() - t0;
+  }
+
   if (retval < 0) { return (CV_LSOLVE_FAIL); }
   if (retval > 0) { return (SUN_NLS_CONV_RECVR); }
 
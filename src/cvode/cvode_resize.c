@@ -349,6 +349,37 @@ int CVodeResizeHistory(void* cvode_mem, sunrealtype* t_hist, N_Vector* y_hist,
     cv_mem->cv_constraintsSet        = SUNFALSE;
   }
 
+  /* Restart compensated summation with the new vector size */
+  if (cv_mem->cv_compsumsMallocDone)
+  {
+    N_VDestroy(cv_mem->cv_ycomp);
+    N_VDestroy(cv_mem->cv_dycomp);
+    N_VDestroy(cv_mem->cv_ynsave);
+    cv_mem->cv_ycomp  = N_VClone(y_hist[0]);
+    cv_mem->cv_dycomp = N_VClone(y_hist[0]);
+    cv_mem->cv_ynsave = N_VClone(y_hist[0]);
+    if (!(cv_mem->cv_ycomp) || !(cv_mem->cv_dycomp) || !(cv_mem->cv_ynsave))
+    {
+      cvProcessError(cv_mem, CV_MEM_FAIL, __LINE__, __func__, __FILE__,
+                     "A vector allocation failed");
+      return CV_MEM_FAIL;
+    }
+    N_VConst(ZERO, cv_mem->cv_ycomp);
+  }
+
+  /* Resize the vector holding interpolated outputs */
+  if (cv_mem->cv_ysinkMallocDone)
+  {
+    N_VDestroy(cv_mem->cv_ysink);
+    cv_mem->cv_ysink = N_VClone(y_hist[0]);
+    if (!(cv_mem->cv_ysink))
+    {
+      cvProcessError(cv_mem, CV_MEM_FAIL, __LINE__, __func__, __FILE__,
+                     "A vector allocation failed");
+      return CV_MEM_FAIL;
+    }
+  }
+
   for (int j = 0; j <= cv_mem->cv_qmax_alloc; j++)
   {
     N_VDestroy(cv_mem->cv_zn[j]);
@@ -489,7 +520,8 @@ int CVodeResizeHistory(void* cvode_mem, sunrealtype* t_hist, N_Vector* y_hist,
    * ------------------- */
 
   /* Ensure internal time and step history match the input history */
-  cv_mem->cv_tn = t_hist[0];
+  cv_mem->cv_tn   = t_hist[0];
+  cv_mem->cv_terr = ZERO;
 
   for (int i = 1; i < n_hist; i++)
   {
@@ -90,6 +90,7 @@
 
 #include "ida_impl.h"
 #include "sundials/priv/sundials_errors_impl.h"
+#include "sundials_utils.h"
 
 /*
  * =================================================================
@@ -202,6 +203,12 @@ static int IDAEwtSetSV(IDAMem IDA_mem, N_Vector ycur, N_Vector weight);
 
 static int IDAStep(IDAMem IDA_mem);
 
+/* Per-step telemetry */
+
+static void IDATelemetryBegin(IDAMem IDA_mem, int attempt);
+static void IDATelemetryEnd(IDAMem IDA_mem, SUNStepOutcome outcome,
+                            sunrealtype dsm);
+
 /* Function called at beginning of step */
 
 static void IDASetCoeffs(IDAMem IDA_mem, sunrealtype* ck);
@@ -247,6 +254,11 @@ static int IDARcheck1(IDAMem IDA_mem);
 static int IDARcheck2(IDAMem IDA_mem);
 static int IDARcheck3(IDAMem IDA_mem);
 static int IDARootfind(IDAMem IDA_mem);
+static int IDARootEval(IDAMem IDA_mem, sunrealtype t, N_Vector yy, N_Vector yp,
+                       sunrealtype* gout, sunbooleantype sparse);
+static int IDARootEvalSubset(IDAMem IDA_mem, sunrealtype t,
+                             sunrealtype* gout);
+static void IDARootFreeSubset(IDAMem IDA_mem);
 
 /*
  * =================================================================
@@ -327,6 +339,7 @@ void* IDACreate(SUNContext sunctx)
   IDA_mem->ida_constraintsSet = SUNFALSE;
   IDA_mem->ida_tstopset       = SUNFALSE;
   IDA_mem->ida_dcj            = DCJ_DEFAULT;
+  IDA_mem->ida_telemetryfn    = NULL;
 
   /* set the saved value maxord_alloc */
   IDA_mem->ida_maxord_alloc = MAXORD_DEFAULT;
@@ -531,6 +544,10 @@ int IDAInit(void* ida_mem, IDAResFn res, sunrealtype t0, N_Vector yy0,
   IDA_mem->ida_nrtfn   = 0;
   IDA_mem->ida_gactive = NULL;
   IDA_mem->ida_mxgnull = 1;
+  IDA_mem->ida_gsub    = NULL;
+  IDA_mem->ida_gmask   = NULL;
+  IDA_mem->ida_gdotmax = NULL;
+  IDA_mem->ida_gtime   = NULL;
 
   /* Initial setup not done yet */
 
@@ -842,6 +859,10 @@ int IDARootInit(void* ida_mem, int nrtfn, IDARootFn g)
 
     IDA_mem->ida_lrw -= 3 * (IDA_mem->ida_nrtfn);
     IDA_mem->ida_liw -= 3 * (IDA_mem->ida_nrtfn);
+
+    /* the subset evaluation data is sized for the old functions */
+    IDARootFreeSubset(IDA_mem);
+    IDA_mem->ida_gsub = NULL;
   }
 
   /* If IDARootInit() was called with nrtfn == 0, then set ida_nrtfn to
@@ -1716,6 +1737,7 @@ void IDAFree(void** ida_mem)
     IDA_mem->ida_rootdir = NULL;
     free(IDA_mem->ida_gactive);
     IDA_mem->ida_gactive = NULL;
+    IDARootFreeSubset(IDA_mem);
   }
 
   free(*ida_mem);
@@ -2508,6 +2530,8 @@ static int IDAStep(IDAMem IDA_mem)
                IDA_mem->ida_nst + 1, IDA_mem->ida_tn, IDA_mem->ida_hh,
                IDA_mem->ida_kk);
 
+    IDATelemetryBegin(IDA_mem, ncf + nef + 1);
+
     /*-----------------------
       Set method coefficients
       -----------------------*/
@@ -2548,6 +2572,13 @@ static int IDAStep(IDAMem IDA_mem)
     /* Test for convergence or error test failures */
     if (nflag != IDA_SUCCESS)
     {
+      if (nflag == ERROR_TEST_FAIL)
+      {
+        IDATelemetryEnd(IDA_mem, SUN_STEP_ERR_TEST_FAIL,
+                        ck * err_k / IDA_mem->ida_sigma[IDA_mem->ida_kk]);
+      }
+      else { IDATelemetryEnd(IDA_mem, SUN_STEP_SOLVER_FAIL, -ONE); }
+
       /* restore and decide what to do */
       IDARestore(IDA_mem, saved_t);
       kflag = IDAHandleNFlag(IDA_mem, nflag, err_k, err_km1, &(IDA_mem->ida_ncfn),
@@ -2579,6 +2610,9 @@ static int IDAStep(IDAMem IDA_mem)
              "status = success, dsm = " SUN_FORMAT_G,
              ck * err_k / IDA_mem->ida_sigma[IDA_mem->ida_kk]);
 
+  IDATelemetryEnd(IDA_mem, SUN_STEP_ACCEPTED,
+                  ck * err_k / IDA_mem->ida_sigma[IDA_mem->ida_kk]);
+
   /* Nonlinear system solve and error test were both successful;
      update data, and consider change of step and/or order */
 
@@ -2600,6 +2634,66 @@ static int IDAStep(IDAMem IDA_mem)
   return (IDA_SUCCESS);
 }
 
+/*
+ * IDATelemetryBegin
+ *
+ * This routine records the state at the start of a step attempt when
+ * a telemetry function is attached. Until the attempt ends, the
+ * counter fields of the record hold the counter values at the start
+ * of the attempt and time_step holds the start time.
+ */
+
+static void IDATelemetryBegin(IDAMem IDA_mem, int attempt)
+{
+  SUNStepTelemetry* tel = &(IDA_mem->ida_telemetry);
+
+  if (IDA_mem->ida_telemetryfn == NULL) { return; }
+
+  tel->version = SUN_STEP_TELEMETRY_VERSION;
+  tel->step    = IDA_mem->ida_nst;
+  tel->attempt = attempt;
+  tel->t       = IDA_mem->ida_tn;
+  tel->h       = IDA_mem->ida_hh;
+  tel->order   = IDA_mem->ida_kk;
+  tel->nni     = IDA_mem->ida_nni;
+  tel->nfe     = IDA_mem->ida_nre;
+  tel->nsetups = IDA_mem->ida_nsetups;
+  idaLsTelemetryCounters(IDA_mem, &(tel->nli), &(tel->nje));
+
+  tel->time_nls    = 0.0;
+  tel->time_lsetup = 0.0;
+  tel->time_lsolve = 0.0;
+  tel->time_step   = sunWallTime();
+}
+
+/*
+ * IDATelemetryEnd
+ *
+ * This routine completes the record for the current step attempt and
+ * passes it to the user's telemetry function.
+ */
+
+static void IDATelemetryEnd(IDAMem IDA_mem, SUNStepOutcome outcome,
+                            sunrealtype dsm)
+{
+  SUNStepTelemetry* tel = &(IDA_mem->ida_telemetry);
+  long int nli, nje;
+
+  if (IDA_mem->ida_telemetryfn == NULL) { return; }
+
+  tel->time_step = sunWallTime() - tel->time_step;
+  tel->outcome   = outcome;
+  tel->dsm       = dsm;
+  tel->nni       = IDA_mem->ida_nni - tel->nni;
+  tel->nfe       = IDA_mem->ida_nre - tel->nfe;
+  tel->nsetups   = IDA_mem->ida_nsetups - tel->nsetups;
+  idaLsTelemetryCounters(IDA_mem, &nli, &nje);
+  tel->nli = nli - tel->nli;
+  tel->nje = nje - tel->nje;
+
+  (void)IDA_mem->ida_telemetryfn(tel, IDA_mem->ida_user_data);
+}
+
 /*
  * IDASetCoeffs
  *
@@ -2710,6 +2804,7 @@ static int IDANls(IDAMem IDA_mem)
   N_Vector mm, tmp;
   long int nni_inc = 0;
   long int nnf_inc = 0;
+  double t0        = 0.0;
 
   callLSetup = SUNFALSE;
 
@@ -2739,6 +2834,8 @@ static int IDANls(IDAMem IDA_mem)
   /* initial guess for the correction to the predictor */
   N_VConst(ZERO, IDA_mem->ida_ee);
 
+  if (IDA_mem->ida_telemetryfn) { t0 = sunWallTime(); }
+
   /* call nonlinear solver setup if it exists */
   if ((IDA_mem->NLS)->ops->setup)
   {
@@ -2755,6 +2852,11 @@ static int IDANls(IDAMem IDA_mem)
                              IDA_mem->ida_ee, IDA_mem->ida_ewt,
                              IDA_mem->ida_epsNewt, callLSetup, IDA_mem);
 
+  if (IDA_mem->ida_telemetryfn)
+  {
+    IDA_mem->ida_telemetry.time_nls += sunWallTime() - t0;
+  }
+
   /* increment counters */
   (void)SUNNonlinSolGetNumIters(IDA_mem->NLS, &nni_inc);
   IDA_mem->ida_nni += nni_inc;
@@ -3451,6 +3553,97 @@ sunrealtype IDAWrmsNorm(IDAMem IDA_mem, N_Vector x, N_Vector w,
  * -----------------------------------------------------------------
  */
 
+/*
+ * IDARootEval
+ *
+ * This routine evaluates the root functions at (t, yy, yp) and
+ * stores the result in gout.  If sparse is SUNTRUE and a subset
+ * function was supplied, only the components flagged in gmask are
+ * evaluated and the remaining entries of gout are unchanged.  All
+ * evaluations of g go through this routine so that they are
+ * counted in nge.
+ */
+
+static int IDARootEval(IDAMem IDA_mem, sunrealtype t, N_Vector yy, N_Vector yp,
+                       sunrealtype* gout, sunbooleantype sparse)
+{
+  IDA_mem->ida_nge++;
+  if (sparse && IDA_mem->ida_gsub != NULL)
+  {
+    return IDA_mem->ida_gsub(t, yy, yp, gout, IDA_mem->ida_gmask,
+                             IDA_mem->ida_user_data);
+  }
+  return IDA_mem->ida_gfun(t, yy, yp, gout, IDA_mem->ida_user_data);
+}
+
+/*
+ * IDARootEvalSubset
+ *
+ * This routine sets gout to g at (t, yy, yp) given the last values
+ * of g in glo, computed at the times in gtime. Only the inactive
+ * g_i and the g_i that were not evaluated at t are updated with
+ * the subset function. If rate bounds were supplied, the latter are
+ * further restricted to the g_i that could have changed sign since
+ * they were last evaluated, and the other entries of gout are
+ * copied from glo. The evaluated components are flagged in gmask
+ * on return.
+ */
+
+static int IDARootEvalSubset(IDAMem IDA_mem, sunrealtype t, sunrealtype* gout)
+{
+  int i;
+  sunbooleantype update;
+
+  update = SUNFALSE;
+  for (i = 0; i < IDA_mem->ida_nrtfn; i++)
+  {
+    IDA_mem->ida_gmask[i] = !IDA_mem->ida_gactive[i] ||
+                            IDA_mem->ida_gtime[i] != t;
+    if (IDA_mem->ida_gmask[i] && IDA_mem->ida_gactive[i] &&
+        IDA_mem->ida_gdotmax != NULL && IDA_mem->ida_gdotmax[i] >= ZERO)
+    {
+      IDA_mem->ida_gmask[i] = SUNRabs(IDA_mem->ida_glo[i]) <=
+                              IDA_mem->ida_gdotmax[i] *
+                                SUNRabs(t - IDA_mem->ida_gtime[i]);
+    }
+    if (IDA_mem->ida_gmask[i]) { update = SUNTRUE; }
+    else { gout[i] = IDA_mem->ida_glo[i]; }
+  }
+  if (!update) { return (0); }
+
+  return (IDARootEval(IDA_mem, t, IDA_mem->ida_yy, IDA_mem->ida_yp, gout,
+                      SUNTRUE));
+}
+
+/*
+ * IDARootFreeSubset
+ *
+ * This routine frees the arrays used for evaluating a subset of
+ * the root functions.
+ */
+
+static void IDARootFreeSubset(IDAMem IDA_mem)
+{
+  if (IDA_mem->ida_gmask != NULL)
+  {
+    free(IDA_mem->ida_gmask);
+    IDA_mem->ida_gmask = NULL;
+    IDA_mem->ida_liw -= IDA_mem->ida_nrtfn;
+  }
+  if (IDA_mem->ida_gtime != NULL)
+  {
+    free(IDA_mem->ida_gtime);
+    IDA_mem->ida_gtime = NULL;
+    IDA_mem->ida_lrw -= IDA_mem->ida_nrtfn;
+  }
+  if (IDA_mem->ida_gdotmax != NULL)
+  {
+    free(IDA_mem->ida_gdotmax);
+    IDA_mem->ida_gdotmax = NULL;
+    IDA_mem->ida_lrw -= IDA_mem->ida_nrtfn;
+  }
+}
+
 /*
  * IDARcheck1
  *
@@ -3475,11 +3668,17 @@ static int IDARcheck1(IDAMem IDA_mem)
                        IDA_mem->ida_uround * HUNDRED);
 
   /* Evaluate g at initial t and check for zero values. */
-  retval           = IDA_mem->ida_gfun(IDA_mem->ida_tlo, IDA_mem->ida_phi[0],
-                                       IDA_mem->ida_phi[1], IDA_mem->ida_glo,
-                                       IDA_mem->ida_user_data);
-  IDA_mem->ida_nge = 1;
+  IDA_mem->ida_nge = 0;
+  retval = IDARootEval(IDA_mem, IDA_mem->ida_tlo, IDA_mem->ida_phi[0],
+                       IDA_mem->ida_phi[1], IDA_mem->ida_glo, SUNFALSE);
   if (retval != 0) { return (IDA_RTFUNC_FAIL); }
+  if (IDA_mem->ida_gtime != NULL)
+  {
+    for (i = 0; i < IDA_mem->ida_nrtfn; i++)
+    {
+      IDA_mem->ida_gtime[i] = IDA_mem->ida_tlo;
+    }
+  }
 
   zroot = SUNFALSE;
   for (i = 0; i < IDA_mem->ida_nrtfn; i++)
@@ -3498,9 +3697,8 @@ static int IDARcheck1(IDAMem IDA_mem)
   tplus  = IDA_mem->ida_tlo + smallh;
   N_VLinearSum(ONE, IDA_mem->ida_phi[0], smallh, IDA_mem->ida_phi[1],
                IDA_mem->ida_yy);
-  retval = IDA_mem->ida_gfun(tplus, IDA_mem->ida_yy, IDA_mem->ida_phi[1],
-                             IDA_mem->ida_ghi, IDA_mem->ida_user_data);
-  IDA_mem->ida_nge++;
+  retval = IDARootEval(IDA_mem, tplus, IDA_mem->ida_yy, IDA_mem->ida_phi[1],
+                       IDA_mem->ida_ghi, SUNFALSE);
   if (retval != 0) { return (IDA_RTFUNC_FAIL); }
 
   /* We check now only the components of g which were exactly 0.0 at t0
@@ -3511,6 +3709,7 @@ static int IDARcheck1(IDAMem IDA_mem)
     {
       IDA_mem->ida_gactive[i] = SUNTRUE;
       IDA_mem->ida_glo[i]     = IDA_mem->ida_ghi[i];
+      if (IDA_mem->ida_gtime != NULL) { IDA_mem->ida_gtime[i] = tplus; }
     }
   }
   return (IDA_SUCCESS);
@@ -3547,10 +3746,28 @@ static int IDARcheck2(IDAMem IDA_mem)
 
   (void)IDAGetSolution(IDA_mem, IDA_mem->ida_tlo, IDA_mem->ida_yy,
                        IDA_mem->ida_yp);
-  retval = IDA_mem->ida_gfun(IDA_mem->ida_tlo, IDA_mem->ida_yy, IDA_mem->ida_yp,
-                             IDA_mem->ida_glo, IDA_mem->ida_user_data);
-  IDA_mem->ida_nge++;
-  if (retval != 0) { return (IDA_RTFUNC_FAIL); }
+  if (IDA_mem->ida_gsub != NULL)
+  {
+    retval = IDARootEvalSubset(IDA_mem, IDA_mem->ida_tlo, IDA_mem->ida_glo);
+    if (retval != 0) { return (IDA_RTFUNC_FAIL); }
+    for (i = 0; i < IDA_mem->ida_nrtfn; i++)
+    {
+      if (IDA_mem->ida_gmask[i]) { IDA_mem->ida_gtime[i] = IDA_mem->ida_tlo; }
+    }
+  }
+  else
+  {
+    retval = IDARootEval(IDA_mem, IDA_mem->ida_tlo, IDA_mem->ida_yy,
+                         IDA_mem->ida_yp, IDA_mem->ida_glo, SUNFALSE);
+    if (retval != 0) { return (IDA_RTFUNC_FAIL); }
+    if (IDA_mem->ida_gtime != NULL)
+    {
+      for (i = 0; i < IDA_mem->ida_nrtfn; i++)
+      {
+        IDA_mem->ida_gtime[i] = IDA_mem->ida_tlo;
+      }
+    }
+  }
 
   zroot = SUNFALSE;
   for (i = 0; i < IDA_mem->ida_nrtfn; i++) { IDA_mem->ida_iroots[i] = 0; }
@@ -3580,10 +3797,17 @@ static int IDARcheck2(IDAMem IDA_mem)
   {
     (void)IDAGetSolution(IDA_mem, tplus, IDA_mem->ida_yy, IDA_mem->ida_yp);
   }
-  retval = IDA_mem->ida_gfun(tplus, IDA_mem->ida_yy, IDA_mem->ida_yp,
-                             IDA_mem->ida_ghi, IDA_mem->ida_user_data);
-  IDA_mem->ida_nge++;
-  if (retval != 0) { return (IDA_RTFUNC_FAIL); }
+  if (IDA_mem->ida_gsub != NULL)
+  {
+    retval = IDARootEvalSubset(IDA_mem, tplus, IDA_mem->ida_ghi);
+    if (retval != 0) { return (IDA_RTFUNC_FAIL); }
+  }
+  else
+  {
+    retval = IDARootEval(IDA_mem, tplus, IDA_mem->ida_yy, IDA_mem->ida_yp,
+                         IDA_mem->ida_ghi, SUNFALSE);
+    if (retval != 0) { return (IDA_RTFUNC_FAIL); }
+  }
 
   /* Check for close roots (error return), for a new zero at tlo+smallh,
   and for a g_i that changed from zero to nonzero. */
@@ -3602,6 +3826,7 @@ static int IDARcheck2(IDAMem IDA_mem)
       if (IDA_mem->ida_iroots[i] == 1)
       {
         IDA_mem->ida_glo[i] = IDA_mem->ida_ghi[i];
+        if (IDA_mem->ida_gtime != NULL) { IDA_mem->ida_gtime[i] = tplus; }
       }
     }
   }
@@ -3644,10 +3869,28 @@ static int IDARcheck3(IDAMem IDA_mem)
                        IDA_mem->ida_yp);
 
   /* Set ghi = g(thi) and call IDARootfind to search (tlo,thi) for roots. */
-  retval = IDA_mem->ida_gfun(IDA_mem->ida_thi, IDA_mem->ida_yy, IDA_mem->ida_yp,
-                             IDA_mem->ida_ghi, IDA_mem->ida_user_data);
-  IDA_mem->ida_nge++;
-  if (retval != 0) { return (IDA_RTFUNC_FAIL); }
+  if (IDA_mem->ida_gsub != NULL)
+  {
+    retval = IDARootEvalSubset(IDA_mem, IDA_mem->ida_thi, IDA_mem->ida_ghi);
+    if (retval != 0) { return (IDA_RTFUNC_FAIL); }
+    for (i = 0; i < IDA_mem->ida_nrtfn; i++)
+    {
+      if (IDA_mem->ida_gmask[i]) { IDA_mem->ida_gtime[i] = IDA_mem->ida_thi; }
+    }
+  }
+  else
+  {
+    retval = IDARootEval(IDA_mem, IDA_mem->ida_thi, IDA_mem->ida_yy,
+                         IDA_mem->ida_yp, IDA_mem->ida_ghi, SUNFALSE);
+    if (retval != 0) { return (IDA_RTFUNC_FAIL); }
+    if (IDA_mem->ida_gtime != NULL)
+    {
+      for (i = 0; i < IDA_mem->ida_nrtfn; i++)
+      {
+        IDA_mem->ida_gtime[i] = IDA_mem->ida_thi;
+      }
+    }
+  }
 
   IDA_mem->ida_ttol = ((SUNRabs(IDA_mem->ida_tn) + SUNRabs(IDA_mem->ida_hh)) *
                        IDA_mem->ida_uround * HUNDRED);
@@ -3699,6 +3942,14 @@ static int IDARcheck3(IDAMem IDA_mem)
  * gfun     = user-defined function for g(t).  Its form is
  *            (void) gfun(t, y, yp, gt, user_data)
  *
+ * gsub     = optional user-defined function evaluating the
+ *            components of g(t) flagged in gmask.  If supplied,
+ *            only the g_i with a sign change or zero at thi are
+ *            evaluated while searching for the root.
+ *
+ * gtime    = if allocated, the times at which the g_i values
+ *            in glo and ghi were last evaluated.
+ *
  * rootdir  = in array specifying the direction of zero-crossings.
  *            If rootdir[i] > 0, search for roots of g_i only if
  *            g_i is increasing; if rootdir[i] < 0, search for
@@ -3817,6 +4068,25 @@ static int IDARootfind(IDAMem IDA_mem)
     return (RTFOUND);
   }
 
+  /* If a subset function was supplied, only the g_i that change sign or are
+     zero at thi (and the inactive g_i) are evaluated during the search; the
+     others keep their value at thi as they do not change sign in (tlo,thi).
+     Since a root is always found below, IDARcheck2 updates any of these g_i
+     that may vanish at the root before the next search. */
+  if (IDA_mem->ida_gsub != NULL)
+  {
+    for (i = 0; i < IDA_mem->ida_nrtfn; i++)
+    {
+      IDA_mem->ida_gmask[i] =
+        !IDA_mem->ida_gactive[i] || SUNRabs(IDA_mem->ida_ghi[i]) == ZERO ||
+        DIFFERENT_SIGN(IDA_mem->ida_glo[i], IDA_mem->ida_ghi[i]);
+      if (!IDA_mem->ida_gmask[i])
+      {
+        IDA_mem->ida_grout[i] = IDA_mem->ida_ghi[i];
+      }
+    }
+  }
+
   /* Initialize alph to avoid compiler warning */
   alph = ONE;
 
@@ -3866,9 +4136,8 @@ static int IDARootfind(IDAMem IDA_mem)
     }
 
     (void)IDAGetSolution(IDA_mem, tmid, IDA_mem->ida_yy, IDA_mem->ida_yp);
-    retval = IDA_mem->ida_gfun(tmid, IDA_mem->ida_yy, IDA_mem->ida_yp,
-                               IDA_mem->ida_grout, IDA_mem->ida_user_data);
-    IDA_mem->ida_nge++;
+    retval = IDARootEval(IDA_mem, tmid, IDA_mem->ida_yy, IDA_mem->ida_yp,
+                         IDA_mem->ida_grout, SUNTRUE);
     if (retval != 0) { return (IDA_RTFUNC_FAIL); }
 
     /* Check to see in which subinterval g changes sign, and reset imax.
@@ -3951,6 +4220,11 @@ static int IDARootfind(IDAMem IDA_mem)
   IDA_mem->ida_trout = IDA_mem->ida_thi;
   for (i = 0; i < IDA_mem->ida_nrtfn; i++)
   {
+    if (IDA_mem->ida_gtime != NULL &&
+        (IDA_mem->ida_gsub == NULL || IDA_mem->ida_gmask[i]))
+    {
+      IDA_mem->ida_gtime[i] = IDA_mem->ida_thi;
+    }
     IDA_mem->ida_grout[i]  = IDA_mem->ida_ghi[i];
     IDA_mem->ida_iroots[i] = 0;
     if (!IDA_mem->ida_gactive[i]) { continue; }
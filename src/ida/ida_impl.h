@@ -230,6 +230,13 @@ typedef struct IDAMemRec
   long int ida_nnf;     /* number of Newton convergence failures             */
   long int ida_nsetups; /* number of lsetup calls                            */
 
+  /*-------------------
+    Per-step telemetry
+    -------------------*/
+
+  SUNStepTelemetryFn ida_telemetryfn; /* func called after each step attempt */
+  SUNStepTelemetry ida_telemetry;     /* record for the current attempt      */
+
   /*------------------
     Space requirements
     ------------------*/
@@ -314,6 +321,11 @@ typedef struct IDAMemRec
   sunbooleantype* ida_gactive; /* array with active/inactive event functions      */
   int ida_mxgnull; /* number of warning messages about possible g==0  */
 
+  IDARootSubsetFn ida_gsub;  /* function evaluating a subset of g           */
+  sunbooleantype* ida_gmask; /* array flagging components to evaluate       */
+  sunrealtype* ida_gdotmax;  /* array of bounds on |dg_i/dt|                */
+  sunrealtype* ida_gtime;    /* array of times of last g_i evaluations      */
+
   /* Arrays for Fused Vector Operations */
 
   /* scalar arrays */
@@ -446,6 +458,10 @@ sunrealtype IDAWrmsNorm(IDAMem IDA_mem, N_Vector x, N_Vector w,
 
 int idaNlsInit(IDAMem IDA_mem);
 
+/* Linear solver counters reported in the per-step telemetry */
+
+void idaLsTelemetryCounters(IDAMem IDA_mem, long int* nli, long int* nje);
+
 /*
  * =================================================================
  *    E R R O R    M E S S A G E S
@@ -210,6 +210,24 @@ int IDASetEtaConvFail(void* ida_mem, sunrealtype eta_cf)
 
 /*-----------------------------------------------------------------*/
 
+int IDASetStepTelemetryFn(void* ida_mem, SUNStepTelemetryFn fn)
+{
+  IDAMem IDA_mem;
+
+  if (ida_mem == NULL)
+  {
+    IDAProcessError(NULL, IDA_MEM_NULL, __LINE__, __func__, __FILE__, MSG_NO_MEM);
+    return (IDA_MEM_NULL);
+  }
+  IDA_mem = (IDAMem)ida_mem;
+
+  IDA_mem->ida_telemetryfn = fn;
+
+  return (IDA_SUCCESS);
+}
+
+/*-----------------------------------------------------------------*/
+
 int IDASetMaxOrd(void* ida_mem, int maxord)
 {
   IDAMem IDA_mem;
@@ -679,6 +697,128 @@ int IDASetNoInactiveRootWarn(void* ida_mem)
   return (IDA_SUCCESS);
 }
 
+/*
+ * IDASetRootSubsetFn
+ *
+ * Specifies an optional function that evaluates only the root
+ * functions flagged in a mask. When supplied, IDA only evaluates
+ * the root functions that bracket a root while locating it, and
+ * those that may have changed sign in a step when bounds on their
+ * rate of change are given with IDASetRootRateBounds. A NULL input
+ * disables the subset evaluations.
+ */
+
+int IDASetRootSubsetFn(void* ida_mem, IDARootSubsetFn gsub)
+{
+  IDAMem IDA_mem;
+  int i, nrt;
+
+  if (ida_mem == NULL)
+  {
+    IDAProcessError(NULL, IDA_MEM_NULL, __LINE__, __func__, __FILE__, MSG_NO_MEM);
+    return (IDA_MEM_NULL);
+  }
+
+  IDA_mem = (IDAMem)ida_mem;
+
+  nrt = IDA_mem->ida_nrtfn;
+  if (nrt == 0)
+  {
+    IDAProcessError(IDA_mem, IDA_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    MSG_NO_ROOT);
+    return (IDA_ILL_INPUT);
+  }
+
+  /* Allocate the evaluation mask and the times of the last evaluation of
+     each function, the latter are set so the first check evaluates all
+     functions */
+  if (gsub != NULL && IDA_mem->ida_gmask == NULL)
+  {
+    IDA_mem->ida_gmask = (sunbooleantype*)malloc(nrt * sizeof(sunbooleantype));
+    IDA_mem->ida_gtime = (sunrealtype*)malloc(nrt * sizeof(sunrealtype));
+    if (IDA_mem->ida_gmask == NULL || IDA_mem->ida_gtime == NULL)
+    {
+      free(IDA_mem->ida_gmask);
+      IDA_mem->ida_gmask = NULL;
+      free(IDA_mem->ida_gtime);
+      IDA_mem->ida_gtime = NULL;
+      IDAProcessError(IDA_mem, IDA_MEM_FAIL, __LINE__, __func__, __FILE__,
+                      MSG_MEM_FAIL);
+      return (IDA_MEM_FAIL);
+    }
+    for (i = 0; i < nrt; i++)
+    {
+      IDA_mem->ida_gmask[i] = SUNTRUE;
+      IDA_mem->ida_gtime[i] = -SUN_BIG_REAL;
+    }
+    IDA_mem->ida_liw += nrt;
+    IDA_mem->ida_lrw += nrt;
+  }
+
+  IDA_mem->ida_gsub = gsub;
+
+  return (IDA_SUCCESS);
+}
+
+/*
+ * IDASetRootRateBounds
+ *
+ * Specifies bounds on the magnitude of the time derivative of each
+ * root function, a negative value indicates the function has no
+ * bound. With a subset function, a root function is only evaluated
+ * at the end of a step if its bound allows it to change sign since
+ * its last evaluation. A NULL input removes the bounds.
+ */
+
+int IDASetRootRateBounds(void* ida_mem, const sunrealtype* gdotmax)
+{
+  IDAMem IDA_mem;
+  int i, nrt;
+
+  if (ida_mem == NULL)
+  {
+    IDAProcessError(NULL, IDA_MEM_NULL, __LINE__, __func__, __FILE__, MSG_NO_MEM);
+    return (IDA_MEM_NULL);
+  }
+
+  IDA_mem = (IDAMem)ida_mem;
+
+  nrt = IDA_mem->ida_nrtfn;
+  if (nrt == 0)
+  {
+    IDAProcessError(IDA_mem, IDA_ILL_INPUT, __LINE__, __func__, __FILE__,
+                    MSG_NO_ROOT);
+    return (IDA_ILL_INPUT);
+  }
+
+  if (gdotmax == NULL)
+  {
+    if (IDA_mem->ida_gdotmax != NULL)
+    {
+      free(IDA_mem->ida_gdotmax);
+      IDA_mem->ida_gdotmax = NULL;
+      IDA_mem->ida_lrw -= nrt;
+    }
+    return (IDA_SUCCESS);
+  }
+
+  if (IDA_mem->ida_gdotmax == NULL)
+  {
+    IDA_mem->ida_gdotmax = (sunrealtype*)malloc(nrt * sizeof(sunrealtype));
+    if (IDA_mem->ida_gdotmax == NULL)
+    {
+      IDAProcessError(IDA_mem, IDA_MEM_FAIL, __LINE__, __func__, __FILE__,
+                      MSG_MEM_FAIL);
+      return (IDA_MEM_FAIL);
+    }
+    IDA_mem->ida_lrw += nrt;
+  }
+
+  for (i = 0; i < nrt; i++) { IDA_mem->ida_gdotmax[i] = gdotmax[i]; }
+
+  return (IDA_SUCCESS);
+}
+
 /*
  * =================================================================
  * IDA IC optional input functions
@@ -1751,6 +1751,30 @@ int idaLsInitializeCounters(IDALsMem idals_mem)
   return (0);
 }
 
+/*---------------------------------------------------------------
+  idaLsTelemetryCounters
+
+  This routine returns the linear iteration and Jacobian
+  evaluation counters for the per-step telemetry. Both are zero
+  when the IDALs interface is not attached.
+  ---------------------------------------------------------------*/
+void idaLsTelemetryCounters(IDAMem IDA_mem, long int* nli, long int* nje)
+{
+  IDALsMem idals_mem;
+
+  *nli = 0;
+  *nje = 0;
+
+  if (IDA_mem->ida_lmem == NULL || IDA_mem->ida_lsolve != idaLsSolve)
+  {
+    return;
+  }
+
+  idals_mem = (IDALsMem)IDA_mem->ida_lmem;
+  *nli      = idals_mem->nli;
+  *nje      = idals_mem->nje;
+}
+
 /*---------------------------------------------------------------
   idaLs_AccessLMem
 
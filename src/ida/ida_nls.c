@@ -16,6 +16,7 @@
 
 #include "ida_impl.h"
 #include "sundials/sundials_math.h"
+#include "sundials_utils.h"
 
 /* constant macros */
 #define PT0001 SUN_RCONST(0.0001) /* real 0.0001 */
@@ -238,6 +239,7 @@ static int idaNlsLSetup(SUNDIALS_MAYBE_UNUSED sunbooleantype jbad,
 {
   IDAMem IDA_mem;
   int retval;
+  double t0 = 0.0;
 
   if (ida_mem == NULL)
   {
@@ -246,11 +248,18 @@ static int idaNlsLSetup(SUNDIALS_MAYBE_UNUSED sunbooleantype jbad,
   }
   IDA_mem = (IDAMem)ida_mem;
 
+  if (IDA_mem->ida_telemetryfn) { t0 = sunWallTime(); }
+
   IDA_mem->ida_nsetups++;
   retval = IDA_mem->ida_lsetup(IDA_mem, IDA_mem->ida_yy, IDA_mem->ida_yp,
                                IDA_mem->ida_savres, IDA_mem->ida_tempv1,
                                IDA_mem->ida_tempv2, IDA_mem->ida_tempv3);
 
+  if (IDA_mem->ida_telemetryfn)
+  {
+    IDA_mem->ida_telemetry.time_lsetup += sunWallTime() - t0;
+  }
+
   /* update Jacobian status */
   *jcur = SUNTRUE;
 
@@ -269,6 +278,7 @@ static int idaNlsLSolve(N_Vector delta, void* ida_mem)
 {
   IDAMem IDA_mem;
   int retval;
+  double t0 = 0.0;
 
   if (ida_mem == NULL)
   {
@@ -277,9 +287,16 @@ static int idaNlsLSolve(N_Vector delta, void* ida_mem)
   }
   IDA_mem = (IDAMem)ida_mem;
 
+  if (IDA_mem->ida_telemetryfn) { t0 = sunWallTime(); }
+
   retval = IDA_mem->ida_lsolve(IDA_mem, delta, IDA_mem->ida_ewt, IDA_mem->ida_yy,
                                IDA_mem->ida_yp, IDA_mem->ida_savres);
 
+  if (IDA_mem->ida_telemetryfn)
+  {
+    IDA_mem->ida_telemetry.time_lsolve += sunWallTime() - t0;
+  }
+
   if (retval < 0) { return (IDA_LSOLVE_FAIL); }
   if (retval > 0) { return (IDA_LSOLVE_RECVR); }
 
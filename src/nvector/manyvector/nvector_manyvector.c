@@ -59,6 +59,35 @@
 #define MANYVECTOR_SUBVECS(v)     (MANYVECTOR_CONTENT(v)->subvec_array)
 #define MANYVECTOR_SUBVEC(v, i)   (MANYVECTOR_SUBVECS(v)[i])
 #define MANYVECTOR_OWN_DATA(v)    (MANYVECTOR_CONTENT(v)->own_data)
+#define MANYVECTOR_NUM_THREADS(v) (MANYVECTOR_CONTENT(v)->num_threads)
+
+/* Macros to evaluate a loop over the subvectors concurrently. Subvector
+   operations are dispatched to OpenMP threads only when more than one
+   thread has been requested, and never when profiling is enabled since
+   the profiler is not thread safe. The last error in the SUNContext is not
+   thread safe either, so it is never read inside these loops. Subvector
+   operations that return a SUNErrCode combine their codes with the min
+   reduction in MANYVECTOR_PARALLEL_FOR_ERR, while the last error of the
+   remaining operations is checked by the calling thread after the loop. */
+#if defined(_OPENMP) && !defined(SUNDIALS_BUILD_WITH_PROFILING)
+#define MANYVECTOR_PRAGMA(x) _Pragma(#x)
+#define MANYVECTOR_PARALLEL_FOR(v)                                     \
+  MANYVECTOR_PRAGMA(omp parallel for schedule(dynamic, 1)              \
+                      num_threads(MANYVECTOR_NUM_THREADS(v))           \
+                        if (MANYVECTOR_NUM_THREADS(v) > 1))
+#define MANYVECTOR_PARALLEL_FOR_ERR(v, err)                            \
+  MANYVECTOR_PRAGMA(omp parallel for schedule(dynamic, 1)              \
+                      num_threads(MANYVECTOR_NUM_THREADS(v))           \
+                        if (MANYVECTOR_NUM_THREADS(v) > 1)             \
+                          reduction(min : err))
+#else
+#define MANYVECTOR_PARALLEL_FOR(v)
+#define MANYVECTOR_PARALLEL_FOR_ERR(v, err)
+#endif
+
+/* Length of the workspace kept on the stack of the calling thread for the
+   local reductions, larger workspaces are allocated by each call */
+#define MANYVECTOR_LOCAL_WORK 64
 
 /* -----------------------------------------------------------------
    Prototypes of utility routines
@@ -67,6 +96,19 @@ static N_Vector ManyVectorClone(N_Vector w, sunbooleantype cloneempty);
 #ifdef MANYVECTOR_BUILD_WITH_MPI
 static int SubvectorMPIRank(N_Vector w);
 #endif
+static sunbooleantype ManyVectorConcurrent(N_Vector x,
+                                           sunbooleantype (*islocal)(N_Vector));
+static sunrealtype* ManyVectorWorkspace(sunindextype length,
+                                        sunrealtype* local);
+static void ManyVectorFreeWorkspace(sunrealtype* work, sunrealtype* local);
+static sunbooleantype ManyVectorHasDotProdLocal(N_Vector w);
+static sunbooleantype ManyVectorHasMaxNormLocal(N_Vector w);
+static sunbooleantype ManyVectorHasWSqrSumLocal(N_Vector w);
+static sunrealtype SubvectorDotProdLocal(N_Vector x, N_Vector y,
+                                         sunindextype i);
+static sunrealtype SubvectorMaxNormLocal(N_Vector x, sunindextype i);
+static sunrealtype SubvectorWSqrSumLocal(N_Vector x, N_Vector w,
+                                         sunindextype i);
 
 /* -----------------------------------------------------------------
    ManyVector API routines
@@ -177,6 +219,7 @@ N_Vector N_VMake_MPIManyVector(MPI_Comm comm, sunindextype num_subvectors,
   content->comm           = MPI_COMM_NULL;
   content->num_subvectors = num_subvectors;
   content->own_data       = SUNFALSE;
+  content->num_threads    = 1;
   content->subvec_array   = NULL;
   content->subvec_array = (N_Vector*)malloc(num_subvectors * sizeof(N_Vector));
   SUNAssertNull(content->subvec_array, SUN_ERR_MALLOC_FAIL);
@@ -395,6 +438,7 @@ N_Vector N_VNew_ManyVector(sunindextype num_subvectors, N_Vector* vec_array,
   /* allocate and set subvector array */
   content->num_subvectors = num_subvectors;
   content->own_data       = SUNFALSE;
+  content->num_threads    = 1;
 
   content->subvec_array = NULL;
   content->subvec_array = (N_Vector*)malloc(num_subvectors * sizeof(N_Vector));
@@ -470,6 +514,16 @@ sunindextype MVAPPEND(N_VGetNumSubvectors)(N_Vector v)
   return (MANYVECTOR_NUM_SUBVECS(v));
 }
 
+/* This function sets the number of threads used to evaluate subvector
+   operations concurrently. */
+SUNErrCode MVAPPEND(N_VSetNumThreads)(N_Vector v, int num_threads)
+{
+  SUNFunctionBegin(v->sunctx);
+  SUNAssert(num_threads > 0, SUN_ERR_ARG_OUTOFRANGE);
+  MANYVECTOR_NUM_THREADS(v) = num_threads;
+  return SUN_SUCCESS;
+}
+
 /* -----------------------------------------------------------------
    ManyVector implementations of generic NVector routines
    -----------------------------------------------------------------*/
@@ -625,12 +679,13 @@ void MVAPPEND(N_VLinearSum)(sunrealtype a, N_Vector x, sunrealtype b,
 {
   SUNFunctionBegin(x->sunctx);
   sunindextype i;
+  MANYVECTOR_PARALLEL_FOR(x)
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
   {
     N_VLinearSum(a, MANYVECTOR_SUBVEC(x, i), b, MANYVECTOR_SUBVEC(y, i),
                  MANYVECTOR_SUBVEC(z, i));
-    SUNCheckLastErrVoid();
   }
+  SUNCheckLastErrVoid();
   return;
 }
 
@@ -639,11 +694,12 @@ void MVAPPEND(N_VConst)(sunrealtype c, N_Vector z)
 {
   SUNFunctionBegin(z->sunctx);
   sunindextype i;
+  MANYVECTOR_PARALLEL_FOR(z)
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(z); i++)
   {
     N_VConst(c, MANYVECTOR_SUBVEC(z, i));
-    SUNCheckLastErrVoid();
   }
+  SUNCheckLastErrVoid();
   return;
 }
 
@@ -654,12 +710,13 @@ void MVAPPEND(N_VProd)(N_Vector x, N_Vector y, N_Vector z)
 {
   SUNFunctionBegin(x->sunctx);
   sunindextype i;
+  MANYVECTOR_PARALLEL_FOR(x)
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
   {
     N_VProd(MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(y, i),
             MANYVECTOR_SUBVEC(z, i));
-    SUNCheckLastErrVoid();
   }
+  SUNCheckLastErrVoid();
   return;
 }
 
@@ -670,12 +727,13 @@ void MVAPPEND(N_VDiv)(N_Vector x, N_Vector y, N_Vector z)
 {
   SUNFunctionBegin(x->sunctx);
   sunindextype i;
+  MANYVECTOR_PARALLEL_FOR(x)
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
   {
     N_VDiv(MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(y, i),
            MANYVECTOR_SUBVEC(z, i));
-    SUNCheckLastErrVoid();
   }
+  SUNCheckLastErrVoid();
   return;
 }
 
@@ -686,11 +744,12 @@ void MVAPPEND(N_VScale)(sunrealtype c, N_Vector x, N_Vector z)
 {
   SUNFunctionBegin(x->sunctx);
   sunindextype i;
+  MANYVECTOR_PARALLEL_FOR(x)
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
   {
     N_VScale(c, MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(z, i));
-    SUNCheckLastErrVoid();
   }
+  SUNCheckLastErrVoid();
   return;
 }
 
@@ -701,11 +760,12 @@ void MVAPPEND(N_VAbs)(N_Vector x, N_Vector z)
 {
   SUNFunctionBegin(x->sunctx);
   sunindextype i;
+  MANYVECTOR_PARALLEL_FOR(x)
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
   {
     N_VAbs(MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(z, i));
-    SUNCheckLastErrVoid();
   }
+  SUNCheckLastErrVoid();
   return;
 }
 
@@ -716,11 +776,12 @@ void MVAPPEND(N_VInv)(N_Vector x, N_Vector z)
 {
   SUNFunctionBegin(x->sunctx);
   sunindextype i;
+  MANYVECTOR_PARALLEL_FOR(x)
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
   {
     N_VInv(MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(z, i));
-    SUNCheckLastErrVoid();
   }
+  SUNCheckLastErrVoid();
   return;
 }
 
@@ -731,11 +792,12 @@ void MVAPPEND(N_VAddConst)(N_Vector x, sunrealtype b, N_Vector z)
 {
   SUNFunctionBegin(x->sunctx);
   sunindextype i;
+  MANYVECTOR_PARALLEL_FOR(x)
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
   {
     N_VAddConst(MANYVECTOR_SUBVEC(x, i), b, MANYVECTOR_SUBVEC(z, i));
-    SUNCheckLastErrVoid();
   }
+  SUNCheckLastErrVoid();
   return;
 }
 
@@ -753,44 +815,37 @@ sunrealtype MVAPPEND(N_VDotProdLocal)(N_Vector x, N_Vector y)
   SUNFunctionBegin(x->sunctx);
   sunindextype i;
   sunrealtype sum;
-#ifdef MANYVECTOR_BUILD_WITH_MPI
-  sunrealtype contrib;
-  int rank;
-#endif
+  sunrealtype* contrib;
+  sunrealtype work[MANYVECTOR_LOCAL_WORK];
 
   /* initialize output*/
   sum = ZERO;
 
-  for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
+  /* evaluate the subvector contributions concurrently and accumulate them in
+     subvector order, so the result does not depend on the number of threads */
+  if (ManyVectorConcurrent(x, ManyVectorHasDotProdLocal))
   {
-#ifdef MANYVECTOR_BUILD_WITH_MPI
+    contrib = ManyVectorWorkspace(MANYVECTOR_NUM_SUBVECS(x), work);
+    SUNAssertNoRet(contrib, SUN_ERR_MALLOC_FAIL);
+    if (contrib == NULL) { return (ZERO); }
 
-    /* check for nvdotprodlocal in subvector */
-    if (MANYVECTOR_SUBVEC(x, i)->ops->nvdotprodlocal)
+    MANYVECTOR_PARALLEL_FOR(x)
+    for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
     {
-      sum += N_VDotProdLocal(MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(y, i));
-      SUNCheckLastErrNoRet();
-      /* otherwise, call nvdotprod and root tasks accumulate to overall sum */
+      contrib[i] = SubvectorDotProdLocal(x, y, i);
     }
-    else
-    {
-      contrib = N_VDotProd(MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(y, i));
-      SUNCheckLastErrNoRet();
+    SUNCheckLastErrNoRet();
 
-      /* get this task's rank in subvector communicator (note: serial
-         subvectors will result in rank==0) */
-      rank = SubvectorMPIRank(MANYVECTOR_SUBVEC(x, i));
-      if (rank < 0) { return (ZERO); }
-      if (rank == 0) { sum += contrib; }
-    }
+    for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++) { sum += contrib[i]; }
 
-#else
+    ManyVectorFreeWorkspace(contrib, work);
+    return (sum);
+  }
 
-    /* add subvector contribution */
-    sum += N_VDotProd(MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(y, i));
+  for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
+  {
+    sum += SubvectorDotProdLocal(x, y, i);
     SUNCheckLastErrNoRet();
-
-#endif
   }
 
   return (sum);
@@ -826,27 +881,40 @@ sunrealtype MVAPPEND(N_VMaxNormLocal)(N_Vector x)
   SUNFunctionBegin(x->sunctx);
   sunindextype i;
   sunrealtype max, lmax;
+  sunrealtype* contrib;
+  sunrealtype work[MANYVECTOR_LOCAL_WORK];
 
   /* initialize output*/
   max = ZERO;
 
-  for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
+  /* evaluate the subvector norms concurrently, then combine them */
+  if (ManyVectorConcurrent(x, ManyVectorHasMaxNormLocal))
   {
-    /* check for nvmaxnormlocal in subvector */
-    if (MANYVECTOR_SUBVEC(x, i)->ops->nvmaxnormlocal)
-    {
-      lmax = N_VMaxNormLocal(MANYVECTOR_SUBVEC(x, i));
-      SUNCheckLastErrNoRet();
-      max = (max > lmax) ? max : lmax;
+    contrib = ManyVectorWorkspace(MANYVECTOR_NUM_SUBVECS(x), work);
+    SUNAssertNoRet(contrib, SUN_ERR_MALLOC_FAIL);
+    if (contrib == NULL) { return (ZERO); }
 
-      /* otherwise, call nvmaxnorm and accumulate to overall max */
+    MANYVECTOR_PARALLEL_FOR(x)
+    for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
+    {
+      contrib[i] = SubvectorMaxNormLocal(x, i);
     }
-    else
+    SUNCheckLastErrNoRet();
+
+    for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
     {
-      lmax = N_VMaxNorm(MANYVECTOR_SUBVEC(x, i));
-      SUNCheckLastErrNoRet();
-      max = (max > lmax) ? max : lmax;
+      max = (max > contrib[i]) ? max : contrib[i];
     }
+
+    ManyVectorFreeWorkspace(contrib, work);
+    return (max);
+  }
+
+  for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
+  {
+    lmax = SubvectorMaxNormLocal(x, i);
+    SUNCheckLastErrNoRet();
+    max = (max > lmax) ? max : lmax;
   }
 
   return (max);
@@ -883,54 +951,39 @@ sunrealtype N_VMaxNorm_MPIManyVector(N_Vector x)
 sunrealtype MVAPPEND(N_VWSqrSumLocal)(N_Vector x, N_Vector w)
 {
   SUNFunctionBegin(x->sunctx);
-  sunindextype i, N;
-  sunrealtype sum, contrib;
-#ifdef MANYVECTOR_BUILD_WITH_MPI
-  int rank;
-#endif
+  sunindextype i;
+  sunrealtype sum;
+  sunrealtype* contrib;
+  sunrealtype work[MANYVECTOR_LOCAL_WORK];
 
   /* initialize output*/
   sum = ZERO;
 
-  for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
+  /* evaluate the subvector contributions concurrently and accumulate them in
+     subvector order, so the result does not depend on the number of threads */
+  if (ManyVectorConcurrent(x, ManyVectorHasWSqrSumLocal))
   {
-#ifdef MANYVECTOR_BUILD_WITH_MPI
+    contrib = ManyVectorWorkspace(MANYVECTOR_NUM_SUBVECS(x), work);
+    SUNAssertNoRet(contrib, SUN_ERR_MALLOC_FAIL);
+    if (contrib == NULL) { return (ZERO); }
 
-    /* check for nvwsqrsumlocal in subvector */
-    if (MANYVECTOR_SUBVEC(x, i)->ops->nvwsqrsumlocal)
+    MANYVECTOR_PARALLEL_FOR(x)
+    for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
     {
-      sum += N_VWSqrSumLocal(MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(w, i));
-      SUNCheckLastErrNoRet();
-
-      /* otherwise, call nvwrmsnorm, and accumulate to overall sum on root task */
+      contrib[i] = SubvectorWSqrSumLocal(x, w, i);
     }
-    else
-    {
-      contrib = N_VWrmsNorm(MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(w, i));
-      SUNCheckLastErrNoRet();
+    SUNCheckLastErrNoRet();
 
-      /* get this task's rank in subvector communicator (note: serial
-         subvectors will result in rank==0) */
-      rank = SubvectorMPIRank(MANYVECTOR_SUBVEC(x, i));
-      if (rank < 0) { return (ZERO); }
-      if (rank == 0)
-      {
-        N = N_VGetLength(MANYVECTOR_SUBVEC(x, i));
-        SUNCheckLastErrNoRet();
-        sum += (contrib * contrib * N);
-      }
-    }
+    for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++) { sum += contrib[i]; }
 
-#else
+    ManyVectorFreeWorkspace(contrib, work);
+    return (sum);
+  }
 
-    /* accumulate subvector contribution to overall sum */
-    contrib = N_VWrmsNorm(MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(w, i));
-    SUNCheckLastErrNoRet();
-    N = N_VGetLength(MANYVECTOR_SUBVEC(x, i));
+  for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
+  {
+    sum += SubvectorWSqrSumLocal(x, w, i);
     SUNCheckLastErrNoRet();
-    sum += (contrib * contrib * N);
-
-#endif
   }
 
   return (sum);
@@ -1410,37 +1463,49 @@ SUNErrCode MVAPPEND(N_VDotProdMultiLocal)(int nvec, N_Vector x, N_Vector* Y,
   SUNFunctionBegin(x->sunctx);
   int j;
   sunindextype i;
+  SUNErrCode err;
   N_Vector* Ysub;
   sunrealtype* contrib;
+  sunrealtype work[MANYVECTOR_LOCAL_WORK];
 
-  /* create temporary workspace arrays */
-  Ysub = NULL;
-  Ysub = (N_Vector*)malloc(nvec * sizeof(N_Vector));
-  SUNAssert(Ysub, SUN_ERR_MALLOC_FAIL);
-
-  contrib = NULL;
-  contrib = (sunrealtype*)malloc(nvec * sizeof(sunrealtype));
+  /* get workspace arrays, with separate storage for each subvector so that
+     subvectors may be processed concurrently */
+  contrib = ManyVectorWorkspace(MANYVECTOR_NUM_SUBVECS(x) * nvec, work);
   SUNAssert(contrib, SUN_ERR_MALLOC_FAIL);
 
-  /* initialize output */
-  for (j = 0; j < nvec; j++) { dotprods[j] = ZERO; }
+  Ysub = NULL;
+  Ysub = (N_Vector*)malloc(MANYVECTOR_NUM_SUBVECS(x) * nvec * sizeof(N_Vector));
+  SUNAssert(Ysub, SUN_ERR_MALLOC_FAIL);
 
-  /* loop over subvectors */
+  /* compute the dot products for each subvector */
+  err = SUN_SUCCESS;
+  MANYVECTOR_PARALLEL_FOR_ERR(x, err)
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
   {
+    SUNErrCode ierr;
+
     /* extract subvectors from vector array */
-    for (j = 0; j < nvec; j++) { Ysub[j] = MANYVECTOR_SUBVEC(Y[j], i); }
+    for (j = 0; j < nvec; j++)
+    {
+      Ysub[i * nvec + j] = MANYVECTOR_SUBVEC(Y[j], i);
+    }
 
     /* compute dot products */
-    SUNCheckCall(
-      N_VDotProdMultiLocal(nvec, MANYVECTOR_SUBVEC(x, i), Ysub, contrib));
+    ierr = N_VDotProdMultiLocal(nvec, MANYVECTOR_SUBVEC(x, i), Ysub + i * nvec,
+                                contrib + i * nvec);
+    if (ierr < err) { err = ierr; }
+  }
 
-    /* accumulate contributions */
-    for (j = 0; j < nvec; j++) { dotprods[j] += contrib[j]; }
+  /* accumulate contributions in subvector order */
+  for (j = 0; j < nvec; j++) { dotprods[j] = ZERO; }
+  for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
+  {
+    for (j = 0; j < nvec; j++) { dotprods[j] += contrib[i * nvec + j]; }
   }
 
+  ManyVectorFreeWorkspace(contrib, work);
   free(Ysub);
-  free(contrib);
+  SUNCheckCall(err);
 
   /* return with success */
   return SUN_SUCCESS;
@@ -1460,6 +1525,47 @@ SUNErrCode N_VDotProdMultiAllReduce_MPIManyVector(int nvec_total, N_Vector x,
 
   return SUN_SUCCESS;
 }
+
+/* Starts the global reduction of N_VDotProdMultiAllReduce without waiting for
+   it to complete; the reduction is completed by N_VReduceFinish */
+SUNErrCode N_VDotProdMultiAllReduceStart_MPIManyVector(int nvec_total,
+                                                       N_Vector x,
+                                                       sunrealtype* sum,
+                                                       MPI_Request* request)
+{
+  SUNFunctionBegin(x->sunctx);
+
+  if (MANYVECTOR_COMM(x) == MPI_COMM_NULL) { return SUN_ERR_ARG_CORRUPT; }
+
+  SUNCheckMPICall(MPI_Iallreduce(MPI_IN_PLACE, sum, nvec_total,
+                                 MPI_SUNREALTYPE, MPI_SUM, MANYVECTOR_COMM(x),
+                                 request));
+
+  return SUN_SUCCESS;
+}
+
+/* Computes the local contributions to N_VDotProdMulti and starts their global
+   reduction; the reduction is completed by N_VReduceFinish */
+SUNErrCode N_VDotProdMultiStart_MPIManyVector(int nvec, N_Vector x, N_Vector* Y,
+                                              sunrealtype* dotprods,
+                                              MPI_Request* request)
+{
+  SUNFunctionBegin(x->sunctx);
+
+  SUNCheckCall(N_VDotProdMultiLocal_MPIManyVector(nvec, x, Y, dotprods));
+  SUNCheckCall(
+    N_VDotProdMultiAllReduceStart_MPIManyVector(nvec, x, dotprods, request));
+
+  return SUN_SUCCESS;
+}
+
+/* Waits for a reduction started by one of the Start operations to complete */
+SUNErrCode N_VReduceFinish_MPIManyVector(N_Vector x, MPI_Request* request)
+{
+  SUNFunctionBegin(x->sunctx);
+  SUNCheckMPICall(MPI_Wait(request, MPI_STATUS_IGNORE));
+  return SUN_SUCCESS;
+}
 #endif
 
 /* -----------------------------------------------------------------
@@ -1480,25 +1586,36 @@ SUNErrCode MVAPPEND(N_VLinearCombination)(int nvec, sunrealtype* c, N_Vector* X,
 {
   SUNFunctionBegin(z->sunctx);
   sunindextype i, j;
+  SUNErrCode err;
   N_Vector* Xsub;
 
-  /* create array of nvec N_Vector pointers for reuse within loop */
+  /* create an array of nvec N_Vector pointers for each subvector */
   Xsub = NULL;
-  Xsub = (N_Vector*)malloc(nvec * sizeof(N_Vector));
+  Xsub = (N_Vector*)malloc(MANYVECTOR_NUM_SUBVECS(z) * nvec * sizeof(N_Vector));
   SUNAssert(Xsub, SUN_ERR_MALLOC_FAIL);
 
   /* perform operation by calling N_VLinearCombination for each subvector */
+  err = SUN_SUCCESS;
+  MANYVECTOR_PARALLEL_FOR_ERR(z, err)
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(z); i++)
   {
+    SUNErrCode ierr;
+
     /* for each subvector, create the array of subvectors of X */
-    for (j = 0; j < nvec; j++) { Xsub[j] = MANYVECTOR_SUBVEC(X[j], i); }
+    for (j = 0; j < nvec; j++)
+    {
+      Xsub[i * nvec + j] = MANYVECTOR_SUBVEC(X[j], i);
+    }
 
     /* now call N_VLinearCombination for this array of subvectors */
-    SUNCheckCall(N_VLinearCombination(nvec, c, Xsub, MANYVECTOR_SUBVEC(z, i)));
+    ierr = N_VLinearCombination(nvec, c, Xsub + i * nvec,
+                                MANYVECTOR_SUBVEC(z, i));
+    if (ierr < err) { err = ierr; }
   }
 
   /* clean up and return */
   free(Xsub);
+  SUNCheckCall(err);
   return SUN_SUCCESS;
 }
 
@@ -1516,32 +1633,40 @@ SUNErrCode MVAPPEND(N_VScaleAddMulti)(int nvec, sunrealtype* a, N_Vector x,
 {
   SUNFunctionBegin(x->sunctx);
   sunindextype i, j;
+  SUNErrCode err;
   N_Vector *Ysub, *Zsub;
 
-  /* create arrays of nvec N_Vector pointers for reuse within loop */
+  /* create arrays of nvec N_Vector pointers for each subvector */
   Ysub = Zsub = NULL;
-  Ysub        = (N_Vector*)malloc(nvec * sizeof(N_Vector));
+  Ysub = (N_Vector*)malloc(MANYVECTOR_NUM_SUBVECS(x) * nvec * sizeof(N_Vector));
   SUNAssert(Ysub, SUN_ERR_MALLOC_FAIL);
-  Zsub = (N_Vector*)malloc(nvec * sizeof(N_Vector));
+  Zsub = (N_Vector*)malloc(MANYVECTOR_NUM_SUBVECS(x) * nvec * sizeof(N_Vector));
   SUNAssert(Zsub, SUN_ERR_MALLOC_FAIL);
 
   /* perform operation by calling N_VScaleAddMulti for each subvector */
+  err = SUN_SUCCESS;
+  MANYVECTOR_PARALLEL_FOR_ERR(x, err)
   for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
   {
+    SUNErrCode ierr;
+
     /* for each subvector, create the array of subvectors of Y and Z */
     for (j = 0; j < nvec; j++)
     {
-      Ysub[j] = MANYVECTOR_SUBVEC(Y[j], i);
-      Zsub[j] = MANYVECTOR_SUBVEC(Z[j], i);
+      Ysub[i * nvec + j] = MANYVECTOR_SUBVEC(Y[j], i);
+      Zsub[i * nvec + j] = MANYVECTOR_SUBVEC(Z[j], i);
     }
 
     /* now call N_VScaleAddMulti for this array of subvectors */
-    SUNCheckCall(N_VScaleAddMulti(nvec, a, MANYVECTOR_SUBVEC(x, i), Ysub, Zsub));
+    ierr = N_VScaleAddMulti(nvec, a, MANYVECTOR_SUBVEC(x, i), Ysub + i * nvec,
+                            Zsub + i * nvec);
+    if (ierr < err) { err = ierr; }
   }
 
   /* clean up and return */
   free(Ysub);
   free(Zsub);
+  SUNCheckCall(err);
   return SUN_SUCCESS;
 }
 
@@ -2065,6 +2190,7 @@ static N_Vector ManyVectorClone(N_Vector w, sunbooleantype cloneempty)
   content->num_subvectors = MANYVECTOR_NUM_SUBVECS(w);
   content->global_length  = MANYVECTOR_GLOBLENGTH(w);
   content->own_data       = SUNTRUE;
+  content->num_threads    = MANYVECTOR_NUM_THREADS(w);
 
   /* Allocate the subvector array */
   content->subvec_array = NULL;
@@ -2126,3 +2252,159 @@ static int SubvectorMPIRank(N_Vector x)
   return rank;
 }
 #endif
+
+/* This function returns SUNTRUE if the subvector operations of x should be
+   evaluated concurrently, i.e., if more than one thread was requested and
+   threading is available.  In the MPI-aware build, a reduction is only
+   evaluated concurrently when every subvector implements the corresponding
+   local operation (checked with islocal), since MPI collectives issued from
+   several threads could be ordered differently on each task. */
+static sunbooleantype ManyVectorConcurrent(
+  N_Vector x, SUNDIALS_MAYBE_UNUSED sunbooleantype (*islocal)(N_Vector))
+{
+#if defined(_OPENMP) && !defined(SUNDIALS_BUILD_WITH_PROFILING)
+  if (MANYVECTOR_NUM_THREADS(x) < 2 || MANYVECTOR_NUM_SUBVECS(x) < 2)
+  {
+    return SUNFALSE;
+  }
+#ifdef MANYVECTOR_BUILD_WITH_MPI
+  sunindextype i;
+  for (i = 0; i < MANYVECTOR_NUM_SUBVECS(x); i++)
+  {
+    if (!islocal(MANYVECTOR_SUBVEC(x, i))) { return SUNFALSE; }
+  }
+#endif
+  return SUNTRUE;
+#else
+  return SUNFALSE;
+#endif
+}
+
+/* This function returns a workspace array of the given length for the local
+   reductions. The local array, of length MANYVECTOR_LOCAL_WORK, on the stack of
+   the calling thread is used when it is long enough, so concurrent reductions
+   never share a workspace and the common case does not allocate memory.
+   Returns NULL if the allocation fails. */
+static sunrealtype* ManyVectorWorkspace(sunindextype length, sunrealtype* local)
+{
+  if (length <= MANYVECTOR_LOCAL_WORK) { return (local); }
+  return ((sunrealtype*)malloc(length * sizeof(sunrealtype)));
+}
+
+/* This function frees a workspace returned by ManyVectorWorkspace */
+static void ManyVectorFreeWorkspace(sunrealtype* work, sunrealtype* local)
+{
+  if (work != local) { free(work); }
+}
+
+/* These functions return SUNTRUE if the input N_Vector implements the local
+   reduction used by the corresponding ManyVector reduction. */
+static sunbooleantype ManyVectorHasDotProdLocal(N_Vector w)
+{
+  return (w->ops->nvdotprodlocal != NULL);
+}
+
+static sunbooleantype ManyVectorHasMaxNormLocal(N_Vector w)
+{
+  return (w->ops->nvmaxnormlocal != NULL);
+}
+
+static sunbooleantype ManyVectorHasWSqrSumLocal(N_Vector w)
+{
+  return (w->ops->nvwsqrsumlocal != NULL);
+}
+
+/* The following functions may be called from the threads evaluating the
+   subvectors concurrently, so they do not check the last error in the
+   SUNContext. The callers check it on their own thread.
+
+   This function returns the contribution of subvector i to the MPI task-local
+   dot product of x and y.
+
+   If the subvector does not implement the N_VDotProdLocal routine (NULL
+   function pointer), then this routine will call N_VDotProd, but only return
+   the result if this is the root task for that subvector's communicator
+   (note: serial vectors are always root task). */
+static sunrealtype SubvectorDotProdLocal(N_Vector x, N_Vector y,
+                                         sunindextype i)
+{
+  sunrealtype contrib;
+#ifdef MANYVECTOR_BUILD_WITH_MPI
+  int rank;
+
+  /* check for nvdotprodlocal in subvector */
+  if (MANYVECTOR_SUBVEC(x, i)->ops->nvdotprodlocal)
+  {
+    contrib = N_VDotProdLocal(MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(y, i));
+    return (contrib);
+  }
+
+  /* otherwise, call nvdotprod and only the root task contributes */
+  contrib = N_VDotProd(MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(y, i));
+
+  /* get this task's rank in subvector communicator (note: serial
+     subvectors will result in rank==0) */
+  rank = SubvectorMPIRank(MANYVECTOR_SUBVEC(x, i));
+  if (rank != 0) { return (ZERO); }
+#else
+  contrib = N_VDotProd(MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(y, i));
+#endif
+  return (contrib);
+}
+
+/* This function returns the MPI task-local maximum norm of subvector i of x,
+   calling N_VMaxNorm if the subvector does not implement N_VMaxNormLocal. */
+static sunrealtype SubvectorMaxNormLocal(N_Vector x, sunindextype i)
+{
+  sunrealtype lmax;
+
+  /* check for nvmaxnormlocal in subvector */
+  if (MANYVECTOR_SUBVEC(x, i)->ops->nvmaxnormlocal)
+  {
+    lmax = N_VMaxNormLocal(MANYVECTOR_SUBVEC(x, i));
+  }
+  else
+  {
+    lmax = N_VMaxNorm(MANYVECTOR_SUBVEC(x, i));
+  }
+
+  return (lmax);
+}
+
+/* This function returns the contribution of subvector i to the MPI task-local
+   weighted squared sum of x.
+
+   If the subvector does not implement the N_VWSqrSumLocal routine (NULL
+   function pointer), then this routine will call N_VWrmsNorm and N_VGetLength
+   to unravel the squared sum of the subvector components, and only return it
+   if this is the root task for that subvector's communicator (note: serial
+   vectors are always root task). */
+static sunrealtype SubvectorWSqrSumLocal(N_Vector x, N_Vector w,
+                                         sunindextype i)
+{
+  sunindextype N;
+  sunrealtype contrib;
+#ifdef MANYVECTOR_BUILD_WITH_MPI
+  int rank;
+
+  /* check for nvwsqrsumlocal in subvector */
+  if (MANYVECTOR_SUBVEC(x, i)->ops->nvwsqrsumlocal)
+  {
+    contrib = N_VWSqrSumLocal(MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(w, i));
+    return (contrib);
+  }
+#endif
+
+  /* otherwise, call nvwrmsnorm */
+  contrib = N_VWrmsNorm(MANYVECTOR_SUBVEC(x, i), MANYVECTOR_SUBVEC(w, i));
+
+#ifdef MANYVECTOR_BUILD_WITH_MPI
+  /* get this task's rank in subvector communicator (note: serial
+     subvectors will result in rank==0) */
+  rank = SubvectorMPIRank(MANYVECTOR_SUBVEC(x, i));
+  if (rank != 0) { return (ZERO); }
+#endif
+
+  N = N_VGetLength(MANYVECTOR_SUBVEC(x, i));
+  return (contrib * contrib * N);
+}
@@ -32,12 +32,16 @@
 #include <sundials/sundials_errors.h>
 
 #include "sundials_macros.h"
+#include "sundials_reduction_impl.h"
 
 #define ZERO   SUN_RCONST(0.0)
 #define HALF   SUN_RCONST(0.5)
 #define ONE    SUN_RCONST(1.0)
 #define ONEPT5 SUN_RCONST(1.5)
 
+/* Private function to place the data of a new vector */
+static void VFirstTouch_OpenMP(sunindextype N, sunrealtype* xd, int num_threads);
+
 /* Private functions for special cases of vector operations */
 static void VCopy_OpenMP(N_Vector x, N_Vector z);             /* z=x */
 static void VSum_OpenMP(N_Vector x, N_Vector y, N_Vector z);  /* z=x+y     */
@@ -205,6 +209,7 @@ N_Vector N_VNew_OpenMP(sunindextype length, int num_threads, SUNContext sunctx)
   {
     data = (sunrealtype*)malloc(length * sizeof(sunrealtype));
     SUNAssertNull(data, SUN_ERR_MALLOC_FAIL);
+    VFirstTouch_OpenMP(length, data, num_threads);
 
     /* Attach data */
     NV_OWN_DATA_OMP(v) = SUNTRUE;
@@ -335,6 +340,7 @@ N_Vector N_VClone_OpenMP(N_Vector w)
   {
     data = (sunrealtype*)malloc(length * sizeof(sunrealtype));
     SUNAssertNull(data, SUN_ERR_MALLOC_FAIL);
+    VFirstTouch_OpenMP(length, data, NV_NUM_THREADS_OMP(w));
   }
 
   /* Attach data */
@@ -1938,6 +1944,26 @@ SUNErrCode N_VBufUnpack_OpenMP(N_Vector x, void* buf)
  * -----------------------------------------------------------------
  */
 
+/* ----------------------------------------------------------------------------
+ * Initialize the data of a new vector with the same static schedule used by
+ * the vector operations. With a first-touch page placement policy each page is
+ * then mapped to the memory of the NUMA domain of the thread that operates on
+ * it, rather than to the domain of the thread that allocated the vector.
+ */
+
+static void VFirstTouch_OpenMP(sunindextype N, sunrealtype* xd, int num_threads)
+{
+  sunindextype i;
+
+  i = 0; /* initialize to suppress clang warning */
+
+#pragma omp parallel for default(none) private(i) shared(N, xd) \
+  schedule(static) num_threads(num_threads)
+  for (i = 0; i < N; i++) { xd[i] = ZERO; }
+
+  return;
+}
+
 /* ----------------------------------------------------------------------------
  * Copy vector components into a second vector
  */
@@ -2420,6 +2446,123 @@ static void VaxpyVectorArray_OpenMP(int nvec, sunrealtype a, N_Vector* X,
   }
 }
 
+/*
+ * -----------------------------------------------------------------
+ * Reproducible reduction operations
+ * -----------------------------------------------------------------
+ */
+
+static sunrealtype ReduceReproducible_OpenMP(SUNReduceKernel kernel, N_Vector x,
+                                             N_Vector y, N_Vector id)
+{
+  sunindextype c, N, nchunks;
+  sunrealtype *xd, *yd, *idd;
+  sunrealtype partials[SUN_REDUCE_MAX_CHUNKS];
+
+  N       = NV_LENGTH_OMP(x);
+  nchunks = sunReduceNumChunks(N);
+  xd      = NV_DATA_OMP(x);
+  yd      = (y) ? NV_DATA_OMP(y) : NULL;
+  idd     = (id) ? NV_DATA_OMP(id) : NULL;
+
+  c = 0; /* initialize to suppress clang warning */
+
+#pragma omp parallel for default(none) private(c)                  \
+  shared(kernel, N, nchunks, xd, yd, idd, partials) schedule(static) \
+  num_threads(NV_NUM_THREADS_OMP(x))
+  for (c = 0; c < nchunks; c++)
+  {
+    partials[c] = sunReduceChunk(kernel, xd, yd, idd, N, c);
+  }
+
+  return sunReduceTree(partials, nchunks);
+}
+
+static sunrealtype DotProdReproducible_OpenMP(N_Vector x, N_Vector y)
+{
+  return ReduceReproducible_OpenMP(SUN_REDUCE_DOTPROD, x, y, NULL);
+}
+
+static sunrealtype WSqrSumLocalReproducible_OpenMP(N_Vector x, N_Vector w)
+{
+  return ReduceReproducible_OpenMP(SUN_REDUCE_WSQRSUM, x, w, NULL);
+}
+
+static sunrealtype WSqrSumMaskLocalReproducible_OpenMP(N_Vector x, N_Vector w,
+                                                       N_Vector id)
+{
+  return ReduceReproducible_OpenMP(SUN_REDUCE_WSQRSUMMASK, x, w, id);
+}
+
+static sunrealtype L1NormReproducible_OpenMP(N_Vector x)
+{
+  return ReduceReproducible_OpenMP(SUN_REDUCE_L1NORM, x, NULL, NULL);
+}
+
+static sunrealtype WrmsNormReproducible_OpenMP(N_Vector x, N_Vector w)
+{
+  return SUNRsqrt(WSqrSumLocalReproducible_OpenMP(x, w) / NV_LENGTH_OMP(x));
+}
+
+static sunrealtype WrmsNormMaskReproducible_OpenMP(N_Vector x, N_Vector w,
+                                                   N_Vector id)
+{
+  return SUNRsqrt(WSqrSumMaskLocalReproducible_OpenMP(x, w, id) /
+                  NV_LENGTH_OMP(x));
+}
+
+static sunrealtype WL2NormReproducible_OpenMP(N_Vector x, N_Vector w)
+{
+  return SUNRsqrt(WSqrSumLocalReproducible_OpenMP(x, w));
+}
+
+static SUNErrCode DotProdMultiReproducible_OpenMP(int nvec, N_Vector x,
+                                                  N_Vector* Y,
+                                                  sunrealtype* dotprods)
+{
+  int i;
+  for (i = 0; i < nvec; i++)
+  {
+    dotprods[i] = DotProdReproducible_OpenMP(x, Y[i]);
+  }
+  return SUN_SUCCESS;
+}
+
+static SUNErrCode WrmsNormVectorArrayReproducible_OpenMP(int nvec,
+                                                         N_Vector* X,
+                                                         N_Vector* W,
+                                                         sunrealtype* nrm)
+{
+  int i;
+  for (i = 0; i < nvec; i++)
+  {
+    nrm[i] = WrmsNormReproducible_OpenMP(X[i], W[i]);
+  }
+  return SUN_SUCCESS;
+}
+
+static SUNErrCode WrmsNormMaskVectorArrayReproducible_OpenMP(int nvec,
+                                                             N_Vector* X,
+                                                             N_Vector* W,
+                                                             N_Vector id,
+                                                             sunrealtype* nrm)
+{
+  int i;
+  for (i = 0; i < nvec; i++)
+  {
+    nrm[i] = WrmsNormMaskReproducible_OpenMP(X[i], W[i], id);
+  }
+  return SUN_SUCCESS;
+}
+
+/* Installs the reproducible fused reductions if v uses the reproducible
+   reductions (called after a fused operation is enabled) */
+static SUNErrCode ReproducibleFusedOps_OpenMP(N_Vector v)
+{
+  if (v->ops->nvdotprod != DotProdReproducible_OpenMP) { return SUN_SUCCESS; }
+  return N_VEnableReproducibleReductions_OpenMP(v, SUNTRUE);
+}
+
 /*
  * -----------------------------------------------------------------
  * Enable / Disable fused and vector array operations
@@ -2464,8 +2607,8 @@ SUNErrCode N_VEnableFusedOps_OpenMP(N_Vector v, sunbooleantype tf)
     v->ops->nvdotprodmultilocal = NULL;
   }
 
-  /* return success */
-  return SUN_SUCCESS;
+  /* keep the fused reductions reproducible if requested */
+  return ReproducibleFusedOps_OpenMP(v);
 }
 
 SUNErrCode N_VEnableLinearCombination_OpenMP(N_Vector v, sunbooleantype tf)
@@ -2484,7 +2627,7 @@ SUNErrCode N_VEnableDotProdMulti_OpenMP(N_Vector v, sunbooleantype tf)
 {
   v->ops->nvdotprodmulti      = tf ? N_VDotProdMulti_OpenMP : NULL;
   v->ops->nvdotprodmultilocal = tf ? N_VDotProdMulti_OpenMP : NULL;
-  return SUN_SUCCESS;
+  return ReproducibleFusedOps_OpenMP(v);
 }
 
 SUNErrCode N_VEnableLinearSumVectorArray_OpenMP(N_Vector v, sunbooleantype tf)
@@ -2508,14 +2651,14 @@ SUNErrCode N_VEnableConstVectorArray_OpenMP(N_Vector v, sunbooleantype tf)
 SUNErrCode N_VEnableWrmsNormVectorArray_OpenMP(N_Vector v, sunbooleantype tf)
 {
   v->ops->nvwrmsnormvectorarray = tf ? N_VWrmsNormVectorArray_OpenMP : NULL;
-  return SUN_SUCCESS;
+  return ReproducibleFusedOps_OpenMP(v);
 }
 
 SUNErrCode N_VEnableWrmsNormMaskVectorArray_OpenMP(N_Vector v, sunbooleantype tf)
 {
   v->ops->nvwrmsnormmaskvectorarray = tf ? N_VWrmsNormMaskVectorArray_OpenMP
                                          : NULL;
-  return SUN_SUCCESS;
+  return ReproducibleFusedOps_OpenMP(v);
 }
 
 SUNErrCode N_VEnableScaleAddMultiVectorArray_OpenMP(N_Vector v, sunbooleantype tf)
@@ -2532,3 +2675,67 @@ SUNErrCode N_VEnableLinearCombinationVectorArray_OpenMP(N_Vector v,
     tf ? N_VLinearCombinationVectorArray_OpenMP : NULL;
   return SUN_SUCCESS;
 }
+
+/*
+ * -----------------------------------------------------------------
+ * Enable / Disable reproducible reductions
+ * -----------------------------------------------------------------
+ */
+
+SUNErrCode N_VEnableReproducibleReductions_OpenMP(N_Vector v, sunbooleantype tf)
+{
+  if (tf)
+  {
+    /* use the chunked reductions */
+    v->ops->nvdotprod          = DotProdReproducible_OpenMP;
+    v->ops->nvwrmsnorm         = WrmsNormReproducible_OpenMP;
+    v->ops->nvwrmsnormmask     = WrmsNormMaskReproducible_OpenMP;
+    v->ops->nvwl2norm          = WL2NormReproducible_OpenMP;
+    v->ops->nvl1norm           = L1NormReproducible_OpenMP;
+    v->ops->nvdotprodlocal     = DotProdReproducible_OpenMP;
+    v->ops->nvl1normlocal      = L1NormReproducible_OpenMP;
+    v->ops->nvwsqrsumlocal     = WSqrSumLocalReproducible_OpenMP;
+    v->ops->nvwsqrsummasklocal = WSqrSumMaskLocalReproducible_OpenMP;
+  }
+  else
+  {
+    /* restore the default reductions */
+    v->ops->nvdotprod          = N_VDotProd_OpenMP;
+    v->ops->nvwrmsnorm         = N_VWrmsNorm_OpenMP;
+    v->ops->nvwrmsnormmask     = N_VWrmsNormMask_OpenMP;
+    v->ops->nvwl2norm          = N_VWL2Norm_OpenMP;
+    v->ops->nvl1norm           = N_VL1Norm_OpenMP;
+    v->ops->nvdotprodlocal     = N_VDotProd_OpenMP;
+    v->ops->nvl1normlocal      = N_VL1Norm_OpenMP;
+    v->ops->nvwsqrsumlocal     = N_VWSqrSumLocal_OpenMP;
+    v->ops->nvwsqrsummasklocal = N_VWSqrSumMaskLocal_OpenMP;
+  }
+
+  /* switch the enabled fused reductions to the matching implementation,
+     disabled fused reductions stay disabled */
+  if (v->ops->nvdotprodmulti)
+  {
+    v->ops->nvdotprodmulti = tf ? DotProdMultiReproducible_OpenMP
+                                : N_VDotProdMulti_OpenMP;
+  }
+  if (v->ops->nvdotprodmultilocal)
+  {
+    v->ops->nvdotprodmultilocal = tf ? DotProdMultiReproducible_OpenMP
+                                     : N_VDotProdMulti_OpenMP;
+  }
+  if (v->ops->nvwrmsnormvectorarray)
+  {
+    v->ops->nvwrmsnormvectorarray =
+      tf ? WrmsNormVectorArrayReproducible_OpenMP
+         : N_VWrmsNormVectorArray_OpenMP;
+  }
+  if (v->ops->nvwrmsnormmaskvectorarray)
+  {
+    v->ops->nvwrmsnormmaskvectorarray =
+      tf ? WrmsNormMaskVectorArrayReproducible_OpenMP
+         : N_VWrmsNormMaskVectorArray_OpenMP;
+  }
+
+  /* return success */
+  return SUN_SUCCESS;
+}
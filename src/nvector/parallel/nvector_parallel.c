@@ -26,6 +26,7 @@
 #include <sundials/sundials_types.h>
 
 #include "sundials_macros.h"
+#include "sundials_reduction_impl.h"
 
 #define ZERO   SUN_RCONST(0.0)
 #define HALF   SUN_RCONST(0.5)
@@ -1188,6 +1189,105 @@ SUNErrCode N_VDotProdMultiAllReduce_Parallel(int nvec, N_Vector x,
   return SUN_SUCCESS;
 }
 
+/*
+ * -----------------------------------------------------------------
+ * split-phase reduction operations
+ * -----------------------------------------------------------------
+ */
+
+SUNErrCode N_VDotProdStart_Parallel(N_Vector x, N_Vector y,
+                                    sunrealtype* dotprod, MPI_Request* request)
+{
+  SUNFunctionBegin(x->sunctx);
+  *dotprod = N_VDotProdLocal_Parallel(x, y);
+  SUNCheckLastErr();
+  SUNCheckMPICall(MPI_Iallreduce(MPI_IN_PLACE, dotprod, 1, MPI_SUNREALTYPE,
+                                 MPI_SUM, NV_COMM_P(x), request));
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VMaxNormStart_Parallel(N_Vector x, sunrealtype* maxnorm,
+                                    MPI_Request* request)
+{
+  SUNFunctionBegin(x->sunctx);
+  *maxnorm = N_VMaxNormLocal_Parallel(x);
+  SUNCheckLastErr();
+  SUNCheckMPICall(MPI_Iallreduce(MPI_IN_PLACE, maxnorm, 1, MPI_SUNREALTYPE,
+                                 MPI_MAX, NV_COMM_P(x), request));
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VMinStart_Parallel(N_Vector x, sunrealtype* min,
+                                MPI_Request* request)
+{
+  SUNFunctionBegin(x->sunctx);
+  *min = N_VMinLocal_Parallel(x);
+  SUNCheckLastErr();
+  SUNCheckMPICall(MPI_Iallreduce(MPI_IN_PLACE, min, 1, MPI_SUNREALTYPE,
+                                 MPI_MIN, NV_COMM_P(x), request));
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VWrmsNormStart_Parallel(N_Vector x, N_Vector w, sunrealtype* nrm,
+                                     MPI_Request* request)
+{
+  SUNFunctionBegin(x->sunctx);
+  *nrm = N_VWSqrSumLocal_Parallel(x, w);
+  SUNCheckLastErr();
+  SUNCheckMPICall(MPI_Iallreduce(MPI_IN_PLACE, nrm, 1, MPI_SUNREALTYPE,
+                                 MPI_SUM, NV_COMM_P(x), request));
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VWrmsNormFinish_Parallel(N_Vector x, sunrealtype* nrm,
+                                      MPI_Request* request)
+{
+  SUNFunctionBegin(x->sunctx);
+  SUNCheckMPICall(MPI_Wait(request, MPI_STATUS_IGNORE));
+  *nrm = SUNRsqrt(*nrm / (NV_GLOBLENGTH_P(x)));
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VDotProdMultiStart_Parallel(int nvec, N_Vector x, N_Vector* Y,
+                                         sunrealtype* dotprods,
+                                         MPI_Request* request)
+{
+  SUNFunctionBegin(x->sunctx);
+
+  SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
+
+  SUNCheckCall(N_VDotProdMultiLocal_Parallel(nvec, x, Y, dotprods));
+  SUNCheckCall(
+    N_VDotProdMultiAllReduceStart_Parallel(nvec, x, dotprods, request));
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VDotProdMultiAllReduceStart_Parallel(int nvec, N_Vector x,
+                                                  sunrealtype* sum,
+                                                  MPI_Request* request)
+{
+  SUNFunctionBegin(x->sunctx);
+
+  SUNAssert(nvec >= 1, SUN_ERR_ARG_OUTOFRANGE);
+
+  /* get communicator */
+  MPI_Comm comm = NV_COMM_P(x);
+
+  /* start reduction */
+  SUNCheckMPICall(MPI_Iallreduce(MPI_IN_PLACE, sum, nvec, MPI_SUNREALTYPE,
+                                 MPI_SUM, comm, request));
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode N_VReduceFinish_Parallel(N_Vector x, MPI_Request* request)
+{
+  SUNFunctionBegin(x->sunctx);
+  SUNCheckMPICall(MPI_Wait(request, MPI_STATUS_IGNORE));
+  return SUN_SUCCESS;
+}
+
 /*
  * -----------------------------------------------------------------
  * vector array operations
@@ -2116,6 +2216,211 @@ static void VaxpyVectorArray_Parallel(int nvec, sunrealtype a, N_Vector* X,
   }
 }
 
+/*
+ * -----------------------------------------------------------------
+ * Reproducible reduction operations
+ * -----------------------------------------------------------------
+ */
+
+static sunrealtype ReduceReproducible_Parallel(SUNReduceKernel kernel,
+                                               N_Vector x, N_Vector y,
+                                               N_Vector id)
+{
+  sunindextype c, N, nchunks;
+  sunrealtype *xd, *yd, *idd;
+  sunrealtype partials[SUN_REDUCE_MAX_CHUNKS];
+
+  N       = NV_LOCLENGTH_P(x);
+  nchunks = sunReduceNumChunks(N);
+  xd      = NV_DATA_P(x);
+  yd      = (y) ? NV_DATA_P(y) : NULL;
+  idd     = (id) ? NV_DATA_P(id) : NULL;
+
+  for (c = 0; c < nchunks; c++)
+  {
+    partials[c] = sunReduceChunk(kernel, xd, yd, idd, N, c);
+  }
+
+  return sunReduceTree(partials, nchunks);
+}
+
+/* Sums the n values in vals over all tasks in place. Rather than using
+   MPI_SUM, whose evaluation order is up to the MPI library, the values from
+   every task are gathered and combined in rank order with a fixed tree. */
+static SUNErrCode AllReduceReproducible_Parallel(N_Vector x, int n,
+                                                 sunrealtype* vals)
+{
+  SUNFunctionBegin(x->sunctx);
+  int i, r, nprocs;
+  sunrealtype *gathered, *column;
+
+  SUNCheckMPICall(MPI_Comm_size(NV_COMM_P(x), &nprocs));
+
+  gathered = (sunrealtype*)malloc((size_t)n * nprocs * sizeof(sunrealtype));
+  SUNAssert(gathered, SUN_ERR_MALLOC_FAIL);
+  column = (sunrealtype*)malloc(nprocs * sizeof(sunrealtype));
+  SUNAssert(column, SUN_ERR_MALLOC_FAIL);
+
+  SUNCheckMPICall(MPI_Allgather(vals, n, MPI_SUNREALTYPE, gathered, n,
+                                MPI_SUNREALTYPE, NV_COMM_P(x)));
+
+  for (i = 0; i < n; i++)
+  {
+    for (r = 0; r < nprocs; r++) { column[r] = gathered[r * n + i]; }
+    vals[i] = sunReduceTree(column, nprocs);
+  }
+
+  free(gathered);
+  free(column);
+
+  return SUN_SUCCESS;
+}
+
+static sunrealtype DotProdLocalReproducible_Parallel(N_Vector x, N_Vector y)
+{
+  return ReduceReproducible_Parallel(SUN_REDUCE_DOTPROD, x, y, NULL);
+}
+
+static sunrealtype WSqrSumLocalReproducible_Parallel(N_Vector x, N_Vector w)
+{
+  return ReduceReproducible_Parallel(SUN_REDUCE_WSQRSUM, x, w, NULL);
+}
+
+static sunrealtype WSqrSumMaskLocalReproducible_Parallel(N_Vector x,
+                                                         N_Vector w,
+                                                         N_Vector id)
+{
+  return ReduceReproducible_Parallel(SUN_REDUCE_WSQRSUMMASK, x, w, id);
+}
+
+static sunrealtype L1NormLocalReproducible_Parallel(N_Vector x)
+{
+  return ReduceReproducible_Parallel(SUN_REDUCE_L1NORM, x, NULL, NULL);
+}
+
+static sunrealtype DotProdReproducible_Parallel(N_Vector x, N_Vector y)
+{
+  SUNFunctionBegin(x->sunctx);
+  sunrealtype sum = DotProdLocalReproducible_Parallel(x, y);
+  SUNCheckCallNoRet(AllReduceReproducible_Parallel(x, 1, &sum));
+  return (sum);
+}
+
+static sunrealtype WrmsNormReproducible_Parallel(N_Vector x, N_Vector w)
+{
+  SUNFunctionBegin(x->sunctx);
+  sunrealtype sum = WSqrSumLocalReproducible_Parallel(x, w);
+  SUNCheckCallNoRet(AllReduceReproducible_Parallel(x, 1, &sum));
+  return (SUNRsqrt(sum / (NV_GLOBLENGTH_P(x))));
+}
+
+static sunrealtype WrmsNormMaskReproducible_Parallel(N_Vector x, N_Vector w,
+                                                     N_Vector id)
+{
+  SUNFunctionBegin(x->sunctx);
+  sunrealtype sum = WSqrSumMaskLocalReproducible_Parallel(x, w, id);
+  SUNCheckCallNoRet(AllReduceReproducible_Parallel(x, 1, &sum));
+  return (SUNRsqrt(sum / (NV_GLOBLENGTH_P(x))));
+}
+
+static sunrealtype WL2NormReproducible_Parallel(N_Vector x, N_Vector w)
+{
+  SUNFunctionBegin(x->sunctx);
+  sunrealtype sum = WSqrSumLocalReproducible_Parallel(x, w);
+  SUNCheckCallNoRet(AllReduceReproducible_Parallel(x, 1, &sum));
+  return (SUNRsqrt(sum));
+}
+
+static sunrealtype L1NormReproducible_Parallel(N_Vector x)
+{
+  SUNFunctionBegin(x->sunctx);
+  sunrealtype sum = L1NormLocalReproducible_Parallel(x);
+  SUNCheckCallNoRet(AllReduceReproducible_Parallel(x, 1, &sum));
+  return (sum);
+}
+
+static SUNErrCode DotProdMultiAllReduceReproducible_Parallel(int nvec,
+                                                             N_Vector x,
+                                                             sunrealtype* sum)
+{
+  SUNFunctionBegin(x->sunctx);
+  SUNCheckCall(AllReduceReproducible_Parallel(x, nvec, sum));
+  return SUN_SUCCESS;
+}
+
+static SUNErrCode DotProdMultiLocalReproducible_Parallel(int nvec, N_Vector x,
+                                                         N_Vector* Y,
+                                                         sunrealtype* dotprods)
+{
+  int i;
+  for (i = 0; i < nvec; i++)
+  {
+    dotprods[i] = DotProdLocalReproducible_Parallel(x, Y[i]);
+  }
+  return SUN_SUCCESS;
+}
+
+static SUNErrCode DotProdMultiReproducible_Parallel(int nvec, N_Vector x,
+                                                    N_Vector* Y,
+                                                    sunrealtype* dotprods)
+{
+  SUNFunctionBegin(x->sunctx);
+  SUNCheckCall(DotProdMultiLocalReproducible_Parallel(nvec, x, Y, dotprods));
+  SUNCheckCall(AllReduceReproducible_Parallel(x, nvec, dotprods));
+  return SUN_SUCCESS;
+}
+
+static SUNErrCode WrmsNormVectorArrayReproducible_Parallel(int nvec,
+                                                           N_Vector* X,
+                                                           N_Vector* W,
+                                                           sunrealtype* nrm)
+{
+  SUNFunctionBegin(X[0]->sunctx);
+  int i;
+
+  for (i = 0; i < nvec; i++)
+  {
+    nrm[i] = WSqrSumLocalReproducible_Parallel(X[i], W[i]);
+  }
+  SUNCheckCall(AllReduceReproducible_Parallel(X[0], nvec, nrm));
+  for (i = 0; i < nvec; i++)
+  {
+    nrm[i] = SUNRsqrt(nrm[i] / (NV_GLOBLENGTH_P(X[i])));
+  }
+
+  return SUN_SUCCESS;
+}
+
+static SUNErrCode WrmsNormMaskVectorArrayReproducible_Parallel(int nvec,
+                                                               N_Vector* X,
+                                                               N_Vector* W,
+                                                               N_Vector id,
+                                                               sunrealtype* nrm)
+{
+  SUNFunctionBegin(X[0]->sunctx);
+  int i;
+
+  for (i = 0; i < nvec; i++)
+  {
+    nrm[i] = WSqrSumMaskLocalReproducible_Parallel(X[i], W[i], id);
+  }
+  SUNCheckCall(AllReduceReproducible_Parallel(X[0], nvec, nrm));
+  for (i = 0; i < nvec; i++)
+  {
+    nrm[i] = SUNRsqrt(nrm[i] / (NV_GLOBLENGTH_P(X[i])));
+  }
+
+  return SUN_SUCCESS;
+}
+
+/* Installs the reproducible fused reductions if v uses the reproducible
+   reductions (called after a fused operation is enabled) */
+static SUNErrCode ReproducibleFusedOps_Parallel(N_Vector v)
+{
+  if (v->ops->nvdotprod != DotProdReproducible_Parallel) { return SUN_SUCCESS; }
+  return N_VEnableReproducibleReductions_Parallel(v, SUNTRUE);
+}
+
 /*
  * -----------------------------------------------------------------
  * Enable / Disable fused and vector array operations
@@ -2162,6 +2467,9 @@ SUNErrCode N_VEnableFusedOps_Parallel(N_Vector v, sunbooleantype tf)
     v->ops->nvdotprodmultilocal = NULL;
   }
 
+  /* keep the fused reductions reproducible if requested */
+  SUNCheckCall(ReproducibleFusedOps_Parallel(v));
+
   return SUN_SUCCESS;
 }
 
@@ -2195,6 +2503,9 @@ SUNErrCode N_VEnableDotProdMulti_Parallel(N_Vector v, sunbooleantype tf)
   if (tf) { v->ops->nvdotprodmulti = N_VDotProdMulti_Parallel; }
   else { v->ops->nvdotprodmulti = NULL; }
 
+  /* keep the fused reductions reproducible if requested */
+  SUNCheckCall(ReproducibleFusedOps_Parallel(v));
+
   return SUN_SUCCESS;
 }
 
@@ -2239,6 +2550,9 @@ SUNErrCode N_VEnableWrmsNormVectorArray_Parallel(N_Vector v, sunbooleantype tf)
   if (tf) { v->ops->nvwrmsnormvectorarray = N_VWrmsNormVectorArray_Parallel; }
   else { v->ops->nvwrmsnormvectorarray = NULL; }
 
+  /* keep the fused reductions reproducible if requested */
+  SUNCheckCall(ReproducibleFusedOps_Parallel(v));
+
   return SUN_SUCCESS;
 }
 
@@ -2253,6 +2567,9 @@ SUNErrCode N_VEnableWrmsNormMaskVectorArray_Parallel(N_Vector v, sunbooleantype
   }
   else { v->ops->nvwrmsnormmaskvectorarray = NULL; }
 
+  /* keep the fused reductions reproducible if requested */
+  SUNCheckCall(ReproducibleFusedOps_Parallel(v));
+
   return SUN_SUCCESS;
 }
 
@@ -2295,5 +2612,75 @@ SUNErrCode N_VEnableDotProdMultiLocal_Parallel(N_Vector v, sunbooleantype tf)
   if (tf) { v->ops->nvdotprodmultilocal = N_VDotProdMultiLocal_Parallel; }
   else { v->ops->nvdotprodmultilocal = NULL; }
 
+  /* keep the fused reductions reproducible if requested */
+  SUNCheckCall(ReproducibleFusedOps_Parallel(v));
+
+  return SUN_SUCCESS;
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Enable / Disable reproducible reductions
+ * -----------------------------------------------------------------
+ */
+
+SUNErrCode N_VEnableReproducibleReductions_Parallel(N_Vector v,
+                                                    sunbooleantype tf)
+{
+  if (tf)
+  {
+    /* use the chunked local reductions and the rank ordered combination */
+    v->ops->nvdotprod               = DotProdReproducible_Parallel;
+    v->ops->nvwrmsnorm              = WrmsNormReproducible_Parallel;
+    v->ops->nvwrmsnormmask          = WrmsNormMaskReproducible_Parallel;
+    v->ops->nvwl2norm               = WL2NormReproducible_Parallel;
+    v->ops->nvl1norm                = L1NormReproducible_Parallel;
+    v->ops->nvdotprodlocal          = DotProdLocalReproducible_Parallel;
+    v->ops->nvl1normlocal           = L1NormLocalReproducible_Parallel;
+    v->ops->nvwsqrsumlocal          = WSqrSumLocalReproducible_Parallel;
+    v->ops->nvwsqrsummasklocal      = WSqrSumMaskLocalReproducible_Parallel;
+    v->ops->nvdotprodmultiallreduce =
+      DotProdMultiAllReduceReproducible_Parallel;
+  }
+  else
+  {
+    /* restore the default reductions */
+    v->ops->nvdotprod               = N_VDotProd_Parallel;
+    v->ops->nvwrmsnorm              = N_VWrmsNorm_Parallel;
+    v->ops->nvwrmsnormmask          = N_VWrmsNormMask_Parallel;
+    v->ops->nvwl2norm               = N_VWL2Norm_Parallel;
+    v->ops->nvl1norm                = N_VL1Norm_Parallel;
+    v->ops->nvdotprodlocal          = N_VDotProdLocal_Parallel;
+    v->ops->nvl1normlocal           = N_VL1NormLocal_Parallel;
+    v->ops->nvwsqrsumlocal          = N_VWSqrSumLocal_Parallel;
+    v->ops->nvwsqrsummasklocal      = N_VWSqrSumMaskLocal_Parallel;
+    v->ops->nvdotprodmultiallreduce = N_VDotProdMultiAllReduce_Parallel;
+  }
+
+  /* switch the enabled fused reductions to the matching implementation,
+     disabled fused reductions stay disabled */
+  if (v->ops->nvdotprodmulti)
+  {
+    v->ops->nvdotprodmulti = tf ? DotProdMultiReproducible_Parallel
+                                : N_VDotProdMulti_Parallel;
+  }
+  if (v->ops->nvdotprodmultilocal)
+  {
+    v->ops->nvdotprodmultilocal = tf ? DotProdMultiLocalReproducible_Parallel
+                                     : N_VDotProdMultiLocal_Parallel;
+  }
+  if (v->ops->nvwrmsnormvectorarray)
+  {
+    v->ops->nvwrmsnormvectorarray =
+      tf ? WrmsNormVectorArrayReproducible_Parallel
+         : N_VWrmsNormVectorArray_Parallel;
+  }
+  if (v->ops->nvwrmsnormmaskvectorarray)
+  {
+    v->ops->nvwrmsnormmaskvectorarray =
+      tf ? WrmsNormMaskVectorArrayReproducible_Parallel
+         : N_VWrmsNormMaskVectorArray_Parallel;
+  }
+
   return SUN_SUCCESS;
 }
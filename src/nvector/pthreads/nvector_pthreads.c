@@ -32,6 +32,7 @@
 #include <sundials/sundials_errors.h>
 
 #include "sundials_macros.h"
+#include "sundials_reduction_impl.h"
 
 #define ZERO   SUN_RCONST(0.0)
 #define HALF   SUN_RCONST(0.5)
@@ -137,6 +138,9 @@ static void* VaxpyVectorArray_PT(void* thread_data);
 static void* VBufPack_PT(void* thread_data);
 static void* VBufUnpack_PT(void* thread_data);
 
+/* Pthread companion function for reproducible reductions */
+static void* nvReduceReproduciblePt(void* thread_data);
+
 /* Function to determine loop values for threads */
 static void nvSplitLoop(int myid, int* nthreads, sunindextype* N,
                         sunindextype* start, sunindextype* end);
@@ -5383,6 +5387,181 @@ static void nvInitThreadData(Pthreads_Data* thread_data)
   thread_data->Y3    = NULL;
 }
 
+/*
+ * -----------------------------------------------------------------
+ * Reproducible reduction operations
+ * -----------------------------------------------------------------
+ */
+
+static sunrealtype ReduceReproducible_Pthreads(SUNReduceKernel kernel,
+                                               N_Vector x, N_Vector y,
+                                               N_Vector id)
+{
+  SUNFunctionBegin(x->sunctx);
+
+  sunindextype nchunks;
+  int i, nthreads;
+  pthread_t* threads;
+  Pthreads_Data* thread_data;
+  pthread_attr_t attr;
+  sunrealtype partials[SUN_REDUCE_MAX_CHUNKS];
+
+  /* allocate threads and thread data structs */
+  nchunks  = sunReduceNumChunks(NV_LENGTH_PT(x));
+  nthreads = NV_NUM_THREADS_PT(x);
+  threads  = malloc(nthreads * sizeof(pthread_t));
+  SUNAssert(threads, SUN_ERR_MALLOC_FAIL);
+  thread_data = (Pthreads_Data*)malloc(nthreads * sizeof(struct _Pthreads_Data));
+  SUNAssert(thread_data, SUN_ERR_MALLOC_FAIL);
+
+  /* set thread attributes */
+  pthread_attr_init(&attr);
+  pthread_attr_setdetachstate(&attr, PTHREAD_CREATE_JOINABLE);
+
+  for (i = 0; i < nthreads; i++)
+  {
+    /* initialize thread data */
+    nvInitThreadData(&thread_data[i]);
+
+    /* compute start and end chunk index for thread */
+    nvSplitLoop(i, &nthreads, &nchunks, &thread_data[i].start,
+                &thread_data[i].end);
+
+    /* pack thread data, each thread writes its own chunk sums */
+    thread_data[i].nvec       = (int)kernel;
+    thread_data[i].x1         = x;
+    thread_data[i].v1         = NV_DATA_PT(x);
+    thread_data[i].v2         = (y) ? NV_DATA_PT(y) : NULL;
+    thread_data[i].v3         = (id) ? NV_DATA_PT(id) : NULL;
+    thread_data[i].global_val = partials;
+
+    /* create threads and call pthread companion function */
+    pthread_create(&threads[i], &attr, nvReduceReproduciblePt,
+                   (void*)&thread_data[i]);
+  }
+
+  /* wait for all threads to finish */
+  for (i = 0; i < nthreads; i++) { pthread_join(threads[i], NULL); }
+
+  /* clean up */
+  pthread_attr_destroy(&attr);
+  free(threads);
+  free(thread_data);
+
+  return sunReduceTree(partials, nchunks);
+}
+
+/* ----------------------------------------------------------------------------
+ * Pthread companion function to the reproducible reductions
+ */
+
+static void* nvReduceReproduciblePt(void* thread_data)
+{
+  sunindextype c;
+  Pthreads_Data* my_data;
+
+  /* extract thread data */
+  my_data = (Pthreads_Data*)thread_data;
+
+  /* compute the sums over this thread's chunks */
+  for (c = my_data->start; c < my_data->end; c++)
+  {
+    my_data->global_val[c] = sunReduceChunk((SUNReduceKernel)my_data->nvec,
+                                            my_data->v1, my_data->v2,
+                                            my_data->v3,
+                                            NV_LENGTH_PT(my_data->x1), c);
+  }
+
+  /* exit */
+  pthread_exit(NULL);
+}
+
+static sunrealtype DotProdReproducible_Pthreads(N_Vector x, N_Vector y)
+{
+  return ReduceReproducible_Pthreads(SUN_REDUCE_DOTPROD, x, y, NULL);
+}
+
+static sunrealtype WSqrSumLocalReproducible_Pthreads(N_Vector x, N_Vector w)
+{
+  return ReduceReproducible_Pthreads(SUN_REDUCE_WSQRSUM, x, w, NULL);
+}
+
+static sunrealtype WSqrSumMaskLocalReproducible_Pthreads(N_Vector x,
+                                                         N_Vector w,
+                                                         N_Vector id)
+{
+  return ReduceReproducible_Pthreads(SUN_REDUCE_WSQRSUMMASK, x, w, id);
+}
+
+static sunrealtype L1NormReproducible_Pthreads(N_Vector x)
+{
+  return ReduceReproducible_Pthreads(SUN_REDUCE_L1NORM, x, NULL, NULL);
+}
+
+static sunrealtype WrmsNormReproducible_Pthreads(N_Vector x, N_Vector w)
+{
+  return SUNRsqrt(WSqrSumLocalReproducible_Pthreads(x, w) / NV_LENGTH_PT(x));
+}
+
+static sunrealtype WrmsNormMaskReproducible_Pthreads(N_Vector x, N_Vector w,
+                                                     N_Vector id)
+{
+  return SUNRsqrt(WSqrSumMaskLocalReproducible_Pthreads(x, w, id) /
+                  NV_LENGTH_PT(x));
+}
+
+static sunrealtype WL2NormReproducible_Pthreads(N_Vector x, N_Vector w)
+{
+  return SUNRsqrt(WSqrSumLocalReproducible_Pthreads(x, w));
+}
+
+static SUNErrCode DotProdMultiReproducible_Pthreads(int nvec, N_Vector x,
+                                                    N_Vector* Y,
+                                                    sunrealtype* dotprods)
+{
+  int i;
+  for (i = 0; i < nvec; i++)
+  {
+    dotprods[i] = DotProdReproducible_Pthreads(x, Y[i]);
+  }
+  return SUN_SUCCESS;
+}
+
+static SUNErrCode WrmsNormVectorArrayReproducible_Pthreads(int nvec,
+                                                           N_Vector* X,
+                                                           N_Vector* W,
+                                                           sunrealtype* nrm)
+{
+  int i;
+  for (i = 0; i < nvec; i++)
+  {
+    nrm[i] = WrmsNormReproducible_Pthreads(X[i], W[i]);
+  }
+  return SUN_SUCCESS;
+}
+
+static SUNErrCode WrmsNormMaskVectorArrayReproducible_Pthreads(int nvec,
+                                                               N_Vector* X,
+                                                               N_Vector* W,
+                                                               N_Vector id,
+                                                               sunrealtype* nrm)
+{
+  int i;
+  for (i = 0; i < nvec; i++)
+  {
+    nrm[i] = WrmsNormMaskReproducible_Pthreads(X[i], W[i], id);
+  }
+  return SUN_SUCCESS;
+}
+
+/* Installs the reproducible fused reductions if v uses the reproducible
+   reductions (called after a fused operation is enabled) */
+static SUNErrCode ReproducibleFusedOps_Pthreads(N_Vector v)
+{
+  if (v->ops->nvdotprod != DotProdReproducible_Pthreads) { return SUN_SUCCESS; }
+  return N_VEnableReproducibleReductions_Pthreads(v, SUNTRUE);
+}
+
 /*
  * -----------------------------------------------------------------
  * Enable / Disable fused and vector array operations
@@ -5427,8 +5606,8 @@ SUNErrCode N_VEnableFusedOps_Pthreads(N_Vector v, sunbooleantype tf)
     v->ops->nvdotprodmultilocal = NULL;
   }
 
-  /* return success */
-  return SUN_SUCCESS;
+  /* keep the fused reductions reproducible if requested */
+  return ReproducibleFusedOps_Pthreads(v);
 }
 
 SUNErrCode N_VEnableLinearCombination_Pthreads(N_Vector v, sunbooleantype tf)
@@ -5447,7 +5626,7 @@ SUNErrCode N_VEnableDotProdMulti_Pthreads(N_Vector v, sunbooleantype tf)
 {
   v->ops->nvdotprodmulti      = tf ? N_VDotProdMulti_Pthreads : NULL;
   v->ops->nvdotprodmultilocal = tf ? N_VDotProdMulti_Pthreads : NULL;
-  return SUN_SUCCESS;
+  return ReproducibleFusedOps_Pthreads(v);
 }
 
 SUNErrCode N_VEnableLinearSumVectorArray_Pthreads(N_Vector v, sunbooleantype tf)
@@ -5471,14 +5650,14 @@ SUNErrCode N_VEnableConstVectorArray_Pthreads(N_Vector v, sunbooleantype tf)
 SUNErrCode N_VEnableWrmsNormVectorArray_Pthreads(N_Vector v, sunbooleantype tf)
 {
   v->ops->nvwrmsnormvectorarray = tf ? N_VWrmsNormVectorArray_Pthreads : NULL;
-  return SUN_SUCCESS;
+  return ReproducibleFusedOps_Pthreads(v);
 }
 
 SUNErrCode N_VEnableWrmsNormMaskVectorArray_Pthreads(N_Vector v, sunbooleantype tf)
 {
   v->ops->nvwrmsnormmaskvectorarray = tf ? N_VWrmsNormMaskVectorArray_Pthreads
                                          : NULL;
-  return SUN_SUCCESS;
+  return ReproducibleFusedOps_Pthreads(v);
 }
 
 SUNErrCode N_VEnableScaleAddMultiVectorArray_Pthreads(N_Vector v,
@@ -5496,3 +5675,68 @@ SUNErrCode N_VEnableLinearCombinationVectorArray_Pthreads(N_Vector v,
     tf ? N_VLinearCombinationVectorArray_Pthreads : NULL;
   return SUN_SUCCESS;
 }
+
+/*
+ * -----------------------------------------------------------------
+ * Enable / Disable reproducible reductions
+ * -----------------------------------------------------------------
+ */
+
+SUNErrCode N_VEnableReproducibleReductions_Pthreads(N_Vector v,
+                                                    sunbooleantype tf)
+{
+  if (tf)
+  {
+    /* use the chunked reductions */
+    v->ops->nvdotprod          = DotProdReproducible_Pthreads;
+    v->ops->nvwrmsnorm         = WrmsNormReproducible_Pthreads;
+    v->ops->nvwrmsnormmask     = WrmsNormMaskReproducible_Pthreads;
+    v->ops->nvwl2norm          = WL2NormReproducible_Pthreads;
+    v->ops->nvl1norm           = L1NormReproducible_Pthreads;
+    v->ops->nvdotprodlocal     = DotProdReproducible_Pthreads;
+    v->ops->nvl1normlocal      = L1NormReproducible_Pthreads;
+    v->ops->nvwsqrsumlocal     = WSqrSumLocalReproducible_Pthreads;
+    v->ops->nvwsqrsummasklocal = WSqrSumMaskLocalReproducible_Pthreads;
+  }
+  else
+  {
+    /* restore the default reductions */
+    v->ops->nvdotprod          = N_VDotProd_Pthreads;
+    v->ops->nvwrmsnorm         = N_VWrmsNorm_Pthreads;
+    v->ops->nvwrmsnormmask     = N_VWrmsNormMask_Pthreads;
+    v->ops->nvwl2norm          = N_VWL2Norm_Pthreads;
+    v->ops->nvl1norm           = N_VL1Norm_Pthreads;
+    v->ops->nvdotprodlocal     = N_VDotProd_Pthreads;
+    v->ops->nvl1normlocal      = N_VL1Norm_Pthreads;
+    v->ops->nvwsqrsumlocal     = N_VWSqrSumLocal_Pthreads;
+    v->ops->nvwsqrsummasklocal = N_VWSqrSumMaskLocal_Pthreads;
+  }
+
+  /* switch the enabled fused reductions to the matching implementation,
+     disabled fused reductions stay disabled */
+  if (v->ops->nvdotprodmulti)
+  {
+    v->ops->nvdotprodmulti = tf ? DotProdMultiReproducible_Pthreads
+                                : N_VDotProdMulti_Pthreads;
+  }
+  if (v->ops->nvdotprodmultilocal)
+  {
+    v->ops->nvdotprodmultilocal = tf ? DotProdMultiReproducible_Pthreads
+                                     : N_VDotProdMulti_Pthreads;
+  }
+  if (v->ops->nvwrmsnormvectorarray)
+  {
+    v->ops->nvwrmsnormvectorarray =
+      tf ? WrmsNormVectorArrayReproducible_Pthreads
+         : N_VWrmsNormVectorArray_Pthreads;
+  }
+  if (v->ops->nvwrmsnormmaskvectorarray)
+  {
+    v->ops->nvwrmsnormmaskvectorarray =
+      tf ? WrmsNormMaskVectorArrayReproducible_Pthreads
+         : N_VWrmsNormMaskVectorArray_Pthreads;
+  }
+
+  /* return success */
+  return SUN_SUCCESS;
+}
@@ -26,12 +26,16 @@
 #include <sundials/sundials_errors.h>
 
 #include "sundials_macros.h"
+#include "sundials_reduction_impl.h"
 
 #define ZERO   SUN_RCONST(0.0)
 #define HALF   SUN_RCONST(0.5)
 #define ONE    SUN_RCONST(1.0)
 #define ONEPT5 SUN_RCONST(1.5)
 
+/* Maximum number of norms accumulated per sweep in N_VWrmsNormVectorArray */
+#define WRMS_BLOCK 4
+
 /* Private functions for special cases of vector operations */
 static void VCopy_Serial(N_Vector x, N_Vector z);             /* z=x       */
 static void VSum_Serial(N_Vector x, N_Vector y, N_Vector z);  /* z=x+y     */
@@ -1230,8 +1234,12 @@ SUNErrCode N_VWrmsNormVectorArray_Serial(int nvec, N_Vector* X, N_Vector* W,
                                          sunrealtype* nrm)
 {
   SUNFunctionBegin(X[0]->sunctx);
-  int i;
+  int i, k, nblk;
   sunindextype j, N;
+  sunbooleantype shared_w;
+  sunrealtype wj;
+  sunrealtype sum[WRMS_BLOCK];
+  sunrealtype* xdb[WRMS_BLOCK];
   sunrealtype* wd = NULL;
   sunrealtype* xd = NULL;
 
@@ -1249,6 +1257,39 @@ SUNErrCode N_VWrmsNormVectorArray_Serial(int nvec, N_Vector* X, N_Vector* W,
   /* get vector length */
   N = NV_LENGTH_S(X[0]);
 
+  /* check if all the norms use the same weight vector */
+  shared_w = SUNTRUE;
+  for (i = 1; i < nvec; i++)
+  {
+    if (W[i] != W[0])
+    {
+      shared_w = SUNFALSE;
+      break;
+    }
+  }
+
+  /* with a shared weight vector, compute blocks of norms in a single sweep */
+  if (shared_w)
+  {
+    wd = NV_DATA_S(W[0]);
+    for (i = 0; i < nvec; i += nblk)
+    {
+      nblk = SUNMIN(WRMS_BLOCK, nvec - i);
+      for (k = 0; k < nblk; k++)
+      {
+        xdb[k] = NV_DATA_S(X[i + k]);
+        sum[k] = ZERO;
+      }
+      for (j = 0; j < N; j++)
+      {
+        wj = wd[j];
+        for (k = 0; k < nblk; k++) { sum[k] += SUNSQR(xdb[k][j] * wj); }
+      }
+      for (k = 0; k < nblk; k++) { nrm[i + k] = SUNRsqrt(sum[k] / N); }
+    }
+    return SUN_SUCCESS;
+  }
+
   /* compute the WRMS norm for each vector in the vector array */
   for (i = 0; i < nvec; i++)
   {
@@ -1936,6 +1977,118 @@ static void VaxpyVectorArray_Serial(int nvec, sunrealtype a, N_Vector* X,
   }
 }
 
+/*
+ * -----------------------------------------------------------------
+ * Reproducible reduction operations
+ * -----------------------------------------------------------------
+ */
+
+static sunrealtype ReduceReproducible_Serial(SUNReduceKernel kernel, N_Vector x,
+                                             N_Vector y, N_Vector id)
+{
+  sunindextype c, N, nchunks;
+  sunrealtype *xd, *yd, *idd;
+  sunrealtype partials[SUN_REDUCE_MAX_CHUNKS];
+
+  N       = NV_LENGTH_S(x);
+  nchunks = sunReduceNumChunks(N);
+  xd      = NV_DATA_S(x);
+  yd      = (y) ? NV_DATA_S(y) : NULL;
+  idd     = (id) ? NV_DATA_S(id) : NULL;
+
+  for (c = 0; c < nchunks; c++)
+  {
+    partials[c] = sunReduceChunk(kernel, xd, yd, idd, N, c);
+  }
+
+  return sunReduceTree(partials, nchunks);
+}
+
+static sunrealtype DotProdReproducible_Serial(N_Vector x, N_Vector y)
+{
+  return ReduceReproducible_Serial(SUN_REDUCE_DOTPROD, x, y, NULL);
+}
+
+static sunrealtype WSqrSumLocalReproducible_Serial(N_Vector x, N_Vector w)
+{
+  return ReduceReproducible_Serial(SUN_REDUCE_WSQRSUM, x, w, NULL);
+}
+
+static sunrealtype WSqrSumMaskLocalReproducible_Serial(N_Vector x, N_Vector w,
+                                                       N_Vector id)
+{
+  return ReduceReproducible_Serial(SUN_REDUCE_WSQRSUMMASK, x, w, id);
+}
+
+static sunrealtype L1NormReproducible_Serial(N_Vector x)
+{
+  return ReduceReproducible_Serial(SUN_REDUCE_L1NORM, x, NULL, NULL);
+}
+
+static sunrealtype WrmsNormReproducible_Serial(N_Vector x, N_Vector w)
+{
+  return SUNRsqrt(WSqrSumLocalReproducible_Serial(x, w) / NV_LENGTH_S(x));
+}
+
+static sunrealtype WrmsNormMaskReproducible_Serial(N_Vector x, N_Vector w,
+                                                   N_Vector id)
+{
+  return SUNRsqrt(WSqrSumMaskLocalReproducible_Serial(x, w, id) /
+                  NV_LENGTH_S(x));
+}
+
+static sunrealtype WL2NormReproducible_Serial(N_Vector x, N_Vector w)
+{
+  return SUNRsqrt(WSqrSumLocalReproducible_Serial(x, w));
+}
+
+static SUNErrCode DotProdMultiReproducible_Serial(int nvec, N_Vector x,
+                                                  N_Vector* Y,
+                                                  sunrealtype* dotprods)
+{
+  int i;
+  for (i = 0; i < nvec; i++)
+  {
+    dotprods[i] = DotProdReproducible_Serial(x, Y[i]);
+  }
+  return SUN_SUCCESS;
+}
+
+static SUNErrCode WrmsNormVectorArrayReproducible_Serial(int nvec,
+                                                         N_Vector* X,
+                                                         N_Vector* W,
+                                                         sunrealtype* nrm)
+{
+  int i;
+  for (i = 0; i < nvec; i++)
+  {
+    nrm[i] = WrmsNormReproducible_Serial(X[i], W[i]);
+  }
+  return SUN_SUCCESS;
+}
+
+static SUNErrCode WrmsNormMaskVectorArrayReproducible_Serial(int nvec,
+                                                             N_Vector* X,
+                                                             N_Vector* W,
+                                                             N_Vector id,
+                                                             sunrealtype* nrm)
+{
+  int i;
+  for (i = 0; i < nvec; i++)
+  {
+    nrm[i] = WrmsNormMaskReproducible_Serial(X[i], W[i], id);
+  }
+  return SUN_SUCCESS;
+}
+
+/* Installs the reproducible fused reductions if v uses the reproducible
+   reductions (called after a fused operation is enabled) */
+static SUNErrCode ReproducibleFusedOps_Serial(N_Vector v)
+{
+  if (v->ops->nvdotprod != DotProdReproducible_Serial) { return SUN_SUCCESS; }
+  return N_VEnableReproducibleReductions_Serial(v, SUNTRUE);
+}
+
 /*
  * -----------------------------------------------------------------
  * Enable / Disable fused and vector array operations
@@ -1980,8 +2133,8 @@ SUNErrCode N_VEnableFusedOps_Serial(N_Vector v, sunbooleantype tf)
     v->ops->nvdotprodmultilocal = NULL;
   }
 
-  /* return success */
-  return SUN_SUCCESS;
+  /* keep the fused reductions reproducible if requested */
+  return ReproducibleFusedOps_Serial(v);
 }
 
 SUNErrCode N_VEnableLinearCombination_Serial(N_Vector v, sunbooleantype tf)
@@ -2000,7 +2153,7 @@ SUNErrCode N_VEnableDotProdMulti_Serial(N_Vector v, sunbooleantype tf)
 {
   v->ops->nvdotprodmulti      = tf ? N_VDotProdMulti_Serial : NULL;
   v->ops->nvdotprodmultilocal = tf ? N_VDotProdMulti_Serial : NULL;
-  return SUN_SUCCESS;
+  return ReproducibleFusedOps_Serial(v);
 }
 
 SUNErrCode N_VEnableLinearSumVectorArray_Serial(N_Vector v, sunbooleantype tf)
@@ -2024,14 +2177,14 @@ SUNErrCode N_VEnableConstVectorArray_Serial(N_Vector v, sunbooleantype tf)
 SUNErrCode N_VEnableWrmsNormVectorArray_Serial(N_Vector v, sunbooleantype tf)
 {
   v->ops->nvwrmsnormvectorarray = tf ? N_VWrmsNormVectorArray_Serial : NULL;
-  return SUN_SUCCESS;
+  return ReproducibleFusedOps_Serial(v);
 }
 
 SUNErrCode N_VEnableWrmsNormMaskVectorArray_Serial(N_Vector v, sunbooleantype tf)
 {
   v->ops->nvwrmsnormmaskvectorarray = tf ? N_VWrmsNormMaskVectorArray_Serial
                                          : NULL;
-  return SUN_SUCCESS;
+  return ReproducibleFusedOps_Serial(v);
 }
 
 SUNErrCode N_VEnableScaleAddMultiVectorArray_Serial(N_Vector v, sunbooleantype tf)
@@ -2048,3 +2201,67 @@ SUNErrCode N_VEnableLinearCombinationVectorArray_Serial(N_Vector v,
     tf ? N_VLinearCombinationVectorArray_Serial : NULL;
   return SUN_SUCCESS;
 }
+
+/*
+ * -----------------------------------------------------------------
+ * Enable / Disable reproducible reductions
+ * -----------------------------------------------------------------
+ */
+
+SUNErrCode N_VEnableReproducibleReductions_Serial(N_Vector v, sunbooleantype tf)
+{
+  if (tf)
+  {
+    /* use the chunked reductions */
+    v->ops->nvdotprod          = DotProdReproducible_Serial;
+    v->ops->nvwrmsnorm         = WrmsNormReproducible_Serial;
+    v->ops->nvwrmsnormmask     = WrmsNormMaskReproducible_Serial;
+    v->ops->nvwl2norm          = WL2NormReproducible_Serial;
+    v->ops->nvl1norm           = L1NormReproducible_Serial;
+    v->ops->nvdotprodlocal     = DotProdReproducible_Serial;
+    v->ops->nvl1normlocal      = L1NormReproducible_Serial;
+    v->ops->nvwsqrsumlocal     = WSqrSumLocalReproducible_Serial;
+    v->ops->nvwsqrsummasklocal = WSqrSumMaskLocalReproducible_Serial;
+  }
+  else
+  {
+    /* restore the default reductions */
+    v->ops->nvdotprod          = N_VDotProd_Serial;
+    v->ops->nvwrmsnorm         = N_VWrmsNorm_Serial;
+    v->ops->nvwrmsnormmask     = N_VWrmsNormMask_Serial;
+    v->ops->nvwl2norm          = N_VWL2Norm_Serial;
+    v->ops->nvl1norm           = N_VL1Norm_Serial;
+    v->ops->nvdotprodlocal     = N_VDotProd_Serial;
+    v->ops->nvl1normlocal      = N_VL1Norm_Serial;
+    v->ops->nvwsqrsumlocal     = N_VWSqrSumLocal_Serial;
+    v->ops->nvwsqrsummasklocal = N_VWSqrSumMaskLocal_Serial;
+  }
+
+  /* switch the enabled fused reductions to the matching implementation,
+     disabled fused reductions stay disabled */
+  if (v->ops->nvdotprodmulti)
+  {
+    v->ops->nvdotprodmulti = tf ? DotProdMultiReproducible_Serial
+                                : N_VDotProdMulti_Serial;
+  }
+  if (v->ops->nvdotprodmultilocal)
+  {
+    v->ops->nvdotprodmultilocal = tf ? DotProdMultiReproducible_Serial
+                                     : N_VDotProdMulti_Serial;
+  }
+  if (v->ops->nvwrmsnormvectorarray)
+  {
+    v->ops->nvwrmsnormvectorarray =
+      tf ? WrmsNormVectorArrayReproducible_Serial
+         : N_VWrmsNormVectorArray_Serial;
+  }
+  if (v->ops->nvwrmsnormmaskvectorarray)
+  {
+    v->ops->nvwrmsnormmaskvectorarray =
+      tf ? WrmsNormMaskVectorArrayReproducible_Serial
+         : N_VWrmsNormMaskVectorArray_Serial;
+  }
+
+  /* return success */
+  return SUN_SUCCESS;
+}
@@ -77,7 +77,7 @@ SUNErrCode SUNAdjointCheckpointScheme_Create_Fixed(
   content->io_mode                    = io_mode;
 
   SUNCheckCall(
-    SUNDataNode_CreateObject(io_mode, estimate, sunctx, &content->root_node));
+    SUNDataNode_CreateIndexed(io_mode, estimate, sunctx, &content->root_node));
 
   check_scheme->content = content;
   *check_scheme_ptr     = check_scheme;
@@ -117,12 +117,10 @@ SUNErrCode SUNAdjointCheckpointScheme_InsertVector_Fixed(
     IMPL_MEMBER(self, step_num_of_current_insert) = step_num;
 
     /* Store the step node in the root node object. */
-    char* key = sunSignedToString(step_num);
-    SUNLogExtraDebug(SUNCTX_->logger, "insert-new-step",
-                     "step_num = %d, key = %s", step_num, key);
-    SUNCheckCall(SUNDataNode_AddNamedChild(IMPL_MEMBER(self, root_node), key,
-                                           step_data_node));
-    free(key);
+    SUNLogExtraDebug(SUNCTX_->logger, "insert-new-step", "step_num = %d",
+                     step_num);
+    SUNCheckCall(SUNDataNode_AddIndexedChild(IMPL_MEMBER(self, root_node),
+                                             step_num, step_data_node));
   }
   else { step_data_node = IMPL_MEMBER(self, current_insert_step_node); }
 
@@ -156,12 +154,10 @@ SUNErrCode SUNAdjointCheckpointScheme_LoadVector_Fixed(
   SUNDataNode step_data_node = NULL;
   if (step_num != IMPL_MEMBER(self, step_num_of_current_load))
   {
-    char* key = sunSignedToString(step_num);
     SUNLogExtraDebug(SUNCTX_->logger, "try-load-new-step",
                      "step_num = %d, stage_num = %d", step_num, stage_num);
-    errcode = SUNDataNode_GetNamedChild(IMPL_MEMBER(self, root_node), key,
-                                        &step_data_node);
-    free(key);
+    errcode = SUNDataNode_GetIndexedChild(IMPL_MEMBER(self, root_node),
+                                          step_num, &step_data_node);
     if (errcode == SUN_SUCCESS)
     {
       IMPL_MEMBER(self, current_load_step_node)   = step_data_node;
@@ -216,11 +212,9 @@ SUNErrCode SUNAdjointCheckpointScheme_LoadVector_Fixed(
     SUNCheckCall(SUNDataNode_HasChildren(step_data_node, &has_children));
     if (!has_children)
     {
-      char* key = sunSignedToString(step_num);
       SUNLogExtraDebug(SUNCTX_->logger, "remove-step", "step_num = %d", step_num);
-      SUNCheckCall(SUNDataNode_RemoveNamedChild(IMPL_MEMBER(self, root_node),
-                                                key, &step_data_node));
-      free(key);
+      SUNCheckCall(SUNDataNode_RemoveIndexedChild(IMPL_MEMBER(self, root_node),
+                                                  step_num, &step_data_node));
       SUNCheckCall(SUNDataNode_Destroy(&step_data_node));
     }
   }
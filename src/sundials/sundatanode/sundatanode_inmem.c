@@ -33,33 +33,41 @@ static SUNDataNode sunDataNode_CreateCommon_InMem(SUNContext sunctx)
   SUNDataNode node;
   SUNCheckCallNull(SUNDataNode_CreateEmpty(sunctx, &node));
 
-  node->ops->haschildren      = SUNDataNode_HasChildren_InMem;
-  node->ops->isleaf           = SUNDataNode_IsLeaf_InMem;
-  node->ops->islist           = SUNDataNode_IsList_InMem;
-  node->ops->isobject         = SUNDataNode_IsObject_InMem;
-  node->ops->addchild         = SUNDataNode_AddChild_InMem;
-  node->ops->addnamedchild    = SUNDataNode_AddNamedChild_InMem;
-  node->ops->getchild         = SUNDataNode_GetChild_InMem;
-  node->ops->getnamedchild    = SUNDataNode_GetNamedChild_InMem;
-  node->ops->removechild      = SUNDataNode_RemoveChild_InMem;
-  node->ops->removenamedchild = SUNDataNode_RemoveNamedChild_InMem;
-  node->ops->getdata          = SUNDataNode_GetData_InMem;
-  node->ops->getdatanvector   = SUNDataNode_GetDataNvector_InMem;
-  node->ops->setdata          = SUNDataNode_SetData_InMem;
-  node->ops->setdatanvector   = SUNDataNode_SetDataNvector_InMem;
-  node->ops->destroy          = SUNDataNode_Destroy_InMem;
+  node->ops->haschildren        = SUNDataNode_HasChildren_InMem;
+  node->ops->isleaf             = SUNDataNode_IsLeaf_InMem;
+  node->ops->islist             = SUNDataNode_IsList_InMem;
+  node->ops->isobject           = SUNDataNode_IsObject_InMem;
+  node->ops->addchild           = SUNDataNode_AddChild_InMem;
+  node->ops->addnamedchild      = SUNDataNode_AddNamedChild_InMem;
+  node->ops->getchild           = SUNDataNode_GetChild_InMem;
+  node->ops->getnamedchild      = SUNDataNode_GetNamedChild_InMem;
+  node->ops->removechild        = SUNDataNode_RemoveChild_InMem;
+  node->ops->removenamedchild   = SUNDataNode_RemoveNamedChild_InMem;
+  node->ops->addindexedchild    = SUNDataNode_AddIndexedChild_InMem;
+  node->ops->getindexedchild    = SUNDataNode_GetIndexedChild_InMem;
+  node->ops->removeindexedchild = SUNDataNode_RemoveIndexedChild_InMem;
+  node->ops->getdata            = SUNDataNode_GetData_InMem;
+  node->ops->getdatanvector     = SUNDataNode_GetDataNvector_InMem;
+  node->ops->setdata            = SUNDataNode_SetData_InMem;
+  node->ops->setdatanvector     = SUNDataNode_SetDataNvector_InMem;
+  node->ops->destroy            = SUNDataNode_Destroy_InMem;
 
   SUNDataNode_InMemContent content =
     (SUNDataNode_InMemContent)malloc(sizeof(*content));
   SUNAssertNull(content, SUN_ERR_MEM_FAIL);
 
-  content->parent             = NULL;
-  content->mem_helper         = NULL;
-  content->leaf_data          = NULL;
-  content->name               = NULL;
-  content->named_children     = NULL;
-  content->num_named_children = 0;
-  content->anon_children      = NULL;
+  content->parent               = NULL;
+  content->mem_helper           = NULL;
+  content->leaf_data            = NULL;
+  content->name                 = NULL;
+  content->named_children       = NULL;
+  content->num_named_children   = 0;
+  content->anon_children        = NULL;
+  content->indexed_keys         = NULL;
+  content->indexed_children     = NULL;
+  content->num_indexed_children = 0;
+  content->indexed_capacity     = 0;
+  content->indexed_hint         = 0;
 
   node->content = (void*)content;
 
@@ -118,6 +126,36 @@ SUNErrCode SUNDataNode_CreateObject_InMem(sundataindex init_size,
   return SUN_SUCCESS;
 }
 
+SUNErrCode SUNDataNode_CreateIndexed_InMem(sundataindex init_size,
+                                           SUNContext sunctx,
+                                           SUNDataNode* node_out)
+{
+  SUNFunctionBegin(sunctx);
+
+  SUNDataNode node = sunDataNode_CreateCommon_InMem(sunctx);
+
+  BASE_MEMBER(node, dtype) = SUNDATANODE_INDEXED;
+
+  if (init_size > 0)
+  {
+    IMPL_MEMBER(node, indexed_keys) =
+      (int64_t*)malloc(init_size * sizeof(int64_t));
+    IMPL_MEMBER(node, indexed_children) =
+      (SUNDataNode*)malloc(init_size * sizeof(SUNDataNode));
+    if (!IMPL_MEMBER(node, indexed_keys) || !IMPL_MEMBER(node, indexed_children))
+    {
+      free(IMPL_MEMBER(node, indexed_keys));
+      free(IMPL_MEMBER(node, indexed_children));
+      sunDataNode_DestroyCommon_InMem(&node);
+      return SUN_ERR_MEM_FAIL;
+    }
+    IMPL_MEMBER(node, indexed_capacity) = init_size;
+  }
+
+  *node_out = node;
+  return SUN_SUCCESS;
+}
+
 SUNErrCode SUNDataNode_CreateLeaf_InMem(SUNMemoryHelper mem_helper,
                                         SUNContext sunctx, SUNDataNode* node_out)
 {
@@ -164,7 +202,8 @@ SUNErrCode SUNDataNode_HasChildren_InMem(const SUNDataNode self,
   *yes_or_no =
     (IMPL_MEMBER(self, anon_children) &&
      SUNStlVector_SUNDataNode_Size(IMPL_MEMBER(self, anon_children)) != 0) ||
-    IMPL_MEMBER(self, num_named_children) != 0;
+    IMPL_MEMBER(self, num_named_children) != 0 ||
+    IMPL_MEMBER(self, num_indexed_children) != 0;
   return SUN_SUCCESS;
 }
 
@@ -299,6 +338,159 @@ SUNErrCode SUNDataNode_RemoveNamedChild_InMem(const SUNDataNode self,
   return SUN_SUCCESS;
 }
 
+/*
+  Returns the position of key in the sorted key array of an indexed node, or
+  the position at which it would be inserted. The positions next to the last
+  access are checked first, so stepping forward or backward through the keys
+  (with or without removing them) does not need the binary search.
+ */
+static sundataindex sunDataNode_SearchIndexed_InMem(const SUNDataNode self,
+                                                    int64_t key)
+{
+  const int64_t* keys = IMPL_MEMBER(self, indexed_keys);
+  sundataindex n      = IMPL_MEMBER(self, num_indexed_children);
+  sundataindex hint   = IMPL_MEMBER(self, indexed_hint);
+  sundataindex lo     = hint > 1 ? hint - 1 : 0;
+  sundataindex hi     = hint + 2 < n ? hint + 2 : n;
+
+  /* Appending a new largest key */
+  if (n == 0 || key > keys[n - 1]) { return n; }
+
+  for (sundataindex i = lo; i <= hi; i++)
+  {
+    if ((i == 0 || keys[i - 1] < key) && (i == n || keys[i] >= key))
+    {
+      return i;
+    }
+  }
+
+  /* Binary search for the first key that is not less than key */
+  lo = 0;
+  hi = n;
+  while (lo < hi)
+  {
+    sundataindex mid = lo + (hi - lo) / 2;
+    if (keys[mid] < key) { lo = mid + 1; }
+    else { hi = mid; }
+  }
+
+  return lo;
+}
+
+SUNErrCode SUNDataNode_AddIndexedChild_InMem(SUNDataNode self, int64_t key,
+                                             SUNDataNode child_node)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  SUNAssert(BASE_MEMBER(self, dtype) == SUNDATANODE_INDEXED,
+            SUN_ERR_ARG_WRONGTYPE);
+
+  sundataindex n   = IMPL_MEMBER(self, num_indexed_children);
+  sundataindex pos = sunDataNode_SearchIndexed_InMem(self, key);
+
+  if (pos < n && IMPL_MEMBER(self, indexed_keys)[pos] == key)
+  {
+    return SUN_ERR_OP_FAIL;
+  }
+
+  if (n == IMPL_MEMBER(self, indexed_capacity))
+  {
+    sundataindex new_capacity = n > 0 ? 2 * n : 1;
+
+    int64_t* keys = (int64_t*)realloc(IMPL_MEMBER(self, indexed_keys),
+                                      new_capacity * sizeof(int64_t));
+    SUNAssert(keys, SUN_ERR_MEM_FAIL);
+    IMPL_MEMBER(self, indexed_keys) = keys;
+
+    SUNDataNode* children =
+      (SUNDataNode*)realloc(IMPL_MEMBER(self, indexed_children),
+                            new_capacity * sizeof(SUNDataNode));
+    SUNAssert(children, SUN_ERR_MEM_FAIL);
+    IMPL_MEMBER(self, indexed_children) = children;
+
+    IMPL_MEMBER(self, indexed_capacity) = new_capacity;
+  }
+
+  int64_t* keys         = IMPL_MEMBER(self, indexed_keys);
+  SUNDataNode* children = IMPL_MEMBER(self, indexed_children);
+
+  /* Shift larger keys up (nothing to do when appending) */
+  if (pos < n)
+  {
+    memmove(&keys[pos + 1], &keys[pos], (n - pos) * sizeof(int64_t));
+    memmove(&children[pos + 1], &children[pos], (n - pos) * sizeof(SUNDataNode));
+  }
+
+  keys[pos]     = key;
+  children[pos] = child_node;
+
+  IMPL_MEMBER(child_node, parent)         = self;
+  IMPL_MEMBER(self, num_indexed_children) = n + 1;
+  IMPL_MEMBER(self, indexed_hint)         = pos;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNDataNode_GetIndexedChild_InMem(const SUNDataNode self,
+                                             int64_t key,
+                                             SUNDataNode* child_node)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  SUNAssert(BASE_MEMBER(self, dtype) == SUNDATANODE_INDEXED,
+            SUN_ERR_ARG_WRONGTYPE);
+
+  *child_node = NULL;
+
+  sundataindex pos = sunDataNode_SearchIndexed_InMem(self, key);
+
+  if (pos == IMPL_MEMBER(self, num_indexed_children) ||
+      IMPL_MEMBER(self, indexed_keys)[pos] != key)
+  {
+    return SUN_ERR_DATANODE_NODENOTFOUND;
+  }
+
+  *child_node                     = IMPL_MEMBER(self, indexed_children)[pos];
+  IMPL_MEMBER(self, indexed_hint) = pos;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNDataNode_RemoveIndexedChild_InMem(SUNDataNode self, int64_t key,
+                                                SUNDataNode* child_node)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  SUNAssert(BASE_MEMBER(self, dtype) == SUNDATANODE_INDEXED,
+            SUN_ERR_ARG_WRONGTYPE);
+
+  *child_node = NULL;
+
+  sundataindex n   = IMPL_MEMBER(self, num_indexed_children);
+  sundataindex pos = sunDataNode_SearchIndexed_InMem(self, key);
+
+  int64_t* keys         = IMPL_MEMBER(self, indexed_keys);
+  SUNDataNode* children = IMPL_MEMBER(self, indexed_children);
+
+  if (pos == n || keys[pos] != key) { return SUN_ERR_DATANODE_NODENOTFOUND; }
+
+  *child_node                      = children[pos];
+  IMPL_MEMBER(*child_node, parent) = NULL;
+
+  /* Shift larger keys down (nothing to do when removing the last key) */
+  if (pos < n - 1)
+  {
+    memmove(&keys[pos], &keys[pos + 1], (n - pos - 1) * sizeof(int64_t));
+    memmove(&children[pos], &children[pos + 1],
+            (n - pos - 1) * sizeof(SUNDataNode));
+  }
+
+  IMPL_MEMBER(self, num_indexed_children) = n - 1;
+  IMPL_MEMBER(self, indexed_hint)         = pos;
+
+  return SUN_SUCCESS;
+}
+
 SUNErrCode SUNDataNode_GetData_InMem(const SUNDataNode self, void** data,
                                      size_t* data_stride, size_t* data_bytes)
 {
@@ -436,6 +628,15 @@ SUNErrCode SUNDataNode_Destroy_InMem(SUNDataNode* node)
   {
     SUNStlVector_SUNDataNode_Destroy(&IMPL_MEMBER(*node, anon_children));
   }
+  else if (BASE_MEMBER(*node, dtype) == SUNDATANODE_INDEXED)
+  {
+    for (sundataindex i = 0; i < IMPL_MEMBER(*node, num_indexed_children); i++)
+    {
+      SUNDataNode_Destroy_InMem(&IMPL_MEMBER(*node, indexed_children)[i]);
+    }
+    free(IMPL_MEMBER(*node, indexed_keys));
+    free(IMPL_MEMBER(*node, indexed_children));
+  }
   else if (BASE_MEMBER(*node, dtype) == SUNDATANODE_LEAF)
   {
     if (IMPL_MEMBER(*node, leaf_data))
@@ -47,6 +47,16 @@ struct SUNDataNode_InMemContent_
 
   // Properties for a List node (nodes that are a collection of anonymous nodes)
   SUNStlVector_SUNDataNode anon_children;
+
+  // Properties for Indexed nodes (nodes that are a collection of nodes keyed
+  // by an integer). The keys are kept sorted in a contiguous array and the
+  // position of the last access is remembered, so monotone sequences of
+  // insertions and lookups (in either direction) are O(1).
+  int64_t* indexed_keys;
+  SUNDataNode* indexed_children;
+  sundataindex num_indexed_children;
+  sundataindex indexed_capacity;
+  sundataindex indexed_hint;
 };
 
 SUNErrCode SUNDataNode_CreateList_InMem(sundataindex init_size,
@@ -56,6 +66,10 @@ SUNErrCode SUNDataNode_CreateObject_InMem(sundataindex init_size,
                                           SUNContext sunctx,
                                           SUNDataNode* node_out);
 
+SUNErrCode SUNDataNode_CreateIndexed_InMem(sundataindex init_size,
+                                           SUNContext sunctx,
+                                           SUNDataNode* node_out);
+
 SUNErrCode SUNDataNode_CreateLeaf_InMem(SUNMemoryHelper mem_helper,
                                         SUNContext sunctx, SUNDataNode* node_out);
 
@@ -91,6 +105,16 @@ SUNErrCode SUNDataNode_RemoveChild_InMem(SUNDataNode self, sundataindex index,
 SUNErrCode SUNDataNode_RemoveNamedChild_InMem(SUNDataNode self, const char* name,
                                               SUNDataNode* child_node);
 
+SUNErrCode SUNDataNode_AddIndexedChild_InMem(SUNDataNode self, int64_t key,
+                                             SUNDataNode child_node);
+
+SUNErrCode SUNDataNode_GetIndexedChild_InMem(const SUNDataNode self,
+                                             int64_t key,
+                                             SUNDataNode* child_node);
+
+SUNErrCode SUNDataNode_RemoveIndexedChild_InMem(SUNDataNode self, int64_t key,
+                                                SUNDataNode* child_node);
+
 SUNErrCode SUNDataNode_GetData_InMem(const SUNDataNode self, void** data,
                                      size_t* data_stride, size_t* data_bytes);
 
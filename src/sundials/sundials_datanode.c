@@ -23,8 +23,9 @@
  *   }
  *
  * Object nodes hold named nodes (children), while list nodes hold
- * anonymous nodes (children). Leaf nodes do not have children, they
- * have values. The SUNDataNode can be used to build all sorts of
+ * anonymous nodes (children). Indexed nodes are objects whose
+ * children are keyed by an integer rather than a name. Leaf nodes do
+ * not have children, they have values. The SUNDataNode can be used to build all sorts of
  * useful things, but we primarily use it as the backbone for
  * checkpointing states in adjoint sensitivity analysis.
  * -----------------------------------------------------------------*/
@@ -54,16 +55,24 @@ SUNErrCode SUNDataNode_CreateEmpty(SUNContext sunctx, SUNDataNode* node_out)
   ops = (SUNDataNode_Ops)malloc(sizeof(*ops));
   SUNAssert(self, SUN_ERR_MEM_FAIL);
 
-  ops->haschildren = NULL;
-  ops->isleaf      = NULL;
-  ops->islist      = NULL;
-  ops->isobject    = NULL;
-  ops->addchild    = NULL;
-  ops->getchild    = NULL;
-  ops->removechild = NULL;
-  ops->getdata     = NULL;
-  ops->setdata     = NULL;
-  ops->destroy     = NULL;
+  ops->haschildren        = NULL;
+  ops->isleaf             = NULL;
+  ops->islist             = NULL;
+  ops->isobject           = NULL;
+  ops->addchild           = NULL;
+  ops->addnamedchild      = NULL;
+  ops->getchild           = NULL;
+  ops->getnamedchild      = NULL;
+  ops->removechild        = NULL;
+  ops->removenamedchild   = NULL;
+  ops->addindexedchild    = NULL;
+  ops->getindexedchild    = NULL;
+  ops->removeindexedchild = NULL;
+  ops->getdata            = NULL;
+  ops->getdatanvector     = NULL;
+  ops->setdata            = NULL;
+  ops->setdatanvector     = NULL;
+  ops->destroy            = NULL;
 
   self->dtype   = 0;
   self->ops     = ops;
@@ -167,6 +176,37 @@ SUNErrCode SUNDataNode_CreateObject(SUNDataIOMode io_mode,
   return err;
 }
 
+/**
+ * :param io_mode: The I/O mode used for storing the data.
+ * :param num_elements: The expected number of elements in the object.
+ * :param sunctx: The SUNContext.
+ * :param node_out: Pointer to the output SUNDataNode.
+ * :return: SUNErrCode indicating success or failure.
+ */
+SUNErrCode SUNDataNode_CreateIndexed(SUNDataIOMode io_mode,
+                                     sundataindex num_elements,
+                                     SUNContext sunctx, SUNDataNode* node_out)
+{
+  SUNFunctionBegin(sunctx);
+
+  SUNDIALS_MARK_FUNCTION_BEGIN(SUNCTX_->profiler);
+
+  SUNErrCode err = SUN_SUCCESS;
+  switch (io_mode)
+  {
+  case (SUNDATAIOMODE_INMEM):
+    err = SUNDataNode_CreateIndexed_InMem(num_elements, sunctx, node_out);
+    break;
+  default: err = SUN_ERR_ARG_OUTOFRANGE;
+  }
+
+  SUNDIALS_MARK_FUNCTION_END(SUNCTX_->profiler);
+
+  SUNCheck(err == SUN_SUCCESS, err);
+
+  return err;
+}
+
 /**
  * :param self: The SUNDataNode.
  * :param yes_or_no: Pointer to the output boolean result.
@@ -377,6 +417,78 @@ SUNErrCode SUNDataNode_RemoveChild(SUNDataNode self, sundataindex index,
   return SUN_ERR_NOT_IMPLEMENTED;
 }
 
+/**
+ * :param self: The SUNDataNode.
+ * :param key: The key of the child.
+ * :param child_node: The child SUNDataNode to add.
+ * :return: SUNErrCode indicating success or failure.
+ */
+SUNErrCode SUNDataNode_AddIndexedChild(SUNDataNode self, int64_t key,
+                                       SUNDataNode child_node)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  SUNDIALS_MARK_FUNCTION_BEGIN(SUNCTX_->profiler);
+
+  if (self->ops->addindexedchild)
+  {
+    SUNErrCode err = self->ops->addindexedchild(self, key, child_node);
+    SUNDIALS_MARK_FUNCTION_END(SUNCTX_->profiler);
+    return err;
+  }
+
+  SUNDIALS_MARK_FUNCTION_END(SUNCTX_->profiler);
+  return SUN_ERR_NOT_IMPLEMENTED;
+}
+
+/**
+ * :param self: The SUNDataNode.
+ * :param key: The key of the child.
+ * :param child_node: Pointer to the output child SUNDataNode.
+ * :return: SUNErrCode indicating success or failure.
+ */
+SUNErrCode SUNDataNode_GetIndexedChild(const SUNDataNode self, int64_t key,
+                                       SUNDataNode* child_node)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  SUNDIALS_MARK_FUNCTION_BEGIN(SUNCTX_->profiler);
+
+  if (self->ops->getindexedchild)
+  {
+    SUNErrCode err = self->ops->getindexedchild(self, key, child_node);
+    SUNDIALS_MARK_FUNCTION_END(SUNCTX_->profiler);
+    return err;
+  }
+
+  SUNDIALS_MARK_FUNCTION_END(SUNCTX_->profiler);
+  return SUN_ERR_NOT_IMPLEMENTED;
+}
+
+/**
+ * :param self: The SUNDataNode.
+ * :param key: The key of the child.
+ * :param child_node: Pointer to the output child SUNDataNode.
+ * :return: SUNErrCode indicating success or failure.
+ */
+SUNErrCode SUNDataNode_RemoveIndexedChild(SUNDataNode self, int64_t key,
+                                          SUNDataNode* child_node)
+{
+  SUNFunctionBegin(self->sunctx);
+
+  SUNDIALS_MARK_FUNCTION_BEGIN(SUNCTX_->profiler);
+
+  if (self->ops->removeindexedchild)
+  {
+    SUNErrCode err = self->ops->removeindexedchild(self, key, child_node);
+    SUNDIALS_MARK_FUNCTION_END(SUNCTX_->profiler);
+    return err;
+  }
+
+  SUNDIALS_MARK_FUNCTION_END(SUNCTX_->profiler);
+  return SUN_ERR_NOT_IMPLEMENTED;
+}
+
 /**
  * :param self: The SUNDataNode.
  * :param data: Pointer to the output data.
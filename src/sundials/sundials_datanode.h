@@ -12,8 +12,8 @@
  * SUNDataNode class definition. A SUNDataNode is a hierarchical
  * object that can hold arbitrary data in arbitrary storage locations.
  * The data may be held directly (a leaf node) or indirectly by
- * holding references to child nodes (list or object nodes). A
- * SUNDataNode maps well to a JSON node.
+ * holding references to child nodes (list, object, or indexed
+ * nodes). A SUNDataNode maps well to a JSON node.
  * ----------------------------------------------------------------*/
 
 #ifndef _SUNDIALS_DATANODE_H
@@ -34,7 +34,8 @@ typedef enum
 {
   SUNDATANODE_LEAF,
   SUNDATANODE_LIST,
-  SUNDATANODE_OBJECT
+  SUNDATANODE_OBJECT,
+  SUNDATANODE_INDEXED
 } SUNDataNodeType;
 
 typedef struct SUNDataNode_Ops_* SUNDataNode_Ops;
@@ -57,6 +58,12 @@ struct SUNDataNode_Ops_
                             SUNDataNode* child_node);
   SUNErrCode (*removenamedchild)(const SUNDataNode, const char* name,
                                  SUNDataNode* child_node);
+  SUNErrCode (*addindexedchild)(SUNDataNode, int64_t key,
+                                SUNDataNode child_node);
+  SUNErrCode (*getindexedchild)(const SUNDataNode, int64_t key,
+                                SUNDataNode* child_node);
+  SUNErrCode (*removeindexedchild)(SUNDataNode, int64_t key,
+                                   SUNDataNode* child_node);
   SUNErrCode (*getdata)(const SUNDataNode, void** data, size_t* data_stride,
                         size_t* data_bytes);
   SUNErrCode (*getdatanvector)(const SUNDataNode, N_Vector v, sunrealtype* t);
@@ -93,6 +100,11 @@ SUNErrCode SUNDataNode_CreateObject(SUNDataIOMode io_mode,
                                     sundataindex num_elements,
                                     SUNContext sunctx, SUNDataNode* node_out);
 
+SUNDIALS_EXPORT
+SUNErrCode SUNDataNode_CreateIndexed(SUNDataIOMode io_mode,
+                                     sundataindex num_elements,
+                                     SUNContext sunctx, SUNDataNode* node_out);
+
 SUNDIALS_EXPORT
 SUNErrCode SUNDataNode_IsLeaf(const SUNDataNode self, sunbooleantype* yes_or_no);
 
@@ -126,6 +138,18 @@ SUNDIALS_EXPORT
 SUNErrCode SUNDataNode_RemoveNamedChild(const SUNDataNode self, const char* name,
                                         SUNDataNode* child_node);
 
+SUNDIALS_EXPORT
+SUNErrCode SUNDataNode_AddIndexedChild(SUNDataNode self, int64_t key,
+                                       SUNDataNode child_node);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNDataNode_GetIndexedChild(const SUNDataNode self, int64_t key,
+                                       SUNDataNode* child_node);
+
+SUNDIALS_EXPORT
+SUNErrCode SUNDataNode_RemoveIndexedChild(SUNDataNode self, int64_t key,
+                                          SUNDataNode* child_node);
+
 SUNDIALS_EXPORT
 SUNErrCode SUNDataNode_GetData(const SUNDataNode self, void** data,
                                size_t* data_stride, size_t* data_bytes);
@@ -11,12 +11,14 @@
  * SPDX-License-Identifier: BSD-3-Clause
  * SUNDIALS Copyright End
  * -----------------------------------------------------------------
- * A simple hashmap implementation for char* keys and
- * void* values. Uses linear probing to resolve collisions.
+ * A simple hashmap implementation for char* (or int64_t) keys and
+ * void* values. Uses open addressing with Robin Hood probing to
+ * resolve collisions and caches the key hashes alongside the slots.
  * The values can be anything, but will be freed by
  * the hash map upon its destruction.
  * -----------------------------------------------------------------*/
 
+#include <inttypes.h>
 #include <limits.h>
 #include <stdint.h>
 #include <stdlib.h>
@@ -46,12 +48,54 @@ static uint64_t fnv1a_hash(const char* str)
   return hash;
 }
 
-static inline int64_t sunHashMapIdxFromKey(SUNHashMap map, const char* key)
+/* Finalizer of the SplitMix64 generator, used to spread integer keys */
+static uint64_t mix64_hash(int64_t key)
 {
-  /* We want the index to be in [0, SUNHashMap_Capacity(map)) */
-  int64_t end = SUNHashMap_Capacity(map) - 1;
-  int64_t idx = end == 0 ? end : (int64_t)(fnv1a_hash(key) % end);
-  return idx;
+  uint64_t hash = (uint64_t)key;
+  hash          = (hash ^ (hash >> 30)) * 0xbf58476d1ce4e5b9U;
+  hash          = (hash ^ (hash >> 27)) * 0x94d049bb133111ebU;
+  return hash ^ (hash >> 31);
+}
+
+/* A cached hash of zero marks an empty slot, so zero is never used as a hash */
+static inline uint64_t sunHashMapNonzero(uint64_t hash)
+{
+  return hash ? hash : 1;
+}
+
+/* The slot a hash would occupy if there were no collisions */
+static inline int64_t sunHashMapHome(SUNHashMap map, uint64_t hash)
+{
+  return (int64_t)(hash % (uint64_t)SUNHashMap_Capacity(map));
+}
+
+/* Distance of the entry in slot idx from its home slot */
+static inline int64_t sunHashMapDist(SUNHashMap map, int64_t idx)
+{
+  int64_t dist = idx - sunHashMapHome(map, map->hashes[idx]);
+  return dist < 0 ? dist + SUNHashMap_Capacity(map) : dist;
+}
+
+static inline SUNHashMapKeyValue* sunHashMapSlot(SUNHashMap map, int64_t idx)
+{
+  return SUNStlVector_SUNHashMapKeyValue_At(map->buckets, idx);
+}
+
+/* Compares a key-value pair to a string key or (skey == NULL) an integer key */
+static inline sunbooleantype sunHashMapKeyEqual(SUNHashMapKeyValue kvp,
+                                                const char* skey, int64_t ikey)
+{
+  if (skey) { return kvp->key && !strcmp(kvp->key, skey); }
+  return !kvp->key && kvp->ikey == ikey;
+}
+
+/*
+  Maximum number of entries before the map is grown. One eighth of the slots
+  are kept empty to keep the probe sequences short, small maps may be filled.
+ */
+static inline int64_t sunHashMapMaxEntries(SUNHashMap map)
+{
+  return SUNHashMap_Capacity(map) - SUNHashMap_Capacity(map) / 8;
 }
 
 /*
@@ -76,13 +120,14 @@ SUNErrCode SUNHashMap_New(int64_t capacity,
   *map = NULL;
   *map = (SUNHashMap)malloc(sizeof(**map));
 
-  if (!map) { return SUN_ERR_MALLOC_FAIL; }
+  if (!(*map)) { return SUN_ERR_MALLOC_FAIL; }
 
   SUNStlVector_SUNHashMapKeyValue buckets =
     SUNStlVector_SUNHashMapKeyValue_New(capacity, destroyKeyValue);
   if (!buckets)
   {
     free(*map);
+    *map = NULL;
     return SUN_ERR_MALLOC_FAIL;
   }
 
@@ -93,7 +138,17 @@ SUNErrCode SUNHashMap_New(int64_t capacity,
     if (err) { return err; };
   }
 
+  (*map)->hashes = (uint64_t*)calloc(capacity, sizeof(uint64_t));
+  if (!(*map)->hashes)
+  {
+    SUNStlVector_SUNHashMapKeyValue_Destroy(&buckets);
+    free(*map);
+    *map = NULL;
+    return SUN_ERR_MALLOC_FAIL;
+  }
+
   (*map)->buckets = buckets;
+  (*map)->size    = 0;
 
   return SUN_SUCCESS;
 }
@@ -112,6 +167,17 @@ int64_t SUNHashMap_Capacity(SUNHashMap map)
   return SUNStlVector_SUNHashMapKeyValue_Capacity(map->buckets);
 }
 
+/*
+  This function returns the number of entries in the hashmap.
+
+  **Arguments:**
+    * ``map`` -- the SUNHashMap object
+
+  **Returns:**
+    * The number of entries in the hashmap
+ */
+int64_t SUNHashMap_Size(SUNHashMap map) { return map->size; }
+
 /*
   This function frees the SUNHashMap object.
 
@@ -124,10 +190,11 @@ int64_t SUNHashMap_Capacity(SUNHashMap map)
  */
 SUNErrCode SUNHashMap_Destroy(SUNHashMap* map)
 {
-  if (map == NULL) { return SUN_SUCCESS; }
+  if (map == NULL || *map == NULL) { return SUN_SUCCESS; }
 
   SUNErrCode err = SUNStlVector_SUNHashMapKeyValue_Destroy(&(*map)->buckets);
   if (err) { return err; }
+  free((*map)->hashes);
   free(*map);
   *map = NULL;
 
@@ -173,12 +240,65 @@ int64_t SUNHashMap_Iterate(SUNHashMap map, int64_t start,
   return SUNHashMap_Capacity(map);
 }
 
-static int64_t sunHashMapLinearProbeInsert(int64_t idx, SUNHashMapKeyValue kv,
-                                           SUNDIALS_MAYBE_UNUSED const void* ctx)
+/*
+  Returns the slot holding the key or SUNHASHMAP_KEYNOTFOUND. The probe walks
+  the cached hashes and only compares keys when the hashes match. Since Robin
+  Hood insertion keeps the entries ordered by their distance from home, the
+  search stops at the first entry closer to its home than the key would be.
+ */
+static int64_t sunHashMapFind(SUNHashMap map, uint64_t hash, const char* skey,
+                              int64_t ikey)
+{
+  int64_t capacity = SUNHashMap_Capacity(map);
+  int64_t idx      = sunHashMapHome(map, hash);
+
+  for (int64_t dist = 0; dist < capacity; dist++)
+  {
+    if (!map->hashes[idx] || sunHashMapDist(map, idx) < dist) { break; }
+    if (map->hashes[idx] == hash &&
+        sunHashMapKeyEqual(*sunHashMapSlot(map, idx), skey, ikey))
+    {
+      return idx;
+    }
+    if (++idx == capacity) { idx = 0; }
+  }
+
+  return SUNHASHMAP_KEYNOTFOUND;
+}
+
+/*
+  Places an entry known not to be in the map. An entry that is further from
+  its home than the occupant of a slot takes the slot, and the occupant moves
+  on (Robin Hood hashing). Requires at least one empty slot.
+ */
+static void sunHashMapPlace(SUNHashMap map, uint64_t hash,
+                            SUNHashMapKeyValue kvp)
 {
-  /* find the next open spot */
-  if (kv == NULL) { return (idx); /* open spot found at idx */ }
-  return SUNHASHMAP_ERROR; /* keep looking */
+  int64_t capacity = SUNHashMap_Capacity(map);
+  int64_t idx      = sunHashMapHome(map, hash);
+  int64_t dist     = 0;
+
+  while (map->hashes[idx])
+  {
+    int64_t occupant_dist = sunHashMapDist(map, idx);
+    if (occupant_dist < dist)
+    {
+      SUNHashMapKeyValue* slot   = sunHashMapSlot(map, idx);
+      SUNHashMapKeyValue tmp_kvp = *slot;
+      uint64_t tmp_hash          = map->hashes[idx];
+      *slot                      = kvp;
+      map->hashes[idx]           = hash;
+      kvp                        = tmp_kvp;
+      hash                       = tmp_hash;
+      dist                       = occupant_dist;
+    }
+    if (++idx == capacity) { idx = 0; }
+    dist++;
+  }
+
+  *sunHashMapSlot(map, idx) = kvp;
+  map->hashes[idx]          = hash;
+  map->size++;
 }
 
 static SUNErrCode sunHashMapResize(SUNHashMap map)
@@ -190,36 +310,109 @@ static SUNErrCode sunHashMapResize(SUNHashMap map)
                                              SUNSTLVECTOR_GROWTH_FACTOR));
 
   SUNStlVector_SUNHashMapKeyValue old_buckets = map->buckets;
-  map->buckets = SUNStlVector_SUNHashMapKeyValue_New(new_capacity,
-                                                     map->buckets->destroyValue);
+  uint64_t* old_hashes                        = map->hashes;
+
+  SUNStlVector_SUNHashMapKeyValue new_buckets =
+    SUNStlVector_SUNHashMapKeyValue_New(new_capacity, old_buckets->destroyValue);
+  if (!new_buckets) { return SUN_ERR_MALLOC_FAIL; }
+
+  uint64_t* new_hashes = (uint64_t*)calloc(new_capacity, sizeof(uint64_t));
+  if (!new_hashes)
+  {
+    SUNStlVector_SUNHashMapKeyValue_Destroy(&new_buckets);
+    return SUN_ERR_MALLOC_FAIL;
+  }
 
   /* Set all buckets to NULL */
   for (int64_t i = 0; i < new_capacity; i++)
   {
-    SUNErrCode err = SUNStlVector_SUNHashMapKeyValue_PushBack(map->buckets, NULL);
+    SUNErrCode err = SUNStlVector_SUNHashMapKeyValue_PushBack(new_buckets, NULL);
     if (err) { return err; }
   }
 
-  /* Rehash and reinsert */
+  map->buckets = new_buckets;
+  map->hashes  = new_hashes;
+  map->size    = 0;
+
+  /* Move the key-value pairs using the cached hashes, keys are not rehashed */
   for (int64_t i = old_capacity - 1; i >= 0; i--)
   {
     SUNHashMapKeyValue kvp = *SUNStlVector_SUNHashMapKeyValue_At(old_buckets, i);
-    if (kvp)
-    {
-      SUNHashMap_Insert(map, kvp->key, kvp->value);
-      free(kvp->key);
-      free(kvp);
-    }
+    if (kvp) { sunHashMapPlace(map, old_hashes[i], kvp); }
     SUNErrCode err = SUNStlVector_SUNHashMapKeyValue_PopBack(old_buckets);
     if (err) { return err; }
   }
 
+  free(old_hashes);
   return SUNStlVector_SUNHashMapKeyValue_Destroy(&old_buckets);
 }
 
+static int64_t sunHashMapInsert(SUNHashMap map, uint64_t hash, const char* skey,
+                                int64_t ikey, void* value)
+{
+  if (sunHashMapFind(map, hash, skey, ikey) >= 0)
+  {
+    return SUNHASHMAP_DUPLICATE;
+  }
+
+  /* Grow the map if it is too full */
+  if (map->size + 1 > sunHashMapMaxEntries(map))
+  {
+    SUNErrCode err = sunHashMapResize(map);
+    if (err) { return err; }
+  }
+
+  /* Create the key-value pair */
+  SUNHashMapKeyValue kvp = (SUNHashMapKeyValue)malloc(sizeof(*kvp));
+  if (!kvp) { return SUNHASHMAP_ERROR; }
+
+  kvp->key   = NULL;
+  kvp->ikey  = ikey;
+  kvp->value = value;
+
+  if (skey)
+  {
+    /* Copy the original_key so that the hashmap owns it */
+    size_t len = strlen(skey) + 1;
+    kvp->key   = malloc(sizeof(*skey) * len);
+    if (!kvp->key)
+    {
+      free(kvp);
+      return SUNHASHMAP_ERROR;
+    }
+    strcpy(kvp->key, skey);
+  }
+
+  sunHashMapPlace(map, hash, kvp);
+
+  return 0;
+}
+
+/*
+  Removes the entry in slot idx. The following entries of the probe sequence
+  are shifted back one slot, so no tombstones are needed.
+ */
+static void sunHashMapErase(SUNHashMap map, int64_t idx)
+{
+  int64_t capacity = SUNHashMap_Capacity(map);
+  int64_t next     = idx + 1 == capacity ? 0 : idx + 1;
+
+  while (map->hashes[next] && sunHashMapDist(map, next) > 0)
+  {
+    *sunHashMapSlot(map, idx) = *sunHashMapSlot(map, next);
+    map->hashes[idx]          = map->hashes[next];
+    idx                       = next;
+    if (++next == capacity) { next = 0; }
+  }
+
+  *sunHashMapSlot(map, idx) = NULL;
+  map->hashes[idx]          = 0;
+  map->size--;
+}
+
 /*
   This function creates a key-value pair and attempts to insert it into the map.
-  Will use linear probing if there is a collision.
+  Collisions are resolved with Robin Hood probing.
 
   **Arguments:**
     * ``map`` -- the ``SUNHashMap`` object to operate on
@@ -233,75 +426,22 @@ static SUNErrCode sunHashMapResize(SUNHashMap map)
  */
 int64_t SUNHashMap_Insert(SUNHashMap map, const char* key, void* value)
 {
-  int64_t idx;
-  int64_t retval;
-  SUNHashMapKeyValue kvp;
-
   if (map == NULL || key == NULL || value == NULL) { return SUNHASHMAP_ERROR; }
 
-  idx = sunHashMapIdxFromKey(map, key);
-
-  /* Check if the bucket is already filled (i.e., we might have had a collision) */
-  kvp = *SUNStlVector_SUNHashMapKeyValue_At(map->buckets, idx);
-  if (kvp != NULL)
-  {
-    /* Determine if key is actually a duplicate (not allowed) */
-    if (!strcmp(key, kvp->key)) { return SUNHASHMAP_DUPLICATE; }
-
-    /* OK, it was a real collision, so find the next open spot */
-    retval = SUNHashMap_Iterate(map, idx + 1, sunHashMapLinearProbeInsert, NULL);
-    if (retval == SUNHASHMAP_ERROR)
-    {
-      /* an error occurred */
-      return retval;
-    }
-    else if (retval == SUNHashMap_Capacity(map))
-    {
-      /* the map is out of empty buckets, so we grow it */
-      SUNErrCode err = sunHashMapResize(map);
-      if (err) { return err; }
-      return SUNHashMap_Insert(map, key, value);
-    }
-
-    idx = retval;
-  }
-
-  /* Create the key-value pair */
-  kvp = (SUNHashMapKeyValue)malloc(sizeof(*kvp));
-
-  /* Copy the original_key so that the hashmap owns it */
-  size_t len     = strlen(key) + 1;
-  char* key_copy = malloc(sizeof(*key) * len);
-  if (!key_copy)
-  {
-    free(kvp);
-    return SUNHASHMAP_ERROR;
-  }
-  strcpy(key_copy, key);
-
-  kvp->key   = key_copy;
-  kvp->value = value;
-
-  /* Insert the key-value pair */
-  return SUNStlVector_SUNHashMapKeyValue_Set(map->buckets, idx, kvp);
+  return sunHashMapInsert(map, sunHashMapNonzero(fnv1a_hash(key)), key, 0,
+                          value);
 }
 
-static int64_t sunHashMapLinearProbeGet(int64_t idx, SUNHashMapKeyValue kv,
-                                        const void* key)
+/*
+  This function is the same as SUNHashMap_Insert but with an integer key.
+  Integer keys are distinct from all string keys.
+ */
+int64_t SUNHashMap_InsertInt(SUNHashMap map, int64_t key, void* value)
 {
-  /* target key cannot be NULL */
-  if (key == NULL) { return SUNHASHMAP_KEYNOTFOUND; }
+  if (map == NULL || value == NULL) { return SUNHASHMAP_ERROR; }
 
-  /* find the matching entry */
-  if (kv == NULL)
-  {
-    return SUNHASHMAP_ERROR; /* keep looking since this bucket is empty */
-  }
-  if (!strcmp(kv->key, (const char*)key))
-  {
-    return (idx); /* found it at idx */
-  }
-  return SUNHASHMAP_ERROR; /* keep looking */
+  return sunHashMapInsert(map, sunHashMapNonzero(mix64_hash(key)), NULL, key,
+                          value);
 }
 
 /*
@@ -319,37 +459,29 @@ static int64_t sunHashMapLinearProbeGet(int64_t idx, SUNHashMapKeyValue kv,
  */
 int64_t SUNHashMap_GetValue(SUNHashMap map, const char* key, void** value)
 {
-  int64_t idx;
-  int64_t retval;
-  sunbooleantype collision;
-
   if (map == NULL || key == NULL || value == NULL) { return SUNHASHMAP_ERROR; }
 
-  idx = sunHashMapIdxFromKey(map, key);
+  int64_t idx = sunHashMapFind(map, sunHashMapNonzero(fnv1a_hash(key)), key, 0);
+  if (idx < 0) { return SUNHASHMAP_KEYNOTFOUND; }
 
-  SUNHashMapKeyValue kvp = *SUNStlVector_SUNHashMapKeyValue_At(map->buckets, idx);
+  /* Return a reference to the value only */
+  *value = (*sunHashMapSlot(map, idx))->value;
 
-  /* Check for a collision (NULL kvp means there was a collision at one point, but
-     the colliding key has since been removed)*/
-  collision = kvp ? strcmp(kvp->key, key) : SUNTRUE;
+  return (0);
+}
 
-  /* Resolve a collision via linear probing */
-  if (collision)
-  {
-    retval = SUNHashMap_Iterate(map, idx + 1, sunHashMapLinearProbeGet, key);
-    if (retval == SUNHASHMAP_ERROR)
-    {
-      /* the key was either not found anywhere or an error occurred */
-      return retval;
-    }
-    else { idx = retval; }
-  }
+/*
+  This function is the same as SUNHashMap_GetValue but with an integer key.
+ */
+int64_t SUNHashMap_GetValueInt(SUNHashMap map, int64_t key, void** value)
+{
+  if (map == NULL || value == NULL) { return SUNHASHMAP_ERROR; }
 
-  /* Return a reference to the value only */
-  SUNHashMapKeyValue* kvp_ptr = SUNStlVector_SUNHashMapKeyValue_At(map->buckets,
-                                                                   idx);
-  if (kvp_ptr) { *value = (*kvp_ptr)->value; }
-  else { return SUNHASHMAP_KEYNOTFOUND; }
+  int64_t idx = sunHashMapFind(map, sunHashMapNonzero(mix64_hash(key)), NULL,
+                               key);
+  if (idx < 0) { return SUNHASHMAP_KEYNOTFOUND; }
+
+  *value = (*sunHashMapSlot(map, idx))->value;
 
   return (0);
 }
@@ -369,44 +501,42 @@ int64_t SUNHashMap_GetValue(SUNHashMap map, const char* key, void** value)
  */
 int64_t SUNHashMap_Remove(SUNHashMap map, const char* key, void** value)
 {
-  int64_t idx;
-  int64_t retval;
-  sunbooleantype collision;
+  if (map == NULL || key == NULL || value == NULL) { return SUNHASHMAP_ERROR; }
 
-  if (map == NULL || key == NULL) { return SUNHASHMAP_ERROR; }
+  int64_t idx = sunHashMapFind(map, sunHashMapNonzero(fnv1a_hash(key)), key, 0);
+  if (idx < 0) { return SUNHASHMAP_KEYNOTFOUND; }
 
-  idx = sunHashMapIdxFromKey(map, key);
+  /* Return a reference to the value only */
+  SUNHashMapKeyValue kvp = *sunHashMapSlot(map, idx);
+  *value                 = kvp->value;
 
-  SUNHashMapKeyValue kvp = *SUNStlVector_SUNHashMapKeyValue_At(map->buckets, idx);
+  /* Since we are returning the value only, we must free the key and the kvp itself. */
+  free(kvp->key);
+  free(kvp);
 
-  /* Check for a collision (NULL kvp means there was a collision at one point, but
-     the colliding key has since been removed)*/
-  collision = kvp ? strcmp(kvp->key, key) : SUNTRUE;
+  sunHashMapErase(map, idx);
 
-  /* Check to see if this is a collision */
-  if (collision)
-  {
-    /* Keys did not match, so we have a collision and need to probe */
-    retval = SUNHashMap_Iterate(map, idx + 1, sunHashMapLinearProbeGet,
-                                (const void*)key);
-    if (retval == SUNHASHMAP_ERROR)
-    {
-      /* an error occurred or the key was not found anywhere */
-      return retval;
-    }
-    else { idx = retval; }
-  }
+  return (0);
+}
 
-  /* Return a reference to the value only */
-  kvp    = *SUNStlVector_SUNHashMapKeyValue_At(map->buckets, idx);
-  *value = kvp->value;
+/*
+  This function is the same as SUNHashMap_Remove but with an integer key.
+ */
+int64_t SUNHashMap_RemoveInt(SUNHashMap map, int64_t key, void** value)
+{
+  if (map == NULL || value == NULL) { return SUNHASHMAP_ERROR; }
 
-  /* Since we are returning the value only, we must free the key and the kvp itself. */
-  free(kvp->key);
+  int64_t idx = sunHashMapFind(map, sunHashMapNonzero(mix64_hash(key)), NULL,
+                               key);
+  if (idx < 0) { return SUNHASHMAP_KEYNOTFOUND; }
+
+  SUNHashMapKeyValue kvp = *sunHashMapSlot(map, idx);
+  *value                 = kvp->value;
   free(kvp);
 
-  /* Clear the bucket by setting it to NULL */
-  return SUNStlVector_SUNHashMapKeyValue_Set(map->buckets, idx, NULL);
+  sunHashMapErase(map, idx);
+
+  return (0);
 }
 
 /*
@@ -484,7 +614,8 @@ SUNErrCode SUNHashMap_PrintKeys(SUNHashMap map, FILE* file)
   for (int64_t i = 0; i < SUNHashMap_Capacity(map); i++)
   {
     SUNHashMapKeyValue kvp = *SUNStlVector_SUNHashMapKeyValue_At(map->buckets, i);
-    if (kvp) { fprintf(file, "%s, ", kvp->key); }
+    if (kvp && kvp->key) { fprintf(file, "%s, ", kvp->key); }
+    else if (kvp) { fprintf(file, "%" PRId64 ", ", kvp->ikey); }
   }
   fprintf(file, "]\n");
 
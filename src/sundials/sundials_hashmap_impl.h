@@ -11,8 +11,9 @@
  * SPDX-License-Identifier: BSD-3-Clause
  * SUNDIALS Copyright End
  * -----------------------------------------------------------------
- * A simple hashmap implementation for char* keys and
- * void* values. Uses linear probing to resolve collisions.
+ * A simple hashmap implementation for char* (or int64_t) keys and
+ * void* values. Uses open addressing with Robin Hood probing to
+ * resolve collisions and caches the key hashes alongside the slots.
  * The values can be anything, but will be freed by
  * the hash map upon its destruction.
  * -----------------------------------------------------------------*/
@@ -35,7 +36,8 @@ typedef struct SUNHashMapKeyValue_* SUNHashMapKeyValue;
 
 struct SUNHashMapKeyValue_
 {
-  char* key;
+  char* key;    /* string key, NULL for an integer key */
+  int64_t ikey; /* integer key, unused for a string key */
   void* value;
 };
 
@@ -49,6 +51,8 @@ struct SUNHashMap_
 {
   SUNErrCode (*destroyKeyValue)(SUNHashMapKeyValue*);
   SUNStlVector_SUNHashMapKeyValue buckets;
+  uint64_t* hashes; /* cached hash of the key in each bucket, 0 if empty */
+  int64_t size;     /* number of entries in the map */
 };
 
 SUNErrCode SUNHashMap_New(int64_t capacity,
@@ -57,6 +61,8 @@ SUNErrCode SUNHashMap_New(int64_t capacity,
 
 int64_t SUNHashMap_Capacity(SUNHashMap map);
 
+int64_t SUNHashMap_Size(SUNHashMap map);
+
 SUNErrCode SUNHashMap_Destroy(SUNHashMap* map);
 
 int64_t SUNHashMap_Iterate(SUNHashMap map, int64_t start,
@@ -66,10 +72,16 @@ int64_t SUNHashMap_Iterate(SUNHashMap map, int64_t start,
 
 int64_t SUNHashMap_Insert(SUNHashMap map, const char* key, void* value);
 
+int64_t SUNHashMap_InsertInt(SUNHashMap map, int64_t key, void* value);
+
 int64_t SUNHashMap_GetValue(SUNHashMap map, const char* key, void** value);
 
+int64_t SUNHashMap_GetValueInt(SUNHashMap map, int64_t key, void** value);
+
 int64_t SUNHashMap_Remove(SUNHashMap map, const char* key, void** value);
 
+int64_t SUNHashMap_RemoveInt(SUNHashMap map, int64_t key, void** value);
+
 SUNErrCode SUNHashMap_Sort(SUNHashMap map, SUNHashMapKeyValue** sorted,
                            int (*compar)(const void*, const void*));
 
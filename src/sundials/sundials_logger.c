@@ -37,6 +37,23 @@
 /* default number of files that we allocate space for */
 #define SUN_DEFAULT_LOGFILE_HANDLES_ 8
 
+/* binary backend: buffer size, initial string table size, and record limits */
+#define SUN_BINLOG_BUFFER_SIZE_    (1 << 20)
+#define SUN_BINLOG_STRING_HANDLES_ 64
+#define SUN_BINLOG_MAX_ARGS_       32
+#define SUN_BINLOG_MAX_ARG_STRLEN_ 255
+#define SUN_BINLOG_MAX_STRLEN_     4095
+#define SUN_BINLOG_VERSION_        1
+
+/* binary backend record kinds and argument tags */
+#define SUN_BINLOG_STRING_   1
+#define SUN_BINLOG_MESSAGE_  2
+#define SUN_BINLOG_INT_      'i'
+#define SUN_BINLOG_UINT_     'u'
+#define SUN_BINLOG_REAL_     'f'
+#define SUN_BINLOG_STR_      's'
+#define SUN_BINLOG_POINTER_  'p'
+
 void sunCreateLogMessage(SUNLogLevel lvl, int rank, const char* scope,
                          const char* label, const char* txt, va_list args,
                          char** log_msg)
@@ -134,6 +151,506 @@ static SUNErrCode sunLoggerFreeKeyValue(SUNHashMapKeyValue* kv_ptr)
   return SUN_SUCCESS;
 }
 
+#if SUNDIALS_LOGGING_LEVEL > 0
+/* Default flush: flush the text output files */
+static SUNErrCode sunLoggerFlushFiles(SUNLogger logger, SUNLogLevel lvl)
+{
+  SUNErrCode retval = SUN_SUCCESS;
+
+  if (sunLoggerIsOutputRank(logger, NULL))
+  {
+    switch (lvl)
+    {
+    case (SUN_LOGLEVEL_DEBUG):
+      if (logger->debug_fp) { fflush(logger->debug_fp); }
+      break;
+    case (SUN_LOGLEVEL_WARNING):
+      if (logger->warning_fp) { fflush(logger->warning_fp); }
+      break;
+    case (SUN_LOGLEVEL_INFO):
+      if (logger->info_fp) { fflush(logger->info_fp); }
+      break;
+    case (SUN_LOGLEVEL_ERROR):
+      if (logger->error_fp) { fflush(logger->error_fp); }
+      break;
+    case (SUN_LOGLEVEL_ALL):
+      if (logger->debug_fp) { fflush(logger->debug_fp); }
+      if (logger->warning_fp) { fflush(logger->warning_fp); }
+      if (logger->info_fp) { fflush(logger->info_fp); }
+      if (logger->error_fp) { fflush(logger->error_fp); }
+      break;
+    default: retval = SUN_ERR_UNREACHABLE;
+    }
+  }
+
+  return retval;
+}
+
+/* Default queuemsg: format the message and write it to the text output file
+   for its level */
+static SUNErrCode sunLoggerWriteMsg(SUNLogger logger, SUNLogLevel lvl,
+                                    const char* scope, const char* label,
+                                    const char* msg_txt, va_list args)
+{
+  SUNErrCode retval = SUN_SUCCESS;
+  int rank          = 0;
+
+  if (sunLoggerIsOutputRank(logger, &rank))
+  {
+    char* log_msg = NULL;
+    sunCreateLogMessage(lvl, rank, scope, label, msg_txt, args, &log_msg);
+
+    switch (lvl)
+    {
+    case (SUN_LOGLEVEL_DEBUG):
+      if (logger->debug_fp) { fprintf(logger->debug_fp, "%s", log_msg); }
+      break;
+    case (SUN_LOGLEVEL_WARNING):
+      if (logger->warning_fp) { fprintf(logger->warning_fp, "%s", log_msg); }
+      break;
+    case (SUN_LOGLEVEL_INFO):
+      if (logger->info_fp) { fprintf(logger->info_fp, "%s", log_msg); }
+      break;
+    case (SUN_LOGLEVEL_ERROR):
+      if (logger->error_fp) { fprintf(logger->error_fp, "%s", log_msg); }
+      break;
+    default: retval = SUN_ERR_UNREACHABLE;
+    }
+
+    free(log_msg);
+  }
+
+  return retval;
+}
+#endif
+
+/* Default destroy: close the text output files and free the logger */
+static void sunLoggerFree(SUNLogger logger)
+{
+  if (sunLoggerIsOutputRank(logger, NULL))
+  {
+    SUNHashMap_Destroy(&logger->filenames);
+  }
+
+#if SUNDIALS_MPI_ENABLED
+  if (logger->comm != SUN_COMM_NULL) { MPI_Comm_free(&logger->comm); }
+#endif
+
+  free(logger);
+}
+
+/*
+ * -----------------------------------------------------------------
+ * Binary logging backend
+ *
+ * Instead of formatting each message, the binary backend appends a
+ * record containing a timestamp, the level, the rank, the ids of the
+ * scope, label, and format strings, and the raw format arguments to
+ * an in-memory buffer. The buffer is written to the file when it is
+ * full, when the logger is flushed, and when it is destroyed. The
+ * first time a string is seen, a record defining its id is written
+ * before the message that uses it. See tools/suntools/logs.py for a
+ * decoder.
+ * -----------------------------------------------------------------
+ */
+
+#if SUNDIALS_LOGGING_LEVEL > 0
+
+struct SUNLoggerBinaryContent_
+{
+  FILE* fp;           /* binary output file            */
+  char* buffer;       /* records not yet written to fp */
+  size_t used;        /* bytes used in the buffer      */
+  SUNHashMap strings; /* string to id map              */
+  uint32_t nstrings;  /* number of ids assigned        */
+  double t0;          /* time the backend was started  */
+
+  /* content and operations replaced by the backend, restored on close */
+  void* content;
+  SUNErrCode (*queuemsg)(SUNLogger logger, SUNLogLevel lvl, const char* scope,
+                         const char* label, const char* msg_txt, va_list args);
+  SUNErrCode (*flush)(SUNLogger logger, SUNLogLevel lvl);
+  SUNErrCode (*destroy)(SUNLogger* logger);
+};
+
+typedef struct SUNLoggerBinaryContent_* SUNLoggerBinaryContent;
+
+#define SUN_BINLOG_CONTENT_(logger) ((SUNLoggerBinaryContent)(logger)->content)
+
+static SUNErrCode sunBinLogFreeKeyValue(SUNHashMapKeyValue* kv_ptr)
+{
+  /* the value is the string id, not a pointer */
+  if (!kv_ptr || !(*kv_ptr)) { return SUN_SUCCESS; }
+  free((*kv_ptr)->key);
+  free(*kv_ptr);
+  return SUN_SUCCESS;
+}
+
+static void sunBinLogPut(SUNLoggerBinaryContent content, const void* data,
+                         size_t size)
+{
+  memcpy(content->buffer + content->used, data, size);
+  content->used += size;
+}
+
+/* Writes the buffered records to the file, returns an error if any of them
+   could not be written */
+static SUNErrCode sunBinLogDrain(SUNLoggerBinaryContent content)
+{
+  if (content->used > 0)
+  {
+    size_t nwritten = fwrite(content->buffer, 1, content->used, content->fp);
+    size_t nbuffer  = content->used;
+    content->used   = 0;
+    if (nwritten != nbuffer) { return SUN_ERR_OP_FAIL; }
+  }
+  return SUN_SUCCESS;
+}
+
+/* Gets the id of str, assigning one (and buffering a record that defines it)
+   the first time str is seen. The map stores id + 1 since it does not accept
+   NULL values. */
+static SUNErrCode sunBinLogStringId(SUNLoggerBinaryContent content,
+                                    const char* str, uint32_t* id)
+{
+  void* value = NULL;
+  uint32_t len;
+  uint8_t kind = SUN_BINLOG_STRING_;
+
+  if (!str) { str = ""; }
+
+  if (!SUNHashMap_GetValue(content->strings, str, &value))
+  {
+    *id = (uint32_t)((uintptr_t)value - 1);
+    return SUN_SUCCESS;
+  }
+
+  *id   = content->nstrings;
+  value = (void*)((uintptr_t)(*id) + 1);
+  if (SUNHashMap_Insert(content->strings, str, value) < 0)
+  {
+    return SUN_ERR_MALLOC_FAIL;
+  }
+  content->nstrings++;
+
+  len = (uint32_t)strlen(str);
+  if (len > SUN_BINLOG_MAX_STRLEN_) { len = SUN_BINLOG_MAX_STRLEN_; }
+
+  sunBinLogPut(content, &kind, sizeof(kind));
+  sunBinLogPut(content, id, sizeof(*id));
+  sunBinLogPut(content, &len, sizeof(len));
+  sunBinLogPut(content, str, len);
+
+  return SUN_SUCCESS;
+}
+
+/* Buffers the arguments for the conversions in fmt and returns the number of
+   arguments stored. Integers are widened to 64 bits and floating point values
+   are stored as doubles. */
+static uint8_t sunBinLogPutArgs(SUNLoggerBinaryContent content,
+                                const char* fmt, va_list args)
+{
+  uint8_t nargs = 0;
+  uint8_t tag;
+  const char* c;
+
+  for (c = fmt; *c && nargs < SUN_BINLOG_MAX_ARGS_; c++)
+  {
+    int lng  = 0; /* number of 'l' modifiers */
+    int dbl  = 0; /* 'L' modifier            */
+    int wide = 0; /* 'z', 't', or 'j'        */
+
+    if (*c != '%') { continue; }
+    c++;
+    if (*c == '%') { continue; }
+
+    /* flags */
+    while (*c && strchr("-+ #0'", *c)) { c++; }
+
+    /* width and precision, '*' consumes an int argument */
+    while (*c && (strchr("0123456789.", *c) || *c == '*'))
+    {
+      if (*c == '*' && nargs < SUN_BINLOG_MAX_ARGS_)
+      {
+        int64_t ival = va_arg(args, int);
+        tag          = SUN_BINLOG_INT_;
+        sunBinLogPut(content, &tag, sizeof(tag));
+        sunBinLogPut(content, &ival, sizeof(ival));
+        nargs++;
+      }
+      c++;
+    }
+
+    /* length modifiers */
+    while (*c && strchr("hlLqjzt", *c))
+    {
+      if (*c == 'l') { lng++; }
+      else if (*c == 'q') { lng = 2; }
+      else if (*c == 'L') { dbl = 1; }
+      else if (*c != 'h') { wide = 1; }
+      c++;
+    }
+
+    switch (*c)
+    {
+    case 'd':
+    case 'i':
+    {
+      int64_t ival;
+      if (wide) { ival = (int64_t)va_arg(args, ptrdiff_t); }
+      else if (lng > 1) { ival = (int64_t)va_arg(args, long long); }
+      else if (lng) { ival = (int64_t)va_arg(args, long); }
+      else { ival = (int64_t)va_arg(args, int); }
+      tag = SUN_BINLOG_INT_;
+      sunBinLogPut(content, &tag, sizeof(tag));
+      sunBinLogPut(content, &ival, sizeof(ival));
+      nargs++;
+      break;
+    }
+    case 'u':
+    case 'o':
+    case 'x':
+    case 'X':
+    case 'c':
+    {
+      uint64_t uval;
+      if (wide) { uval = (uint64_t)va_arg(args, size_t); }
+      else if (lng > 1) { uval = (uint64_t)va_arg(args, unsigned long long); }
+      else if (lng) { uval = (uint64_t)va_arg(args, unsigned long); }
+      else { uval = (uint64_t)va_arg(args, unsigned int); }
+      tag = SUN_BINLOG_UINT_;
+      sunBinLogPut(content, &tag, sizeof(tag));
+      sunBinLogPut(content, &uval, sizeof(uval));
+      nargs++;
+      break;
+    }
+    case 'e':
+    case 'E':
+    case 'f':
+    case 'F':
+    case 'g':
+    case 'G':
+    case 'a':
+    case 'A':
+    {
+      double rval;
+      if (dbl) { rval = (double)va_arg(args, long double); }
+      else { rval = va_arg(args, double); }
+      tag = SUN_BINLOG_REAL_;
+      sunBinLogPut(content, &tag, sizeof(tag));
+      sunBinLogPut(content, &rval, sizeof(rval));
+      nargs++;
+      break;
+    }
+    case 's':
+    {
+      const char* sval = va_arg(args, const char*);
+      size_t slen;
+      uint16_t len;
+      if (!sval) { sval = "(null)"; }
+      slen = strlen(sval);
+      if (slen > SUN_BINLOG_MAX_ARG_STRLEN_)
+      {
+        slen = SUN_BINLOG_MAX_ARG_STRLEN_;
+      }
+      len = (uint16_t)slen;
+      tag = SUN_BINLOG_STR_;
+      sunBinLogPut(content, &tag, sizeof(tag));
+      sunBinLogPut(content, &len, sizeof(len));
+      sunBinLogPut(content, sval, len);
+      nargs++;
+      break;
+    }
+    case 'p':
+    {
+      uint64_t pval = (uint64_t)(uintptr_t)va_arg(args, void*);
+      tag           = SUN_BINLOG_POINTER_;
+      sunBinLogPut(content, &tag, sizeof(tag));
+      sunBinLogPut(content, &pval, sizeof(pval));
+      nargs++;
+      break;
+    }
+    case 'n': (void)va_arg(args, void*); break;
+    default:
+      /* unknown conversion, the remaining argument types are unknown */
+      return nargs;
+    }
+  }
+
+  return nargs;
+}
+
+static SUNErrCode sunBinLogQueueMsg(SUNLogger logger, SUNLogLevel lvl,
+                                    const char* scope, const char* label,
+                                    const char* msg_txt, va_list args)
+{
+  SUNLoggerBinaryContent content = SUN_BINLOG_CONTENT_(logger);
+  SUNErrCode retval              = SUN_SUCCESS;
+  uint8_t kind                   = SUN_BINLOG_MESSAGE_;
+  uint8_t level                  = (uint8_t)lvl;
+  uint8_t nargs                  = 0;
+  int32_t rank                   = 0;
+  double time;
+  uint32_t ids[3];
+  size_t nargs_pos;
+  size_t needed;
+  int irank = 0;
+
+  if (!sunLoggerIsOutputRank(logger, &irank)) { return SUN_SUCCESS; }
+  rank = (int32_t)irank;
+  time = sunWallTime() - content->t0;
+
+  /* errors and warnings are also written to their text output files so they
+     are still reported, e.g., on stderr by the default error handler */
+  if (lvl == SUN_LOGLEVEL_ERROR || lvl == SUN_LOGLEVEL_WARNING)
+  {
+    va_list text_args;
+    va_copy(text_args, args);
+    retval = sunLoggerWriteMsg(logger, lvl, scope, label, msg_txt, text_args);
+    va_end(text_args);
+    if (retval) { return retval; }
+  }
+
+  /* make sure the largest possible message and its string definitions fit */
+  needed = 3 * (9 + SUN_BINLOG_MAX_STRLEN_) + 28 +
+           SUN_BINLOG_MAX_ARGS_ * (3 + SUN_BINLOG_MAX_ARG_STRLEN_);
+  if (content->used + needed > SUN_BINLOG_BUFFER_SIZE_)
+  {
+    retval = sunBinLogDrain(content);
+  }
+
+  if (sunBinLogStringId(content, scope, &ids[0]) ||
+      sunBinLogStringId(content, label, &ids[1]) ||
+      sunBinLogStringId(content, msg_txt, &ids[2]))
+  {
+    return SUN_ERR_MALLOC_FAIL;
+  }
+
+  sunBinLogPut(content, &kind, sizeof(kind));
+  sunBinLogPut(content, &level, sizeof(level));
+  sunBinLogPut(content, &rank, sizeof(rank));
+  sunBinLogPut(content, &time, sizeof(time));
+  sunBinLogPut(content, ids, sizeof(ids));
+  nargs_pos = content->used;
+  sunBinLogPut(content, &nargs, sizeof(nargs));
+
+  nargs = sunBinLogPutArgs(content, msg_txt ? msg_txt : "", args);
+  memcpy(content->buffer + nargs_pos, &nargs, sizeof(nargs));
+
+  return retval;
+}
+
+static SUNErrCode sunBinLogFlush(SUNLogger logger, SUNLogLevel lvl)
+{
+  SUNLoggerBinaryContent content = SUN_BINLOG_CONTENT_(logger);
+  SUNErrCode retval              = sunBinLogDrain(content);
+
+  if (fflush(content->fp) && !retval) { retval = SUN_ERR_OP_FAIL; }
+  if (retval) { return retval; }
+
+  /* vectors are still printed to the text debug file */
+  return sunLoggerFlushFiles(logger, lvl);
+}
+
+/* Writes out and closes the binary log, if the binary backend is in use, and
+   restores the content and operations it replaced */
+static SUNErrCode sunBinLogClose(SUNLogger logger)
+{
+  SUNLoggerBinaryContent content;
+  SUNErrCode retval;
+
+  if (logger->queuemsg != sunBinLogQueueMsg) { return SUN_SUCCESS; }
+  content = SUN_BINLOG_CONTENT_(logger);
+
+  retval = sunBinLogDrain(content);
+  if (fclose(content->fp) && !retval) { retval = SUN_ERR_OP_FAIL; }
+
+  logger->content  = content->content;
+  logger->queuemsg = content->queuemsg;
+  logger->flush    = content->flush;
+  logger->destroy  = content->destroy;
+
+  SUNHashMap_Destroy(&content->strings);
+  free(content->buffer);
+  free(content);
+
+  return retval;
+}
+
+static SUNErrCode sunBinLogDestroy(SUNLogger* logger_ptr)
+{
+  SUNErrCode retval = sunBinLogClose(*logger_ptr);
+
+  /* destroy the logger with the restored operation, if any */
+  if ((*logger_ptr)->destroy)
+  {
+    SUNErrCode destroy_retval = (*logger_ptr)->destroy(logger_ptr);
+    return retval ? retval : destroy_retval;
+  }
+
+  sunLoggerFree(*logger_ptr);
+  *logger_ptr = NULL;
+  return retval;
+}
+
+static SUNErrCode sunBinLogOpen(SUNLogger logger, const char* fname)
+{
+  SUNLoggerBinaryContent content;
+  const char magic[8] = "SUNBLOG";
+  uint32_t header[2]  = {SUN_BINLOG_VERSION_, 0x01020304};
+
+  content = (SUNLoggerBinaryContent)malloc(sizeof(*content));
+  if (!content) { return SUN_ERR_MALLOC_FAIL; }
+
+  content->buffer = (char*)malloc(SUN_BINLOG_BUFFER_SIZE_);
+  if (!content->buffer)
+  {
+    free(content);
+    return SUN_ERR_MALLOC_FAIL;
+  }
+
+  content->fp = fopen(fname, "wb");
+  if (!content->fp)
+  {
+    free(content->buffer);
+    free(content);
+    return SUN_ERR_FILE_OPEN;
+  }
+
+  content->strings = NULL;
+  if (SUNHashMap_New(SUN_BINLOG_STRING_HANDLES_, sunBinLogFreeKeyValue,
+                     &content->strings))
+  {
+    fclose(content->fp);
+    free(content->buffer);
+    free(content);
+    return SUN_ERR_MALLOC_FAIL;
+  }
+
+  content->used     = 0;
+  content->nstrings = 0;
+  content->t0       = sunWallTime();
+
+  /* file header: magic string, version, and byte order marker */
+  sunBinLogPut(content, magic, sizeof(magic));
+  sunBinLogPut(content, header, sizeof(header));
+
+  /* save the content and operations replaced by the backend */
+  content->content  = logger->content;
+  content->queuemsg = logger->queuemsg;
+  content->flush    = logger->flush;
+  content->destroy  = logger->destroy;
+
+  logger->content  = content;
+  logger->queuemsg = sunBinLogQueueMsg;
+  logger->flush    = sunBinLogFlush;
+  logger->destroy  = sunBinLogDestroy;
+
+  return SUN_SUCCESS;
+}
+
+#endif
+
 SUNErrCode SUNLogger_Create(SUNComm comm, int output_rank, SUNLogger* logger_ptr)
 {
   SUNLogger logger = NULL;
@@ -190,6 +707,7 @@ SUNErrCode SUNLogger_CreateFromEnv(SUNComm comm, SUNLogger* logger_out)
   const char* warning_fname_env = getenv("SUNLOGGER_WARNING_FILENAME");
   const char* info_fname_env    = getenv("SUNLOGGER_INFO_FILENAME");
   const char* debug_fname_env   = getenv("SUNLOGGER_DEBUG_FILENAME");
+  const char* binary_fname_env  = getenv("SUNLOGGER_BINARY_FILENAME");
 
   if (SUNLogger_Create(comm, output_rank, &logger))
   {
@@ -205,6 +723,8 @@ SUNErrCode SUNLogger_CreateFromEnv(SUNComm comm, SUNLogger* logger_out)
     err = SUNLogger_SetDebugFilename(logger, debug_fname_env);
     if (err) { break; }
     err = SUNLogger_SetInfoFilename(logger, info_fname_env);
+    if (err) { break; }
+    err = SUNLogger_SetBinaryFilename(logger, binary_fname_env);
   }
   while (0);
 
@@ -335,6 +855,29 @@ SUNErrCode SUNLogger_SetDebugFilename(SUNLogger logger, const char* debug_filena
   return SUN_SUCCESS;
 }
 
+SUNErrCode SUNLogger_SetBinaryFilename(SUNLogger logger,
+                                       const char* binary_filename)
+{
+  if (!logger) { return SUN_ERR_ARG_CORRUPT; }
+
+  if (!sunLoggerIsOutputRank(logger, NULL)) { return SUN_SUCCESS; }
+
+#if SUNDIALS_LOGGING_LEVEL > 0
+  /* write out and close any existing binary log */
+  SUNErrCode retval = sunBinLogClose(logger);
+  if (retval) { return retval; }
+
+  if (binary_filename && strcmp(binary_filename, ""))
+  {
+    return sunBinLogOpen(logger, binary_filename);
+  }
+#else
+  ((void)binary_filename);
+#endif
+
+  return SUN_SUCCESS;
+}
+
 SUNErrCode SUNLogger_QueueMsg(SUNLogger logger, SUNLogLevel lvl,
                               const char* scope, const char* label,
                               const char* msg_txt, ...)
@@ -359,37 +902,10 @@ SUNErrCode SUNLogger_QueueMsg(SUNLogger logger, SUNLogLevel lvl,
     else
     {
       /* Default implementation */
-      int rank = 0;
-      if (sunLoggerIsOutputRank(logger, &rank))
-      {
-        char* log_msg = NULL;
-        va_list args;
-        va_start(args, msg_txt);
-        sunCreateLogMessage(lvl, rank, scope, label, msg_txt, args, &log_msg);
-        va_end(args);
-
-        switch (lvl)
-        {
-        case (SUN_LOGLEVEL_DEBUG):
-          if (logger->debug_fp) { fprintf(logger->debug_fp, "%s", log_msg); }
-          break;
-        case (SUN_LOGLEVEL_WARNING):
-          if (logger->warning_fp)
-          {
-            fprintf(logger->warning_fp, "%s", log_msg);
-          }
-          break;
-        case (SUN_LOGLEVEL_INFO):
-          if (logger->info_fp) { fprintf(logger->info_fp, "%s", log_msg); }
-          break;
-        case (SUN_LOGLEVEL_ERROR):
-          if (logger->error_fp) { fprintf(logger->error_fp, "%s", log_msg); }
-          break;
-        default: retval = SUN_ERR_UNREACHABLE;
-        }
-
-        free(log_msg);
-      }
+      va_list args;
+      va_start(args, msg_txt);
+      retval = sunLoggerWriteMsg(logger, lvl, scope, label, msg_txt, args);
+      va_end(args);
     }
   }
 #else
@@ -416,35 +932,7 @@ SUNErrCode SUNLogger_Flush(SUNLogger logger, SUNLogLevel lvl)
 
 #if SUNDIALS_LOGGING_LEVEL > 0
   if (logger->flush) { retval = logger->flush(logger, lvl); }
-  else
-  {
-    /* Default implementation */
-    if (sunLoggerIsOutputRank(logger, NULL))
-    {
-      switch (lvl)
-      {
-      case (SUN_LOGLEVEL_DEBUG):
-        if (logger->debug_fp) { fflush(logger->debug_fp); }
-        break;
-      case (SUN_LOGLEVEL_WARNING):
-        if (logger->warning_fp) { fflush(logger->warning_fp); }
-        break;
-      case (SUN_LOGLEVEL_INFO):
-        if (logger->info_fp) { fflush(logger->info_fp); }
-        break;
-      case (SUN_LOGLEVEL_ERROR):
-        if (logger->error_fp) { fflush(logger->error_fp); }
-        break;
-      case (SUN_LOGLEVEL_ALL):
-        if (logger->debug_fp) { fflush(logger->debug_fp); }
-        if (logger->warning_fp) { fflush(logger->warning_fp); }
-        if (logger->info_fp) { fflush(logger->info_fp); }
-        if (logger->error_fp) { fflush(logger->error_fp); }
-        break;
-      default: retval = SUN_ERR_UNREACHABLE;
-      }
-    }
-  }
+  else { retval = sunLoggerFlushFiles(logger, lvl); }
 #else
   /* silence warnings when all logging is disabled */
   ((void)lvl);
@@ -473,18 +961,8 @@ SUNErrCode SUNLogger_Destroy(SUNLogger* logger_ptr)
   else if (logger)
   {
     /* Default implementation */
-
-    if (sunLoggerIsOutputRank(logger, NULL))
-    {
-      SUNHashMap_Destroy(&logger->filenames);
-    }
-
-#if SUNDIALS_MPI_ENABLED
-    if (logger->comm != SUN_COMM_NULL) { MPI_Comm_free(&logger->comm); }
-#endif
-
-    free(logger);
-    logger = NULL;
+    sunLoggerFree(logger);
+    *logger_ptr = NULL;
   }
 
   return retval;
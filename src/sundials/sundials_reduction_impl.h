@@ -0,0 +1,121 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * This header file contains the kernels shared by the reproducible
+ * reductions in the host vector implementations.
+ *
+ * A reproducible reduction splits the vector into chunks whose
+ * boundaries depend only on the vector length, sums each chunk in
+ * index order, and combines the chunk sums with a fixed pairwise
+ * tree. The result therefore does not depend on how the chunks are
+ * distributed among threads, and the serial, OpenMP, and Pthreads
+ * vectors produce identical results for the same data.
+ * -----------------------------------------------------------------*/
+
+#ifndef _SUNDIALS_REDUCTION_IMPL_H
+#define _SUNDIALS_REDUCTION_IMPL_H
+
+#include <sundials/sundials_math.h>
+#include <sundials/sundials_types.h>
+
+/* Minimum number of entries in a chunk */
+#define SUN_REDUCE_MIN_CHUNK_LENGTH 1024
+
+/* Maximum number of chunks, i.e., the size of the partial sum buffer */
+#define SUN_REDUCE_MAX_CHUNKS 512
+
+/* Reductions available as reproducible kernels */
+typedef enum
+{
+  SUN_REDUCE_DOTPROD,     /* sum x[i] * y[i]                  */
+  SUN_REDUCE_WSQRSUM,     /* sum (x[i] * w[i])^2              */
+  SUN_REDUCE_WSQRSUMMASK, /* sum (x[i] * w[i])^2 if id[i] > 0 */
+  SUN_REDUCE_L1NORM       /* sum |x[i]|                       */
+} SUNReduceKernel;
+
+/* Returns the length of the chunks used for a vector of length N */
+static inline sunindextype sunReduceChunkLength(sunindextype N)
+{
+  sunindextype len = (N + SUN_REDUCE_MAX_CHUNKS - 1) / SUN_REDUCE_MAX_CHUNKS;
+  if (len < SUN_REDUCE_MIN_CHUNK_LENGTH) { len = SUN_REDUCE_MIN_CHUNK_LENGTH; }
+  return len;
+}
+
+/* Returns the number of chunks used for a vector of length N */
+static inline sunindextype sunReduceNumChunks(sunindextype N)
+{
+  sunindextype len = sunReduceChunkLength(N);
+  return (N + len - 1) / len;
+}
+
+/* Returns the sum over chunk c of a vector of length N */
+static inline sunrealtype sunReduceChunk(SUNReduceKernel kernel,
+                                         const sunrealtype* xd,
+                                         const sunrealtype* yd,
+                                         const sunrealtype* idd,
+                                         sunindextype N, sunindextype c)
+{
+  sunindextype i, start, end, len;
+  sunrealtype prod, sum = SUN_RCONST(0.0);
+
+  len   = sunReduceChunkLength(N);
+  start = c * len;
+  end   = (start + len < N) ? start + len : N;
+
+  switch (kernel)
+  {
+  case SUN_REDUCE_DOTPROD:
+    for (i = start; i < end; i++) { sum += xd[i] * yd[i]; }
+    break;
+  case SUN_REDUCE_WSQRSUM:
+    for (i = start; i < end; i++)
+    {
+      prod = xd[i] * yd[i];
+      sum += SUNSQR(prod);
+    }
+    break;
+  case SUN_REDUCE_WSQRSUMMASK:
+    for (i = start; i < end; i++)
+    {
+      if (idd[i] > SUN_RCONST(0.0))
+      {
+        prod = xd[i] * yd[i];
+        sum += SUNSQR(prod);
+      }
+    }
+    break;
+  case SUN_REDUCE_L1NORM:
+    for (i = start; i < end; i++) { sum += SUNRabs(xd[i]); }
+    break;
+  }
+
+  return sum;
+}
+
+/* Combines the n partial sums with a fixed pairwise tree (in place) */
+static inline sunrealtype sunReduceTree(sunrealtype* partials, sunindextype n)
+{
+  sunindextype i, stride;
+
+  if (n < 1) { return SUN_RCONST(0.0); }
+
+  for (stride = 1; stride < n; stride *= 2)
+  {
+    for (i = 0; i + stride < n; i += 2 * stride)
+    {
+      partials[i] += partials[i + stride];
+    }
+  }
+
+  return partials[0];
+}
+
+#endif
@@ -21,6 +21,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <time.h>
 #include <sundials/sundials_config.h>
 #include <sundials/sundials_types.h>
 
@@ -73,6 +74,18 @@ static inline int sunvasnprintf(char** str, const char* fmt, va_list args)
   return size;
 }
 
+/* Returns the wall clock time in seconds (monotonic when available) */
+static inline double sunWallTime(void)
+{
+#if defined(SUNDIALS_HAVE_POSIX_TIMERS)
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (double)ts.tv_sec + 1.0e-9 * (double)ts.tv_nsec;
+#else
+  return (double)clock() / CLOCKS_PER_SEC;
+#endif
+}
+
 static inline void sunCompensatedSum(sunrealtype base, sunrealtype inc,
                                      sunrealtype* sum, sunrealtype* error)
 {
@@ -0,0 +1,368 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------
+ * SUNDIALS memory helper implementation that caches system memory
+ * allocations in power-of-two size class free lists.
+ * ----------------------------------------------------------------*/
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <sundials/priv/sundials_errors_impl.h>
+#include <sundials/sundials_errors.h>
+#include <sundials/sundials_math.h>
+#include <sundials/sundials_memory.h>
+#include <sunmemory/sunmemory_system.h>
+
+#include "sundials_debug.h"
+#include "sundials_macros.h"
+
+/* The smallest size class holds 2^SYSPOOL_MIN_SHIFT bytes (enough to store
+   the free list link) and the largest holds
+   2^(SYSPOOL_MIN_SHIFT + SYSPOOL_NUM_CLASSES - 1) bytes. Larger requests are
+   passed directly to the system allocator. */
+#define SYSPOOL_MIN_SHIFT   6
+#define SYSPOOL_NUM_CLASSES 26
+
+struct SUNMemoryHelper_Content_SysPool_
+{
+  unsigned long num_allocations;
+  unsigned long num_deallocations;
+  size_t bytes_allocated;
+  size_t bytes_high_watermark;
+  unsigned long num_hits;   /* allocations served from a free list */
+  unsigned long num_misses; /* allocations passed to the system    */
+  size_t bytes_cached;      /* bytes held in the free lists        */
+  size_t max_bytes_cached;  /* free list capacity (0 = unlimited)  */
+  size_t alignment;         /* allocation alignment (0 = default)  */
+  SUNMemory free_list[SYSPOOL_NUM_CLASSES];
+};
+
+typedef struct SUNMemoryHelper_Content_SysPool_ SUNMemoryHelper_Content_SysPool;
+
+#define SUNHELPER_CONTENT(h) ((SUNMemoryHelper_Content_SysPool*)h->content)
+
+/* The free lists are threaded through the cached buffers: the first bytes of
+   a cached buffer hold the next cached SUNMemory in the same size class. */
+#define SYSPOOL_NEXT(mem) (*((SUNMemory*)(mem)->ptr))
+
+/* Returns the size class for a request or -1 if it is too large to cache */
+static int syspoolClass(size_t mem_size)
+{
+  int k;
+  for (k = 0; k < SYSPOOL_NUM_CLASSES; k++)
+  {
+    if (mem_size <= ((size_t)1 << (k + SYSPOOL_MIN_SHIFT))) { return k; }
+  }
+  return -1;
+}
+
+static size_t syspoolClassBytes(int k)
+{
+  return ((size_t)1 << (k + SYSPOOL_MIN_SHIFT));
+}
+
+/* Allocates an (optionally aligned) buffer; with an alignment the address
+   returned by malloc is stored immediately before the aligned buffer */
+static void* syspoolMalloc(size_t bytes, size_t alignment)
+{
+  void* raw;
+  uintptr_t addr;
+
+  if (alignment == 0) { return malloc(bytes); }
+
+  /* the padded size must not overflow */
+  if (bytes > SIZE_MAX - alignment - sizeof(void*)) { return NULL; }
+
+  raw = malloc(bytes + alignment + sizeof(void*));
+  if (raw == NULL) { return NULL; }
+
+  addr = ((uintptr_t)raw + sizeof(void*) + alignment - 1) &
+         ~((uintptr_t)alignment - 1);
+  ((void**)addr)[-1] = raw;
+
+  return (void*)addr;
+}
+
+static void syspoolFree(void* ptr, size_t alignment)
+{
+  if (alignment == 0) { free(ptr); }
+  else { free(((void**)ptr)[-1]); }
+}
+
+/* Releases cached buffers, starting with the largest size class, until the
+   number of cached bytes is at most max_bytes */
+static void syspoolTrim(SUNMemoryHelper helper, size_t max_bytes)
+{
+  int k;
+  SUNMemory mem;
+  SUNMemoryHelper_Content_SysPool* content = SUNHELPER_CONTENT(helper);
+
+  for (k = SYSPOOL_NUM_CLASSES - 1; k >= 0; k--)
+  {
+    while (content->bytes_cached > max_bytes && content->free_list[k] != NULL)
+    {
+      mem                   = content->free_list[k];
+      content->free_list[k] = SYSPOOL_NEXT(mem);
+      content->bytes_cached -= syspoolClassBytes(k);
+      syspoolFree(mem->ptr, content->alignment);
+      free(mem);
+    }
+  }
+}
+
+SUNMemoryHelper SUNMemoryHelper_SysPool(SUNContext sunctx)
+{
+  SUNFunctionBegin(sunctx);
+
+  int k;
+  SUNMemoryHelper helper;
+
+  /* Allocate the helper */
+  helper = SUNMemoryHelper_NewEmpty(sunctx);
+  SUNCheckLastErrNull();
+
+  /* Set the ops */
+  helper->ops->alloc         = SUNMemoryHelper_Alloc_SysPool;
+  helper->ops->allocstrided  = SUNMemoryHelper_AllocStrided_SysPool;
+  helper->ops->dealloc       = SUNMemoryHelper_Dealloc_SysPool;
+  helper->ops->copy          = SUNMemoryHelper_Copy_Sys;
+  helper->ops->getallocstats = SUNMemoryHelper_GetAllocStats_SysPool;
+  helper->ops->clone         = SUNMemoryHelper_Clone_SysPool;
+  helper->ops->destroy       = SUNMemoryHelper_Destroy_SysPool;
+
+  /* Attach content and ops */
+  helper->content = (SUNMemoryHelper_Content_SysPool*)malloc(
+    sizeof(SUNMemoryHelper_Content_SysPool));
+  SUNAssertNull(helper->content, SUN_ERR_MALLOC_FAIL);
+
+  SUNHELPER_CONTENT(helper)->num_allocations      = 0;
+  SUNHELPER_CONTENT(helper)->num_deallocations    = 0;
+  SUNHELPER_CONTENT(helper)->bytes_allocated      = 0;
+  SUNHELPER_CONTENT(helper)->bytes_high_watermark = 0;
+  SUNHELPER_CONTENT(helper)->num_hits             = 0;
+  SUNHELPER_CONTENT(helper)->num_misses           = 0;
+  SUNHELPER_CONTENT(helper)->bytes_cached         = 0;
+  SUNHELPER_CONTENT(helper)->max_bytes_cached     = 0;
+  SUNHELPER_CONTENT(helper)->alignment            = 0;
+  for (k = 0; k < SYSPOOL_NUM_CLASSES; k++)
+  {
+    SUNHELPER_CONTENT(helper)->free_list[k] = NULL;
+  }
+
+  return helper;
+}
+
+SUNErrCode SUNMemoryHelper_SetAlignment_SysPool(SUNMemoryHelper helper,
+                                                size_t alignment)
+{
+  SUNFunctionBegin(helper->sunctx);
+
+  SUNMemoryHelper_Content_SysPool* content = SUNHELPER_CONTENT(helper);
+
+  /* The alignment must be a power of two and can only change when no
+     allocations are outstanding */
+  SUNAssert((alignment & (alignment - 1)) == 0, SUN_ERR_ARG_OUTOFRANGE);
+  SUNAssert(content->num_allocations == content->num_deallocations,
+            SUN_ERR_ARG_INCOMPATIBLE);
+
+  /* Cached buffers were allocated with the previous alignment */
+  syspoolTrim(helper, 0);
+  content->alignment = alignment;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMemoryHelper_SetMaxCachedBytes_SysPool(SUNMemoryHelper helper,
+                                                     size_t max_bytes_cached)
+{
+  SUNFunctionBegin(helper->sunctx);
+
+  SUNHELPER_CONTENT(helper)->max_bytes_cached = max_bytes_cached;
+  if (max_bytes_cached > 0) { syspoolTrim(helper, max_bytes_cached); }
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMemoryHelper_Trim_SysPool(SUNMemoryHelper helper)
+{
+  SUNFunctionBegin(helper->sunctx);
+  syspoolTrim(helper, 0);
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMemoryHelper_GetPoolStats_SysPool(SUNMemoryHelper helper,
+                                                unsigned long* num_hits,
+                                                unsigned long* num_misses,
+                                                size_t* bytes_cached)
+{
+  SUNFunctionBegin(helper->sunctx);
+  *num_hits     = SUNHELPER_CONTENT(helper)->num_hits;
+  *num_misses   = SUNHELPER_CONTENT(helper)->num_misses;
+  *bytes_cached = SUNHELPER_CONTENT(helper)->bytes_cached;
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMemoryHelper_Alloc_SysPool(SUNMemoryHelper helper,
+                                         SUNMemory* memptr, size_t mem_size,
+                                         SUNMemoryType mem_type,
+                                         SUNDIALS_MAYBE_UNUSED void* queue)
+{
+  SUNFunctionBegin(helper->sunctx);
+
+  int k;
+  SUNMemory mem                            = NULL;
+  SUNMemoryHelper_Content_SysPool* content = SUNHELPER_CONTENT(helper);
+
+  SUNAssert(mem_type == SUNMEMTYPE_HOST, SUN_ERR_ARG_INCOMPATIBLE);
+
+  k = syspoolClass(mem_size);
+
+  if (k >= 0 && content->free_list[k] != NULL)
+  {
+    /* Reuse a cached handle and buffer */
+    mem                   = content->free_list[k];
+    content->free_list[k] = SYSPOOL_NEXT(mem);
+    content->bytes_cached -= syspoolClassBytes(k);
+    content->num_hits++;
+  }
+  else
+  {
+    mem = SUNMemoryNewEmpty(helper->sunctx);
+    SUNCheckLastErr();
+
+    mem->ptr = syspoolMalloc((k >= 0) ? syspoolClassBytes(k) : mem_size,
+                             content->alignment);
+    if (mem->ptr == NULL)
+    {
+      /* release the handle and report the failure even when assertions are
+         disabled, so the caller never receives a freed handle */
+      free(mem);
+      *memptr = NULL;
+      SUNHandleErrWithMsg(__LINE__, __func__, __FILE__, NULL,
+                          SUN_ERR_MALLOC_FAIL, SUNCTX_);
+      return SUN_ERR_MALLOC_FAIL;
+    }
+    content->num_misses++;
+  }
+
+  mem->own    = SUNTRUE;
+  mem->type   = mem_type;
+  mem->bytes  = mem_size;
+  mem->stride = 1;
+
+  content->bytes_allocated += mem_size;
+  content->num_allocations++;
+  content->bytes_high_watermark = SUNMAX(content->bytes_allocated,
+                                         content->bytes_high_watermark);
+
+  *memptr = mem;
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMemoryHelper_AllocStrided_SysPool(SUNMemoryHelper helper,
+                                                SUNMemory* memptr,
+                                                size_t mem_size, size_t stride,
+                                                SUNMemoryType mem_type,
+                                                void* queue)
+{
+  SUNFunctionBegin(helper->sunctx);
+
+  SUNCheckCall(
+    SUNMemoryHelper_Alloc_SysPool(helper, memptr, mem_size, mem_type, queue));
+
+  (*memptr)->stride = stride;
+
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMemoryHelper_Dealloc_SysPool(SUNMemoryHelper helper,
+                                           SUNMemory mem,
+                                           SUNDIALS_MAYBE_UNUSED void* queue)
+{
+  SUNFunctionBegin(helper->sunctx);
+
+  int k;
+  SUNMemoryHelper_Content_SysPool* content = SUNHELPER_CONTENT(helper);
+
+  if (mem == NULL) { return SUN_SUCCESS; }
+
+  SUNAssert(mem->type == SUNMEMTYPE_HOST, SUN_ERR_ARG_INCOMPATIBLE);
+
+  if (mem->ptr != NULL && mem->own)
+  {
+    content->num_deallocations++;
+    content->bytes_allocated -= mem->bytes;
+
+    /* Cache the handle and buffer if there is room */
+    k = syspoolClass(mem->bytes);
+    if (k >= 0 && (content->max_bytes_cached == 0 ||
+                   content->bytes_cached + syspoolClassBytes(k) <=
+                     content->max_bytes_cached))
+    {
+      SYSPOOL_NEXT(mem)     = content->free_list[k];
+      content->free_list[k] = mem;
+      content->bytes_cached += syspoolClassBytes(k);
+      return SUN_SUCCESS;
+    }
+
+    syspoolFree(mem->ptr, content->alignment);
+    mem->ptr = NULL;
+  }
+
+  free(mem);
+  return SUN_SUCCESS;
+}
+
+SUNErrCode SUNMemoryHelper_GetAllocStats_SysPool(
+  SUNMemoryHelper helper, SUNDIALS_MAYBE_UNUSED SUNMemoryType mem_type,
+  unsigned long* num_allocations, unsigned long* num_deallocations,
+  size_t* bytes_allocated, size_t* bytes_high_watermark)
+{
+  SUNFunctionBegin(helper->sunctx);
+  SUNAssert(mem_type == SUNMEMTYPE_HOST, SUN_ERR_ARG_INCOMPATIBLE);
+  *num_allocations      = SUNHELPER_CONTENT(helper)->num_allocations;
+  *num_deallocations    = SUNHELPER_CONTENT(helper)->num_deallocations;
+  *bytes_allocated      = SUNHELPER_CONTENT(helper)->bytes_allocated;
+  *bytes_high_watermark = SUNHELPER_CONTENT(helper)->bytes_high_watermark;
+  return SUN_SUCCESS;
+}
+
+SUNMemoryHelper SUNMemoryHelper_Clone_SysPool(SUNMemoryHelper helper)
+{
+  SUNFunctionBegin(helper->sunctx);
+
+  /* The clone has the same settings but its own (empty) free lists */
+  SUNMemoryHelper hclone = SUNMemoryHelper_SysPool(helper->sunctx);
+  SUNCheckLastErrNull();
+
+  SUNHELPER_CONTENT(hclone)->max_bytes_cached =
+    SUNHELPER_CONTENT(helper)->max_bytes_cached;
+  SUNHELPER_CONTENT(hclone)->alignment = SUNHELPER_CONTENT(helper)->alignment;
+
+  return hclone;
+}
+
+SUNErrCode SUNMemoryHelper_Destroy_SysPool(SUNMemoryHelper helper)
+{
+  if (helper)
+  {
+    if (helper->content)
+    {
+      syspoolTrim(helper, 0);
+      free(helper->content);
+    }
+    if (helper->ops) { free(helper->ops); }
+    free(helper);
+  }
+  return SUN_SUCCESS;
+}
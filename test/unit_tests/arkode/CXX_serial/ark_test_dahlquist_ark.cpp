@@ -609,11 +609,11 @@ int run_tests(ARKodeButcherTable Be, ARKodeButcherTable Bi,
     {
       if (prob_opts.r_type == rk_type::expl || prob_opts.r_type == rk_type::imex)
       {
-        extra_fe_evals += (degree == 4) ? 1 : 4;
+        extra_fe_evals += (degree == 4) ? 1 : 2;
       }
       if (prob_opts.r_type == rk_type::impl || prob_opts.r_type == rk_type::imex)
       {
-        extra_fi_evals += (degree == 4) ? 1 : 4;
+        extra_fi_evals += (degree == 4) ? 1 : 2;
       }
     }
 
@@ -621,6 +621,15 @@ int run_tests(ARKodeButcherTable Be, ARKodeButcherTable Bi,
                                 nfe_expected + extra_fe_evals,
                                 nfi_expected + extra_fi_evals);
 
+    // When the implicit stage predictor uses the interpolant, the RHS
+    // evaluations for dense output are reused by the predictor in the next
+    // step and are accounted for in expected_rhs_evals.
+    if (prob_opts.p_type != 0 && prob_opts.r_type != rk_type::expl)
+    {
+      extra_fe_evals = 0;
+      extra_fi_evals = 0;
+    }
+
     std::cout << "--------------------" << std::endl;
   }
 
@@ -749,7 +758,8 @@ int expected_rhs_evals(ProblemOptions& prob_opts, int stages, int order,
 
     // With higher order methods some predictors require additional RHS when
     // using Hermite interpolation (note default degree is order - 1, except
-    // for first order where the degree is 1.
+    // for first order where the degree is 1. These evaluations only depend on
+    // the previous step, so they occur once per step rather than per stage.
     int degree = (order == 1) ? 1 : order - 1;
 
     if (prob_opts.p_type != 0 && prob_opts.i_type == interp_type::hermite &&
@@ -757,14 +767,14 @@ int expected_rhs_evals(ProblemOptions& prob_opts, int stages, int order,
     {
       if (prob_opts.r_type == rk_type::expl || prob_opts.r_type == rk_type::imex)
       {
-        extra_fe_evals = (degree == 4) ? 1 : 4;
+        extra_fe_evals = (degree == 4) ? 1 : 2;
       }
       if (prob_opts.r_type == rk_type::impl || prob_opts.r_type == rk_type::imex)
       {
-        extra_fi_evals = (degree == 4) ? 1 : 4;
+        extra_fi_evals = (degree == 4) ? 1 : 2;
       }
-      extra_fe_evals *= implicit_stages * (nst - 1);
-      extra_fi_evals *= implicit_stages * (nst - 1);
+      extra_fe_evals *= nst - 1;
+      extra_fi_evals *= nst - 1;
     }
   }
 
@@ -319,7 +319,7 @@ int run_tests(ARKodeButcherTable Be, ProblemData& prob_data,
     int degree = (order == 1) ? 1 : order - 1;
     if (prob_opts.i_type == interp_type::hermite && degree > 3)
     {
-      extra_fe_evals += (degree == 4) ? 1 : 4;
+      extra_fe_evals += (degree == 4) ? 1 : 2;
     }
 
     numfails += check_rhs_evals(erkstep_mem, nfe_expected + extra_fe_evals);
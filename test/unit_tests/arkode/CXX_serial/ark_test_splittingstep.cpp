@@ -493,6 +493,116 @@ static int test_reinit(const sundials::Context& ctx)
   return fail;
 }
 
+/* Integrates the ODE
+ *
+ * y' = [-y / 2] + [-y / 3] + [-y / 6]
+ *
+ * with initial condition y(0) = 1 using a method with several sequential
+ * methods. The integration is repeated with an extra set of steppers so the
+ * sequential methods may be evaluated concurrently, and we check that both
+ * integrations agree and evolve each partition the same number of times. Each
+ * set of steppers is created with its own SUNContext.
+ */
+static int test_concurrent(const sundials::Context& ctx, bool symmetric)
+{
+  constexpr auto t0         = SUN_RCONST(0.0);
+  constexpr auto tf         = SUN_RCONST(1.0);
+  constexpr auto dt         = SUN_RCONST(8.0e-3);
+  constexpr auto local_tol  = SUN_RCONST(1.0e-6);
+  constexpr auto tol        = SUN_RCONST(1.0e-12);
+  constexpr auto partitions = 3;
+  constexpr auto copies     = 1;
+  auto y                    = N_VNew_Serial(1, ctx);
+
+  ARKRhsFn f = [](sunrealtype, N_Vector z, N_Vector zdot, void* user_data)
+  {
+    auto lambda = *static_cast<sunrealtype*>(user_data);
+    N_VScale(lambda, z, zdot);
+    return 0;
+  };
+
+  sunrealtype lambda[] = {-SUN_RCONST(1.0) / SUN_RCONST(2.0),
+                          -SUN_RCONST(1.0) / SUN_RCONST(3.0),
+                          -SUN_RCONST(1.0) / SUN_RCONST(6.0)};
+
+  std::vector<sundials::Context> copy_ctx(copies);
+  std::vector<N_Vector> copy_y(copies);
+  for (int c = 0; c < copies; c++)
+  {
+    copy_y[c] = N_VNew_Serial(1, copy_ctx[c]);
+  }
+
+  constexpr auto count = (copies + 1) * partitions;
+  std::vector<void*> partition_mem(count);
+  std::vector<SUNStepper> steppers(count);
+  for (int i = 0; i < count; i++)
+  {
+    auto set           = i / partitions;
+    auto set_y         = set == 0 ? y : copy_y[set - 1];
+    SUNContext set_ctx = set == 0 ? ctx : copy_ctx[set - 1];
+    partition_mem[i]   = ERKStepCreate(f, t0, set_y, set_ctx);
+    ARKodeSetUserData(partition_mem[i], &lambda[i % partitions]);
+    ARKodeSStolerances(partition_mem[i], local_tol, local_tol);
+    ARKodeCreateSUNStepper(partition_mem[i], &steppers[i]);
+  }
+
+  auto coefficients = symmetric
+                        ? SplittingStepCoefficients_SymmetricParallel(partitions)
+                        : SplittingStepCoefficients_Parallel(partitions);
+  auto name = symmetric ? "symmetric parallel method" : "parallel method";
+
+  sunrealtype solution[2];
+  long int evolves[2][partitions];
+  for (int run = 0; run < 2; run++)
+  {
+    N_VConst(SUN_RCONST(1.0), y);
+    auto arkode_mem = SplittingStepCreate(steppers.data(), partitions, t0, y,
+                                          ctx);
+    SplittingStepSetCoefficients(arkode_mem, coefficients);
+    if (run == 1)
+    {
+      SplittingStepSetConcurrentSteppers(arkode_mem, copies,
+                                         steppers.data() + partitions);
+    }
+    ARKodeSetFixedStep(arkode_mem, dt);
+    auto tret = t0;
+    ARKodeEvolve(arkode_mem, tf, y, &tret, ARK_NORMAL);
+
+    solution[run] = N_VGetArrayPointer(y)[0];
+    for (int k = 0; k < partitions; k++)
+    {
+      SplittingStepGetNumEvolves(arkode_mem, k, &evolves[run][k]);
+    }
+    ARKodeFree(&arkode_mem);
+  }
+
+  int fail = SUNRCompareTol(solution[0], solution[1], tol);
+  for (int k = 0; k < partitions; k++)
+  {
+    if (evolves[0][k] != evolves[1][k]) { fail = 1; }
+  }
+
+  std::cout << "Concurrent solution with " << name
+            << (fail ? " differs from" : " matches") << " the sequential one\n";
+  if (fail)
+  {
+    std::cerr << "Sequential solution " << solution[0]
+              << ", concurrent solution " << solution[1] << "\n";
+  }
+  std::cout << "\n";
+
+  SplittingStepCoefficients_Destroy(&coefficients);
+  N_VDestroy(y);
+  for (int i = 0; i < count; i++)
+  {
+    ARKodeFree(&partition_mem[i]);
+    SUNStepper_Destroy(&steppers[i]);
+  }
+  for (int c = 0; c < copies; c++) { N_VDestroy(copy_y[c]); }
+
+  return fail;
+}
+
 int main()
 {
   sundials::Context ctx;
@@ -521,6 +631,8 @@ int main()
   errors += test_custom_stepper(ctx, 4);
   errors += test_custom_stepper(ctx, 6);
   errors += test_reinit(ctx);
+  errors += test_concurrent(ctx, false);
+  errors += test_concurrent(ctx, true);
 
   if (errors == 0) { std::cout << "Success\n"; }
   else { std::cout << errors << " Test Failures\n"; }
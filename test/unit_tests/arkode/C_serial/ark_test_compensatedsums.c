@@ -0,0 +1,183 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for compensated summation of the step solution on the problem
+ *
+ *   m y' = m r,  y(0) = 1,
+ *
+ * where the rate r is small enough that each increment h r is lost to roundoff
+ * when added to y. Without compensated summation the solution stagnates while
+ * with it the solution matches y(t) = 1 + r t to within a few ulps.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "arkode/arkode_arkstep.h"
+#include "arkode/arkode_erkstep.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_dense.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define ONE    SUN_RCONST(1.0)
+#define RATE   (SUN_UNIT_ROUNDOFF / SUN_RCONST(8.0))
+#define NSTEPS 1000
+
+typedef enum
+{
+  ERK,
+  DIRK,
+  DIRK_MASS
+} method_type;
+
+static const char* method_names[] = {"ERK", "DIRK", "DIRK with mass matrix"};
+
+static int f(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype m = *((sunrealtype*)user_data);
+  N_VConst(m * RATE, ydot);
+  return 0;
+}
+
+static int mass(sunrealtype t, SUNMatrix M, void* user_data, N_Vector tmp1,
+                N_Vector tmp2, N_Vector tmp3)
+{
+  sunrealtype m         = *((sunrealtype*)user_data);
+  SM_ELEMENT_D(M, 0, 0) = m;
+  return 0;
+}
+
+/* Integrates NSTEPS unit steps and returns the error in the final solution */
+static int run_test(method_type method, sunbooleantype compensate,
+                    sunrealtype* err, SUNContext sunctx)
+{
+  int retval          = 0;
+  sunrealtype m       = (method == DIRK_MASS) ? SUN_RCONST(2.0) : ONE;
+  sunrealtype tf      = (sunrealtype)NSTEPS;
+  sunrealtype tret    = SUN_RCONST(0.0);
+  void* arkode_mem    = NULL;
+  SUNMatrix A         = NULL;
+  SUNMatrix M         = NULL;
+  SUNLinearSolver LS  = NULL;
+  SUNLinearSolver MLS = NULL;
+
+  N_Vector y = N_VNew_Serial(1, sunctx);
+  if (!y) { return 1; }
+  N_VConst(ONE, y);
+
+  if (method == ERK) { arkode_mem = ERKStepCreate(f, tret, y, sunctx); }
+  else
+  {
+    arkode_mem = ARKStepCreate(NULL, f, tret, y, sunctx);
+    if (!arkode_mem) { return 1; }
+
+    retval = ARKStepSetTableNum(arkode_mem, ARKODE_SDIRK_2_1_2,
+                                ARKODE_ERK_NONE);
+    if (retval) { return 1; }
+
+    A  = SUNDenseMatrix(1, 1, sunctx);
+    LS = SUNLinSol_Dense(y, A, sunctx);
+    if (!A || !LS) { return 1; }
+
+    retval = ARKodeSetLinearSolver(arkode_mem, LS, A);
+    if (retval) { return 1; }
+
+    retval = ARKodeSetLinear(arkode_mem, 0);
+    if (retval) { return 1; }
+
+    if (method == DIRK_MASS)
+    {
+      M   = SUNDenseMatrix(1, 1, sunctx);
+      MLS = SUNLinSol_Dense(y, M, sunctx);
+      if (!M || !MLS) { return 1; }
+
+      retval = ARKodeSetMassLinearSolver(arkode_mem, MLS, M, SUNFALSE);
+      if (retval) { return 1; }
+
+      retval = ARKodeSetMassFn(arkode_mem, mass);
+      if (retval) { return 1; }
+    }
+  }
+  if (!arkode_mem) { return 1; }
+
+  retval = ARKodeSetUserData(arkode_mem, &m);
+  if (retval) { return 1; }
+
+  retval = ARKodeSetFixedStep(arkode_mem, ONE);
+  if (retval) { return 1; }
+
+  retval = ARKodeSetMaxNumSteps(arkode_mem, 2 * NSTEPS);
+  if (retval) { return 1; }
+
+  retval = ARKodeSetStopTime(arkode_mem, tf);
+  if (retval) { return 1; }
+
+  retval = ARKodeSetUseCompensatedSums(arkode_mem, compensate);
+  if (retval) { return 1; }
+
+  retval = ARKodeEvolve(arkode_mem, tf, y, &tret, ARK_NORMAL);
+  if (retval < 0) { return 1; }
+
+  *err = N_VGetArrayPointer(y)[0] - (ONE + RATE * tf);
+
+  ARKodeFree(&arkode_mem);
+  SUNLinSolFree(LS);
+  SUNLinSolFree(MLS);
+  SUNMatDestroy(A);
+  SUNMatDestroy(M);
+  N_VDestroy(y);
+
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  int fail          = 0;
+  SUNContext sunctx = NULL;
+  sunrealtype err_std, err_comp;
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx)) { return 1; }
+
+  for (int i = ERK; i <= DIRK_MASS; i++)
+  {
+    if (run_test((method_type)i, SUNFALSE, &err_std, sunctx)) { return 1; }
+    if (run_test((method_type)i, SUNTRUE, &err_comp, sunctx)) { return 1; }
+
+    printf("%s: standard error = %" GSYM ", compensated error = %" GSYM "\n",
+           method_names[i], err_std, err_comp);
+
+    /* the increments are all lost without compensation */
+    if (SUNRabs(err_std) < SUN_RCONST(0.5) * RATE * NSTEPS)
+    {
+      fprintf(stderr, "  Unexpected error without compensated summation\n");
+      fail = 1;
+    }
+
+    if (SUNRabs(err_comp) > SUN_RCONST(4.0) * SUN_UNIT_ROUNDOFF)
+    {
+      fprintf(stderr, "  Error with compensated summation is too large\n");
+      fail = 1;
+    }
+  }
+
+  SUNContext_Free(&sunctx);
+
+  if (!fail) { printf("SUCCESS\n"); }
+
+  return fail;
+}
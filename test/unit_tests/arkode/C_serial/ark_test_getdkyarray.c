@@ -0,0 +1,199 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for computing dense output at several times with one call
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "arkode/arkode_erkstep.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+
+#define NT 5
+
+static int f(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* y_data    = N_VGetArrayPointer(y);
+  sunrealtype* ydot_data = N_VGetArrayPointer(ydot);
+  ydot_data[0]           = -y_data[1];
+  ydot_data[1]           = y_data[0];
+  return 0;
+}
+
+/* Main program */
+int main(int argc, char* argv[])
+{
+  int retval        = 0;
+  int i             = 0;
+  int k             = 0;
+  SUNContext sunctx = NULL;
+  N_Vector y        = NULL;
+  N_Vector dky      = NULL;
+  N_Vector* dkys    = NULL;
+  void* arkode_mem  = NULL;
+  sunrealtype tret  = ZERO;
+  sunrealtype hlast, err;
+  sunrealtype t[NT];
+
+  /* Create the SUNDIALS context object for this simulation. */
+  retval = SUNContext_Create(SUN_COMM_NULL, &sunctx);
+  if (retval)
+  {
+    fprintf(stderr, "SUNContext_Create returned %i\n", retval);
+    return 1;
+  }
+
+  /* Create solution vectors */
+  y = N_VNew_Serial(2, sunctx);
+  if (!y)
+  {
+    fprintf(stderr, "N_VNew_Serial returned NULL\n");
+    return 1;
+  }
+  N_VGetArrayPointer(y)[0] = ONE;
+  N_VGetArrayPointer(y)[1] = ZERO;
+
+  dky = N_VClone(y);
+  if (!dky)
+  {
+    fprintf(stderr, "N_VClone returned NULL\n");
+    return 1;
+  }
+
+  dkys = N_VCloneVectorArray(NT, y);
+  if (!dkys)
+  {
+    fprintf(stderr, "N_VCloneVectorArray returned NULL\n");
+    return 1;
+  }
+
+  /* Create ARKODE mem structure with a quintic Hermite interpolant */
+  arkode_mem = ERKStepCreate(f, ZERO, y, sunctx);
+  if (!arkode_mem)
+  {
+    fprintf(stderr, "ERKStepCreate returned NULL\n");
+    return 1;
+  }
+
+  retval = ARKodeSetInterpolantDegree(arkode_mem, 5);
+  if (retval)
+  {
+    fprintf(stderr, "ARKodeSetInterpolantDegree returned %i\n", retval);
+    return 1;
+  }
+
+  retval = ARKodeSStolerances(arkode_mem, SUN_RCONST(1.0e-6),
+                              SUN_RCONST(1.0e-10));
+  if (retval)
+  {
+    fprintf(stderr, "ARKodeSStolerances returned %i\n", retval);
+    return 1;
+  }
+
+  /* Advance in time */
+  retval = ARKodeEvolve(arkode_mem, ONE, y, &tret, ARK_NORMAL);
+  if (retval < 0)
+  {
+    fprintf(stderr, "ARKodeEvolve returned %i\n", retval);
+    return 1;
+  }
+
+  retval = ARKodeGetLastStep(arkode_mem, &hlast);
+  if (retval)
+  {
+    fprintf(stderr, "ARKodeGetLastStep returned %i\n", retval);
+    return 1;
+  }
+
+  /* Output times spanning the last step (tret may be interpolated) */
+  retval = ARKodeGetCurrentTime(arkode_mem, &tret);
+  if (retval)
+  {
+    fprintf(stderr, "ARKodeGetCurrentTime returned %i\n", retval);
+    return 1;
+  }
+
+  for (i = 0; i < NT; i++)
+  {
+    t[i] = tret - hlast + hlast * ((sunrealtype)i) / ((sunrealtype)(NT - 1));
+  }
+
+  /* Compare batched and single-time dense output */
+  for (k = 0; k <= 5; k++)
+  {
+    retval = ARKodeGetDkyArray(arkode_mem, NT, t, k, dkys);
+    if (retval)
+    {
+      fprintf(stderr, "ARKodeGetDkyArray returned %i for k = %i\n", retval, k);
+      break;
+    }
+
+    for (i = 0; i < NT; i++)
+    {
+      retval = ARKodeGetDky(arkode_mem, t[i], k, dky);
+      if (retval) { break; }
+
+      N_VLinearSum(ONE, dkys[i], -ONE, dky, dky);
+      err = N_VMaxNorm(dky);
+      if (err > SUN_RCONST(100.0) * SUN_UNIT_ROUNDOFF *
+                  SUNMAX(ONE, N_VMaxNorm(dkys[i])))
+      {
+        fprintf(stderr, "k = %i, t = %" GSYM ", difference = %" GSYM "\n", k,
+                t[i], err);
+        retval = 1;
+        break;
+      }
+    }
+    if (retval) { break; }
+  }
+
+  /* Invalid times must be rejected without modifying the outputs */
+  if (!retval)
+  {
+    N_VConst(ZERO, dkys[0]);
+    t[NT - 1] = tret + hlast;
+    if (ARKodeGetDkyArray(arkode_mem, NT, t, 0, dkys) != ARK_BAD_T ||
+        N_VMaxNorm(dkys[0]) != ZERO)
+    {
+      fprintf(stderr, "Expected ARK_BAD_T with unmodified outputs\n");
+      retval = 1;
+    }
+  }
+
+  /* Clean up */
+  ARKodeFree(&arkode_mem);
+  N_VDestroy(y);
+  N_VDestroy(dky);
+  N_VDestroyVectorArray(dkys, NT);
+  SUNContext_Free(&sunctx);
+
+  if (retval)
+  {
+    printf("FAIL\n");
+    return 1;
+  }
+
+  printf("SUCCESS\n");
+  return 0;
+}
+
+/*---- end of file ----*/
@@ -0,0 +1,177 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for the internal dominant eigenvalue estimator in LSRKStep. The
+ * estimate is compared to the exact dominant eigenvalue for
+ *
+ *   1. the 1D heat equation discretized with second order finite differences,
+ *      which has a real dominant eigenvalue, and
+ *   2. a block diagonal system of damped oscillators, which has a dominant
+ *      complex conjugate pair of eigenvalues.
+ * ---------------------------------------------------------------------------*/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "arkode/arkode_lsrkstep.h"
+#include "arkode/arkode_lsrkstep_impl.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+#define TWO  SUN_RCONST(2.0)
+#define PI   SUN_RCONST(3.141592653589793238462643383279502884197169)
+
+#define NX 63
+
+/* Heat equation y' = (y_{i-1} - 2 y_i + y_{i+1}) / dx^2, zero boundaries */
+static int heat(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* yd  = N_VGetArrayPointer(y);
+  sunrealtype* dyd = N_VGetArrayPointer(ydot);
+  sunrealtype dx   = ONE / (NX + 1);
+  sunrealtype c    = ONE / (dx * dx);
+
+  for (int i = 0; i < NX; i++)
+  {
+    sunrealtype yl = (i > 0) ? yd[i - 1] : ZERO;
+    sunrealtype yr = (i < NX - 1) ? yd[i + 1] : ZERO;
+    dyd[i]         = c * (yl - TWO * yd[i] + yr);
+  }
+  return 0;
+}
+
+/* Oscillators (y_{2k}, y_{2k+1})' = [-a_k -b_k; b_k -a_k] (y_{2k}, y_{2k+1})
+   with a_k = 100 (k + 1) and b_k = 10 (k + 1) */
+static int oscillators(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* yd  = N_VGetArrayPointer(y);
+  sunrealtype* dyd = N_VGetArrayPointer(ydot);
+
+  for (int k = 0; k < NX / 2; k++)
+  {
+    sunrealtype a  = SUN_RCONST(100.0) * (k + 1);
+    sunrealtype b  = SUN_RCONST(10.0) * (k + 1);
+    dyd[2 * k]     = -a * yd[2 * k] - b * yd[2 * k + 1];
+    dyd[2 * k + 1] = b * yd[2 * k] - a * yd[2 * k + 1];
+  }
+  dyd[NX - 1] = -yd[NX - 1];
+  return 0;
+}
+
+static int check_estimate(ARKRhsFn f, const char* name, sunrealtype lambdaR,
+                          sunrealtype lambdaI, SUNContext sunctx)
+{
+  int retval        = 0;
+  N_Vector y        = NULL;
+  void* arkode_mem  = NULL;
+  sunrealtype tret  = ZERO;
+  sunrealtype* yd   = NULL;
+  long int nupdates = 0;
+  ARKodeMem ark_mem;
+  ARKodeLSRKStepMem step_mem;
+
+  y = N_VNew_Serial(NX, sunctx);
+  if (!y) { return 1; }
+  yd = N_VGetArrayPointer(y);
+  for (int i = 0; i < NX; i++)
+  {
+    yd[i] = sin(PI * (i + 1) / (NX + 1)) + SUN_RCONST(0.1) * (i % 3);
+  }
+
+  arkode_mem = LSRKStepCreateSTS(f, ZERO, y, sunctx);
+  if (!arkode_mem) { return 1; }
+
+  /* NULL selects the internal estimator (the default) */
+  retval = LSRKStepSetDomEigFn(arkode_mem, NULL);
+  if (retval) { return 1; }
+
+  retval = LSRKStepSetDomEigRelTol(arkode_mem, SUN_RCONST(1.0e-4));
+  if (retval) { return 1; }
+
+  retval = ARKodeSStolerances(arkode_mem, SUN_RCONST(1.0e-4),
+                              SUN_RCONST(1.0e-8));
+  if (retval) { return 1; }
+
+  retval = ARKodeEvolve(arkode_mem, SUN_RCONST(0.01), y, &tret, ARK_NORMAL);
+  if (retval < 0)
+  {
+    printf("ERROR: ARKodeEvolve failed for %s (%i)\n", name, retval);
+    return 1;
+  }
+
+  retval = LSRKStepGetNumDomEigUpdates(arkode_mem, &nupdates);
+  if (retval) { return 1; }
+
+  /* compare the last estimate (without the safety factor) to the exact one */
+  ark_mem  = (ARKodeMem)arkode_mem;
+  step_mem = (ARKodeLSRKStepMem)ark_mem->step_mem;
+
+  sunrealtype estR  = step_mem->lambdaR / step_mem->dom_eig_safety;
+  sunrealtype estI  = SUNRabs(step_mem->lambdaI / step_mem->dom_eig_safety);
+  sunrealtype exact = SUNRsqrt(SUNSQR(lambdaR) + SUNSQR(lambdaI));
+  sunrealtype err   = SUNRsqrt(SUNSQR(estR - lambdaR) + SUNSQR(estI - lambdaI));
+
+  printf("%s: %li updates, %li iterations, estimate = %" GSYM " %+" GSYM
+         "i, exact = %" GSYM " %+" GSYM "i\n",
+         name, nupdates, step_mem->dom_eig_num_iters, estR, estI, lambdaR,
+         lambdaI);
+
+  retval = 0;
+  if (nupdates < 1 || err > SUN_RCONST(0.05) * exact)
+  {
+    printf("ERROR: inaccurate dominant eigenvalue estimate for %s\n", name);
+    retval = 1;
+  }
+
+  ARKodeFree(&arkode_mem);
+  N_VDestroy(y);
+
+  return retval;
+}
+
+/* Main program */
+int main(int argc, char* argv[])
+{
+  int retval        = 0;
+  SUNContext sunctx = NULL;
+  sunrealtype dx    = ONE / (NX + 1);
+  sunrealtype s     = sin(PI * NX / (TWO * (NX + 1)));
+
+  retval = SUNContext_Create(SUN_COMM_NULL, &sunctx);
+  if (retval)
+  {
+    fprintf(stderr, "SUNContext_Create returned %i\n", retval);
+    return 1;
+  }
+
+  retval |= check_estimate(heat, "heat", -SUN_RCONST(4.0) * s * s / (dx * dx),
+                           ZERO, sunctx);
+  retval |= check_estimate(oscillators, "oscillators",
+                           -SUN_RCONST(100.0) * (NX / 2),
+                           SUN_RCONST(10.0) * (NX / 2), sunctx);
+
+  SUNContext_Free(&sunctx);
+
+  if (!retval) { printf("SUCCESS\n"); }
+
+  return retval;
+}
+
+/*---- end of file ----*/
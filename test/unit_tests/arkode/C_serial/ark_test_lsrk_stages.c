@@ -0,0 +1,223 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for the LSRKStep stage vectors. The RKC and RKL stages rotate
+ * through three vectors such that the last stage lands in ycur, so the stage
+ * counts used must cover every remainder modulo three. The test also switches
+ * from an STS method, which does not use tempv3, to an SSP method that does
+ * after the integration has started. The problem
+ *
+ *   y' = lambda (y - cos(t)) - sin(t),  y(0) = 1
+ *
+ * has the solution y(t) = cos(t) for any lambda.
+ * ---------------------------------------------------------------------------*/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "arkode/arkode_lsrkstep.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+/* Precision specific math function macros */
+#if defined(SUNDIALS_DOUBLE_PRECISION)
+#define SIN(x) (sin((x)))
+#define COS(x) (cos((x)))
+#elif defined(SUNDIALS_SINGLE_PRECISION)
+#define SIN(x) (sinf((x)))
+#define COS(x) (cosf((x)))
+#elif defined(SUNDIALS_EXTENDED_PRECISION)
+#define SIN(x) (sinl((x)))
+#define COS(x) (cosl((x)))
+#endif
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+#define H    SUN_RCONST(0.01)
+#define TF   SUN_RCONST(1.0)
+
+/* The error is O(1) if the last stage does not end up in ycur, while the
+   two stage RKC method is close to its stability limit at lambda = -200 */
+#define TOL SUN_RCONST(1.0e-2)
+
+static int f(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype lambda = *((sunrealtype*)user_data);
+  sunrealtype* yd    = N_VGetArrayPointer(y);
+  sunrealtype* dyd   = N_VGetArrayPointer(ydot);
+
+  dyd[0] = lambda * (yd[0] - COS(t)) - SIN(t);
+  return 0;
+}
+
+static int dom_eig(sunrealtype t, N_Vector y, N_Vector fn, sunrealtype* lambdaR,
+                   sunrealtype* lambdaI, void* user_data, N_Vector temp1,
+                   N_Vector temp2, N_Vector temp3)
+{
+  *lambdaR = *((sunrealtype*)user_data);
+  *lambdaI = ZERO;
+  return 0;
+}
+
+/* Integrate to TF with fixed steps using an STS method, optionally switching
+   to an SSP method half way, and return the maximum number of stages used */
+static int solve(ARKODE_LSRKMethodType method, sunrealtype lambda,
+                 sunbooleantype switch_ssp, SUNContext sunctx, int* stages,
+                 sunrealtype* err)
+{
+  int flag         = 0;
+  N_Vector y       = NULL;
+  void* arkode_mem = NULL;
+  sunrealtype tret = ZERO;
+
+  y = N_VNew_Serial(1, sunctx);
+  if (!y) { return 1; }
+  N_VConst(ONE, y);
+
+  arkode_mem = LSRKStepCreateSTS(f, ZERO, y, sunctx);
+  if (!arkode_mem) { return 1; }
+
+  flag = LSRKStepSetSTSMethod(arkode_mem, method);
+  if (flag) { return 1; }
+
+  flag = LSRKStepSetDomEigFn(arkode_mem, dom_eig);
+  if (flag) { return 1; }
+
+  flag = ARKodeSetUserData(arkode_mem, &lambda);
+  if (flag) { return 1; }
+
+  flag = ARKodeSStolerances(arkode_mem, SUN_RCONST(1.0e-8), SUN_RCONST(1.0e-8));
+  if (flag) { return 1; }
+
+  flag = ARKodeSetFixedStep(arkode_mem, H);
+  if (flag) { return 1; }
+
+  flag = ARKodeSetStopTime(arkode_mem, TF);
+  if (flag) { return 1; }
+
+  if (switch_ssp)
+  {
+    flag = ARKodeEvolve(arkode_mem, SUN_RCONST(0.5) * TF, y, &tret, ARK_NORMAL);
+    if (flag < 0) { return 1; }
+
+    flag = LSRKStepSetSSPMethod(arkode_mem, ARKODE_LSRK_SSP_S_3);
+    if (flag) { return 1; }
+  }
+
+  flag = ARKodeEvolve(arkode_mem, TF, y, &tret, ARK_NORMAL);
+  if (flag < 0) { return 1; }
+
+  flag = LSRKStepGetMaxNumStages(arkode_mem, stages);
+  if (flag) { return 1; }
+
+  *err = SUNRabs(N_VGetArrayPointer(y)[0] - COS(tret));
+
+  ARKodeFree(&arkode_mem);
+  N_VDestroy(y);
+
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  SUNContext sunctx = NULL;
+
+  int flag        = 0;
+  int fails       = 0;
+  int stages      = 0;
+  int remainders  = 0;
+  sunrealtype err = ZERO;
+
+  const ARKODE_LSRKMethodType methods[] = {ARKODE_LSRK_RKC_2,
+                                           ARKODE_LSRK_RKL_2};
+  const char* names[]                   = {"RKC", "RKL"};
+
+  flag = SUNContext_Create(SUN_COMM_NULL, &sunctx);
+  if (flag)
+  {
+    fprintf(stderr, "SUNContext_Create returned %i\n", flag);
+    return 1;
+  }
+
+  /* Increase the stiffness until every stage count remainder is covered */
+  for (int m = 0; m < 2; m++)
+  {
+    remainders = 0;
+    for (int i = 1; i <= 12; i++)
+    {
+      sunrealtype lambda = -SUN_RCONST(50.0) * i * i;
+
+      flag = solve(methods[m], lambda, SUNFALSE, sunctx, &stages, &err);
+      if (flag)
+      {
+        printf("ERROR: %s solve failed with lambda = %" GSYM "\n", names[m],
+               lambda);
+        return 1;
+      }
+
+      printf("%s: lambda = %" GSYM ", stages = %i, error = %" GSYM "\n",
+             names[m], lambda, stages, err);
+
+      if (err > TOL)
+      {
+        printf("ERROR: %s error is too large\n", names[m]);
+        fails++;
+      }
+      remainders |= 1 << (stages % 3);
+    }
+
+    if (remainders != 7)
+    {
+      printf("ERROR: %s stage counts do not cover every remainder\n", names[m]);
+      fails++;
+    }
+  }
+
+  /* Switch from an STS method to an SSP method after the first steps */
+  for (int m = 0; m < 2; m++)
+  {
+    flag = solve(methods[m], -SUN_RCONST(100.0), SUNTRUE, sunctx, &stages,
+                 &err);
+    if (flag)
+    {
+      printf("ERROR: %s to SSP solve failed\n", names[m]);
+      return 1;
+    }
+
+    printf("%s to SSP: error = %" GSYM "\n", names[m], err);
+
+    if (err > TOL)
+    {
+      printf("ERROR: %s to SSP error is too large\n", names[m]);
+      fails++;
+    }
+  }
+
+  SUNContext_Free(&sunctx);
+
+  if (fails)
+  {
+    printf("FAIL\n");
+    return 1;
+  }
+
+  printf("SUCCESS\n");
+  return 0;
+}
+
+/*---- end of file ----*/
@@ -0,0 +1,176 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test checking that an adaptive MRI-GARK method only resets the inner
+ * stepper when its state does not already match the start of a slow step. The
+ * multirate Dahlquist problem y' = lambda_s y + lambda_f y is solved with a
+ * custom forward Euler inner stepper that counts the number of resets.
+ * ---------------------------------------------------------------------------*/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "arkode/arkode.h"
+#include "arkode/arkode_mristep.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+
+#define LAMBDA_S SUN_RCONST(-1.0)
+#define LAMBDA_F SUN_RCONST(-10.0)
+#define NSUB     100
+
+typedef struct
+{
+  long int nresets;
+  sunrealtype tcur;
+} InnerContent;
+
+static int ode_slow_rhs(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  N_VScale(LAMBDA_S, y, ydot);
+  return 0;
+}
+
+/* Forward Euler substeps for v' = lambda_f v + r(t) with the MRI forcing r */
+static int fast_evolve(MRIStepInnerStepper fast_mem, sunrealtype t0,
+                       sunrealtype tf, N_Vector y)
+{
+  int retval, nforcing;
+  sunrealtype tshift, tscale, tau, r;
+  N_Vector* forcing;
+  void* content;
+  InnerContent* inner;
+  sunrealtype* ydata = N_VGetArrayPointer(y);
+  sunrealtype h      = (tf - t0) / NSUB;
+
+  retval = MRIStepInnerStepper_GetContent(fast_mem, &content);
+  if (retval) { return -1; }
+  inner = (InnerContent*)content;
+
+  /* the inner state must continue from where it was left or was reset to */
+  if (SUNRabs(t0 - inner->tcur) > SUN_RCONST(1.0e-12)) { return -1; }
+
+  retval = MRIStepInnerStepper_GetForcingData(fast_mem, &tshift, &tscale,
+                                              &forcing, &nforcing);
+  if (retval) { return -1; }
+
+  for (int i = 0; i < NSUB; i++)
+  {
+    tau = (t0 + i * h - tshift) / tscale;
+    r   = ZERO;
+    for (int k = nforcing - 1; k >= 0; k--)
+    {
+      r = r * tau + N_VGetArrayPointer(forcing[k])[0];
+    }
+    ydata[0] += h * (LAMBDA_F * ydata[0] + r);
+  }
+  inner->tcur = tf;
+
+  return 0;
+}
+
+static int fast_reset(MRIStepInnerStepper fast_mem, sunrealtype tR, N_Vector yR)
+{
+  void* content;
+  if (MRIStepInnerStepper_GetContent(fast_mem, &content)) { return -1; }
+  ((InnerContent*)content)->nresets++;
+  ((InnerContent*)content)->tcur = tR;
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  SUNContext sunctx            = NULL;
+  N_Vector y                   = NULL;
+  void* arkode_mem             = NULL;
+  MRIStepInnerStepper fast_mem = NULL;
+  InnerContent inner           = {0, ZERO};
+  sunrealtype tout             = ONE;
+  sunrealtype tret             = ZERO;
+  long int nst, nst_a, expected;
+  sunrealtype err;
+  int flag = 0;
+
+  flag = SUNContext_Create(SUN_COMM_NULL, &sunctx);
+  if (flag) { return 1; }
+
+  y = N_VNew_Serial(1, sunctx);
+  if (!y) { return 1; }
+  N_VConst(ONE, y);
+
+  flag = MRIStepInnerStepper_Create(sunctx, &fast_mem);
+  if (flag) { return 1; }
+
+  flag = MRIStepInnerStepper_SetContent(fast_mem, &inner);
+  if (flag) { return 1; }
+
+  flag = MRIStepInnerStepper_SetEvolveFn(fast_mem, fast_evolve);
+  if (flag) { return 1; }
+
+  flag = MRIStepInnerStepper_SetResetFn(fast_mem, fast_reset);
+  if (flag) { return 1; }
+
+  arkode_mem = MRIStepCreate(ode_slow_rhs, NULL, ZERO, y, fast_mem, sunctx);
+  if (!arkode_mem) { return 1; }
+
+  flag = ARKodeSStolerances(arkode_mem, SUN_RCONST(1.0e-4), SUN_RCONST(1.0e-8));
+  if (flag) { return 1; }
+
+  flag = ARKodeSetInterpolantType(arkode_mem, ARK_INTERP_LAGRANGE);
+  if (flag) { return 1; }
+
+  flag = ARKodeEvolve(arkode_mem, tout, y, &tret, ARK_NORMAL);
+  if (flag < 0)
+  {
+    printf("ERROR: ARKodeEvolve returned %i\n", flag);
+    return 1;
+  }
+  flag = 0;
+
+  (void)ARKodeGetNumSteps(arkode_mem, &nst);
+  (void)ARKodeGetNumStepAttempts(arkode_mem, &nst_a);
+
+  /* One reset restores the state after each embedding and the inner stepper
+     is only reset at the start of the first step and of each retried step */
+  expected = nst_a + 1 + (nst_a - nst);
+  err = SUNRabs(N_VGetArrayPointer(y)[0] - exp((LAMBDA_S + LAMBDA_F) * tret));
+
+  printf("steps = %li, attempts = %li, resets = %li (expected %li)\n", nst,
+         nst_a, inner.nresets, expected);
+  printf("error = %g\n", (double)err);
+
+  if (inner.nresets != expected)
+  {
+    printf("ERROR: unexpected number of inner stepper resets\n");
+    flag = 1;
+  }
+
+  if (err > SUN_RCONST(1.0e-2))
+  {
+    printf("ERROR: inaccurate solution\n");
+    flag = 1;
+  }
+
+  MRIStepInnerStepper_Free(&fast_mem);
+  ARKodeFree(&arkode_mem);
+  N_VDestroy(y);
+  SUNContext_Free(&sunctx);
+
+  if (!flag) { printf("SUCCESS\n"); }
+
+  return flag;
+}
+
+/*---- end of file ----*/
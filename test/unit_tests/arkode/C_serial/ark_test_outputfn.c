@@ -0,0 +1,208 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for the solution output function
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "arkode/arkode_erkstep.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+
+#define LAMBDA SUN_RCONST(-1.0)
+#define TOUT0  SUN_RCONST(0.0)
+#define DTOUT  SUN_RCONST(0.1)
+#define TF     SUN_RCONST(1.0)
+#define NSTEPS 3
+
+typedef struct
+{
+  long int ngrid;  /* number of grid outputs received */
+  long int nstep;  /* number of step outputs received */
+  sunrealtype err; /* max error in the grid outputs   */
+} OutputData;
+
+static int f(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  N_VScale(LAMBDA, y, ydot);
+  return 0;
+}
+
+static int output(sunrealtype t, N_Vector y, void* user_data)
+{
+  OutputData* data = (OutputData*)user_data;
+  sunrealtype tgrid;
+
+  /* Grid outputs arrive in order before any step output at the same time */
+  tgrid = TOUT0 + data->ngrid * DTOUT;
+  if (SUNRabs(t - tgrid) <= SUN_RCONST(10.0) * SUN_UNIT_ROUNDOFF)
+  {
+    data->err = SUNMAX(data->err, SUNRabs(N_VGetArrayPointer(y)[0] -
+                                          SUNRexp(LAMBDA * t)));
+    data->ngrid++;
+  }
+  else { data->nstep++; }
+
+  return 0;
+}
+
+/* Main program */
+int main(int argc, char* argv[])
+{
+  int retval        = 0;
+  SUNContext sunctx = NULL;
+  N_Vector y        = NULL;
+  void* arkode_mem  = NULL;
+  sunrealtype tret  = ZERO;
+  long int nst      = 0;
+  OutputData data   = {0, 0, ZERO};
+
+  /* Create the SUNDIALS context object for this simulation. */
+  retval = SUNContext_Create(SUN_COMM_NULL, &sunctx);
+  if (retval)
+  {
+    fprintf(stderr, "SUNContext_Create returned %i\n", retval);
+    return 1;
+  }
+
+  /* Create solution vector and initialize to one */
+  y = N_VNew_Serial(1, sunctx);
+  if (!y)
+  {
+    fprintf(stderr, "N_VNew_Serial returned NULL\n");
+    return 1;
+  }
+  N_VConst(ONE, y);
+
+  /* Create ARKODE mem structure */
+  arkode_mem = ERKStepCreate(f, ZERO, y, sunctx);
+  if (!arkode_mem)
+  {
+    fprintf(stderr, "ERKStepCreate returned NULL\n");
+    return 1;
+  }
+
+  retval = ARKodeSStolerances(arkode_mem, SUN_RCONST(1.0e-8),
+                              SUN_RCONST(1.0e-12));
+  if (retval)
+  {
+    fprintf(stderr, "ARKodeSStolerances returned %i\n", retval);
+    return 1;
+  }
+
+  retval = ARKodeSetUserData(arkode_mem, &data);
+  if (retval)
+  {
+    fprintf(stderr, "ARKodeSetUserData returned %i\n", retval);
+    return 1;
+  }
+
+  /* Request output on a time grid and every few steps */
+  retval = ARKodeSetOutputFn(arkode_mem, output);
+  if (retval)
+  {
+    fprintf(stderr, "ARKodeSetOutputFn returned %i\n", retval);
+    return 1;
+  }
+
+  retval = ARKodeSetOutputTimes(arkode_mem, TOUT0, DTOUT);
+  if (retval)
+  {
+    fprintf(stderr, "ARKodeSetOutputTimes returned %i\n", retval);
+    return 1;
+  }
+
+  retval = ARKodeSetOutputStepInterval(arkode_mem, NSTEPS);
+  if (retval)
+  {
+    fprintf(stderr, "ARKodeSetOutputStepInterval returned %i\n", retval);
+    return 1;
+  }
+
+  /* Advance to the final time (stopping there exactly) in two calls */
+  retval = ARKodeSetStopTime(arkode_mem, TF);
+  if (retval)
+  {
+    fprintf(stderr, "ARKodeSetStopTime returned %i\n", retval);
+    return 1;
+  }
+
+  retval = ARKodeEvolve(arkode_mem, SUN_RCONST(0.55), y, &tret, ARK_NORMAL);
+  if (retval < 0)
+  {
+    fprintf(stderr, "ARKodeEvolve returned %i\n", retval);
+    return 1;
+  }
+
+  retval = ARKodeEvolve(arkode_mem, TF, y, &tret, ARK_NORMAL);
+  if (retval < 0)
+  {
+    fprintf(stderr, "ARKodeEvolve returned %i\n", retval);
+    return 1;
+  }
+
+  retval = ARKodeGetNumSteps(arkode_mem, &nst);
+  if (retval)
+  {
+    fprintf(stderr, "ARKodeGetNumSteps returned %i\n", retval);
+    return 1;
+  }
+
+  /* Check the outputs received */
+  retval = 0;
+  printf("grid outputs = %li, step outputs = %li, max error = %" GSYM "\n",
+         data.ngrid, data.nstep, data.err);
+
+  if (data.ngrid != 11)
+  {
+    fprintf(stderr, "Expected 11 grid outputs\n");
+    retval = 1;
+  }
+
+  if (data.nstep != nst / NSTEPS)
+  {
+    fprintf(stderr, "Expected %li step outputs\n", nst / NSTEPS);
+    retval = 1;
+  }
+
+  if (data.err > SUN_RCONST(1.0e-6))
+  {
+    fprintf(stderr, "Grid output error is too large\n");
+    retval = 1;
+  }
+
+  /* Clean up */
+  ARKodeFree(&arkode_mem);
+  N_VDestroy(y);
+  SUNContext_Free(&sunctx);
+
+  if (retval)
+  {
+    printf("FAIL\n");
+    return 1;
+  }
+
+  printf("SUCCESS\n");
+  return 0;
+}
+
+/*---- end of file ----*/
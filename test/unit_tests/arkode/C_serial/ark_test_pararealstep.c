@@ -0,0 +1,226 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit tests for the PararealStep module on the Prothero-Robinson problem
+ *
+ *   y' = lambda (y - cos(t)) - sin(t),  y(0) = 1,
+ *
+ * with the exact solution y(t) = cos(t). The coarse propagator is a second
+ * order ERK method taking one step per slice and the fine propagators are a
+ * fourth order ERK method with much smaller steps. Each fine propagator is
+ * created with its own SUNContext so they may be evolved concurrently.
+ * ---------------------------------------------------------------------------*/
+
+#include <math.h>
+#include <arkode/arkode_erkstep.h>
+#include <arkode/arkode_pararealstep.h>
+#include <nvector/nvector_serial.h>
+#include <sundials/sundials_math.h>
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define LAMBDA  SUN_RCONST(-10.0)
+#define T0      SUN_RCONST(0.0)
+#define TF      SUN_RCONST(1.0)
+#define H       SUN_RCONST(0.5)
+#define NSLICES 8
+#define NFINE   3
+#define NSUB    16
+
+static int f(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* yd = N_VGetArrayPointer(y);
+  N_VGetArrayPointer(ydot)[0] = LAMBDA * (yd[0] - cos(t)) - sin(t);
+  return 0;
+}
+
+/* Sets up the coarse and fine steppers, integrates to TF with PararealStep,
+ * and returns the solution and the number of iterations */
+static int run_parareal(sunrealtype tol, sunrealtype* ysol, long int* iters,
+                        SUNContext ctx)
+{
+  N_Vector y = N_VNew_Serial(1, ctx);
+  N_VConst(SUN_RCONST(1.0), y);
+
+  void* coarse_mem = ERKStepCreate(f, T0, y, ctx);
+  ERKStepSetTableNum(coarse_mem, ARKODE_HEUN_EULER_2_1_2);
+  ARKodeSetFixedStep(coarse_mem, H / NSLICES);
+  SUNStepper coarse = NULL;
+  ARKodeCreateSUNStepper(coarse_mem, &coarse);
+
+  SUNContext fine_ctx[NFINE];
+  N_Vector fine_y[NFINE];
+  void* fine_mem[NFINE];
+  SUNStepper fine[NFINE];
+  for (int l = 0; l < NFINE; l++)
+  {
+    SUNContext_Create(SUN_COMM_NULL, &fine_ctx[l]);
+    fine_y[l] = N_VNew_Serial(1, fine_ctx[l]);
+    N_VConst(SUN_RCONST(1.0), fine_y[l]);
+    fine_mem[l] = ERKStepCreate(f, T0, fine_y[l], fine_ctx[l]);
+    ARKodeSetFixedStep(fine_mem[l], H / (NSLICES * NSUB));
+    ARKodeCreateSUNStepper(fine_mem[l], &fine[l]);
+  }
+
+  void* arkode_mem = PararealStepCreate(coarse, fine, NFINE, T0, y, ctx);
+  ARKodeSetFixedStep(arkode_mem, H);
+  ARKodeSStolerances(arkode_mem, SUN_RCONST(1.0e-6), SUN_RCONST(1.0e-8));
+  PararealStepSetNumSlices(arkode_mem, NSLICES);
+  PararealStepSetTolerance(arkode_mem, tol);
+
+  sunrealtype tret = T0;
+  int retval       = ARKodeEvolve(arkode_mem, TF, y, &tret, ARK_NORMAL);
+
+  *ysol = N_VGetArrayPointer(y)[0];
+  PararealStepGetNumIters(arkode_mem, iters);
+  ARKodePrintAllStats(arkode_mem, stdout, SUN_OUTPUTFORMAT_TABLE);
+
+  ARKodeFree(&arkode_mem);
+  ARKodeFree(&coarse_mem);
+  SUNStepper_Destroy(&coarse);
+  for (int l = 0; l < NFINE; l++)
+  {
+    ARKodeFree(&fine_mem[l]);
+    SUNStepper_Destroy(&fine[l]);
+    N_VDestroy(fine_y[l]);
+    SUNContext_Free(&fine_ctx[l]);
+  }
+  N_VDestroy(y);
+
+  return retval;
+}
+
+/* Integrates each slice sequentially with the fine propagator */
+static sunrealtype run_sequential(SUNContext ctx)
+{
+  N_Vector y = N_VNew_Serial(1, ctx);
+  N_VConst(SUN_RCONST(1.0), y);
+
+  void* fine_mem = ERKStepCreate(f, T0, y, ctx);
+  ARKodeSetFixedStep(fine_mem, H / (NSLICES * NSUB));
+  SUNStepper fine = NULL;
+  ARKodeCreateSUNStepper(fine_mem, &fine);
+
+  sunrealtype tret = T0;
+  for (sunrealtype tn = T0; tn < TF; tn += H)
+  {
+    for (int p = 0; p < NSLICES; p++)
+    {
+      sunrealtype t0 = tn + (H * p) / NSLICES;
+      sunrealtype tf = (p == NSLICES - 1) ? tn + H
+                                          : tn + (H * (p + 1)) / NSLICES;
+      SUNStepper_Reset(fine, t0, y);
+      SUNStepper_SetStopTime(fine, tf);
+      SUNStepper_Evolve(fine, tf, y, &tret);
+    }
+  }
+
+  sunrealtype ysol = N_VGetArrayPointer(y)[0];
+
+  ARKodeFree(&fine_mem);
+  SUNStepper_Destroy(&fine);
+  N_VDestroy(y);
+
+  return ysol;
+}
+
+/* Fine SUNSteppers that share a SUNContext may not be evolved concurrently, so
+ * PararealStepCreate must reject them. Returns 1 if they are accepted. */
+static int check_shared_context(SUNContext ctx)
+{
+  N_Vector y = N_VNew_Serial(1, ctx);
+  N_VConst(SUN_RCONST(1.0), y);
+
+  void* stepper_mem[3];
+  SUNStepper steppers[3];
+  for (int l = 0; l < 3; l++)
+  {
+    stepper_mem[l] = ERKStepCreate(f, T0, y, ctx);
+    ARKodeCreateSUNStepper(stepper_mem[l], &steppers[l]);
+  }
+
+  void* arkode_mem = PararealStepCreate(steppers[0], steppers + 1, 2, T0, y,
+                                        ctx);
+  int fail         = (arkode_mem != NULL);
+
+  ARKodeFree(&arkode_mem);
+  for (int l = 0; l < 3; l++)
+  {
+    ARKodeFree(&stepper_mem[l]);
+    SUNStepper_Destroy(&steppers[l]);
+  }
+  N_VDestroy(y);
+
+  return fail;
+}
+
+int main(int argc, char* argv[])
+{
+  SUNContext ctx = NULL;
+  int fail       = 0;
+  long int iters = 0;
+  sunrealtype ysol;
+
+  if (SUNContext_Create(SUN_COMM_NULL, &ctx)) { return 1; }
+
+  sunrealtype yseq   = run_sequential(ctx);
+  sunrealtype yexact = cos(TF);
+  long int nsteps    = (long int)((TF - T0) / H);
+
+  /* Without a tolerance, Parareal iterates until every slice has converged
+     and must reproduce the sequential fine solution to roundoff */
+  if (run_parareal(SUN_RCONST(0.0), &ysol, &iters, ctx) < 0) { return 1; }
+  printf("Exact iterations: %li iterations, difference from sequential "
+         "solution = %" GSYM "\n\n",
+         iters, ysol - yseq);
+  if (iters != nsteps * NSLICES)
+  {
+    fprintf(stderr, "Unexpected number of iterations\n");
+    fail = 1;
+  }
+  if (SUNRCompareTol(ysol, yseq, SUN_RCONST(10.0) * SUN_UNIT_ROUNDOFF))
+  {
+    fprintf(stderr, "Parareal does not match the sequential fine solution\n");
+    fail = 1;
+  }
+
+  /* With the default tolerance, Parareal should converge in fewer iterations
+     while remaining close to the exact solution */
+  if (run_parareal(SUN_RCONST(1.0), &ysol, &iters, ctx) < 0) { return 1; }
+  printf("Default tolerance: %li iterations, error = %" GSYM "\n\n", iters,
+         ysol - yexact);
+  if (iters >= nsteps * NSLICES)
+  {
+    fprintf(stderr, "Parareal did not converge early\n");
+    fail = 1;
+  }
+  if (SUNRCompareTol(ysol, yexact, SUN_RCONST(1.0e-5)))
+  {
+    fprintf(stderr, "Error exceeded tolerance\n");
+    fail = 1;
+  }
+
+  if (check_shared_context(ctx))
+  {
+    fprintf(stderr, "Fine steppers sharing a context were accepted\n");
+    fail = 1;
+  }
+
+  SUNContext_Free(&ctx);
+
+  if (!fail) { printf("SUCCESS\n"); }
+
+  return fail;
+}
@@ -0,0 +1,293 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for relaxation with a quadratic relaxation function on the problem
+ *
+ *   y0' =  w1 y1,  y0(0) = 1,
+ *   y1' = -w0 y0,  y1(0) = 0,
+ *
+ * that conserves the energy xi(y) = 1/2 (w0 y0^2 + w1 y1^2). The solution with
+ * the quadratic relaxation function declared by ARKodeSetRelaxQuadratic is
+ * compared to the solution with user-supplied relaxation functions and should
+ * conserve the energy at least as well without evaluating the user functions.
+ * With an ERK method the energy is conserved to roundoff while with a DIRK
+ * method it is conserved to the accuracy of the stage solves. Replacing the
+ * quadratic function with user-supplied functions should free its weights.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "arkode/arkode_arkstep.h"
+#include "arkode/arkode_erkstep.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_dense.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define ZERO SUN_RCONST(0.0)
+#define HALF SUN_RCONST(0.5)
+#define ONE  SUN_RCONST(1.0)
+#define W0   SUN_RCONST(1.0)
+#define W1   SUN_RCONST(4.0)
+#define TF   SUN_RCONST(10.0)
+
+static int f(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* yd  = N_VGetArrayPointer(y);
+  sunrealtype* ydd = N_VGetArrayPointer(ydot);
+  ydd[0]           = W1 * yd[1];
+  ydd[1]           = -W0 * yd[0];
+  return 0;
+}
+
+static int Jac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix J,
+               void* user_data, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3)
+{
+  SM_ELEMENT_D(J, 0, 0) = ZERO;
+  SM_ELEMENT_D(J, 0, 1) = W1;
+  SM_ELEMENT_D(J, 1, 0) = -W0;
+  SM_ELEMENT_D(J, 1, 1) = ZERO;
+  return 0;
+}
+
+static sunrealtype energy(N_Vector y)
+{
+  sunrealtype* yd = N_VGetArrayPointer(y);
+  return HALF * (W0 * yd[0] * yd[0] + W1 * yd[1] * yd[1]);
+}
+
+static int rfn(N_Vector y, sunrealtype* r, void* user_data)
+{
+  *r = energy(y);
+  return 0;
+}
+
+static int rjac(N_Vector y, N_Vector J, void* user_data)
+{
+  sunrealtype* yd = N_VGetArrayPointer(y);
+  sunrealtype* Jd = N_VGetArrayPointer(J);
+  Jd[0]           = W0 * yd[0];
+  Jd[1]           = W1 * yd[1];
+  return 0;
+}
+
+/* Integrates to TF and returns the final solution and relaxation statistics */
+static int run_test(sunbooleantype dirk, sunbooleantype quadratic, N_Vector y,
+                    long int* nfe_relax, long int* nje_relax,
+                    SUNContext sunctx)
+{
+  int retval         = 0;
+  sunrealtype tret   = ZERO;
+  void* arkode_mem   = NULL;
+  N_Vector w         = NULL;
+  SUNMatrix A        = NULL;
+  SUNLinearSolver LS = NULL;
+
+  N_VGetArrayPointer(y)[0] = ONE;
+  N_VGetArrayPointer(y)[1] = ZERO;
+
+  if (dirk)
+  {
+    arkode_mem = ARKStepCreate(NULL, f, ZERO, y, sunctx);
+    if (!arkode_mem) { return 1; }
+
+    /* relaxation requires non-negative weights b */
+    retval = ARKStepSetTableNum(arkode_mem, ARKODE_SDIRK_2_1_2,
+                                ARKODE_ERK_NONE);
+    if (retval) { return 1; }
+
+    A  = SUNDenseMatrix(2, 2, sunctx);
+    LS = SUNLinSol_Dense(y, A, sunctx);
+    if (!A || !LS) { return 1; }
+
+    retval = ARKodeSetLinearSolver(arkode_mem, LS, A);
+    if (retval) { return 1; }
+
+    retval = ARKodeSetJacFn(arkode_mem, Jac);
+    if (retval) { return 1; }
+
+    retval = ARKodeSetLinear(arkode_mem, 0);
+    if (retval) { return 1; }
+  }
+  else { arkode_mem = ERKStepCreate(f, ZERO, y, sunctx); }
+  if (!arkode_mem) { return 1; }
+
+  retval = ARKodeSStolerances(arkode_mem, SUN_RCONST(1.0e-6),
+                              SUN_RCONST(1.0e-10));
+  if (retval) { return 1; }
+
+  if (quadratic)
+  {
+    w = N_VClone(y);
+    if (!w) { return 1; }
+    N_VGetArrayPointer(w)[0] = W0;
+    N_VGetArrayPointer(w)[1] = W1;
+
+    retval = ARKodeSetRelaxQuadratic(arkode_mem, w);
+    if (retval) { return 1; }
+
+    /* the weights are copied */
+    N_VDestroy(w);
+  }
+  else
+  {
+    retval = ARKodeSetRelaxFn(arkode_mem, rfn, rjac);
+    if (retval) { return 1; }
+  }
+
+  retval = ARKodeSetMaxNumSteps(arkode_mem, 20000);
+  if (retval) { return 1; }
+
+  retval = ARKodeSetStopTime(arkode_mem, TF);
+  if (retval) { return 1; }
+
+  retval = ARKodeEvolve(arkode_mem, TF, y, &tret, ARK_NORMAL);
+  if (retval < 0) { return 1; }
+
+  retval = ARKodeGetNumRelaxFnEvals(arkode_mem, nfe_relax);
+  if (retval) { return 1; }
+
+  retval = ARKodeGetNumRelaxJacEvals(arkode_mem, nje_relax);
+  if (retval) { return 1; }
+
+  ARKodeFree(&arkode_mem);
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+
+  return 0;
+}
+
+/* Checks that the weights are freed when switching to user functions */
+static int check_workspace(N_Vector y, SUNContext sunctx)
+{
+  int retval       = 0;
+  void* arkode_mem = NULL;
+  N_Vector w       = NULL;
+  long int lenrw_fn, lenrw_quad, lenrw, leniw;
+
+  arkode_mem = ERKStepCreate(f, ZERO, y, sunctx);
+  if (!arkode_mem) { return 1; }
+
+  w = N_VClone(y);
+  if (!w) { return 1; }
+  N_VConst(ONE, w);
+
+  retval = ARKodeSetRelaxFn(arkode_mem, rfn, rjac);
+  if (retval) { return 1; }
+
+  retval = ARKodeGetWorkSpace(arkode_mem, &lenrw_fn, &leniw);
+  if (retval) { return 1; }
+
+  retval = ARKodeSetRelaxQuadratic(arkode_mem, w);
+  if (retval) { return 1; }
+
+  retval = ARKodeGetWorkSpace(arkode_mem, &lenrw_quad, &leniw);
+  if (retval) { return 1; }
+
+  retval = ARKodeSetRelaxFn(arkode_mem, rfn, rjac);
+  if (retval) { return 1; }
+
+  retval = ARKodeGetWorkSpace(arkode_mem, &lenrw, &leniw);
+  if (retval) { return 1; }
+
+  printf("real workspace: user = %li, quadratic = %li, user again = %li\n",
+         lenrw_fn, lenrw_quad, lenrw);
+
+  N_VDestroy(w);
+  ARKodeFree(&arkode_mem);
+
+  return (lenrw_quad <= lenrw_fn || lenrw != lenrw_fn);
+}
+
+int main(int argc, char* argv[])
+{
+  int fail          = 0;
+  SUNContext sunctx = NULL;
+  N_Vector y_user, y_quad;
+  long int nfe_user, nje_user, nfe_quad, nje_quad;
+  sunrealtype e0, e_user, e_quad, etol, diff;
+  const char* names[2] = {"ERK", "DIRK"};
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx)) { return 1; }
+
+  y_user = N_VNew_Serial(2, sunctx);
+  y_quad = N_VNew_Serial(2, sunctx);
+  if (!y_user || !y_quad) { return 1; }
+
+  /* initial energy */
+  e0 = HALF * W0;
+
+  for (int dirk = 0; dirk < 2; dirk++)
+  {
+    if (run_test(dirk, SUNFALSE, y_user, &nfe_user, &nje_user, sunctx))
+    {
+      return 1;
+    }
+    if (run_test(dirk, SUNTRUE, y_quad, &nfe_quad, &nje_quad, sunctx))
+    {
+      return 1;
+    }
+
+    e_user = energy(y_user);
+    e_quad = energy(y_quad);
+
+    N_VLinearSum(ONE, y_user, -ONE, y_quad, y_user);
+    diff = N_VMaxNorm(y_user);
+
+    printf("%s: user energy error = %" GSYM ", quadratic energy error = %" GSYM
+           ", solution difference = %" GSYM "\n",
+           names[dirk], e_user - e0, e_quad - e0, diff);
+    printf("  user relax fn evals = %li, jac evals = %li\n", nfe_user,
+           nje_user);
+
+    etol = SUN_RCONST(100.0) * SUN_UNIT_ROUNDOFF;
+    if (dirk) { etol += SUN_RCONST(2.0) * SUNRabs(e_user - e0); }
+
+    if (SUNRabs(e_quad - e0) > etol)
+    {
+      fprintf(stderr, "  Energy is not conserved with a quadratic function\n");
+      fail = 1;
+    }
+
+    if (diff > SUN_RCONST(1.0e-10))
+    {
+      fprintf(stderr, "  Solutions with user and quadratic functions differ\n");
+      fail = 1;
+    }
+
+    if (nfe_quad != 0 || nje_quad != 0)
+    {
+      fprintf(stderr, "  User functions evaluated with a quadratic function\n");
+      fail = 1;
+    }
+  }
+
+  if (check_workspace(y_user, sunctx))
+  {
+    fprintf(stderr, "  Weights not freed with user functions\n");
+    fail = 1;
+  }
+
+  N_VDestroy(y_user);
+  N_VDestroy(y_quad);
+  SUNContext_Free(&sunctx);
+
+  if (!fail) { printf("SUCCESS\n"); }
+
+  return fail;
+}
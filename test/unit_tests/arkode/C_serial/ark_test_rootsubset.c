@@ -0,0 +1,205 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for evaluating a subset of the root functions on the problem
+ *
+ *   y' = 1,  y(0) = 0,
+ *
+ * with the NRT threshold functions g_i(t, y) = y - c_i, c_i = (i + 1/2) / 10,
+ * that have roots at t = c_i. The roots found when evaluating all functions
+ * are compared to those found with a subset function and bounds on the rate of
+ * change of the functions, and the latter should need far fewer evaluations of
+ * the individual functions. Every call to either function must be counted in
+ * the number of root function evaluations.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "arkode/arkode_erkstep.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+#define NRT  100
+#define TF   SUN_RCONST(10.0)
+
+/* number of root function calls and individual function evaluations */
+static long int ncalls = 0;
+static long int ncomp  = 0;
+
+static sunrealtype threshold(int i)
+{
+  return (i + SUN_RCONST(0.5)) / SUN_RCONST(10.0);
+}
+
+static int f(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  N_VConst(ONE, ydot);
+  return 0;
+}
+
+static int g(sunrealtype t, N_Vector y, sunrealtype* gout, void* user_data)
+{
+  sunrealtype yval = N_VGetArrayPointer(y)[0];
+  for (int i = 0; i < NRT; i++) { gout[i] = yval - threshold(i); }
+  ncalls++;
+  ncomp += NRT;
+  return 0;
+}
+
+static int gsub(sunrealtype t, N_Vector y, sunrealtype* gout,
+                const sunbooleantype* gmask, void* user_data)
+{
+  sunrealtype yval = N_VGetArrayPointer(y)[0];
+  for (int i = 0; i < NRT; i++)
+  {
+    if (!gmask[i]) { continue; }
+    gout[i] = yval - threshold(i);
+    ncomp++;
+  }
+  ncalls++;
+  return 0;
+}
+
+/* Integrates to TF and stores the times of the roots found */
+static int run_test(sunbooleantype sparse, sunrealtype* troots, int* nroots,
+                    SUNContext sunctx)
+{
+  int retval         = 0;
+  sunrealtype tret   = ZERO;
+  long int nge       = 0;
+  void* arkode_mem   = NULL;
+  sunrealtype gdotmax[NRT];
+
+  N_Vector y = N_VNew_Serial(1, sunctx);
+  if (!y) { return 1; }
+  N_VConst(ZERO, y);
+
+  arkode_mem = ERKStepCreate(f, ZERO, y, sunctx);
+  if (!arkode_mem) { return 1; }
+
+  retval = ARKodeSStolerances(arkode_mem, SUN_RCONST(1.0e-6),
+                              SUN_RCONST(1.0e-10));
+  if (retval) { return 1; }
+
+  retval = ARKodeSetMaxStep(arkode_mem, SUN_RCONST(0.1));
+  if (retval) { return 1; }
+
+  retval = ARKodeSetStopTime(arkode_mem, TF);
+  if (retval) { return 1; }
+
+  retval = ARKodeRootInit(arkode_mem, NRT, g);
+  if (retval) { return 1; }
+
+  if (sparse)
+  {
+    /* |dg_i/dt| = |y'| = 1 */
+    for (int i = 0; i < NRT; i++) { gdotmax[i] = ONE; }
+
+    retval = ARKodeSetRootSubsetFn(arkode_mem, gsub);
+    if (retval) { return 1; }
+
+    retval = ARKodeSetRootRateBounds(arkode_mem, gdotmax);
+    if (retval) { return 1; }
+  }
+
+  *nroots = 0;
+  ncalls  = 0;
+  ncomp   = 0;
+  while (tret < TF)
+  {
+    retval = ARKodeEvolve(arkode_mem, TF, y, &tret, ARK_NORMAL);
+    if (retval < 0) { return 1; }
+    if (retval == ARK_ROOT_RETURN && *nroots < NRT)
+    {
+      troots[(*nroots)++] = tret;
+    }
+  }
+
+  retval = ARKodeGetNumGEvals(arkode_mem, &nge);
+  if (retval) { return 1; }
+
+  if (nge != ncalls)
+  {
+    printf("ERROR: %li root function calls, but %li evaluations counted\n",
+           ncalls, nge);
+    return 1;
+  }
+
+  ARKodeFree(&arkode_mem);
+  N_VDestroy(y);
+
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  int fail          = 0;
+  SUNContext sunctx = NULL;
+  int nroots_full, nroots_sparse;
+  long int ncomp_full, ncomp_sparse;
+  sunrealtype troots_full[NRT], troots_sparse[NRT];
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx)) { return 1; }
+
+  if (run_test(SUNFALSE, troots_full, &nroots_full, sunctx)) { return 1; }
+  ncomp_full = ncomp;
+
+  if (run_test(SUNTRUE, troots_sparse, &nroots_sparse, sunctx)) { return 1; }
+  ncomp_sparse = ncomp;
+
+  printf("full evaluation:   %d roots, %li function evaluations\n",
+         nroots_full, ncomp_full);
+  printf("subset evaluation: %d roots, %li function evaluations\n",
+         nroots_sparse, ncomp_sparse);
+
+  if (nroots_full != NRT || nroots_sparse != NRT)
+  {
+    fprintf(stderr, "  Expected %d roots\n", NRT);
+    fail = 1;
+  }
+  else
+  {
+    for (int i = 0; i < NRT; i++)
+    {
+      if (SUNRabs(troots_full[i] - threshold(i)) > SUN_RCONST(1.0e-8) ||
+          SUNRabs(troots_sparse[i] - troots_full[i]) > SUN_RCONST(1.0e-12))
+      {
+        fprintf(stderr,
+                "  Root %d: full = %" GSYM ", subset = %" GSYM
+                ", exact = %" GSYM "\n",
+                i, troots_full[i], troots_sparse[i], threshold(i));
+        fail = 1;
+      }
+    }
+  }
+
+  /* only a few functions are near a root in each step */
+  if (10 * ncomp_sparse > ncomp_full)
+  {
+    fprintf(stderr, "  Too many function evaluations with a subset function\n");
+    fail = 1;
+  }
+
+  SUNContext_Free(&sunctx);
+
+  if (!fail) { printf("SUCCESS\n"); }
+
+  return fail;
+}
@@ -0,0 +1,196 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for stiffness switching in ARKStep on the problem
+ *
+ *   y0' = l(t) (y0 - cos(t)) - sin(t),  y0(0) = 1,
+ *   y1' = -(y1 - sin(t)) / 2 + cos(t),  y1(0) = 0,
+ *
+ * with solution y = [cos(t), sin(t)] where l(t) = -1 - L exp(-(t - 5)^2) is
+ * only stiff in a burst around t = 5. The integration should switch to the
+ * implicit table during the burst and back to the explicit table afterwards
+ * while taking far fewer steps than the explicit table alone.
+ * ---------------------------------------------------------------------------*/
+
+#include <math.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "arkode/arkode_arkstep.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_dense.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define ZERO SUN_RCONST(0.0)
+#define HALF SUN_RCONST(0.5)
+#define ONE  SUN_RCONST(1.0)
+#define L    SUN_RCONST(1.0e4)
+#define TF   SUN_RCONST(10.0)
+
+static sunrealtype lambda(sunrealtype t)
+{
+  return -ONE - L * SUNRexp(-(t - SUN_RCONST(5.0)) * (t - SUN_RCONST(5.0)));
+}
+
+static int f(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* yd  = N_VGetArrayPointer(y);
+  sunrealtype* ydd = N_VGetArrayPointer(ydot);
+  ydd[0]           = lambda(t) * (yd[0] - cos(t)) - sin(t);
+  ydd[1]           = -HALF * (yd[1] - sin(t)) + cos(t);
+  return 0;
+}
+
+static int Jac(sunrealtype t, N_Vector y, N_Vector fy, SUNMatrix J,
+               void* user_data, N_Vector tmp1, N_Vector tmp2, N_Vector tmp3)
+{
+  SM_ELEMENT_D(J, 0, 0) = lambda(t);
+  SM_ELEMENT_D(J, 0, 1) = ZERO;
+  SM_ELEMENT_D(J, 1, 0) = ZERO;
+  SM_ELEMENT_D(J, 1, 1) = -HALF;
+  return 0;
+}
+
+/* Integrates to TF and returns the solution error and integrator statistics */
+static int run_test(sunbooleantype switching, sunrealtype* err, long int* nst,
+                    long int* nswitches, SUNContext sunctx)
+{
+  int retval         = 0;
+  sunrealtype tret   = ZERO;
+  void* arkode_mem   = NULL;
+  SUNMatrix A        = NULL;
+  SUNLinearSolver LS = NULL;
+  sunrealtype* yd    = NULL;
+
+  N_Vector y = N_VNew_Serial(2, sunctx);
+  if (!y) { return 1; }
+  yd    = N_VGetArrayPointer(y);
+  yd[0] = ONE;
+  yd[1] = ZERO;
+
+  if (switching)
+  {
+    arkode_mem = ARKStepCreate(NULL, f, ZERO, y, sunctx);
+    if (!arkode_mem) { return 1; }
+
+    retval = ARKStepSetStiffnessSwitching(arkode_mem, SUNTRUE);
+    if (retval) { return 1; }
+
+    A  = SUNDenseMatrix(2, 2, sunctx);
+    LS = SUNLinSol_Dense(y, A, sunctx);
+    if (!A || !LS) { return 1; }
+
+    retval = ARKodeSetLinearSolver(arkode_mem, LS, A);
+    if (retval) { return 1; }
+
+    retval = ARKodeSetJacFn(arkode_mem, Jac);
+    if (retval) { return 1; }
+  }
+  else
+  {
+    /* the explicit table used with switching */
+    arkode_mem = ARKStepCreate(f, NULL, ZERO, y, sunctx);
+    if (!arkode_mem) { return 1; }
+
+    retval = ARKStepSetTableNum(arkode_mem, ARKODE_DIRK_NONE,
+                                ARKSTEP_DEFAULT_ARK_ETABLE_4);
+    if (retval) { return 1; }
+  }
+
+  retval = ARKodeSStolerances(arkode_mem, SUN_RCONST(1.0e-6),
+                              SUN_RCONST(1.0e-10));
+  if (retval) { return 1; }
+
+  retval = ARKodeSetMaxNumSteps(arkode_mem, 100000);
+  if (retval) { return 1; }
+
+  retval = ARKodeSetStopTime(arkode_mem, TF);
+  if (retval) { return 1; }
+
+  retval = ARKodeEvolve(arkode_mem, TF, y, &tret, ARK_NORMAL);
+  if (retval < 0) { return 1; }
+
+  yd[0] -= cos(tret);
+  yd[1] -= sin(tret);
+  *err = N_VMaxNorm(y);
+
+  retval = ARKodeGetNumSteps(arkode_mem, nst);
+  if (retval) { return 1; }
+
+  *nswitches = 0;
+  if (switching)
+  {
+    retval = ARKStepGetNumStiffnessSwitches(arkode_mem, nswitches);
+    if (retval) { return 1; }
+
+    retval = ARKodePrintAllStats(arkode_mem, stdout, SUN_OUTPUTFORMAT_TABLE);
+    if (retval) { return 1; }
+  }
+
+  ARKodeFree(&arkode_mem);
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+  N_VDestroy(y);
+
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  int fail          = 0;
+  SUNContext sunctx = NULL;
+  sunrealtype err_erk, err_switch;
+  long int nst_erk, nst_switch, nswitches;
+
+  if (SUNContext_Create(SUN_COMM_NULL, &sunctx)) { return 1; }
+
+  if (run_test(SUNFALSE, &err_erk, &nst_erk, &nswitches, sunctx)) { return 1; }
+  if (run_test(SUNTRUE, &err_switch, &nst_switch, &nswitches, sunctx))
+  {
+    return 1;
+  }
+
+  printf("explicit:  error = %" GSYM ", steps = %li\n", err_erk, nst_erk);
+  printf("switching: error = %" GSYM ", steps = %li, switches = %li\n",
+         err_switch, nst_switch, nswitches);
+
+  /* switch to the implicit table in the burst and back afterwards */
+  if (nswitches < 2 || nswitches % 2 != 0)
+  {
+    fprintf(stderr, "  Unexpected number of switches\n");
+    fail = 1;
+  }
+
+  if (err_switch > SUN_RCONST(1.0e-4))
+  {
+    fprintf(stderr, "  Error with switching is too large\n");
+    fail = 1;
+  }
+
+  if (2 * nst_switch > nst_erk)
+  {
+    fprintf(stderr, "  Too many steps with switching\n");
+    fail = 1;
+  }
+
+  SUNContext_Free(&sunctx);
+
+  if (!fail) { printf("SUCCESS\n"); }
+
+  return fail;
+}
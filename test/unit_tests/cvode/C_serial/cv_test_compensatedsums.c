@@ -0,0 +1,146 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for compensated summation of the solution on y' = r, y(0) = 1,
+ * where the rate r is small enough that each increment is lost to roundoff
+ * when added to y unless compensated summation is used.
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cvode/cvode.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sundials/sundials_nvector.h"
+#include "sunnonlinsol/sunnonlinsol_fixedpoint.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+#define TF   SUN_RCONST(1000.0)
+#define RATE (SUN_UNIT_ROUNDOFF / SUN_RCONST(8.0))
+
+static int ode_rhs(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  N_VConst(RATE, ydot);
+  return 0;
+}
+
+/* Integrate to TF with unit steps and return the error in the solution */
+static int solve(SUNContext sunctx, int lmm, sunbooleantype compensate,
+                 sunrealtype* err)
+{
+  int flag               = 0;
+  N_Vector y             = NULL;
+  SUNNonlinearSolver NLS = NULL;
+  void* cvode_mem        = NULL;
+  sunrealtype tret       = ZERO;
+
+  y = N_VNew_Serial(1, sunctx);
+  if (!y) { return 1; }
+  N_VConst(ONE, y);
+
+  cvode_mem = CVodeCreate(lmm, sunctx);
+  if (!cvode_mem) { return 1; }
+
+  flag = CVodeInit(cvode_mem, ode_rhs, ZERO, y);
+  if (flag) { return 1; }
+
+  flag = CVodeSStolerances(cvode_mem, SUN_RCONST(1.0e-6), SUN_RCONST(1.0e-8));
+  if (flag) { return 1; }
+
+  NLS = SUNNonlinSol_FixedPoint(y, 0, sunctx);
+  if (!NLS) { return 1; }
+
+  flag = CVodeSetNonlinearSolver(cvode_mem, NLS);
+  if (flag) { return 1; }
+
+  flag = CVodeSetMaxStep(cvode_mem, ONE);
+  if (flag) { return 1; }
+
+  flag = CVodeSetMaxNumSteps(cvode_mem, 2000);
+  if (flag) { return 1; }
+
+  flag = CVodeSetStopTime(cvode_mem, TF);
+  if (flag) { return 1; }
+
+  flag = CVodeSetUseCompensatedSums(cvode_mem, compensate);
+  if (flag) { return 1; }
+
+  flag = CVode(cvode_mem, TF, y, &tret, CV_NORMAL);
+  if (flag < 0) { return 1; }
+
+  *err = N_VGetArrayPointer(y)[0] - (ONE + RATE * tret);
+
+  CVodeFree(&cvode_mem);
+  SUNNonlinSolFree(NLS);
+  N_VDestroy(y);
+
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  SUNContext sunctx = NULL;
+
+  int flag             = 0;
+  sunrealtype err_std  = ZERO;
+  sunrealtype err_comp = ZERO;
+  int lmm[2]           = {CV_ADAMS, CV_BDF};
+  const char* name[2]  = {"Adams", "BDF"};
+
+  flag = SUNContext_Create(SUN_COMM_NULL, &sunctx);
+  if (flag)
+  {
+    fprintf(stderr, "SUNContext_Create returned %i\n", flag);
+    return 1;
+  }
+
+  for (int i = 0; i < 2; i++)
+  {
+    if (solve(sunctx, lmm[i], SUNFALSE, &err_std) ||
+        solve(sunctx, lmm[i], SUNTRUE, &err_comp))
+    {
+      printf("ERROR: %s integration failed\n", name[i]);
+      return 1;
+    }
+
+    printf("%s: standard error = %" GSYM ", compensated error = %" GSYM "\n",
+           name[i], err_std, err_comp);
+
+    /* Most of the increments are lost without compensation */
+    if (SUNRabs(err_std) < SUN_RCONST(0.5) * RATE * TF)
+    {
+      printf("ERROR: unexpected error without compensated summation\n");
+      flag = 1;
+    }
+
+    if (SUNRabs(err_comp) > SUN_RCONST(4.0) * SUN_UNIT_ROUNDOFF)
+    {
+      printf("ERROR: error with compensated summation is too large\n");
+      flag = 1;
+    }
+  }
+
+  SUNContext_Free(&sunctx);
+
+  if (!flag) { printf("SUCCESS\n"); }
+
+  return flag;
+}
+
+/*---- end of file ----*/
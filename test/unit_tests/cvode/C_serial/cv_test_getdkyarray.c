@@ -0,0 +1,186 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for computing dense output at several times with one call
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cvode/cvode.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sundials/sundials_nvector.h"
+#include "sunnonlinsol/sunnonlinsol_fixedpoint.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+
+#define NT 5
+
+static int ode_rhs(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* y_data    = N_VGetArrayPointer(y);
+  sunrealtype* ydot_data = N_VGetArrayPointer(ydot);
+  ydot_data[0]           = -y_data[1];
+  ydot_data[1]           = y_data[0];
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  SUNContext sunctx      = NULL;
+  N_Vector y             = NULL;
+  N_Vector dky           = NULL;
+  N_Vector* dkys         = NULL;
+  SUNNonlinearSolver NLS = NULL;
+  void* cvode_mem        = NULL;
+
+  int flag         = 0;
+  int i            = 0;
+  int k            = 0;
+  int qlast        = 0;
+  sunrealtype tret = ZERO;
+  sunrealtype hlast, err;
+  sunrealtype t[NT];
+
+  /* --------------
+   * Create context
+   * -------------- */
+
+  flag = SUNContext_Create(SUN_COMM_NULL, &sunctx);
+  if (flag)
+  {
+    fprintf(stderr, "SUNContext_Create returned %i\n", flag);
+    return 1;
+  }
+
+  /* -----------------------
+   * Setup initial condition
+   * ----------------------- */
+
+  y = N_VNew_Serial(2, sunctx);
+  if (!y) { return 1; }
+  N_VGetArrayPointer(y)[0] = ONE;
+  N_VGetArrayPointer(y)[1] = ZERO;
+
+  dky = N_VClone(y);
+  if (!dky) { return 1; }
+
+  dkys = N_VCloneVectorArray(NT, y);
+  if (!dkys) { return 1; }
+
+  /* -----------
+   * Setup CVODE
+   * ----------- */
+
+  cvode_mem = CVodeCreate(CV_ADAMS, sunctx);
+  if (!cvode_mem) { return 1; }
+
+  flag = CVodeInit(cvode_mem, ode_rhs, ZERO, y);
+  if (flag) { return 1; }
+
+  flag = CVodeSStolerances(cvode_mem, SUN_RCONST(1.0e-6), SUN_RCONST(1.0e-10));
+  if (flag) { return 1; }
+
+  NLS = SUNNonlinSol_FixedPoint(y, 0, sunctx);
+  if (!NLS) { return 1; }
+
+  flag = CVodeSetNonlinearSolver(cvode_mem, NLS);
+  if (flag) { return 1; }
+
+  /* Take enough steps to build up the order */
+  flag = CVode(cvode_mem, ONE, y, &tret, CV_NORMAL);
+  if (flag < 0) { return 1; }
+
+  flag = CVodeGetLastOrder(cvode_mem, &qlast);
+  if (flag) { return 1; }
+
+  flag = CVodeGetLastStep(cvode_mem, &hlast);
+  if (flag) { return 1; }
+
+  /* Output times spanning the last step (tret may be interpolated) */
+  flag = CVodeGetCurrentTime(cvode_mem, &tret);
+  if (flag) { return 1; }
+
+  for (i = 0; i < NT; i++)
+  {
+    t[i] = tret - hlast + hlast * ((sunrealtype)i) / ((sunrealtype)(NT - 1));
+  }
+
+  /* -----------------------------------------------
+   * Compare batched and single-time dense output
+   * ----------------------------------------------- */
+
+  for (k = 0; k <= qlast; k++)
+  {
+    flag = CVodeGetDkyArray(cvode_mem, NT, t, k, dkys);
+    if (flag)
+    {
+      printf("ERROR: CVodeGetDkyArray returned %i for k = %i\n", flag, k);
+      break;
+    }
+
+    for (i = 0; i < NT; i++)
+    {
+      flag = CVodeGetDky(cvode_mem, t[i], k, dky);
+      if (flag) { break; }
+
+      N_VLinearSum(ONE, dkys[i], -ONE, dky, dky);
+      err = N_VMaxNorm(dky);
+      if (err > SUN_RCONST(100.0) * SUN_UNIT_ROUNDOFF *
+                  SUNMAX(ONE, N_VMaxNorm(dkys[i])))
+      {
+        printf("ERROR: k = %i, t = %" GSYM ", difference = %" GSYM "\n", k,
+               t[i], err);
+        flag = 1;
+        break;
+      }
+    }
+    if (flag) { break; }
+  }
+
+  /* Invalid times must be rejected without modifying the outputs */
+  if (!flag)
+  {
+    N_VConst(ZERO, dkys[0]);
+    t[NT - 1] = tret + hlast;
+    if (CVodeGetDkyArray(cvode_mem, NT, t, 0, dkys) != CV_BAD_T ||
+        N_VMaxNorm(dkys[0]) != ZERO)
+    {
+      printf("ERROR: Expected CV_BAD_T with unmodified outputs!\n");
+      flag = 1;
+    }
+  }
+
+  /* --------
+   * Clean up
+   * -------- */
+
+  CVodeFree(&cvode_mem);
+  N_VDestroy(y);
+  N_VDestroy(dky);
+  N_VDestroyVectorArray(dkys, NT);
+  SUNNonlinSolFree(NLS);
+  SUNContext_Free(&sunctx);
+
+  if (!flag) { printf("SUCCESS\n"); }
+
+  return flag;
+}
+
+/*---- end of file ----*/
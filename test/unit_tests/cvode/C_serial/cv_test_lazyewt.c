@@ -0,0 +1,178 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for lazy error weight updates
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cvode/cvode.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sundials/sundials_nvector.h"
+#include "sunnonlinsol/sunnonlinsol_fixedpoint.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+#define TF   SUN_RCONST(10.0)
+
+/* Decaying modes, y(t) = (exp(-t/10), exp(-t)) */
+static int ode_rhs(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* y_data    = N_VGetArrayPointer(y);
+  sunrealtype* ydot_data = N_VGetArrayPointer(ydot);
+  ydot_data[0]           = SUN_RCONST(-0.1) * y_data[0];
+  ydot_data[1]           = -y_data[1];
+  return 0;
+}
+
+/* Integrate to TF and return the error, number of weight evaluations, and
+   number of steps */
+static int solve(SUNContext sunctx, sunrealtype ewt_thresh, sunrealtype atol,
+                 sunrealtype* err, long int* newt, long int* nst)
+{
+  int flag               = 0;
+  N_Vector y             = NULL;
+  SUNNonlinearSolver NLS = NULL;
+  void* cvode_mem        = NULL;
+  sunrealtype tret       = ZERO;
+  sunrealtype* ydata     = NULL;
+
+  y = N_VNew_Serial(2, sunctx);
+  if (!y) { return 1; }
+  ydata    = N_VGetArrayPointer(y);
+  ydata[0] = ONE;
+  ydata[1] = ONE;
+
+  cvode_mem = CVodeCreate(CV_ADAMS, sunctx);
+  if (!cvode_mem) { return 1; }
+
+  flag = CVodeInit(cvode_mem, ode_rhs, ZERO, y);
+  if (flag) { return 1; }
+
+  flag = CVodeSStolerances(cvode_mem, SUN_RCONST(1.0e-6), atol);
+  if (flag) { return 1; }
+
+  NLS = SUNNonlinSol_FixedPoint(y, 0, sunctx);
+  if (!NLS) { return 1; }
+
+  flag = CVodeSetNonlinearSolver(cvode_mem, NLS);
+  if (flag) { return 1; }
+
+  flag = CVodeSetErrWeightUpdateThreshold(cvode_mem, ewt_thresh);
+  if (flag) { return 1; }
+
+  flag = CVode(cvode_mem, TF, y, &tret, CV_NORMAL);
+  if (flag < 0) { return 1; }
+
+  flag = CVodeGetNumErrWeightEvals(cvode_mem, newt);
+  if (flag) { return 1; }
+
+  flag = CVodeGetNumSteps(cvode_mem, nst);
+  if (flag) { return 1; }
+
+  *err = SUNMAX(SUNRabs(ydata[0] - SUNRexp(-TF / SUN_RCONST(10.0))),
+                SUNRabs(ydata[1] - SUNRexp(-TF)));
+
+  CVodeFree(&cvode_mem);
+  SUNNonlinSolFree(NLS);
+  N_VDestroy(y);
+
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  SUNContext sunctx = NULL;
+
+  int flag             = 0;
+  sunrealtype err_ref  = ZERO;
+  sunrealtype err_lazy = ZERO;
+  sunrealtype err_zero = ZERO;
+  long int newt_ref    = 0;
+  long int newt_lazy   = 0;
+  long int newt_zero   = 0;
+  long int nst_ref     = 0;
+  long int nst_lazy    = 0;
+  long int nst_zero    = 0;
+
+  flag = SUNContext_Create(SUN_COMM_NULL, &sunctx);
+  if (flag)
+  {
+    fprintf(stderr, "SUNContext_Create returned %i\n", flag);
+    return 1;
+  }
+
+  /* Update the weights every step (default) */
+  flag = solve(sunctx, ZERO, SUN_RCONST(1.0e-8), &err_ref, &newt_ref, &nst_ref);
+  if (flag)
+  {
+    printf("ERROR: default weight updates failed\n");
+    return 1;
+  }
+
+  /* Lazy weight updates */
+  flag = solve(sunctx, SUN_RCONST(0.1), SUN_RCONST(1.0e-8), &err_lazy,
+               &newt_lazy, &nst_lazy);
+  if (flag)
+  {
+    printf("ERROR: lazy weight updates failed\n");
+    return 1;
+  }
+
+  /* Lazy weight updates requested with a zero absolute tolerance */
+  flag = solve(sunctx, SUN_RCONST(0.1), ZERO, &err_zero, &newt_zero, &nst_zero);
+  if (flag)
+  {
+    printf("ERROR: lazy weight updates with atol = 0 failed\n");
+    return 1;
+  }
+
+  printf("default: error = %" GSYM ", weight evals = %li\n", err_ref, newt_ref);
+  printf("lazy:    error = %" GSYM ", weight evals = %li\n", err_lazy, newt_lazy);
+  printf("atol=0:  error = %" GSYM ", weight evals = %li\n", err_zero, newt_zero);
+
+  /* Fewer weight evaluations with comparable accuracy */
+  if (newt_lazy >= newt_ref)
+  {
+    printf("ERROR: expected fewer weight evaluations\n");
+    flag = 1;
+  }
+
+  if (err_lazy > SUN_RCONST(10.0) * SUNMAX(err_ref, SUN_RCONST(1.0e-6)))
+  {
+    printf("ERROR: lazy weight updates degraded the solution\n");
+    flag = 1;
+  }
+
+  /* Weights that can vanish are recomputed (and checked) every step, once
+     in the initial setup and once before every later step */
+  if (newt_zero != nst_zero)
+  {
+    printf("ERROR: expected a weight evaluation every step with atol = 0\n");
+    flag = 1;
+  }
+
+  SUNContext_Free(&sunctx);
+
+  if (!flag) { printf("SUCCESS\n"); }
+
+  return flag;
+}
+
+/*---- end of file ----*/
@@ -0,0 +1,233 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for the solution output function
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cvode/cvode.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sunnonlinsol/sunnonlinsol_fixedpoint.h"
+
+#if defined(SUNDIALS_EXTENDED_PRECISION)
+#define GSYM "Lg"
+#else
+#define GSYM "g"
+#endif
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+
+#define LAMBDA SUN_RCONST(-1.0)
+#define TOUT0  SUN_RCONST(0.0)
+#define DTOUT  SUN_RCONST(0.1)
+#define TF     SUN_RCONST(1.0)
+#define NSTEPS 3
+
+typedef struct
+{
+  long int ngrid;  /* number of grid outputs received */
+  long int nstep;  /* number of step outputs received */
+  sunrealtype err; /* max error in the grid outputs   */
+} OutputData;
+
+static int f(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  N_VScale(LAMBDA, y, ydot);
+  return 0;
+}
+
+static int output(sunrealtype t, N_Vector y, void* user_data)
+{
+  OutputData* data = (OutputData*)user_data;
+  sunrealtype tgrid;
+
+  /* Grid outputs arrive in order before any step output at the same time */
+  tgrid = TOUT0 + data->ngrid * DTOUT;
+  if (SUNRabs(t - tgrid) <= SUN_RCONST(10.0) * SUN_UNIT_ROUNDOFF)
+  {
+    data->err = SUNMAX(data->err, SUNRabs(N_VGetArrayPointer(y)[0] -
+                                          SUNRexp(LAMBDA * t)));
+    data->ngrid++;
+  }
+  else { data->nstep++; }
+
+  return 0;
+}
+
+/* Main program */
+int main(int argc, char* argv[])
+{
+  int retval             = 0;
+  SUNContext sunctx      = NULL;
+  N_Vector y             = NULL;
+  SUNNonlinearSolver NLS = NULL;
+  void* cvode_mem        = NULL;
+  sunrealtype tret       = ZERO;
+  long int nst           = 0;
+  OutputData data        = {0, 0, ZERO};
+
+  /* Create the SUNDIALS context object for this simulation. */
+  retval = SUNContext_Create(SUN_COMM_NULL, &sunctx);
+  if (retval)
+  {
+    fprintf(stderr, "SUNContext_Create returned %i\n", retval);
+    return 1;
+  }
+
+  /* Create solution vector and initialize to one */
+  y = N_VNew_Serial(1, sunctx);
+  if (!y)
+  {
+    fprintf(stderr, "N_VNew_Serial returned NULL\n");
+    return 1;
+  }
+  N_VConst(ONE, y);
+
+  /* Create CVODE mem structure */
+  cvode_mem = CVodeCreate(CV_ADAMS, sunctx);
+  if (!cvode_mem)
+  {
+    fprintf(stderr, "CVodeCreate returned NULL\n");
+    return 1;
+  }
+
+  retval = CVodeInit(cvode_mem, f, ZERO, y);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeInit returned %i\n", retval);
+    return 1;
+  }
+
+  retval = CVodeSStolerances(cvode_mem, SUN_RCONST(1.0e-8),
+                             SUN_RCONST(1.0e-12));
+  if (retval)
+  {
+    fprintf(stderr, "CVodeSStolerances returned %i\n", retval);
+    return 1;
+  }
+
+  /* Use fixed-point iteration to avoid requiring a linear solver */
+  NLS = SUNNonlinSol_FixedPoint(y, 0, sunctx);
+  if (!NLS)
+  {
+    fprintf(stderr, "SUNNonlinSol_FixedPoint returned NULL\n");
+    return 1;
+  }
+
+  retval = CVodeSetNonlinearSolver(cvode_mem, NLS);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeSetNonlinearSolver returned %i\n", retval);
+    return 1;
+  }
+
+  retval = CVodeSetUserData(cvode_mem, &data);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeSetUserData returned %i\n", retval);
+    return 1;
+  }
+
+  /* Request output on a time grid and every few steps */
+  retval = CVodeSetOutputFn(cvode_mem, output);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeSetOutputFn returned %i\n", retval);
+    return 1;
+  }
+
+  retval = CVodeSetOutputTimes(cvode_mem, TOUT0, DTOUT);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeSetOutputTimes returned %i\n", retval);
+    return 1;
+  }
+
+  retval = CVodeSetOutputStepInterval(cvode_mem, NSTEPS);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeSetOutputStepInterval returned %i\n", retval);
+    return 1;
+  }
+
+  /* Advance to the final time (stopping there exactly) in two calls */
+  retval = CVodeSetStopTime(cvode_mem, TF);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeSetStopTime returned %i\n", retval);
+    return 1;
+  }
+
+  retval = CVode(cvode_mem, SUN_RCONST(0.55), y, &tret, CV_NORMAL);
+  if (retval < 0)
+  {
+    fprintf(stderr, "CVode returned %i\n", retval);
+    return 1;
+  }
+
+  retval = CVode(cvode_mem, TF, y, &tret, CV_NORMAL);
+  if (retval < 0)
+  {
+    fprintf(stderr, "CVode returned %i\n", retval);
+    return 1;
+  }
+
+  retval = CVodeGetNumSteps(cvode_mem, &nst);
+  if (retval)
+  {
+    fprintf(stderr, "CVodeGetNumSteps returned %i\n", retval);
+    return 1;
+  }
+
+  /* Check the outputs received */
+  retval = 0;
+  printf("grid outputs = %li, step outputs = %li, max error = %" GSYM "\n",
+         data.ngrid, data.nstep, data.err);
+
+  if (data.ngrid != 11)
+  {
+    fprintf(stderr, "Expected 11 grid outputs\n");
+    retval = 1;
+  }
+
+  if (data.nstep != nst / NSTEPS)
+  {
+    fprintf(stderr, "Expected %li step outputs\n", nst / NSTEPS);
+    retval = 1;
+  }
+
+  if (data.err > SUN_RCONST(1.0e-6))
+  {
+    fprintf(stderr, "Grid output error is too large\n");
+    retval = 1;
+  }
+
+  /* Clean up */
+  CVodeFree(&cvode_mem);
+  SUNNonlinSolFree(NLS);
+  N_VDestroy(y);
+  SUNContext_Free(&sunctx);
+
+  if (retval)
+  {
+    printf("FAIL\n");
+    return 1;
+  }
+
+  printf("SUCCESS\n");
+  return 0;
+}
+
+/*---- end of file ----*/
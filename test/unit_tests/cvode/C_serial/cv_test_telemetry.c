@@ -0,0 +1,198 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for the per-step telemetry function
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "cvode/cvode.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_dense.h"
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+#define TF   SUN_RCONST(10.0)
+
+/* Totals accumulated from the telemetry records */
+typedef struct
+{
+  int bad_record;
+  long int accepted, err_fails, solver_fails;
+  long int nni, nfe, nje, nsetups;
+} Totals;
+
+/* Stiff problem, y1 quickly relaxes to y2 = exp(-t) */
+static int ode_rhs(sunrealtype t, N_Vector y, N_Vector ydot, void* user_data)
+{
+  sunrealtype* y_data    = N_VGetArrayPointer(y);
+  sunrealtype* ydot_data = N_VGetArrayPointer(ydot);
+  ydot_data[0]           = SUN_RCONST(-1000.0) * (y_data[0] - y_data[1]);
+  ydot_data[1]           = -y_data[1];
+  return 0;
+}
+
+static int telemetry(const SUNStepTelemetry* tel, void* user_data)
+{
+  Totals* totals = (Totals*)user_data;
+
+  if (tel->version != SUN_STEP_TELEMETRY_VERSION || tel->attempt < 1 ||
+      tel->h <= ZERO || tel->order < 1 || tel->order > 5 ||
+      tel->time_step < 0.0 || tel->time_nls > tel->time_step ||
+      tel->time_lsetup + tel->time_lsolve > tel->time_nls)
+  {
+    totals->bad_record = 1;
+  }
+
+  switch (tel->outcome)
+  {
+  case SUN_STEP_ACCEPTED:
+    if (tel->step != totals->accepted || tel->dsm > ONE)
+    {
+      totals->bad_record = 1;
+    }
+    totals->accepted++;
+    break;
+  case SUN_STEP_ERR_TEST_FAIL:
+    if (tel->dsm <= ONE) { totals->bad_record = 1; }
+    totals->err_fails++;
+    break;
+  case SUN_STEP_SOLVER_FAIL: totals->solver_fails++; break;
+  }
+
+  totals->nni += tel->nni;
+  totals->nfe += tel->nfe;
+  totals->nje += tel->nje;
+  totals->nsetups += tel->nsetups;
+
+  return 0;
+}
+
+static int check(const char* name, long int telemetry, long int expected)
+{
+  printf("%-12s telemetry = %6li, expected = %6li\n", name, telemetry,
+         expected);
+  if (telemetry != expected)
+  {
+    printf("ERROR: %s does not match\n", name);
+    return 1;
+  }
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  SUNContext sunctx  = NULL;
+  N_Vector y         = NULL;
+  SUNMatrix A        = NULL;
+  SUNLinearSolver LS = NULL;
+  void* cvode_mem    = NULL;
+  sunrealtype tret   = ZERO;
+  sunrealtype* ydata = NULL;
+  Totals totals      = {0};
+  int flag           = 0;
+  long int nst, netf, ncfn, nni, nfe, nje, nsetups;
+
+  flag = SUNContext_Create(SUN_COMM_NULL, &sunctx);
+  if (flag)
+  {
+    fprintf(stderr, "SUNContext_Create returned %i\n", flag);
+    return 1;
+  }
+
+  y = N_VNew_Serial(2, sunctx);
+  if (!y) { return 1; }
+  ydata    = N_VGetArrayPointer(y);
+  ydata[0] = ZERO;
+  ydata[1] = ONE;
+
+  A = SUNDenseMatrix(2, 2, sunctx);
+  if (!A) { return 1; }
+
+  LS = SUNLinSol_Dense(y, A, sunctx);
+  if (!LS) { return 1; }
+
+  cvode_mem = CVodeCreate(CV_BDF, sunctx);
+  if (!cvode_mem) { return 1; }
+
+  flag = CVodeInit(cvode_mem, ode_rhs, ZERO, y);
+  if (flag) { return 1; }
+
+  flag = CVodeSStolerances(cvode_mem, SUN_RCONST(1.0e-6), SUN_RCONST(1.0e-8));
+  if (flag) { return 1; }
+
+  flag = CVodeSetLinearSolver(cvode_mem, LS, A);
+  if (flag) { return 1; }
+
+  flag = CVodeSetUserData(cvode_mem, &totals);
+  if (flag) { return 1; }
+
+  flag = CVodeSetStepTelemetryFn(cvode_mem, telemetry);
+  if (flag) { return 1; }
+
+  flag = CVode(cvode_mem, TF / SUN_RCONST(2.0), y, &tret, CV_NORMAL);
+  if (flag < 0) { return 1; }
+  flag = 0;
+
+  (void)CVodeGetNumSteps(cvode_mem, &nst);
+  (void)CVodeGetNumErrTestFails(cvode_mem, &netf);
+  (void)CVodeGetNumNonlinSolvConvFails(cvode_mem, &ncfn);
+  (void)CVodeGetNumNonlinSolvIters(cvode_mem, &nni);
+  (void)CVodeGetNumRhsEvals(cvode_mem, &nfe);
+  (void)CVodeGetNumJacEvals(cvode_mem, &nje);
+  (void)CVodeGetNumLinSolvSetups(cvode_mem, &nsetups);
+
+  flag |= check("steps", totals.accepted, nst);
+  flag |= check("err fails", totals.err_fails, netf);
+  flag |= check("conv fails", totals.solver_fails, ncfn);
+  flag |= check("nonlin iters", totals.nni, nni);
+  flag |= check("jac evals", totals.nje, nje);
+  flag |= check("lin setups", totals.nsetups, nsetups);
+
+  /* the initial step size selection evaluates the RHS outside of any step */
+  if (totals.nfe <= 0 || totals.nfe > nfe)
+  {
+    printf("ERROR: unexpected number of RHS evaluations\n");
+    flag = 1;
+  }
+
+  if (totals.bad_record)
+  {
+    printf("ERROR: inconsistent telemetry record\n");
+    flag = 1;
+  }
+
+  /* Disabling telemetry stops the records */
+  if (CVodeSetStepTelemetryFn(cvode_mem, NULL)) { return 1; }
+
+  if (CVode(cvode_mem, TF, y, &tret, CV_NORMAL) < 0) { return 1; }
+
+  if (totals.accepted != nst)
+  {
+    printf("ERROR: records received with telemetry disabled\n");
+    flag = 1;
+  }
+
+  CVodeFree(&cvode_mem);
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+  N_VDestroy(y);
+  SUNContext_Free(&sunctx);
+
+  if (!flag) { printf("SUCCESS\n"); }
+
+  return flag;
+}
+
+/*---- end of file ----*/
@@ -0,0 +1,204 @@
+/* -----------------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------------------
+ * Unit test for the per-step telemetry function
+ * ---------------------------------------------------------------------------*/
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#include "ida/ida.h"
+#include "nvector/nvector_serial.h"
+#include "sundials/sundials_math.h"
+#include "sunlinsol/sunlinsol_dense.h"
+#include "sunmatrix/sunmatrix_dense.h"
+
+#define ZERO SUN_RCONST(0.0)
+#define ONE  SUN_RCONST(1.0)
+#define TF   SUN_RCONST(10.0)
+
+/* Totals accumulated from the telemetry records */
+typedef struct
+{
+  int bad_record;
+  long int accepted, err_fails, solver_fails;
+  long int nni, nfe, nje, nsetups;
+} Totals;
+
+/* Stiff problem, y1 quickly relaxes to y2 = exp(-t) */
+static int dae_res(sunrealtype t, N_Vector y, N_Vector yp, N_Vector res,
+                   void* user_data)
+{
+  sunrealtype* y_data   = N_VGetArrayPointer(y);
+  sunrealtype* yp_data  = N_VGetArrayPointer(yp);
+  sunrealtype* res_data = N_VGetArrayPointer(res);
+
+  res_data[0] = yp_data[0] + SUN_RCONST(1000.0) * (y_data[0] - y_data[1]);
+  res_data[1] = yp_data[1] + y_data[1];
+  return 0;
+}
+
+static int telemetry(const SUNStepTelemetry* tel, void* user_data)
+{
+  Totals* totals = (Totals*)user_data;
+
+  if (tel->version != SUN_STEP_TELEMETRY_VERSION || tel->attempt < 1 ||
+      tel->h <= ZERO || tel->order < 1 || tel->order > 5 ||
+      tel->time_step < 0.0 || tel->time_nls > tel->time_step ||
+      tel->time_lsetup + tel->time_lsolve > tel->time_nls)
+  {
+    totals->bad_record = 1;
+  }
+
+  switch (tel->outcome)
+  {
+  case SUN_STEP_ACCEPTED:
+    if (tel->step != totals->accepted || tel->dsm > ONE)
+    {
+      totals->bad_record = 1;
+    }
+    totals->accepted++;
+    break;
+  case SUN_STEP_ERR_TEST_FAIL:
+    if (tel->dsm <= ONE) { totals->bad_record = 1; }
+    totals->err_fails++;
+    break;
+  case SUN_STEP_SOLVER_FAIL: totals->solver_fails++; break;
+  }
+
+  totals->nni += tel->nni;
+  totals->nfe += tel->nfe;
+  totals->nje += tel->nje;
+  totals->nsetups += tel->nsetups;
+
+  return 0;
+}
+
+static int check(const char* name, long int telemetry, long int expected)
+{
+  printf("%-12s telemetry = %6li, expected = %6li\n", name, telemetry,
+         expected);
+  if (telemetry != expected)
+  {
+    printf("ERROR: %s does not match\n", name);
+    return 1;
+  }
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  SUNContext sunctx   = NULL;
+  N_Vector y          = NULL;
+  N_Vector yp         = NULL;
+  SUNMatrix A         = NULL;
+  SUNLinearSolver LS  = NULL;
+  void* ida_mem       = NULL;
+  sunrealtype tret    = ZERO;
+  sunrealtype* ydata  = NULL;
+  sunrealtype* ypdata = NULL;
+  Totals totals       = {0};
+  int flag            = 0;
+  long int nst, netf, ncfn, nni, nre, nje, nsetups;
+
+  flag = SUNContext_Create(SUN_COMM_NULL, &sunctx);
+  if (flag)
+  {
+    fprintf(stderr, "SUNContext_Create returned %i\n", flag);
+    return 1;
+  }
+
+  y = N_VNew_Serial(2, sunctx);
+  if (!y) { return 1; }
+  ydata    = N_VGetArrayPointer(y);
+  ydata[0] = ZERO;
+  ydata[1] = ONE;
+
+  yp = N_VNew_Serial(2, sunctx);
+  if (!yp) { return 1; }
+  ypdata    = N_VGetArrayPointer(yp);
+  ypdata[0] = SUN_RCONST(1000.0);
+  ypdata[1] = -ONE;
+
+  A = SUNDenseMatrix(2, 2, sunctx);
+  if (!A) { return 1; }
+
+  LS = SUNLinSol_Dense(y, A, sunctx);
+  if (!LS) { return 1; }
+
+  ida_mem = IDACreate(sunctx);
+  if (!ida_mem) { return 1; }
+
+  flag = IDAInit(ida_mem, dae_res, ZERO, y, yp);
+  if (flag) { return 1; }
+
+  flag = IDASStolerances(ida_mem, SUN_RCONST(1.0e-6), SUN_RCONST(1.0e-8));
+  if (flag) { return 1; }
+
+  flag = IDASetLinearSolver(ida_mem, LS, A);
+  if (flag) { return 1; }
+
+  flag = IDASetUserData(ida_mem, &totals);
+  if (flag) { return 1; }
+
+  flag = IDASetStepTelemetryFn(ida_mem, telemetry);
+  if (flag) { return 1; }
+
+  flag = IDASolve(ida_mem, TF / SUN_RCONST(2.0), &tret, y, yp, IDA_NORMAL);
+  if (flag < 0) { return 1; }
+  flag = 0;
+
+  (void)IDAGetNumSteps(ida_mem, &nst);
+  (void)IDAGetNumErrTestFails(ida_mem, &netf);
+  (void)IDAGetNumNonlinSolvConvFails(ida_mem, &ncfn);
+  (void)IDAGetNumNonlinSolvIters(ida_mem, &nni);
+  (void)IDAGetNumResEvals(ida_mem, &nre);
+  (void)IDAGetNumJacEvals(ida_mem, &nje);
+  (void)IDAGetNumLinSolvSetups(ida_mem, &nsetups);
+
+  flag |= check("steps", totals.accepted, nst);
+  flag |= check("err fails", totals.err_fails, netf);
+  flag |= check("conv fails", totals.solver_fails, ncfn);
+  flag |= check("nonlin iters", totals.nni, nni);
+  flag |= check("res evals", totals.nfe, nre);
+  flag |= check("jac evals", totals.nje, nje);
+  flag |= check("lin setups", totals.nsetups, nsetups);
+
+  if (totals.bad_record)
+  {
+    printf("ERROR: inconsistent telemetry record\n");
+    flag = 1;
+  }
+
+  /* Disabling telemetry stops the records */
+  if (IDASetStepTelemetryFn(ida_mem, NULL)) { return 1; }
+
+  if (IDASolve(ida_mem, TF, &tret, y, yp, IDA_NORMAL) < 0) { return 1; }
+
+  if (totals.accepted != nst)
+  {
+    printf("ERROR: records received with telemetry disabled\n");
+    flag = 1;
+  }
+
+  IDAFree(&ida_mem);
+  SUNLinSolFree(LS);
+  SUNMatDestroy(A);
+  N_VDestroy(yp);
+  N_VDestroy(y);
+  SUNContext_Free(&sunctx);
+
+  if (!flag) { printf("SUCCESS\n"); }
+
+  return flag;
+}
+
+/*---- end of file ----*/
@@ -24,6 +24,10 @@
 
 #include "test_nvector.h"
 
+/* Implementation specific tests */
+static int Test_N_VSetNumThreads_ManyVector(N_Vector X, sunindextype local_length,
+                                            int myid);
+
 /* ----------------------------------------------------------------------
  * Main NVector Testing Routine
  * --------------------------------------------------------------------*/
@@ -245,6 +249,10 @@ int main(int argc, char* argv[])
   printf("\nTesting local fused reduction operations:\n\n");
   fails += Test_N_VDotProdMultiLocal(V, length, 0);
 
+  /* threaded subvector operations */
+  printf("\nTesting threaded subvector operations:\n\n");
+  fails += Test_N_VSetNumThreads_ManyVector(V, length, 0);
+
   /* XBraid interface operations */
   printf("\nTesting XBraid interface operations:\n\n");
 
@@ -358,3 +366,110 @@ void sync_device(N_Vector x)
   /* not running on GPU, just return */
   return;
 }
+
+/* ----------------------------------------------------------------------
+ * N_VSetNumThreads_ManyVector Test
+ *
+ * Checks that evaluating the subvector operations concurrently gives
+ * results identical to the sequential evaluation.
+ * --------------------------------------------------------------------*/
+static int Test_N_VSetNumThreads_ManyVector(N_Vector X, sunindextype local_length,
+                                            int myid)
+{
+  int failure = 0, fails = 0;
+  int j;
+  sunindextype i;
+  N_Vector T, *Xs, *Xt;
+  sunrealtype c[3], dots[3], dott[3];
+  sunrealtype dot, nrm, maxnrm;
+
+  /* create sequential and threaded copies of the input vectors */
+  Xs = N_VCloneVectorArray(5, X);
+
+  T = N_VClone(X);
+  failure += N_VSetNumThreads_ManyVector(T, 4);
+  Xt = N_VCloneVectorArray(5, T);
+  N_VDestroy(T);
+
+  for (j = 0; j < 5; j++)
+  {
+    for (i = 0; i < local_length; i++)
+    {
+      set_element(Xs[j], i, (j + 1) * SUNRsqrt(i + ONE) / (i + j + 3));
+      set_element(Xt[j], i, get_element(Xs[j], i));
+    }
+  }
+  c[0] = HALF;
+  c[1] = -ONE / SUN_RCONST(3.0);
+  c[2] = TWO;
+
+  /* elementwise and fused operations */
+  N_VLinearSum(c[0], Xs[0], c[1], Xs[1], Xs[3]);
+  N_VLinearSum(c[0], Xt[0], c[1], Xt[1], Xt[3]);
+  failure += N_VLinearCombination(3, c, Xs, Xs[4]);
+  failure += N_VLinearCombination(3, c, Xt, Xt[4]);
+  for (i = 0; i < local_length; i++)
+  {
+    if (get_element(Xs[3], i) != get_element(Xt[3], i)) { failure++; }
+    if (get_element(Xs[4], i) != get_element(Xt[4], i)) { failure++; }
+  }
+
+  failure += N_VScaleAddMulti(2, c, Xs[0], Xs + 1, Xs + 3);
+  failure += N_VScaleAddMulti(2, c, Xt[0], Xt + 1, Xt + 3);
+  for (i = 0; i < local_length; i++)
+  {
+    if (get_element(Xs[3], i) != get_element(Xt[3], i)) { failure++; }
+    if (get_element(Xs[4], i) != get_element(Xt[4], i)) { failure++; }
+  }
+
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VSetNumThreads_ManyVector Case 1, Proc %d \n",
+           myid);
+    fails++;
+  }
+  else if (myid == 0)
+  {
+    printf("PASSED test -- N_VSetNumThreads_ManyVector Case 1 \n");
+  }
+
+  /* reductions must match the sequential result exactly */
+  failure = 0;
+
+  dot    = N_VDotProd(Xs[0], Xs[1]);
+  nrm    = N_VWrmsNorm(Xs[0], Xs[2]);
+  maxnrm = N_VMaxNorm(Xs[3]);
+  if (N_VDotProd(Xt[0], Xt[1]) != dot) { failure++; }
+  if (N_VWrmsNorm(Xt[0], Xt[2]) != nrm) { failure++; }
+  if (N_VMaxNorm(Xt[3]) != maxnrm) { failure++; }
+
+  failure += N_VDotProdMulti(3, Xs[4], Xs, dots);
+  failure += N_VDotProdMulti(3, Xt[4], Xt, dott);
+  for (j = 0; j < 3; j++)
+  {
+    if (dots[j] != dott[j]) { failure++; }
+  }
+
+  failure += N_VDotProdMultiLocal(3, Xs[4], Xs, dots);
+  failure += N_VDotProdMultiLocal(3, Xt[4], Xt, dott);
+  for (j = 0; j < 3; j++)
+  {
+    if (dots[j] != dott[j]) { failure++; }
+  }
+
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VSetNumThreads_ManyVector Case 2, Proc %d \n",
+           myid);
+    fails++;
+  }
+  else if (myid == 0)
+  {
+    printf("PASSED test -- N_VSetNumThreads_ManyVector Case 2 \n");
+  }
+
+  N_VDestroyVectorArray(Xs, 5);
+  N_VDestroyVectorArray(Xt, 5);
+
+  return (fails);
+}
@@ -26,6 +26,9 @@
 
 #include "test_nvector.h"
 
+/* Implementation specific tests */
+static int Test_SplitPhaseReductions(N_Vector X, int myid);
+
 /* ----------------------------------------------------------------------
  * Main NVector Testing Routine
  * --------------------------------------------------------------------*/
@@ -321,6 +324,13 @@ int main(int argc, char* argv[])
   fails += Test_N_VDotProdMultiLocal(V, local_length, myid);
   fails += Test_N_VDotProdMultiAllReduce(V, local_length, myid);
 
+  /* split-phase reduction operations */
+  if (myid == 0)
+  {
+    printf("\nTesting split-phase reduction operations:\n\n");
+  }
+  fails += Test_SplitPhaseReductions(X, myid);
+
   /* XBraid interface operations */
   if (myid == 0) { printf("\nTesting XBraid interface operations:\n\n"); }
 
@@ -449,3 +459,51 @@ void sync_device(N_Vector x)
   /* not running on GPU, just return */
   return;
 }
+
+/* ----------------------------------------------------------------------
+ * Check that the split-phase (non-blocking) reductions agree with the
+ * blocking reductions
+ * --------------------------------------------------------------------*/
+static int Test_SplitPhaseReductions(N_Vector X, int myid)
+{
+  int i, failure = 0;
+  N_Vector* V;
+  sunrealtype dotprods[3], ans[3];
+  MPI_Request request;
+
+  /* fill vectors with process dependent data */
+  V = N_VCloneVectorArray(3, X);
+  N_VConst((sunrealtype)(myid + 1), X);
+  N_VConst(HALF, V[0]);
+  N_VConst(NEG_ONE, V[1]);
+  N_VConst(TWO * (myid + 1), V[2]);
+
+  failure += N_VDotProdMulti(3, X, V, ans);
+
+  /* split-phase multiple dot products */
+  failure += N_VDotProdMultiStart_MPIManyVector(3, X, V, dotprods, &request);
+  failure += N_VReduceFinish_MPIManyVector(X, &request);
+  for (i = 0; i < 3; i++) { failure += SUNRCompare(dotprods[i], ans[i]); }
+
+  /* split-phase reduction of local contributions */
+  failure += N_VDotProdMultiLocal(3, X, V, dotprods);
+  failure += N_VDotProdMultiAllReduceStart_MPIManyVector(3, X, dotprods,
+                                                         &request);
+  failure += N_VReduceFinish_MPIManyVector(X, &request);
+  for (i = 0; i < 3; i++) { failure += SUNRCompare(dotprods[i], ans[i]); }
+
+  N_VDestroyVectorArray(V, 3);
+
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VReduceStart_MPIManyVector, Proc %d \n",
+           myid);
+    return 1;
+  }
+  else if (myid == 0)
+  {
+    printf("PASSED test -- N_VReduceStart_MPIManyVector \n");
+  }
+
+  return 0;
+}
@@ -24,6 +24,10 @@
 
 #include "test_nvector.h"
 
+/* Implementation specific tests */
+static int Test_SplitPhaseReductions(N_Vector X, N_Vector Y,
+                                     sunindextype local_length, int myid);
+
 /* ----------------------------------------------------------------------
  * Main NVector Testing Routine
  * --------------------------------------------------------------------*/
@@ -244,6 +248,22 @@ int main(int argc, char* argv[])
   fails += Test_N_VDotProdMultiLocal(V, local_length, myid);
   fails += Test_N_VDotProdMultiAllReduce(V, local_length, myid);
 
+  /* split-phase reduction operations */
+  if (myid == 0)
+  {
+    printf("\nTesting split-phase reduction operations:\n\n");
+  }
+  fails += Test_SplitPhaseReductions(X, Y, local_length, myid);
+
+  /* reproducible reduction operations */
+  if (myid == 0)
+  {
+    printf("\nTesting reproducible reduction operations:\n\n");
+  }
+  fails += Test_N_VEnableReproducibleReductions(
+    X, N_VEnableReproducibleReductions_Parallel, N_VEnableFusedOps_Parallel,
+    0, NULL, local_length, myid);
+
   /* XBraid interface operations */
   if (myid == 0) { printf("\nTesting XBraid interface operations:\n\n"); }
 
@@ -336,3 +356,86 @@ void sync_device(N_Vector x)
   /* not running on GPU, just return */
   return;
 }
+
+/* ----------------------------------------------------------------------
+ * Check that the split-phase (non-blocking) reductions agree with the
+ * blocking reductions
+ * --------------------------------------------------------------------*/
+static int Test_SplitPhaseReductions(N_Vector X, N_Vector Y,
+                                     sunindextype local_length, int myid)
+{
+  int failure = 0;
+  sunindextype i;
+  N_Vector* V;
+  sunrealtype *xd, *yd;
+  sunrealtype dot, maxnorm, min, nrm, dotprods[3], ans[3];
+  MPI_Request requests[4];
+
+  /* fill vectors with process dependent data */
+  xd = N_VGetArrayPointer(X);
+  yd = N_VGetArrayPointer(Y);
+  for (i = 0; i < local_length; i++)
+  {
+    xd[i] = (myid + 1) * (i + 1) / ((sunrealtype)local_length);
+    yd[i] = ONE / (myid + i + 2);
+  }
+  V = N_VCloneVectorArray(3, X);
+  N_VScale(TWO, X, V[0]);
+  N_VConst(-HALF, V[1]);
+  N_VScale(NEG_ONE, Y, V[2]);
+
+  /* start all of the reductions before completing any of them */
+  failure += N_VDotProdStart_Parallel(X, Y, &dot, &requests[0]);
+  failure += N_VMaxNormStart_Parallel(X, &maxnorm, &requests[1]);
+  failure += N_VMinStart_Parallel(Y, &min, &requests[2]);
+  failure += N_VWrmsNormStart_Parallel(X, Y, &nrm, &requests[3]);
+  failure += N_VReduceFinish_Parallel(X, &requests[0]);
+  failure += N_VReduceFinish_Parallel(X, &requests[1]);
+  failure += N_VReduceFinish_Parallel(X, &requests[2]);
+  failure += N_VWrmsNormFinish_Parallel(X, &nrm, &requests[3]);
+
+  failure += SUNRCompare(dot, N_VDotProd(X, Y));
+  failure += SUNRCompare(maxnorm, N_VMaxNorm(X));
+  failure += SUNRCompare(min, N_VMin(Y));
+  failure += SUNRCompare(nrm, N_VWrmsNorm(X, Y));
+
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VReduceStart_Parallel Case 1, Proc %d \n",
+           myid);
+    N_VDestroyVectorArray(V, 3);
+    return 1;
+  }
+  else if (myid == 0)
+  {
+    printf("PASSED test -- N_VReduceStart_Parallel Case 1 \n");
+  }
+
+  /* multiple dot products */
+  failure += N_VDotProdMulti(3, X, V, ans);
+  failure += N_VDotProdMultiStart_Parallel(3, X, V, dotprods, &requests[0]);
+  failure += N_VReduceFinish_Parallel(X, &requests[0]);
+  for (i = 0; i < 3; i++) { failure += SUNRCompare(dotprods[i], ans[i]); }
+
+  /* split-phase reduction of local contributions */
+  failure += N_VDotProdMultiLocal(3, X, V, dotprods);
+  failure += N_VDotProdMultiAllReduceStart_Parallel(3, X, dotprods,
+                                                    &requests[0]);
+  failure += N_VReduceFinish_Parallel(X, &requests[0]);
+  for (i = 0; i < 3; i++) { failure += SUNRCompare(dotprods[i], ans[i]); }
+
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VReduceStart_Parallel Case 2, Proc %d \n",
+           myid);
+    N_VDestroyVectorArray(V, 3);
+    return 1;
+  }
+  else if (myid == 0)
+  {
+    printf("PASSED test -- N_VReduceStart_Parallel Case 2 \n");
+  }
+
+  N_VDestroyVectorArray(V, 3);
+  return 0;
+}
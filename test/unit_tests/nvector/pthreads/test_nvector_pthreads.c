@@ -34,6 +34,8 @@ int main(int argc, char* argv[])
   N_Vector U, V, W, X, Y, Z; /* test vectors              */
   int print_timing;          /* turn timing on/off        */
   int nthreads;              /* number of POSIX threads   */
+  N_Vector T[3];             /* thread count test vectors */
+  int i;                     /* thread count test index   */
 
   Test_Init(SUN_COMM_NULL);
 
@@ -222,6 +224,16 @@ int main(int argc, char* argv[])
   printf("\nTesting local fused reduction operations:\n\n");
   fails += Test_N_VDotProdMultiLocal(V, length, 0);
 
+  /* reproducible reduction operations */
+  printf("\nTesting reproducible reduction operations:\n\n");
+
+  /* the results must not depend on the number of threads */
+  for (i = 0; i < 3; i++) { T[i] = N_VNew_Pthreads(length, 1 << i, sunctx); }
+  fails += Test_N_VEnableReproducibleReductions(
+    X, N_VEnableReproducibleReductions_Pthreads, N_VEnableFusedOps_Pthreads,
+    3, T, length, 0);
+  for (i = 0; i < 3; i++) { N_VDestroy(T[i]); }
+
   /* XBraid interface operations */
   printf("\nTesting XBraid interface operations:\n\n");
 
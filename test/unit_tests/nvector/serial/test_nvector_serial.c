@@ -220,6 +220,12 @@ int main(int argc, char* argv[])
   printf("\nTesting local fused reduction operations:\n\n");
   fails += Test_N_VDotProdMultiLocal(V, length, 0);
 
+  /* reproducible reduction operations */
+  printf("\nTesting reproducible reduction operations:\n\n");
+  fails += Test_N_VEnableReproducibleReductions(
+    X, N_VEnableReproducibleReductions_Serial, N_VEnableFusedOps_Serial, 0,
+    NULL, length, 0);
+
   /* XBraid interface operations */
   printf("\nTesting XBraid interface operations:\n\n");
 
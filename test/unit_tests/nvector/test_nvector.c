@@ -54,6 +54,7 @@ static time_t base_time_tv_sec = 0; /* Base time; makes time values returned
 
 /* private functions */
 static double get_time(void);
+static void ReproducibleReductions(N_Vector* V, sunrealtype* vals);
 
 /* private variables */
 static int print_time = 0;
@@ -3725,6 +3726,7 @@ int Test_N_VWrmsNormVectorArray(N_Vector X, sunindextype local_length, int myid)
   sunrealtype nrm[3];
   N_Vector* Z;
   N_Vector* W;
+  N_Vector W2[3];
 
   /* create vectors for testing */
   Z = N_VCloneVectorArray(3, X);
@@ -3813,6 +3815,53 @@ int Test_N_VWrmsNormVectorArray(N_Vector X, sunindextype local_length, int myid)
   maxt = max_time(X, stop_time - start_time);
   PRINT_TIME("N_VWrmsNormVectorArray", maxt);
 
+  /*
+   * Case 1c: nrm[i] = ||Z[i]|| with a shared weight vector
+   */
+
+  /* fill vector data */
+  N_VConst(NEG_HALF, Z[0]);
+  N_VConst(TWO * TWO, Z[1]);
+  N_VConst(HALF, Z[2]);
+
+  N_VConst(HALF, W[0]);
+
+  W2[0] = W[0];
+  W2[1] = W[0];
+  W2[2] = W[0];
+
+  nrm[0] = NEG_ONE;
+  nrm[1] = NEG_ONE;
+  nrm[2] = NEG_ONE;
+
+  start_time = get_time();
+  ierr       = N_VWrmsNormVectorArray(3, Z, W2, nrm);
+  sync_device(X);
+  stop_time = get_time();
+
+  /* ans should equal 1/4, 2, 1/4 */
+  if (ierr == 0)
+  {
+    failure = (nrm[0] < ZERO) ? 1 : SUNRCompare(nrm[0], HALF * HALF);
+    failure += (nrm[1] < ZERO) ? 1 : SUNRCompare(nrm[1], TWO);
+    failure += (nrm[2] < ZERO) ? 1 : SUNRCompare(nrm[2], HALF * HALF);
+  }
+  else { failure = 1; }
+
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VWrmsNormVectorArray Case 1c, Proc %d \n", myid);
+    fails++;
+  }
+  else if (myid == 0)
+  {
+    printf("PASSED test -- N_VWrmsNormVectorArray Case 1c \n");
+  }
+
+  /* find max time across all processes */
+  maxt = max_time(X, stop_time - start_time);
+  PRINT_TIME("N_VWrmsNormVectorArray", maxt);
+
   /* Free vectors */
   N_VDestroyVectorArray(Z, 3);
   N_VDestroyVectorArray(W, 3);
@@ -5983,6 +6032,179 @@ int Test_N_VBufUnpack(N_Vector x, sunindextype local_length, int myid)
   return (0);
 }
 
+/* ----------------------------------------------------------------------
+ * N_VEnableReproducibleReductions Test
+ *
+ * Checks that the reproducible reductions agree with the default
+ * reductions, that the fused reductions match them, and that the fused
+ * operation settings are kept when switching between the two. The vector
+ * specific functions to enable the reproducible reductions and the fused
+ * operations are given by enable and enablefused. The results must also be
+ * identical for the nthr vectors in Xthr (e.g., vectors like X with a
+ * different number of threads), which may be NULL.
+ * --------------------------------------------------------------------*/
+int Test_N_VEnableReproducibleReductions(
+  N_Vector X, SUNErrCode (*enable)(N_Vector, sunbooleantype),
+  SUNErrCode (*enablefused)(N_Vector, sunbooleantype), int nthr,
+  N_Vector* Xthr, sunindextype local_length, int myid)
+{
+  int failure = 0;
+  int j, k;
+  sunindextype i;
+  N_Vector F, T, *D, *R, *S;
+  sunrealtype ans[5], vals[5], svals[5], dots[3], nrms[3], mnrms[3];
+  sunrealtype tol = SUNRsqrt(SUN_UNIT_ROUNDOFF);
+
+  /* vectors with the default and the reproducible reductions */
+  D = N_VCloneVectorArray(3, X);
+
+  T = N_VClone(X);
+  failure += enable(T, SUNTRUE);
+  R = N_VCloneVectorArray(3, T);
+  N_VDestroy(T);
+
+  /* positive data (and a 0/1 mask) so there is no cancellation */
+  for (i = 0; i < local_length; i++)
+  {
+    set_element(D[0], i, (i % 11 + myid + 1) / (i + ONE));
+    set_element(D[1], i, ONE / (i % 7 + TWO));
+    set_element(D[2], i, (i % 3) ? ONE : ZERO);
+    for (j = 0; j < 3; j++) { set_element(R[j], i, get_element(D[j], i)); }
+  }
+
+  ReproducibleReductions(D, ans);
+  ReproducibleReductions(R, vals);
+  for (j = 0; j < 5; j++) { failure += SUNRCompareTol(vals[j], ans[j], tol); }
+
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VEnableReproducibleReductions Case 1, "
+           "Proc %d \n",
+           myid);
+    N_VDestroyVectorArray(D, 3);
+    N_VDestroyVectorArray(R, 3);
+    return (1);
+  }
+  else if (myid == 0)
+  {
+    printf("PASSED test -- N_VEnableReproducibleReductions Case 1 \n");
+  }
+
+  /* the fused reductions must give the same bits as the single ones */
+  failure += N_VDotProdMulti(3, R[0], R, dots);
+  failure += N_VWrmsNormVectorArray(3, R, R, nrms);
+  for (j = 0; j < 3; j++)
+  {
+    if (dots[j] != N_VDotProd(R[0], R[j])) { failure++; }
+    if (nrms[j] != N_VWrmsNorm(R[j], R[j])) { failure++; }
+  }
+
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VEnableReproducibleReductions Case 2, "
+           "Proc %d \n",
+           myid);
+    N_VDestroyVectorArray(D, 3);
+    N_VDestroyVectorArray(R, 3);
+    return (1);
+  }
+  else if (myid == 0)
+  {
+    printf("PASSED test -- N_VEnableReproducibleReductions Case 2 \n");
+  }
+
+  /* the results must be identical for the other vectors */
+  for (k = 0; k < nthr; k++)
+  {
+    T = N_VClone(Xthr[k]);
+    failure += enable(T, SUNTRUE);
+    S = N_VCloneVectorArray(3, T);
+    N_VDestroy(T);
+
+    for (i = 0; i < local_length; i++)
+    {
+      for (j = 0; j < 3; j++) { set_element(S[j], i, get_element(R[j], i)); }
+    }
+
+    ReproducibleReductions(S, svals);
+    for (j = 0; j < 5; j++)
+    {
+      if (svals[j] != vals[j]) { failure++; }
+    }
+
+    N_VDestroyVectorArray(S, 3);
+  }
+
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VEnableReproducibleReductions Case 3, "
+           "Proc %d \n",
+           myid);
+    N_VDestroyVectorArray(D, 3);
+    N_VDestroyVectorArray(R, 3);
+    return (1);
+  }
+  else if (myid == 0 && nthr > 0)
+  {
+    printf("PASSED test -- N_VEnableReproducibleReductions Case 3 \n");
+  }
+
+  /* enabling the fused operations keeps them reproducible */
+  failure += enablefused(R[0], SUNTRUE);
+  failure += enablefused(R[1], SUNFALSE);
+  failure += N_VDotProdMulti(3, R[0], R, dots);
+  failure += N_VWrmsNormVectorArray(3, R, R, nrms);
+  failure += N_VWrmsNormMaskVectorArray(3, R, R, R[2], mnrms);
+  for (j = 0; j < 3; j++)
+  {
+    if (dots[j] != N_VDotProd(R[0], R[j])) { failure++; }
+    if (nrms[j] != N_VWrmsNorm(R[j], R[j])) { failure++; }
+    if (mnrms[j] != N_VWrmsNormMask(R[j], R[j], R[2])) { failure++; }
+  }
+
+  /* disabling the reproducible reductions restores the enabled fused
+     operations and leaves the disabled ones disabled */
+  failure += enable(R[0], SUNFALSE);
+  failure += enable(R[1], SUNFALSE);
+
+  F = N_VClone(X);
+  failure += enablefused(F, SUNTRUE);
+  if (R[0]->ops->nvdotprodmulti != F->ops->nvdotprodmulti) { failure++; }
+  if (R[0]->ops->nvwrmsnormvectorarray != F->ops->nvwrmsnormvectorarray)
+  {
+    failure++;
+  }
+  if (R[0]->ops->nvwrmsnormmaskvectorarray !=
+      F->ops->nvwrmsnormmaskvectorarray)
+  {
+    failure++;
+  }
+  if (R[1]->ops->nvdotprodmulti || R[1]->ops->nvwrmsnormvectorarray ||
+      R[1]->ops->nvwrmsnormmaskvectorarray)
+  {
+    failure++;
+  }
+  N_VDestroy(F);
+
+  if (failure)
+  {
+    printf(">>> FAILED test -- N_VEnableReproducibleReductions Case 4, "
+           "Proc %d \n",
+           myid);
+    N_VDestroyVectorArray(D, 3);
+    N_VDestroyVectorArray(R, 3);
+    return (1);
+  }
+  else if (myid == 0)
+  {
+    printf("PASSED test -- N_VEnableReproducibleReductions Case 4 \n");
+  }
+
+  N_VDestroyVectorArray(D, 3);
+  N_VDestroyVectorArray(R, 3);
+  return (0);
+}
+
 /* ======================================================================
  * Private functions
  * ====================================================================*/
@@ -6006,6 +6228,16 @@ void SetTiming(int onoff, int myid)
   print_time = (myid == 0) ? onoff : 0;
 }
 
+/* Evaluates the reductions with a reproducible variant on V = [x, w, id] */
+static void ReproducibleReductions(N_Vector* V, sunrealtype* vals)
+{
+  vals[0] = N_VDotProd(V[0], V[1]);
+  vals[1] = N_VWrmsNorm(V[0], V[1]);
+  vals[2] = N_VWrmsNormMask(V[0], V[1], V[2]);
+  vals[3] = N_VWL2Norm(V[0], V[1]);
+  vals[4] = N_VL1Norm(V[0]);
+}
+
 /* ----------------------------------------------------------------------
  * Timer
  * --------------------------------------------------------------------*/
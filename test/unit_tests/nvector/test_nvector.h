@@ -143,6 +143,12 @@ int Test_N_VBufSize(N_Vector x, sunindextype local_length, int myid);
 int Test_N_VBufPack(N_Vector x, sunindextype local_length, int myid);
 int Test_N_VBufUnpack(N_Vector x, sunindextype local_length, int myid);
 
+/* Reproducible reduction tests */
+int Test_N_VEnableReproducibleReductions(
+  N_Vector X, SUNErrCode (*enable)(N_Vector, sunbooleantype),
+  SUNErrCode (*enablefused)(N_Vector, sunbooleantype), int nthr,
+  N_Vector* Xthr, sunindextype local_length, int myid);
+
 /* Enabled/disable operation timing */
 void SetTiming(int onoff, int myid);
 
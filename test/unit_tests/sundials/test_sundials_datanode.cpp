@@ -477,3 +477,89 @@ TEST_F(SUNDataNodeTest, SetAndGetDataNvectorWhenLeaf)
   N_VDestroy(v);
   N_VDestroy(vec_we_got);
 }
+
+TEST_F(SUNDataNodeTest, IndexedChildrenWork)
+{
+  SUNErrCode err;
+  SUNDataNode root_node, child_node;
+  int values[10];
+
+  err = SUNDataNode_CreateIndexed(SUNDATAIOMODE_INMEM, 2, sunctx, &root_node);
+  EXPECT_EQ(err, SUN_SUCCESS);
+
+  // Insert out of order to exercise the sorted insertion
+  for (int i : {4, 0, 8, 2, 6, 1, 9, 3, 7, 5})
+  {
+    values[i] = 10 * i;
+    err = SUNDataNode_CreateLeaf(SUNDATAIOMODE_INMEM, mem_helper, sunctx,
+                                 &child_node);
+    EXPECT_EQ(err, SUN_SUCCESS);
+    err = SUNDataNode_SetData(child_node, SUNMEMTYPE_HOST, SUNMEMTYPE_HOST,
+                              (void*)(&values[i]), sizeof(int), sizeof(int));
+    EXPECT_EQ(err, SUN_SUCCESS);
+    err = SUNDataNode_AddIndexedChild(root_node, 100 * i, child_node);
+    EXPECT_EQ(err, SUN_SUCCESS);
+  }
+
+  err = SUNDataNode_AddIndexedChild(root_node, 500, child_node);
+  EXPECT_EQ(err, SUN_ERR_OP_FAIL);
+
+  for (int i = 9; i >= 0; i--)
+  {
+    err = SUNDataNode_GetIndexedChild(root_node, 100 * i, &child_node);
+    EXPECT_EQ(err, SUN_SUCCESS);
+    EXPECT_EQ(values[i], get_leaf_as_int(child_node));
+  }
+
+  err = SUNDataNode_GetIndexedChild(root_node, 150, &child_node);
+  EXPECT_EQ(err, SUN_ERR_DATANODE_NODENOTFOUND);
+  EXPECT_FALSE(child_node);
+
+  err = SUNDataNode_Destroy(&root_node);
+  EXPECT_EQ(err, SUN_SUCCESS);
+}
+
+TEST_F(SUNDataNodeTest, RemoveIndexedChildWorks)
+{
+  SUNErrCode err;
+  SUNDataNode root_node, child_node;
+  int values[10];
+
+  err = SUNDataNode_CreateIndexed(SUNDATAIOMODE_INMEM, 0, sunctx, &root_node);
+  EXPECT_EQ(err, SUN_SUCCESS);
+
+  for (int i = 0; i < 10; i++)
+  {
+    values[i] = i;
+    err = SUNDataNode_CreateLeaf(SUNDATAIOMODE_INMEM, mem_helper, sunctx,
+                                 &child_node);
+    EXPECT_EQ(err, SUN_SUCCESS);
+    err = SUNDataNode_SetData(child_node, SUNMEMTYPE_HOST, SUNMEMTYPE_HOST,
+                              (void*)(&values[i]), sizeof(int), sizeof(int));
+    EXPECT_EQ(err, SUN_SUCCESS);
+    err = SUNDataNode_AddIndexedChild(root_node, i, child_node);
+    EXPECT_EQ(err, SUN_SUCCESS);
+  }
+
+  // Remove in reverse order as in the backward sweep of an adjoint solve
+  for (int i = 9; i >= 0; i--)
+  {
+    err = SUNDataNode_RemoveIndexedChild(root_node, i, &child_node);
+    EXPECT_EQ(err, SUN_SUCCESS);
+    EXPECT_EQ(values[i], get_leaf_as_int(child_node));
+    EXPECT_FALSE(GET_IMPL(child_node)->parent);
+    err = SUNDataNode_Destroy(&child_node);
+    EXPECT_EQ(err, SUN_SUCCESS);
+
+    err = SUNDataNode_GetIndexedChild(root_node, i, &child_node);
+    EXPECT_EQ(err, SUN_ERR_DATANODE_NODENOTFOUND);
+  }
+
+  sunbooleantype yes_or_no = SUNTRUE;
+  err                      = SUNDataNode_HasChildren(root_node, &yes_or_no);
+  EXPECT_EQ(err, SUN_SUCCESS);
+  EXPECT_FALSE(yes_or_no);
+
+  err = SUNDataNode_Destroy(&root_node);
+  EXPECT_EQ(err, SUN_SUCCESS);
+}
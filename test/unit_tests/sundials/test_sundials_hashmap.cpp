@@ -148,3 +148,76 @@ TEST_F(SUNHashMapTest, RemoveWorks)
   err = SUNHashMap_GetValue(map, key, &retrieved_value);
   ASSERT_EQ(err, -1);
 }
+
+TEST_F(SUNHashMapTest, IntegerKeysWork)
+{
+  SetUp(2);
+
+  int64_t err;
+  int values[100];
+  void* retrieved_value;
+
+  for (int i = 0; i < 100; i++)
+  {
+    values[i] = i;
+    err       = SUNHashMap_InsertInt(map, -3 * i, &values[i]);
+    ASSERT_EQ(err, 0);
+  }
+  EXPECT_EQ(SUNHashMap_Size(map), 100);
+
+  err = SUNHashMap_InsertInt(map, -3, &values[0]);
+  ASSERT_EQ(err, -2);
+
+  // Integer keys never match string keys
+  err = SUNHashMap_GetValue(map, "0", &retrieved_value);
+  ASSERT_EQ(err, -1);
+
+  for (int i = 0; i < 100; i++)
+  {
+    err = SUNHashMap_GetValueInt(map, -3 * i, &retrieved_value);
+    ASSERT_EQ(err, 0);
+    EXPECT_EQ(&values[i], retrieved_value);
+  }
+
+  err = SUNHashMap_GetValueInt(map, 1, &retrieved_value);
+  ASSERT_EQ(err, -1);
+}
+
+TEST_F(SUNHashMapTest, RemoveKeepsOtherKeysReachable)
+{
+  SetUp(16);
+
+  int64_t err;
+  int values[200];
+  void* retrieved_value;
+
+  for (int i = 0; i < 200; i++)
+  {
+    values[i] = i;
+    err       = SUNHashMap_Insert(map, std::to_string(i).c_str(), &values[i]);
+    ASSERT_EQ(err, 0);
+  }
+
+  // Remove every other key, the remaining keys must still be found
+  for (int i = 0; i < 200; i += 2)
+  {
+    err = SUNHashMap_Remove(map, std::to_string(i).c_str(), &retrieved_value);
+    ASSERT_EQ(err, 0);
+    EXPECT_EQ(&values[i], retrieved_value);
+  }
+  EXPECT_EQ(SUNHashMap_Size(map), 100);
+
+  for (int i = 0; i < 200; i++)
+  {
+    err = SUNHashMap_GetValue(map, std::to_string(i).c_str(), &retrieved_value);
+    if (i % 2) { ASSERT_EQ(err, 0); }
+    else { ASSERT_EQ(err, -1); }
+  }
+
+  // Removed keys can be inserted again
+  err = SUNHashMap_Insert(map, "0", &values[0]);
+  ASSERT_EQ(err, 0);
+  err = SUNHashMap_GetValue(map, "0", &retrieved_value);
+  ASSERT_EQ(err, 0);
+  EXPECT_EQ(&values[0], retrieved_value);
+}
@@ -0,0 +1,258 @@
+/* -----------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ * -----------------------------------------------------------------*/
+
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+#include <iterator>
+#include <map>
+#include <string>
+#include <sundials/sundials_core.h>
+#include <vector>
+
+// Minimal reader for the records in a binary log file
+class BinaryLogReader
+{
+public:
+  explicit BinaryLogReader(const char* filename)
+  {
+    std::ifstream file(filename, std::ios::binary);
+    data_.assign(std::istreambuf_iterator<char>(file),
+                 std::istreambuf_iterator<char>());
+  }
+
+  bool valid() const
+  {
+    return data_.size() >= 16 && !std::memcmp(data_.data(), "SUNBLOG", 8) &&
+           get<uint32_t>(8) == 1 && get<uint32_t>(12) == 0x01020304;
+  }
+
+  // Decodes the messages as (level, scope, label, format, argument tags)
+  std::vector<std::vector<std::string>> messages()
+  {
+    std::map<uint32_t, std::string> strings;
+    std::vector<std::vector<std::string>> msgs;
+    size_t pos = 16;
+    ndefs_     = 0;
+    while (pos < data_.size())
+    {
+      uint8_t kind = get<uint8_t>(pos++);
+      if (kind == 1)
+      {
+        uint32_t id  = get<uint32_t>(pos);
+        uint32_t len = get<uint32_t>(pos + 4);
+        strings[id]  = std::string(data_.data() + pos + 8, len);
+        pos += 8 + len;
+        ndefs_++;
+      }
+      else
+      {
+        std::vector<std::string> msg;
+        msg.push_back(std::to_string(get<uint8_t>(pos)));
+        msg.push_back(strings[get<uint32_t>(pos + 13)]);
+        msg.push_back(strings[get<uint32_t>(pos + 17)]);
+        msg.push_back(strings[get<uint32_t>(pos + 21)]);
+        uint8_t nargs = get<uint8_t>(pos + 25);
+        pos += 26;
+        for (uint8_t i = 0; i < nargs; i++)
+        {
+          char tag = get<char>(pos++);
+          msg.push_back(std::string(1, tag));
+          if (tag == 's')
+          {
+            uint16_t len = get<uint16_t>(pos);
+            msg.back() += std::string(data_.data() + pos + 2, len);
+            pos += 2 + len;
+          }
+          else if (tag == 'f')
+          {
+            msg.back() += std::to_string(get<double>(pos));
+            pos += 8;
+          }
+          else
+          {
+            msg.back() += std::to_string(get<int64_t>(pos));
+            pos += 8;
+          }
+        }
+        msgs.push_back(msg);
+      }
+    }
+    return msgs;
+  }
+
+  // Number of string definitions read by the last call to messages()
+  int definitions() const { return ndefs_; }
+
+private:
+  template<typename T>
+  T get(size_t pos) const
+  {
+    T val;
+    std::memcpy(&val, data_.data() + pos, sizeof(T));
+    return val;
+  }
+
+  std::vector<char> data_;
+  int ndefs_ = 0;
+};
+
+class SUNLoggerBinaryTest : public testing::Test
+{
+protected:
+  SUNLoggerBinaryTest() { SUNLogger_Create(SUN_COMM_NULL, 0, &logger); }
+
+  ~SUNLoggerBinaryTest()
+  {
+    SUNLogger_Destroy(&logger);
+    std::remove(filename);
+  }
+
+  SUNLogger logger;
+  const char* filename = "test_sundials_logger.bin";
+};
+
+#if SUNDIALS_LOGGING_LEVEL > 0
+
+TEST_F(SUNLoggerBinaryTest, WritesHeaderAndMessages)
+{
+  SUNErrCode err = SUNLogger_SetBinaryFilename(logger, filename);
+  ASSERT_EQ(err, SUN_SUCCESS);
+
+  for (int i = 0; i < 2; i++)
+  {
+    err = SUNLogger_QueueMsg(logger, SUN_LOGLEVEL_INFO, "scope", "label",
+                             "i = %d, t = %.16g, s = %s, n = %ld", i, 0.5,
+                             "str", 7L);
+    EXPECT_EQ(err, SUN_SUCCESS);
+  }
+  err = SUNLogger_QueueMsg(logger, SUN_LOGLEVEL_DEBUG, "scope", "other",
+                           "no arguments, 100%% done");
+  EXPECT_EQ(err, SUN_SUCCESS);
+
+  err = SUNLogger_Flush(logger, SUN_LOGLEVEL_ALL);
+  EXPECT_EQ(err, SUN_SUCCESS);
+
+  BinaryLogReader reader(filename);
+  ASSERT_TRUE(reader.valid());
+
+  auto msgs = reader.messages();
+  ASSERT_EQ(msgs.size(), 3);
+  EXPECT_THAT(msgs[0], testing::ElementsAre("3", "scope", "label",
+                                            "i = %d, t = %.16g, s = %s, n = %ld",
+                                            "i0", "f0.500000", "sstr", "i7"));
+  EXPECT_THAT(msgs[1], testing::ElementsAre("3", "scope", "label",
+                                            "i = %d, t = %.16g, s = %s, n = %ld",
+                                            "i1", "f0.500000", "sstr", "i7"));
+  EXPECT_THAT(msgs[2], testing::ElementsAre("4", "scope", "other",
+                                            "no arguments, 100%% done"));
+
+  /* each distinct string, including the first one, is defined once */
+  EXPECT_EQ(reader.definitions(), 5);
+}
+
+TEST_F(SUNLoggerBinaryTest, WritesErrorsToTextFile)
+{
+  const char* error_filename = "test_sundials_logger_error.txt";
+
+  SUNErrCode err = SUNLogger_SetErrorFilename(logger, error_filename);
+  ASSERT_EQ(err, SUN_SUCCESS);
+
+  err = SUNLogger_SetBinaryFilename(logger, filename);
+  ASSERT_EQ(err, SUN_SUCCESS);
+
+  err = SUNLogger_QueueMsg(logger, SUN_LOGLEVEL_ERROR, "scope", "label",
+                           "error %d", 3);
+  EXPECT_EQ(err, SUN_SUCCESS);
+
+  err = SUNLogger_Flush(logger, SUN_LOGLEVEL_ALL);
+  EXPECT_EQ(err, SUN_SUCCESS);
+
+  /* errors are written to both the binary and the text file */
+  BinaryLogReader reader(filename);
+  ASSERT_TRUE(reader.valid());
+  EXPECT_EQ(reader.messages().size(), 1);
+
+  std::ifstream file(error_filename);
+  std::string line;
+  std::getline(file, line);
+  EXPECT_EQ(line, "[ERROR][rank 0][scope][label] error 3");
+
+  file.close();
+  std::remove(error_filename);
+}
+
+TEST_F(SUNLoggerBinaryTest, EmptyFilenameDisablesBinaryLog)
+{
+  SUNErrCode err = SUNLogger_SetBinaryFilename(logger, filename);
+  ASSERT_EQ(err, SUN_SUCCESS);
+
+  err = SUNLogger_QueueMsg(logger, SUN_LOGLEVEL_INFO, "scope", "label", "%d", 1);
+  EXPECT_EQ(err, SUN_SUCCESS);
+
+  /* closing the binary log writes out the queued message */
+  err = SUNLogger_SetBinaryFilename(logger, "");
+  EXPECT_EQ(err, SUN_SUCCESS);
+
+  err = SUNLogger_QueueMsg(logger, SUN_LOGLEVEL_INFO, "scope", "label", "%d", 2);
+  EXPECT_EQ(err, SUN_SUCCESS);
+
+  BinaryLogReader reader(filename);
+  ASSERT_TRUE(reader.valid());
+  EXPECT_EQ(reader.messages().size(), 1);
+}
+
+TEST_F(SUNLoggerBinaryTest, TruncatesLongStringArguments)
+{
+  SUNErrCode err = SUNLogger_SetBinaryFilename(logger, filename);
+  ASSERT_EQ(err, SUN_SUCCESS);
+
+  /* the length would wrap around to a short string if narrowed first */
+  std::string str(65536 + 10, 'x');
+  err = SUNLogger_QueueMsg(logger, SUN_LOGLEVEL_INFO, "scope", "label", "%s",
+                           str.c_str());
+  EXPECT_EQ(err, SUN_SUCCESS);
+
+  err = SUNLogger_Flush(logger, SUN_LOGLEVEL_ALL);
+  EXPECT_EQ(err, SUN_SUCCESS);
+
+  BinaryLogReader reader(filename);
+  ASSERT_TRUE(reader.valid());
+
+  auto msgs = reader.messages();
+  ASSERT_EQ(msgs.size(), 1);
+  EXPECT_EQ(msgs[0][4], "s" + std::string(255, 'x'));
+}
+
+#if defined(__linux__)
+TEST_F(SUNLoggerBinaryTest, ReportsWriteFailures)
+{
+  /* every write to /dev/full fails with ENOSPC */
+  SUNErrCode err = SUNLogger_SetBinaryFilename(logger, "/dev/full");
+  ASSERT_EQ(err, SUN_SUCCESS);
+
+  err = SUNLogger_QueueMsg(logger, SUN_LOGLEVEL_INFO, "scope", "label", "%d", 1);
+  EXPECT_EQ(err, SUN_SUCCESS);
+
+  err = SUNLogger_Flush(logger, SUN_LOGLEVEL_ALL);
+  EXPECT_NE(err, SUN_SUCCESS);
+
+  /* the logger falls back to its text output once the binary log is closed */
+  SUNLogger_SetBinaryFilename(logger, "");
+  err = SUNLogger_QueueMsg(logger, SUN_LOGLEVEL_INFO, "scope", "label", "%d", 2);
+  EXPECT_EQ(err, SUN_SUCCESS);
+}
+#endif
+
+#endif
@@ -0,0 +1,198 @@
+/*------------------------------------------------------------------
+ * SUNDIALS Copyright Start
+ * Copyright (c) 2002-2025, Lawrence Livermore National Security
+ * and Southern Methodist University.
+ * All rights reserved.
+ *
+ * See the top-level LICENSE and NOTICE files for details.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ * SUNDIALS Copyright End
+ *-----------------------------------------------------------------*/
+
+#include <cstdint>
+#include <iostream>
+#include <sundials/sundials_core.hpp>
+#include <sunmemory/sunmemory_system.h>
+
+// Allocate and free a batch of blocks of the given sizes
+static int alloc_dealloc(SUNMemoryHelper helper, const size_t* sizes, int n,
+                         size_t alignment)
+{
+  SUNMemory mem[8];
+  for (int i = 0; i < n; i++)
+  {
+    if (SUNMemoryHelper_Alloc(helper, &mem[i], sizes[i], SUNMEMTYPE_HOST,
+                              nullptr))
+    {
+      return -1;
+    }
+    if (alignment > 0 &&
+        reinterpret_cast<std::uintptr_t>(mem[i]->ptr) % alignment != 0)
+    {
+      std::cout << "    block " << i << " is not aligned\n";
+      return -1;
+    }
+    // Touch every byte of the block
+    unsigned char* bytes = static_cast<unsigned char*>(mem[i]->ptr);
+    for (size_t j = 0; j < sizes[i]; j++)
+    {
+      bytes[j] = static_cast<unsigned char>(j);
+    }
+  }
+  for (int i = 0; i < n; i++)
+  {
+    if (SUNMemoryHelper_Dealloc(helper, mem[i], nullptr)) { return -1; }
+  }
+  return 0;
+}
+
+static int check_stats(SUNMemoryHelper helper, unsigned long hits_expected,
+                       unsigned long misses_expected, size_t cached_expected)
+{
+  unsigned long hits, misses;
+  size_t cached;
+  if (SUNMemoryHelper_GetPoolStats_SysPool(helper, &hits, &misses, &cached))
+  {
+    return -1;
+  }
+  std::cout << "\tnum_hits = " << hits << " num_misses = " << misses
+            << " bytes_cached = " << cached << "\n";
+  if (hits != hits_expected || misses != misses_expected ||
+      cached != cached_expected)
+  {
+    std::cout << "    expected num_hits = " << hits_expected
+              << " num_misses = " << misses_expected
+              << " bytes_cached = " << cached_expected << "\n";
+    return -1;
+  }
+  return 0;
+}
+
+int main(int argc, char* argv[])
+{
+  sundials::Context sunctx;
+
+  // Block sizes: two in the 64 byte class and two in the 128 byte class
+  const size_t sizes[] = {8, 64, 100, 128};
+
+  std::cout << "Testing the SUNMemoryHelper_SysPool module... \n";
+
+  SUNMemoryHelper helper = SUNMemoryHelper_SysPool(sunctx);
+  if (!helper)
+  {
+    std::cout << "  SUNMemoryHelper_SysPool... FAILED\n";
+    return -1;
+  }
+
+  // The first pass misses, the second pass hits
+  std::cout << "  SUNMemoryHelper_Alloc (miss/hit)... \n";
+  if (alloc_dealloc(helper, sizes, 4, 0) || check_stats(helper, 0, 4, 384) ||
+      alloc_dealloc(helper, sizes, 4, 0) || check_stats(helper, 4, 4, 384))
+  {
+    std::cout << "  SUNMemoryHelper_Alloc (miss/hit)... FAILED\n";
+    return -1;
+  }
+  std::cout << "  SUNMemoryHelper_Alloc (miss/hit)... PASSED\n";
+
+  // Allocation statistics are the same as for SUNMemoryHelper_Sys
+  std::cout << "  SUNMemoryHelper_GetAllocStats... \n";
+  unsigned long num_allocations, num_deallocations;
+  size_t bytes_allocated, bytes_high_watermark;
+  if (SUNMemoryHelper_GetAllocStats(helper, SUNMEMTYPE_HOST, &num_allocations,
+                                    &num_deallocations, &bytes_allocated,
+                                    &bytes_high_watermark) ||
+      num_allocations != 8 || num_deallocations != 8 || bytes_allocated != 0 ||
+      bytes_high_watermark != 8 + 64 + 100 + 128)
+  {
+    std::cout << "  SUNMemoryHelper_GetAllocStats... FAILED\n";
+    return -1;
+  }
+  std::cout << "  SUNMemoryHelper_GetAllocStats... PASSED\n";
+
+  // Copy between pooled blocks
+  std::cout << "  SUNMemoryHelper_Copy... \n";
+  {
+    SUNMemory src = nullptr, dst = nullptr;
+    SUNMemoryHelper_Alloc(helper, &src, 64, SUNMEMTYPE_HOST, nullptr);
+    SUNMemoryHelper_Alloc(helper, &dst, 64, SUNMEMTYPE_HOST, nullptr);
+    for (int i = 0; i < 64; i++) { static_cast<char*>(src->ptr)[i] = char(i); }
+    SUNMemoryHelper_Copy(helper, dst, src, 64, nullptr);
+    for (int i = 0; i < 64; i++)
+    {
+      if (static_cast<char*>(dst->ptr)[i] != char(i))
+      {
+        std::cout << "  SUNMemoryHelper_Copy... FAILED\n";
+        return -1;
+      }
+    }
+    SUNMemoryHelper_Dealloc(helper, src, nullptr);
+    SUNMemoryHelper_Dealloc(helper, dst, nullptr);
+  }
+  std::cout << "  SUNMemoryHelper_Copy... PASSED\n";
+
+  // Limiting the cache releases the largest blocks first
+  std::cout << "  SUNMemoryHelper_SetMaxCachedBytes_SysPool... \n";
+  if (SUNMemoryHelper_SetMaxCachedBytes_SysPool(helper, 256) ||
+      check_stats(helper, 6, 4, 256) || alloc_dealloc(helper, sizes, 4, 0) ||
+      check_stats(helper, 9, 5, 256))
+  {
+    std::cout << "  SUNMemoryHelper_SetMaxCachedBytes_SysPool... FAILED\n";
+    return -1;
+  }
+  std::cout << "  SUNMemoryHelper_SetMaxCachedBytes_SysPool... PASSED\n";
+
+  // Trimming empties the cache
+  std::cout << "  SUNMemoryHelper_Trim_SysPool... \n";
+  if (SUNMemoryHelper_Trim_SysPool(helper) || check_stats(helper, 9, 5, 0))
+  {
+    std::cout << "  SUNMemoryHelper_Trim_SysPool... FAILED\n";
+    return -1;
+  }
+  std::cout << "  SUNMemoryHelper_Trim_SysPool... PASSED\n";
+
+  // Aligned allocations
+  std::cout << "  SUNMemoryHelper_SetAlignment_SysPool... \n";
+  if (SUNMemoryHelper_SetAlignment_SysPool(helper, 4096) ||
+      alloc_dealloc(helper, sizes, 4, 4096) ||
+      alloc_dealloc(helper, sizes, 4, 4096))
+  {
+    std::cout << "  SUNMemoryHelper_SetAlignment_SysPool... FAILED\n";
+    return -1;
+  }
+  std::cout << "  SUNMemoryHelper_SetAlignment_SysPool... PASSED\n";
+
+  // The clone keeps the settings but not the cached blocks
+  std::cout << "  SUNMemoryHelper_Clone... \n";
+  SUNMemoryHelper helper2 = SUNMemoryHelper_Clone(helper);
+  if (!helper2 || check_stats(helper2, 0, 0, 0) ||
+      alloc_dealloc(helper2, sizes, 4, 4096) ||
+      check_stats(helper2, 0, 4, 256))
+  {
+    std::cout << "  SUNMemoryHelper_Clone... FAILED\n";
+    return -1;
+  }
+  std::cout << "  SUNMemoryHelper_Clone... PASSED\n";
+
+  // A failed allocation returns an error and no handle
+  std::cout << "  SUNMemoryHelper_Alloc failure... \n";
+  SUNMemory mem = nullptr;
+  if (SUNMemoryHelper_Alloc(helper2, &mem, SIZE_MAX / 2, SUNMEMTYPE_HOST,
+                            nullptr) != SUN_ERR_MALLOC_FAIL ||
+      mem != nullptr || check_stats(helper2, 0, 4, 256))
+  {
+    std::cout << "  SUNMemoryHelper_Alloc failure... FAILED\n";
+    return -1;
+  }
+  std::cout << "  SUNMemoryHelper_Alloc failure... PASSED\n";
+
+  std::cout << "  SUNMemoryHelper_Destroy... \n";
+  if (SUNMemoryHelper_Destroy(helper) || SUNMemoryHelper_Destroy(helper2))
+  {
+    std::cout << "  SUNMemoryHelper_Destroy... FAILED\n";
+    return -1;
+  }
+  std::cout << "  SUNMemoryHelper_Destroy... PASSED\n";
+
+  return 0;
+}
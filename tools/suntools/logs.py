@@ -17,6 +17,7 @@
 # -----------------------------------------------------------------------------
 
 import re
+import struct
 import numpy as np
 from collections import ChainMap
 
@@ -87,6 +88,123 @@ def parse_logfile_line(line, line_number, all_lines):
     return line_dict
 
 
+# Binary log files written by SUNLogger_SetBinaryFilename start with this string
+BINARY_LOG_MAGIC = b"SUNBLOG\0"
+
+# Log level names for the numeric levels in a binary log file
+BINARY_LOG_LEVELS = {1: "ERROR", 2: "WARNING", 3: "INFO", 4: "DEBUG"}
+
+
+def c_format_to_python(fmt):
+    """Convert a C printf format string to the equivalent Python % format"""
+
+    def convert(match):
+        flags, width, precision, length, conv = match.groups()
+        if conv == "%":
+            return "%%"
+        if conv == "n":
+            return ""
+        if conv == "p":
+            return "%#x"
+        if conv in "aA":
+            conv = "e"
+        return "%" + flags.replace("'", "") + width + (precision or "") + conv
+
+    # flags, width, precision, length modifier, and conversion
+    pattern = (
+        r"%([-+ #0']*)(\*|\d*)(\.\*|\.\d*)?"
+        r"(hh|h|ll|l|L|q|j|z|t)?([diouxXcseEfFgGaApn%])"
+    )
+    return re.sub(pattern, convert, fmt)
+
+
+def is_binary_logfile(filename):
+    """Check if a file is a binary SUNDIALS log file"""
+    with open(filename, "rb") as logfile:
+        return logfile.read(len(BINARY_LOG_MAGIC)) == BINARY_LOG_MAGIC
+
+
+def decode_binary_logfile(filename):
+    """
+    Decode a binary SUNDIALS log file into a list of dictionaries, one per
+    message, with the keys loglvl, rank, time, scope, label, and msg. The time
+    is in seconds since the binary log was opened.
+    """
+    with open(filename, "rb") as logfile:
+        data = logfile.read()
+
+    if data[: len(BINARY_LOG_MAGIC)] != BINARY_LOG_MAGIC:
+        raise ValueError(f"{filename} is not a binary SUNDIALS log file")
+
+    # The byte order marker is written as the integer 0x01020304
+    pos = len(BINARY_LOG_MAGIC)
+    order = "<" if struct.unpack_from("<I", data, pos + 4)[0] == 0x01020304 else ">"
+    pos += 8
+
+    header = struct.Struct(order + "BidIIIB")
+    scalars = {"i": "q", "u": "Q", "p": "Q", "f": "d"}
+
+    strings = {}
+    messages = []
+    while pos < len(data):
+        kind = data[pos]
+        pos += 1
+        if kind == 1:
+            # string definition: id, length, characters
+            sid, length = struct.unpack_from(order + "II", data, pos)
+            pos += 8
+            strings[sid] = data[pos : pos + length].decode(errors="replace")
+            pos += length
+        elif kind == 2:
+            # message: level, rank, time, scope, label, format, arguments
+            lvl, rank, time, scope, label, fmt, nargs = header.unpack_from(data, pos)
+            pos += header.size
+            args = []
+            for _ in range(nargs):
+                tag = chr(data[pos])
+                pos += 1
+                if tag == "s":
+                    (length,) = struct.unpack_from(order + "H", data, pos)
+                    pos += 2
+                    args.append(data[pos : pos + length].decode(errors="replace"))
+                    pos += length
+                else:
+                    fmtchar = scalars[tag]
+                    args.append(struct.unpack_from(order + fmtchar, data, pos)[0])
+                    pos += struct.calcsize(fmtchar)
+            try:
+                msg = c_format_to_python(strings[fmt]) % tuple(args)
+            except (TypeError, ValueError):
+                msg = " ".join([strings[fmt]] + [str(arg) for arg in args])
+            messages.append(
+                {
+                    "loglvl": BINARY_LOG_LEVELS.get(lvl, str(lvl)),
+                    "rank": rank,
+                    "time": time,
+                    "scope": strings[scope],
+                    "label": strings[label],
+                    "msg": msg,
+                }
+            )
+        else:
+            raise ValueError(f"{filename} is corrupt at byte {pos - 1}")
+
+    return messages
+
+
+def binary_logfile_to_lines(filename):
+    """
+    Decode a binary SUNDIALS log file into the lines of the equivalent text log
+    file.
+    """
+    lines = []
+    for m in decode_binary_logfile(filename):
+        prefix = f"[{m['loglvl']}][rank {m['rank']}][{m['scope']}][{m['label']}]"
+        text = f"{prefix} {m['msg']}"
+        lines.extend(line + "\n" for line in text.splitlines())
+    return lines
+
+
 class StepData:
     """
     Helper class for parsing a step attempt from a SUNDIALS log file into a
@@ -145,8 +263,8 @@ class StepData:
 
 def log_file_to_list(filename):
     """
-    This function takes a SUNDIALS log file and creates a list where each list
-    element represents an integrator step attempt.
+    This function takes a SUNDIALS log file (text or binary) and creates a list
+    where each list element represents an integrator step attempt.
 
     E.g.,
       [
@@ -170,7 +288,10 @@ def log_file_to_list(filename):
         partition = 0
 
         # Read the log file
-        all_lines = logfile.readlines()
+        if is_binary_logfile(filename):
+            all_lines = binary_logfile_to_lines(filename)
+        else:
+            all_lines = logfile.readlines()
 
         # Create instance of helper class for building attempt dictionary
         s = StepData()